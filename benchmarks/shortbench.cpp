@@ -176,6 +176,93 @@ std::vector<BenchmarkFunc> available_functions = {
          return len;
        };
      }},
+    {"to_well_formed_utf8",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         size_t len = simdutf::to_well_formed_utf8(input.data(), input.size(),
+                                                   output.data());
+         return len;
+       };
+     }},
+    {"validate_utf8_and_index_lines",
+     [](std::span<const char> input, std::span<char>) {
+       return [input,
+               positions = std::vector<size_t>(input.size())]() mutable
+              -> size_t {
+         size_t line_count = positions.size();
+         simdutf::result r = simdutf::validate_utf8_and_index_lines(
+             input.data(), input.size(), positions.data(), line_count);
+         return r.count + line_count;
+       };
+     }},
+    {"validate_utf8_and_find_json_escape",
+     [](std::span<const char> input, std::span<char>) {
+       return [input]() -> size_t {
+         simdutf::result r = simdutf::validate_utf8_and_find_json_escape(
+             input.data(), input.size());
+         return r.count;
+       };
+     }},
+    {"escape_json_utf8",
+     [](std::span<const char> input, std::span<char>) {
+       return [input,
+               escaped = std::vector<char>(6 * input.size())]() mutable
+              -> size_t {
+         simdutf::result r = simdutf::escape_json_utf8(
+             input.data(), input.size(), escaped.data());
+         return r.count;
+       };
+     }},
+    {"utf16_length_from_utf8_with_errors",
+     [](std::span<const char> input, std::span<char>) {
+       return [input]() -> size_t {
+         simdutf::result r = simdutf::utf16_length_from_utf8_with_errors(
+             input.data(), input.size());
+         return r.count;
+       };
+     }},
+    {"convert_utf8_to_utf16le_with_replacement",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         size_t len = simdutf::convert_utf8_to_utf16le_with_replacement(
+             input.data(), input.size(),
+             reinterpret_cast<char16_t *>(output.data()));
+         return len;
+       };
+     }},
+    // The input cut in strings of 16 bytes, converted one call at a time.
+    {"convert_utf8_to_utf16le_pieces",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         char16_t *out = reinterpret_cast<char16_t *>(output.data());
+         size_t len = 0;
+         for (size_t i = 0; i < input.size(); i += 16) {
+           len += simdutf::convert_utf8_to_utf16le(
+               input.data() + i, std::min<size_t>(16, input.size() - i),
+               out + len);
+         }
+         return len;
+       };
+     }},
+    // The same strings through the batch wrapper, which should match the loop
+    // above.
+    {"convert_utf8_to_utf16le_batch",
+     [](std::span<const char> input, std::span<char> output) {
+       std::vector<const char *> inputs;
+       std::vector<size_t> lengths;
+       for (size_t i = 0; i < input.size(); i += 16) {
+         inputs.push_back(input.data() + i);
+         lengths.push_back(std::min<size_t>(16, input.size() - i));
+       }
+       std::vector<size_t> offsets(inputs.size() + 1);
+       return [inputs, lengths, offsets, output]() mutable -> size_t {
+         size_t errors = simdutf::convert_utf8_to_utf16le_batch(
+             inputs.data(), lengths.data(), inputs.size(),
+             reinterpret_cast<char16_t *>(output.data()), offsets.data(),
+             nullptr);
+         return errors + offsets.back();
+       };
+     }},
     {"convert_utf8_to_utf32",
      [](std::span<const char> input, std::span<char> output) {
        return [input, output]() -> size_t {
@@ -298,6 +385,41 @@ std::vector<BenchmarkFunc> available_functions = {
          return std::get<1>(result);
        };
      }},
+    {"binary_to_hex",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         size_t len =
+             simdutf::binary_to_hex(input.data(), input.size(), output.data());
+         return len;
+       };
+     }},
+    {"hex_to_binary",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         auto result = simdutf::hex_to_binary(input.data(), input.size(),
+                                              output.data());
+         return result.count;
+       };
+     }},
+    {"convert_sbcs_to_utf16",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         size_t len = simdutf::convert_sbcs_to_utf16(
+             input.data(), input.size(),
+             simdutf::sbcs_table(simdutf::sbcs_koi8_r),
+             reinterpret_cast<char16_t *>(output.data()));
+         return len;
+       };
+     }},
+    {"convert_sbcs_to_utf8",
+     [](std::span<const char> input, std::span<char> output) {
+       return [input, output]() -> size_t {
+         size_t len = simdutf::convert_sbcs_to_utf8(
+             input.data(), input.size(),
+             simdutf::sbcs_table(simdutf::sbcs_koi8_r), output.data());
+         return len;
+       };
+     }},
     {"find_equal",
      [](std::span<const char> input, [[maybe_unused]] std::span<char> output) {
        return [input]() -> size_t {
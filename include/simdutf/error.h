@@ -41,7 +41,13 @@ enum error_code {
   BASE64_EXTRA_BITS,        // The base64 input terminates with non-zero
                             // padding bits.
   OUTPUT_BUFFER_TOO_SMALL,  // The provided buffer is too small.
-  OTHER                     // Not related to validation/transcoding.
+  OTHER,                    // Not related to validation/transcoding.
+  INVALID_JSON_ESCAPE,      // Found an invalid escape sequence, or a character
+                            // that must be escaped, in a JSON string.
+  INVALID_HEX_CHARACTER,    // Found a character that is not a hexadecimal
+                            // digit.
+  HEX_INPUT_REMAINDER       // The hexadecimal input has an odd number of
+                            // digits.
 };
 
 inline std::string_view error_to_string(error_code code) noexcept {
@@ -68,6 +74,12 @@ inline std::string_view error_to_string(error_code code) noexcept {
     return "BASE64_EXTRA_BITS";
   case OUTPUT_BUFFER_TOO_SMALL:
     return "OUTPUT_BUFFER_TOO_SMALL";
+  case INVALID_JSON_ESCAPE:
+    return "INVALID_JSON_ESCAPE";
+  case INVALID_HEX_CHARACTER:
+    return "INVALID_HEX_CHARACTER";
+  case HEX_INPUT_REMAINDER:
+    return "HEX_INPUT_REMAINDER";
   default:
     return "OTHER";
   }
@@ -12,6 +12,8 @@
 #include "simdutf/error.h"
 #include "simdutf/internal/isadetection.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
 #if SIMDUTF_SPAN
   #include <concepts>
@@ -181,6 +183,10 @@ concept indexes_into_uint32 = requires(InputPtr p) {
 #include <simdutf/scalar/utf8_to_utf16/valid_utf8_to_utf16.h>
 #include <simdutf/scalar/utf8_to_utf32/utf8_to_utf32.h>
 #include <simdutf/scalar/utf8_to_utf32/valid_utf8_to_utf32.h>
+#include <simdutf/scalar/json.h>
+#include <simdutf/scalar/windows1252.h>
+#include <simdutf/scalar/sbcs.h>
+#include <simdutf/scalar/cesu8.h>
 
 namespace simdutf {
 
@@ -313,6 +319,327 @@ validate_utf8_with_errors(
   #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Validate the UTF-8 string and, in the same pass, record the positions of its
+ * newline characters ('\n'), e.g., to index the lines of a log file. This is
+ * faster than calling validate_utf8_with_errors and then searching for the
+ * newlines, since the input is only loaded once.
+ *
+ * When the line_positions array is too small, the function stops at the first
+ * newline that does not fit and returns OUTPUT_BUFFER_TOO_SMALL with its
+ * position: the input before it is valid, and the caller may resume from
+ * there with a fresh array. The line positions are then relative to the new
+ * start.
+ *
+ * Overridden by each implementation.
+ *
+ * @param input the UTF-8 string to validate.
+ * @param length the length of the string in bytes.
+ * @param line_positions the array where the positions of the newlines are
+ * written, in increasing order.
+ * @param line_count the number of positions that can be written in the
+ * line_positions array. Upon return, it is modified to reflect how many
+ * positions were written. If there is an error, only the newlines before it are
+ * recorded.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either the position of the
+ * error (or of the newline that did not fit for OUTPUT_BUFFER_TOO_SMALL) if
+ * any, or the number of code units validated if successful.
+ */
+simdutf_warn_unused result validate_utf8_and_index_lines(
+    const char *input, size_t length, size_t *line_positions,
+    size_t &line_count) noexcept;
+  #if SIMDUTF_SPAN
+/**
+ * @brief span overload
+ * @return a tuple of result and the number of positions written
+ */
+simdutf_really_inline simdutf_warn_unused std::tuple<result, std::size_t>
+validate_utf8_and_index_lines(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<size_t> line_positions) noexcept {
+  size_t line_count = line_positions.size();
+  const result r = validate_utf8_and_index_lines(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      line_positions.data(), line_count);
+  return {r, line_count};
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Validate the UTF-8 string and, in the same pass, find the first byte that
+ * must be escaped for the string to appear in a JSON document: the quotation
+ * mark, the reverse solidus (backslash) or a control character (below 0x20),
+ * as per RFC 8259. When there is none, the string can be copied verbatim
+ * between quotes. The whole string is validated even after the first such
+ * byte.
+ *
+ * Overridden by each implementation.
+ *
+ * @param input the UTF-8 string to validate.
+ * @param length the length of the string in bytes.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either the position of the
+ * error (in the input in code units) if any, or the position of the first byte
+ * that must be escaped (length if there is none) if successful.
+ */
+simdutf_warn_unused result validate_utf8_and_find_json_escape(
+    const char *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+validate_utf8_and_find_json_escape(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::json::validate_utf8_and_find_escape(
+        detail::constexpr_cast_ptr<uint8_t>(input.data()), input.size());
+  } else
+    #endif
+  {
+    return validate_utf8_and_find_json_escape(
+        reinterpret_cast<const char *>(input.data()), input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Escape a UTF-8 string so that it can appear between the quotation marks of
+ * a JSON string (RFC 8259). The quotation mark, the reverse solidus and the
+ * control characters are escaped, with the short forms \", \\, \b, \f, \n,
+ * \r and \t when they exist and \u00XX otherwise. When ascii_only is true,
+ * the non-ASCII characters are escaped too, as \uXXXX or as a surrogate pair
+ * of \uXXXX escapes, so that the output is ASCII. The quotation marks around
+ * the string are not written.
+ *
+ * The input is validated as UTF-8 by the same pass that finds the characters
+ * to escape. The output buffer must hold 6 * length bytes, which is enough in
+ * the worst case.
+ *
+ * Overridden by each implementation.
+ *
+ * @param input the UTF-8 string to escape.
+ * @param length the length of the string in bytes.
+ * @param output the pointer to a buffer that can hold 6 * length bytes.
+ * @param ascii_only whether to escape the non-ASCII characters as well.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either the position of the
+ * UTF-8 error (in the input in code units) if any, or the number of bytes
+ * written if successful.
+ */
+simdutf_warn_unused result escape_json_utf8(const char *input, size_t length,
+                                            char *output,
+                                            bool ascii_only = false) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result escape_json_utf8(
+    const detail::input_span_of_byte_like auto &input,
+    detail::output_span_of_byte_like auto &&output,
+    bool ascii_only = false) noexcept {
+  return escape_json_utf8(reinterpret_cast<const char *>(input.data()),
+                          input.size(), reinterpret_cast<char *>(output.data()),
+                          ascii_only);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Unescape the content of a JSON string (without the surrounding quotation
+ * marks) into UTF-8. All the escape sequences of RFC 8259 are supported, and
+ * a \uXXXX escape of a high surrogate must be followed by the escape of a low
+ * surrogate.
+ *
+ * The input is validated in the same pass: it must be valid UTF-8, and the
+ * quotation mark and the control characters must be escaped. The first error
+ * in the input is reported. The output is never longer than the input, but it
+ * must not overlap the input.
+ *
+ * Overridden by each implementation.
+ *
+ * @param input the content of the JSON string, in UTF-8.
+ * @param length the length of the input in bytes.
+ * @param output the pointer to a buffer that can hold length bytes.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either the position of the
+ * error (in the input in code units) if any, or the number of bytes written if
+ * successful. The error is a UTF-8 error, INVALID_JSON_ESCAPE for an invalid
+ * escape sequence or a character that must be escaped, or SURROGATE for an
+ * unpaired surrogate.
+ */
+simdutf_warn_unused result unescape_json_to_utf8(const char *input,
+                                                 size_t length,
+                                                 char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result unescape_json_to_utf8(
+    const detail::input_span_of_byte_like auto &input,
+    detail::output_span_of_byte_like auto &&output) noexcept {
+  return unescape_json_to_utf8(reinterpret_cast<const char *>(input.data()),
+                               input.size(),
+                               reinterpret_cast<char *>(output.data()));
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Unescape the content of a JSON string (without the surrounding quotation
+ * marks) into UTF-16 with the native endianness. The input is validated as
+ * with unescape_json_to_utf8.
+ *
+ * Overridden by each implementation.
+ *
+ * @param input the content of the JSON string, in UTF-8.
+ * @param length the length of the input in bytes.
+ * @param output the pointer to a buffer that can hold length char16_t.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either the position of the
+ * error (in the input in code units) if any, or the number of char16_t written
+ * if successful.
+ */
+simdutf_warn_unused result unescape_json_to_utf16(const char *input,
+                                                  size_t length,
+                                                  char16_t *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result unescape_json_to_utf16(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char16_t> output) noexcept {
+  return unescape_json_to_utf16(reinterpret_cast<const char *>(input.data()),
+                                input.size(), output.data());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Validate a column of UTF-8 strings stored as one data buffer and an array
+ * of offsets, as in Apache Arrow: row i is made of the bytes from
+ * data[offsets[i]] to data[offsets[i + 1]] (excluded). The whole buffer is
+ * validated in one pass, and every offset must fall on a character boundary.
+ * The result is the same as validating each row on its own with
+ * validate_utf8_with_errors, which is much slower for short rows.
+ *
+ * The offsets must be non-decreasing and non-negative.
+ *
+ * @param data the data buffer of the column.
+ * @param offsets the row_count + 1 offsets of the rows in the data buffer.
+ * @param row_count the number of rows.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with the error code of the first invalid row and
+ * its index if any, or the number of rows if they are all valid.
+ */
+simdutf_warn_unused result validate_utf8_offsets(const char *data,
+                                                 const int32_t *offsets,
+                                                 size_t row_count) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result validate_utf8_offsets(
+    const detail::input_span_of_byte_like auto &data,
+    std::span<const int32_t> offsets) noexcept {
+  return validate_utf8_offsets(reinterpret_cast<const char *>(data.data()),
+                               offsets.data(),
+                               offsets.empty() ? 0 : offsets.size() - 1);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate a column of UTF-8 strings stored as one data buffer and an array
+ * of 64-bit offsets, as in Apache Arrow large strings: row i is made of the
+ * bytes from data[offsets[i]] to data[offsets[i + 1]] (excluded). The whole
+ * buffer is validated in one pass, and every offset must fall on a character
+ * boundary. The result is the same as validating each row on its own with
+ * validate_utf8_with_errors, which is much slower for short rows.
+ *
+ * The offsets must be non-decreasing and non-negative.
+ *
+ * @param data the data buffer of the column.
+ * @param offsets the row_count + 1 offsets of the rows in the data buffer.
+ * @param row_count the number of rows.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with the error code of the first invalid row and
+ * its index if any, or the number of rows if they are all valid.
+ */
+simdutf_warn_unused result validate_utf8_offsets(const char *data,
+                                                 const int64_t *offsets,
+                                                 size_t row_count) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result validate_utf8_offsets(
+    const detail::input_span_of_byte_like auto &data,
+    std::span<const int64_t> offsets) noexcept {
+  return validate_utf8_offsets(reinterpret_cast<const char *>(data.data()),
+                               offsets.data(),
+                               offsets.empty() ? 0 : offsets.size() - 1);
+}
+  #endif // SIMDUTF_SPAN
+/**
+ * Compute the number of bytes that to_well_formed_utf8 writes for this
+ * string: each maximal subpart of an ill-formed sequence takes the 3 bytes of
+ * U+FFFD instead of its own bytes.
+ *
+ * @param input the UTF-8 string to correct.
+ * @param length the length of the string in bytes.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) where the count is the number of bytes required,
+ * and the error code is either SUCCESS, in which case the string is valid and
+ * needs no correction, or the first error that validate_utf8_with_errors
+ * reports. The count is correct regardless of the error field.
+ */
+simdutf_warn_unused result to_well_formed_utf8_length(const char *input,
+                                                      size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+to_well_formed_utf8_length(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::well_formed_length(
+        detail::constexpr_cast_ptr<uint8_t>(input.data()), input.size());
+  } else
+    #endif
+  {
+    return to_well_formed_utf8_length(
+        reinterpret_cast<const char *>(input.data()), input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Fixes an ill-formed UTF-8 string by replacing each maximal subpart of an
+ * ill-formed sequence with the Unicode replacement character U+FFFD (the bytes
+ * 0xEF 0xBF 0xBD), as the WHATWG Encoding Standard prescribes. Valid parts of
+ * the string are copied unchanged.
+ *
+ * Since the output may be longer than the input, the output buffer must not
+ * overlap the input. It must hold to_well_formed_utf8_length(input,
+ * length).count bytes, which is at most 3 * length.
+ *
+ * @param input the UTF-8 string to correct.
+ * @param length the length of the string in bytes.
+ * @param output the output buffer.
+ * @return the number of bytes written.
+ */
+simdutf_warn_unused size_t to_well_formed_utf8(const char *input, size_t length,
+                                               char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+to_well_formed_utf8(const detail::input_span_of_byte_like auto &input,
+                    detail::output_span_of_byte_like auto &&output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::to_well_formed(
+        detail::constexpr_cast_ptr<uint8_t>(input.data()), input.size(),
+        detail::constexpr_cast_writeptr<char>(output.data()));
+  } else
+    #endif
+  {
+    return to_well_formed_utf8(reinterpret_cast<const char *>(input.data()),
+                               input.size(),
+                               reinterpret_cast<char *>(output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
 #if SIMDUTF_FEATURE_ASCII
 /**
  * Validate the ASCII string.
@@ -661,7 +988,8 @@ validate_utf16be_with_errors(std::span<const char16_t> input) noexcept {
  * the Unicode replacement character U+FFFD. If input and output points to
  * different memory areas, the procedure copies string, and it's expected that
  * output memory is at least as big as the input. It's also possible to set
- * input equal output, that makes replacements an in-place operation.
+ * input equal output, that makes replacements an in-place operation: only the
+ * replaced code units are then written, and a valid string is left untouched.
  *
  * @param input the UTF-16LE string to correct.
  * @param len the length of the string in number of 2-byte code units
@@ -691,7 +1019,8 @@ to_well_formed_utf16le(std::span<const char16_t> input,
  * the Unicode replacement character U+FFFD. If input and output points to
  * different memory areas, the procedure copies string, and it's expected that
  * output memory is at least as big as the input. It's also possible to set
- * input equal output, that makes replacements an in-place operation.
+ * input equal output, that makes replacements an in-place operation: only the
+ * replaced code units are then written, and a valid string is left untouched.
  *
  * @param input the UTF-16BE string to correct.
  * @param len the length of the string in number of 2-byte code units
@@ -721,7 +1050,8 @@ to_well_formed_utf16be(std::span<const char16_t> input,
  * Unicode replacement character U+FFFD. If input and output points to different
  * memory areas, the procedure copies string, and it's expected that output
  * memory is at least as big as the input. It's also possible to set input equal
- * output, that makes replacements an in-place operation.
+ * output, that makes replacements an in-place operation: only the replaced code
+ * units are then written, and a valid string is left untouched.
  *
  * @param input the UTF-16 string to correct.
  * @param len the length of the string in number of 2-byte code units
@@ -1404,162 +1734,385 @@ convert_utf8_to_utf16be_with_errors(
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-8 string into UTF-32 string.
+ * Using native endianness, convert possibly broken UTF-8 string into UTF-16
+ * string, replacing each maximal subpart of an ill-formed sequence with the
+ * Unicode replacement character U+FFFD, as the WHATWG Encoding Standard
+ * prescribes.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * This function always succeeds. For example, the bytes 0xF0 0x80 0x80 become
+ * three U+FFFD, and the truncated sequence 0xE2 0x82 becomes a single U+FFFD.
+ * Valid input takes the same path as convert_utf8_to_utf16_with_errors.
+ *
+ * This function is not BOM-aware.
  *
  * @param input         the UTF-8 string to convert
  * @param length        the length of the string in bytes
- * @param utf32_output  the pointer to buffer that can hold conversion result
- * @return the number of written char32_t; 0 if the input was not valid UTF-8
- * string
+ * @param utf16_output  the pointer to buffer that can hold conversion result,
+ * of at least utf16_length_from_utf8_with_replacement(input, length).count
+ * char16_t
+ * @return number of written code units
  */
-simdutf_warn_unused size_t convert_utf8_to_utf32(
-    const char *input, size_t length, char32_t *utf32_output) noexcept;
+simdutf_warn_unused size_t convert_utf8_to_utf16_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf8_to_utf32(const detail::input_span_of_byte_like auto &utf8_input,
-                      std::span<char32_t> utf32_output) noexcept {
+convert_utf8_to_utf16_with_replacement(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char16_t> utf16_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf8_to_utf32::convert(utf8_input.data(), utf8_input.size(),
-                                          utf32_output.data());
+    return scalar::utf8_to_utf16::convert_with_replacement<endianness::NATIVE>(
+        utf8_input.data(), utf8_input.size(), utf16_output.data());
   } else
     #endif
   {
-    return convert_utf8_to_utf32(
+    return convert_utf8_to_utf16_with_replacement(
         reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
-        utf32_output.data());
+        utf16_output.data());
   }
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-8 string into UTF-32 string and stop on error.
+ * Convert possibly broken UTF-8 string into UTF-16LE string, replacing each
+ * maximal subpart of an ill-formed sequence with the Unicode replacement
+ * character U+FFFD, as the WHATWG Encoding Standard prescribes.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * This function always succeeds. For example, the bytes 0xF0 0x80 0x80 become
+ * three U+FFFD, and the truncated sequence 0xE2 0x82 becomes a single U+FFFD.
+ * Valid input takes the same path as convert_utf8_to_utf16le_with_errors.
+ *
+ * This function is not BOM-aware.
  *
  * @param input         the UTF-8 string to convert
  * @param length        the length of the string in bytes
- * @param utf32_output  the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char32_t written if
- * successful.
+ * @param utf16_output  the pointer to buffer that can hold conversion result,
+ * of at least utf16_length_from_utf8_with_replacement(input, length).count
+ * char16_t
+ * @return number of written code units
  */
-simdutf_warn_unused result convert_utf8_to_utf32_with_errors(
-    const char *input, size_t length, char32_t *utf32_output) noexcept;
+simdutf_warn_unused size_t convert_utf8_to_utf16le_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf8_to_utf32_with_errors(
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf8_to_utf16le_with_replacement(
     const detail::input_span_of_byte_like auto &utf8_input,
-    std::span<char32_t> utf32_output) noexcept {
+    std::span<char16_t> utf16_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf8_to_utf32::convert_with_errors(
-        utf8_input.data(), utf8_input.size(), utf32_output.data());
+    return scalar::utf8_to_utf16::convert_with_replacement<endianness::LITTLE>(
+        utf8_input.data(), utf8_input.size(), utf16_output.data());
   } else
     #endif
   {
-    return convert_utf8_to_utf32_with_errors(
+    return convert_utf8_to_utf16le_with_replacement(
         reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
-        utf32_output.data());
+        utf16_output.data());
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert valid UTF-8 string into latin1 string.
- *
- * This function assumes that the input string is valid UTF-8 and that it can be
- * represented as Latin1. If you violate this assumption, the result is
- * implementation defined and may include system-dependent behavior such as
- * crashes.
+ * Convert possibly broken UTF-8 string into UTF-16BE string, replacing each
+ * maximal subpart of an ill-formed sequence with the Unicode replacement
+ * character U+FFFD, as the WHATWG Encoding Standard prescribes.
  *
- * This function is for expert users only and not part of our public API. Use
- * convert_utf8_to_latin1 instead. The function may be removed from the library
- * in the future.
+ * This function always succeeds. For example, the bytes 0xF0 0x80 0x80 become
+ * three U+FFFD, and the truncated sequence 0xE2 0x82 becomes a single U+FFFD.
+ * Valid input takes the same path as convert_utf8_to_utf16be_with_errors.
  *
  * This function is not BOM-aware.
  *
  * @param input         the UTF-8 string to convert
  * @param length        the length of the string in bytes
- * @param latin1_output  the pointer to buffer that can hold conversion result
- * @return the number of written char; 0 if the input was not valid UTF-8 string
+ * @param utf16_output  the pointer to buffer that can hold conversion result,
+ * of at least utf16_length_from_utf8_with_replacement(input, length).count
+ * char16_t
+ * @return number of written code units
  */
-simdutf_warn_unused size_t convert_valid_utf8_to_latin1(
-    const char *input, size_t length, char *latin1_output) noexcept;
+simdutf_warn_unused size_t convert_utf8_to_utf16be_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf8_to_latin1(
-    const detail::input_span_of_byte_like auto &valid_utf8_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+convert_utf8_to_utf16be_with_replacement(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char16_t> utf16_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf8_to_latin1::convert_valid(
-        valid_utf8_input.data(), valid_utf8_input.size(), latin1_output.data());
+    return scalar::utf8_to_utf16::convert_with_replacement<endianness::BIG>(
+        utf8_input.data(), utf8_input.size(), utf16_output.data());
   } else
     #endif
   {
-    return convert_valid_utf8_to_latin1(
-        reinterpret_cast<const char *>(valid_utf8_input.data()),
-        valid_utf8_input.size(), latin1_output.data());
+    return convert_utf8_to_utf16be_with_replacement(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+        utf16_output.data());
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Using native endianness, convert valid UTF-8 string into a UTF-16 string.
+ * Compute the number of 2-byte code units that this UTF-8 string would require
+ * in UTF-16 format when each maximal subpart of an ill-formed sequence is
+ * replaced with U+FFFD, as convert_utf8_to_utf16_with_replacement does.
  *
- * This function assumes that the input string is valid UTF-8.
+ * This function is not BOM-aware.
  *
- * @param input         the UTF-8 string to convert
+ * @param input         the UTF-8 string to process
  * @param length        the length of the string in bytes
- * @param utf16_buffer  the pointer to buffer that can hold conversion result
- * @return the number of written char16_t
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) where the count is the number of char16_t required,
+ * and the error code is either SUCCESS or the first error that
+ * validate_utf8_with_errors reports. The count is correct regardless of the
+ * error field.
  */
-simdutf_warn_unused size_t convert_valid_utf8_to_utf16(
-    const char *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused result utf16_length_from_utf8_with_replacement(
+    const char *input, size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf8_to_utf16(
-    const detail::input_span_of_byte_like auto &valid_utf8_input,
-    std::span<char16_t> utf16_output) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+utf16_length_from_utf8_with_replacement(
+    const detail::input_span_of_byte_like auto &utf8_input) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf8_to_utf16::convert_valid<endianness::NATIVE>(
-        valid_utf8_input.data(), valid_utf8_input.size(), utf16_output.data());
+    return scalar::utf8::utf16_length_from_utf8_with_replacement(
+        detail::constexpr_cast_ptr<uint8_t>(utf8_input.data()),
+        utf8_input.size());
   } else
     #endif
   {
-    return convert_valid_utf8_to_utf16(
-        reinterpret_cast<const char *>(valid_utf8_input.data()),
-        valid_utf8_input.size(), utf16_output.data());
+    return utf16_length_from_utf8_with_replacement(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size());
   }
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert valid UTF-8 string into UTF-16LE string.
+ * Convert possibly broken UTF-8 string into UTF-32 string.
  *
- * This function assumes that the input string is valid UTF-8.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * @param input         the UTF-8 string to convert
  * @param length        the length of the string in bytes
- * @param utf16_buffer  the pointer to buffer that can hold conversion result
- * @return the number of written char16_t
- */
-simdutf_warn_unused size_t convert_valid_utf8_to_utf16le(
+ * @param utf32_output  the pointer to buffer that can hold conversion result
+ * @return the number of written char32_t; 0 if the input was not valid UTF-8
+ * string
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf32(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf8_to_utf32(const detail::input_span_of_byte_like auto &utf8_input,
+                      std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8_to_utf32::convert(utf8_input.data(), utf8_input.size(),
+                                          utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf8_to_utf32(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+        utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into UTF-32 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf32_with_errors(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf8_to_utf32_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8_to_utf32::convert_with_errors(
+        utf8_input.data(), utf8_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf8_to_utf32_with_errors(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+        utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into UTF-32 string, replacing each
+ * maximal subpart of an ill-formed sequence with the Unicode replacement
+ * character U+FFFD, as the WHATWG Encoding Standard prescribes.
+ *
+ * This function always succeeds. For example, the bytes 0xF0 0x80 0x80 become
+ * three U+FFFD, and the truncated sequence 0xE2 0x82 becomes a single U+FFFD.
+ * Valid input takes the same path as convert_utf8_to_utf32_with_errors.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to buffer that can hold conversion result,
+ * of at least utf32_length_from_utf8_with_replacement(input, length).count
+ * char32_t
+ * @return number of written code units
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf32_with_replacement(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf8_to_utf32_with_replacement(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8_to_utf32::convert_with_replacement(
+        utf8_input.data(), utf8_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf8_to_utf32_with_replacement(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+        utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of 4-byte code units that this UTF-8 string would require
+ * in UTF-32 format when each maximal subpart of an ill-formed sequence is
+ * replaced with U+FFFD, as convert_utf8_to_utf32_with_replacement does.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) where the count is the number of char32_t required,
+ * and the error code is either SUCCESS or the first error that
+ * validate_utf8_with_errors reports. The count is correct regardless of the
+ * error field.
+ */
+simdutf_warn_unused result utf32_length_from_utf8_with_replacement(
+    const char *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+utf32_length_from_utf8_with_replacement(
+    const detail::input_span_of_byte_like auto &utf8_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::utf32_length_from_utf8_with_replacement(
+        detail::constexpr_cast_ptr<uint8_t>(utf8_input.data()),
+        utf8_input.size());
+  } else
+    #endif
+  {
+    return utf32_length_from_utf8_with_replacement(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+/**
+ * Convert valid UTF-8 string into latin1 string.
+ *
+ * This function assumes that the input string is valid UTF-8 and that it can be
+ * represented as Latin1. If you violate this assumption, the result is
+ * implementation defined and may include system-dependent behavior such as
+ * crashes.
+ *
+ * This function is for expert users only and not part of our public API. Use
+ * convert_utf8_to_latin1 instead. The function may be removed from the library
+ * in the future.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param latin1_output  the pointer to buffer that can hold conversion result
+ * @return the number of written char; 0 if the input was not valid UTF-8 string
+ */
+simdutf_warn_unused size_t convert_valid_utf8_to_latin1(
+    const char *input, size_t length, char *latin1_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf8_to_latin1(
+    const detail::input_span_of_byte_like auto &valid_utf8_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8_to_latin1::convert_valid(
+        valid_utf8_input.data(), valid_utf8_input.size(), latin1_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf8_to_latin1(
+        reinterpret_cast<const char *>(valid_utf8_input.data()),
+        valid_utf8_input.size(), latin1_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Using native endianness, convert valid UTF-8 string into a UTF-16 string.
+ *
+ * This function assumes that the input string is valid UTF-8.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_buffer  the pointer to buffer that can hold conversion result
+ * @return the number of written char16_t
+ */
+simdutf_warn_unused size_t convert_valid_utf8_to_utf16(
+    const char *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf8_to_utf16(
+    const detail::input_span_of_byte_like auto &valid_utf8_input,
+    std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8_to_utf16::convert_valid<endianness::NATIVE>(
+        valid_utf8_input.data(), valid_utf8_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf8_to_utf16(
+        reinterpret_cast<const char *>(valid_utf8_input.data()),
+        valid_utf8_input.size(), utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-8 string into UTF-16LE string.
+ *
+ * This function assumes that the input string is valid UTF-8.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_buffer  the pointer to buffer that can hold conversion result
+ * @return the number of written char16_t
+ */
+simdutf_warn_unused size_t convert_valid_utf8_to_utf16le(
     const char *input, size_t length, char16_t *utf16_buffer) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
@@ -1743,6 +2296,41 @@ utf16_length_from_utf8(
   }
 }
   #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-8 string and, in the same pass over the input, compute the
+ * number of 2-byte code units that it would require in UTF-16 format. This is
+ * faster than calling validate_utf8_with_errors and then
+ * utf16_length_from_utf8, which read the input twice.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t code units
+ * required to encode the UTF-8 string as UTF-16 if successful.
+ */
+simdutf_warn_unused result
+utf16_length_from_utf8_with_errors(const char *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+utf16_length_from_utf8_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::utf16_length_from_utf8_with_errors(
+        detail::constexpr_cast_ptr<uint8_t>(utf8_input.data()),
+        utf8_input.size());
+  } else
+    #endif
+  {
+    return utf16_length_from_utf8_with_errors(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -1782,6 +2370,44 @@ utf32_length_from_utf8(
   }
 }
   #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-8 string and, in the same pass over the input, compute the
+ * number of 4-byte code units that it would require in UTF-32 format. This is
+ * faster than calling validate_utf8_with_errors and then
+ * utf32_length_from_utf8, which read the input twice.
+ *
+ * On success, the count is also the number of code points, hence the value
+ * of latin1_length_from_utf8 when all of them fit in Latin-1.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t code units
+ * required to encode the UTF-8 string as UTF-32 if successful.
+ */
+simdutf_warn_unused result
+utf32_length_from_utf8_with_errors(const char *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+utf32_length_from_utf8_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::utf32_length_from_utf8_with_errors(
+        detail::constexpr_cast_ptr<uint8_t>(utf8_input.data()),
+        utf8_input.size());
+  } else
+    #endif
+  {
+    return utf32_length_from_utf8_with_errors(
+        reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
@@ -1881,2119 +2507,5680 @@ convert_utf16_to_utf8_safe(
   #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Using native endianness, convert possibly broken UTF-16 string into Latin1
- * string.
+ * Using native endianness, convert possibly broken UTF-8 string into UTF-16
+ * string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16 string
- * or if it cannot be represented as Latin1
- */
-simdutf_warn_unused size_t convert_utf16_to_latin1(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * @param utf16_len     the maximum output length in char16_t
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf8_to_utf16_safe_with_errors(
+    const char *input, size_t length, char16_t *utf16_output,
+    size_t utf16_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16_to_latin1(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert<endianness::NATIVE>(
-        utf16_input.data(), utf16_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16_to_latin1(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf8_to_utf16_safe_with_errors(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_utf8_to_utf16_safe_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      utf16_output.data(), utf16_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-16LE string into Latin1 string.
- * If the string cannot be represented as Latin1, an error
- * is returned.
+ * Convert possibly broken UTF-8 string into UTF-32 string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16LE
- * string or if it cannot be represented as Latin1
- */
-simdutf_warn_unused size_t convert_utf16le_to_latin1(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to buffer that can hold conversion result
+ * @param utf32_len     the maximum output length in char32_t
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf8_to_utf32_safe_with_errors(
+    const char *input, size_t length, char32_t *utf32_output,
+    size_t utf32_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16le_to_latin1(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_latin1(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf8_to_utf32_safe_with_errors(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_utf8_to_utf32_safe_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      utf32_output.data(), utf32_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-16BE string into Latin1 string.
+ * Convert possibly broken UTF-8 string into Latin1 string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
+ * The characters that Latin1 cannot represent are errors (TOO_LARGE).
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16BE
- * string or if it cannot be represented as Latin1
- */
-simdutf_warn_unused size_t convert_utf16be_to_latin1(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param latin1_output the pointer to buffer that can hold conversion result
+ * @param latin1_len    the maximum output length in bytes
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf8_to_latin1_safe_with_errors(
+    const char *input, size_t length, char *latin1_output,
+    size_t latin1_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16be_to_latin1(
-    std::span<const char16_t> utf16_input,
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf8_to_latin1_safe_with_errors(
+    const detail::input_span_of_byte_like auto &input,
     detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_latin1(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+  return convert_utf8_to_latin1_safe_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      reinterpret_cast<char *>(latin1_output.data()), latin1_output.size());
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Convert possibly broken UTF-16LE string into UTF-8 string.
+ * Using native endianness, convert possibly broken UTF-16 string into UTF-8
+ * string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16LE
- * string
- */
-simdutf_warn_unused size_t convert_utf16le_to_utf8(const char16_t *input,
-                                                   size_t length,
-                                                   char *utf8_buffer) noexcept;
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 16-bit code units (char16_t)
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * @param utf8_len      the maximum output length in bytes
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf16_to_utf8_safe_with_errors(
+    const char16_t *input, size_t length, char *utf8_output,
+    size_t utf8_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16le_to_utf8(
-    std::span<const char16_t> utf16_input,
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf16_to_utf8_safe_with_errors(
+    std::span<const char16_t> input,
     detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_utf8(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+  return convert_utf16_to_utf8_safe_with_errors(
+      input.data(), input.size(),
+      reinterpret_cast<char *>(utf8_output.data()), utf8_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-16BE string into UTF-8 string.
+ * Using native endianness, convert possibly broken UTF-16 string into UTF-32
+ * string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16LE
- * string
- */
-simdutf_warn_unused size_t convert_utf16be_to_utf8(const char16_t *input,
-                                                   size_t length,
-                                                   char *utf8_buffer) noexcept;
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 16-bit code units (char16_t)
+ * @param utf32_output  the pointer to buffer that can hold conversion result
+ * @param utf32_len     the maximum output length in char32_t
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf16_to_utf32_safe_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    size_t utf32_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16be_to_utf8(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_utf8(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf16_to_utf32_safe_with_errors(
+    std::span<const char16_t> input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_utf16_to_utf32_safe_with_errors(
+      input.data(), input.size(),
+      utf32_output.data(), utf32_output.size());
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 /**
  * Using native endianness, convert possibly broken UTF-16 string into Latin1
- * string.
+ * string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The characters that Latin1 cannot represent are errors (TOO_LARGE).
+ *
  * This function is not BOM-aware.
  *
  * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
- * successful.
- */
-simdutf_warn_unused result convert_utf16_to_latin1_with_errors(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+ * @param length        the length of the string in 16-bit code units (char16_t)
+ * @param latin1_output the pointer to buffer that can hold conversion result
+ * @param latin1_len    the maximum output length in bytes
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf16_to_latin1_safe_with_errors(
+    const char16_t *input, size_t length, char *latin1_output,
+    size_t latin1_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16_to_latin1_with_errors(
-    std::span<const char16_t> utf16_input,
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf16_to_latin1_safe_with_errors(
+    std::span<const char16_t> input,
     detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert_with_errors<endianness::NATIVE>(
-        utf16_input.data(), utf16_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16_to_latin1_with_errors(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+  return convert_utf16_to_latin1_safe_with_errors(
+      input.data(), input.size(),
+      reinterpret_cast<char *>(latin1_output.data()), latin1_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-16LE string into Latin1 string.
+ * Convert possibly broken UTF-32 string into UTF-8 string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
- * This function is not BOM-aware.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
- * successful.
- */
-simdutf_warn_unused result convert_utf16le_to_latin1_with_errors(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 32-bit code units (char32_t)
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * @param utf8_len      the maximum output length in bytes
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf32_to_utf8_safe_with_errors(
+    const char32_t *input, size_t length, char *utf8_output,
+    size_t utf8_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16le_to_latin1_with_errors(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert_with_errors<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_latin1_with_errors(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf32_to_utf8_safe_with_errors(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_utf32_to_utf8_safe_with_errors(
+      input.data(), input.size(),
+      reinterpret_cast<char *>(utf8_output.data()), utf8_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-16BE string into Latin1 string.
- * If the string cannot be represented as Latin1, an error
- * is returned.
+ * Using native endianness, convert possibly broken UTF-32 string into UTF-16
+ * string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
+ *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
- * successful.
- */
-simdutf_warn_unused result convert_utf16be_to_latin1_with_errors(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 32-bit code units (char32_t)
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * @param utf16_len     the maximum output length in char16_t
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf32_to_utf16_safe_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    size_t utf16_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16be_to_latin1_with_errors(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert_with_errors<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_latin1_with_errors(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf32_to_utf16_safe_with_errors(
+    std::span<const char32_t> input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_utf32_to_utf16_safe_with_errors(
+      input.data(), input.size(),
+      utf16_output.data(), utf16_output.size());
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 /**
- * Using native endianness, convert possibly broken UTF-16 string into UTF-8
- * string and stop on error.
+ * Convert possibly broken UTF-32 string into Latin1 string with output limit.
+ *
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
+ * The characters that Latin1 cannot represent are errors (TOO_LARGE).
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
- * successful.
- */
-simdutf_warn_unused result convert_utf16_to_utf8_with_errors(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 32-bit code units (char32_t)
+ * @param latin1_output the pointer to buffer that can hold conversion result
+ * @param latin1_len    the maximum output length in bytes
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_utf32_to_latin1_safe_with_errors(
+    const char32_t *input, size_t length, char *latin1_output,
+    size_t latin1_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16_to_utf8_with_errors(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_with_errors<endianness::NATIVE>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16_to_utf8_with_errors(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_utf32_to_latin1_safe_with_errors(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+  return convert_utf32_to_latin1_safe_with_errors(
+      input.data(), input.size(),
+      reinterpret_cast<char *>(latin1_output.data()), latin1_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-16LE string into UTF-8 string and stop on error.
- *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * Convert Latin1 string into UTF-8 string with output limit.
  *
- * This function is not BOM-aware.
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
- * successful.
- */
-simdutf_warn_unused result convert_utf16le_to_utf8_with_errors(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+ * @param input         the Latin1 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * @param utf8_len      the maximum output length in bytes
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_latin1_to_utf8_safe_with_errors(
+    const char *input, size_t length, char *utf8_output,
+    size_t utf8_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16le_to_utf8_with_errors(
-    std::span<const char16_t> utf16_input,
+simdutf_really_inline simdutf_warn_unused full_result
+convert_latin1_to_utf8_safe_with_errors(
+    const detail::input_span_of_byte_like auto &input,
     detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_with_errors<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_utf8_with_errors(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+  return convert_latin1_to_utf8_safe_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      reinterpret_cast<char *>(utf8_output.data()), utf8_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-16BE string into UTF-8 string and stop on error.
+ * Using native endianness, convert Latin1 string into UTF-16 string with
+ * output limit.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
- * successful.
- */
-simdutf_warn_unused result convert_utf16be_to_utf8_with_errors(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+ * @param input         the Latin1 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * @param utf16_len     the maximum output length in char16_t
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_latin1_to_utf16_safe_with_errors(
+    const char *input, size_t length, char16_t *utf16_output,
+    size_t utf16_len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16be_to_utf8_with_errors(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_with_errors<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_utf8_with_errors(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused full_result
+convert_latin1_to_utf16_safe_with_errors(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_latin1_to_utf16_safe_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      utf16_output.data(), utf16_output.size());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-16LE string into UTF-8 string, replacing
- * unpaired surrogates with the Unicode replacement character U+FFFD.
+ * Convert Latin1 string into UTF-32 string with output limit.
  *
- * This function always succeeds: unpaired surrogates are replaced with
- * U+FFFD (3 bytes in UTF-8: 0xEF 0xBF 0xBD).
+ * We write as many characters as possible into the output buffer and stop
+ * before the first character that does not fit, so that the conversion can
+ * resume from input_count with another buffer.
  *
- * This function is not BOM-aware.
+ * @param input         the Latin1 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to buffer that can hold conversion result
+ * @param utf32_len     the maximum output length in char32_t
+ * @return a full_result struct (of type simdutf::full_result containing the
+ * three fields error, input_count and output_count) with an error code, the
+ * number of input code units converted and the number of code units written.
+ * The error is SUCCESS when the whole input was converted and
+ * OUTPUT_BUFFER_TOO_SMALL when the next character does not fit. Otherwise,
+ * it is the error found at position input_count, and the input before it has
+ * been converted.
+ */
+simdutf_warn_unused full_result convert_latin1_to_utf32_safe_with_errors(
+    const char *input, size_t length, char32_t *utf32_output,
+    size_t utf32_len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused full_result
+convert_latin1_to_utf32_safe_with_errors(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_latin1_to_utf32_safe_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      utf32_output.data(), utf32_output.size());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+/**
+ * Compute the number of bytes that this windows-1252 string would require in
+ * UTF-8 format.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units
+ * windows-1252 is Latin1 with the bytes 0x80 to 0x9F mapped to printable
+ * characters such as the euro sign and the curly quotation marks. It is what
+ * web browsers decode when a document is labeled "latin1" or "iso-8859-1".
+ * The five bytes it leaves unassigned map to the C1 control of the same value.
+ * Conversely, a string converted to windows-1252 has one byte per character:
+ * its length is given by latin1_length_from_utf8, latin1_length_from_utf16 and
+ * latin1_length_from_utf32.
+ *
+ * @param input         the windows-1252 string to process
+ * @param length        the length of the string in bytes
+ * @return the number of bytes required to encode the string as UTF-8
  */
-simdutf_warn_unused size_t convert_utf16le_to_utf8_with_replacement(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused size_t utf8_length_from_windows1252(const char *input,
+                                                        size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16le_to_utf8_with_replacement(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_with_replacement<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_utf8_with_replacement(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t utf8_length_from_windows1252(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+  return utf8_length_from_windows1252(
+      reinterpret_cast<const char *>(input.data()), input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-16BE string into UTF-8 string, replacing
- * unpaired surrogates with the Unicode replacement character U+FFFD.
- *
- * This function always succeeds: unpaired surrogates are replaced with
- * U+FFFD (3 bytes in UTF-8: 0xEF 0xBF 0xBD).
+ * Convert windows-1252 string into UTF-8 string.
  *
- * This function is not BOM-aware.
+ * Every byte is a valid windows-1252 character, so the conversion cannot fail.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units
+ * @param input         the windows-1252 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * (utf8_length_from_windows1252 bytes, or at most 3 * length)
+ * @return the number of written char
  */
-simdutf_warn_unused size_t convert_utf16be_to_utf8_with_replacement(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused size_t convert_windows1252_to_utf8(
+    const char *input, size_t length, char *utf8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16be_to_utf8_with_replacement(
-    std::span<const char16_t> utf16_input,
+simdutf_really_inline simdutf_warn_unused size_t convert_windows1252_to_utf8(
+    const detail::input_span_of_byte_like auto &input,
     detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_with_replacement<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_utf8_with_replacement(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+  return convert_windows1252_to_utf8(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      reinterpret_cast<char *>(utf8_output.data()));
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 &&
+         // SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-16 string (native endianness) into UTF-8 string,
- * replacing unpaired surrogates with the Unicode replacement character U+FFFD.
- *
- * This function always succeeds: unpaired surrogates are replaced with
- * U+FFFD (3 bytes in UTF-8: 0xEF 0xBF 0xBD).
+ * Convert possibly broken UTF-8 string into windows-1252 string.
  *
- * This function is not BOM-aware.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units
+ * @param input               the UTF-8 string to convert
+ * @param length              the length of the string in bytes
+ * @param windows1252_output  the pointer to buffer that can hold conversion
+ * result
+ * @return the number of written char; 0 if the input is not a valid UTF-8
+ * string or if it cannot be represented as windows-1252
  */
-simdutf_warn_unused size_t convert_utf16_to_utf8_with_replacement(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf8_to_windows1252(
+    const char *input, size_t length, char *windows1252_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16_to_utf8_with_replacement(
-    std::span<const char16_t> utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_with_replacement<endianness::NATIVE>(
-        utf16_input.data(), utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16_to_utf8_with_replacement(
-        utf16_input.data(), utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_utf8_to_windows1252(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    detail::output_span_of_byte_like auto &&windows1252_output) noexcept {
+  return convert_utf8_to_windows1252(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      reinterpret_cast<char *>(windows1252_output.data()));
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Using native endianness, convert valid UTF-16 string into UTF-8 string.
+ * Convert possibly broken UTF-8 string into windows-1252 string and stop on
+ * error.
  *
- * This function assumes that the input string is valid UTF-16.
+ * If a character cannot be represented as windows-1252, the TOO_LARGE error
+ * code is returned. This includes the C1 controls other than U+0081, U+008D,
+ * U+008F, U+0090 and U+009D.
  *
- * This function is not BOM-aware.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to a buffer that can hold the conversion
+ * @param input               the UTF-8 string to convert
+ * @param length              the length of the string in bytes
+ * @param windows1252_output  the pointer to buffer that can hold conversion
  * result
- * @return number of written code units; 0 if conversion is not possible
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t convert_valid_utf16_to_utf8(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused result convert_utf8_to_windows1252_with_errors(
+    const char *input, size_t length, char *windows1252_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16_to_utf8(
-    std::span<const char16_t> valid_utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_valid<endianness::NATIVE>(
-        valid_utf16_input.data(), valid_utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf16_to_utf8(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_windows1252_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    detail::output_span_of_byte_like auto &&windows1252_output) noexcept {
+  return convert_utf8_to_windows1252_with_errors(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      reinterpret_cast<char *>(windows1252_output.data()));
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 /**
- * Using native endianness, convert UTF-16 string into Latin1 string.
+ * Convert windows-1252 string into UTF-16 string, using native endianness.
  *
- * This function assumes that the input string is valid UTF-16 and that it can
- * be represented as Latin1. If you violate this assumption, the result is
- * implementation defined and may include system-dependent behavior such as
- * crashes.
- *
- * This function is for expert users only and not part of our public API. Use
- * convert_utf16_to_latin1 instead. The function may be removed from the library
- * in the future.
- *
- * This function is not BOM-aware.
+ * Every byte is a valid windows-1252 character, so the conversion cannot fail.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input         the windows-1252 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * (length char16_t)
+ * @return the number of written char16_t
  */
-simdutf_warn_unused size_t convert_valid_utf16_to_latin1(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+simdutf_warn_unused size_t convert_windows1252_to_utf16(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16_to_latin1(
-    std::span<const char16_t> valid_utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert_valid_impl<endianness::NATIVE>(
-        detail::constexpr_cast_ptr<uint16_t>(valid_utf16_input.data()),
-        valid_utf16_input.size(),
-        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
-  } else
-    #endif
-  {
-    return convert_valid_utf16_to_latin1(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_windows1252_to_utf16(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_windows1252_to_utf16(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      utf16_output.data());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-16LE string into Latin1 string.
- *
- * This function assumes that the input string is valid UTF-16LE and that it can
- * be represented as Latin1. If you violate this assumption, the result is
- * implementation defined and may include system-dependent behavior such as
- * crashes.
+ * Using native endianness, convert possibly broken UTF-16 string into
+ * windows-1252 string.
  *
- * This function is for expert users only and not part of our public API. Use
- * convert_utf16le_to_latin1 instead. The function may be removed from the
- * library in the future.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input               the UTF-16 string to convert
+ * @param length              the length of the string in 2-byte code units
+ * (char16_t)
+ * @param windows1252_output  the pointer to buffer that can hold conversion
+ * result
+ * @return the number of written char; 0 if the input is not a valid UTF-16
+ * string or if it cannot be represented as windows-1252
  */
-simdutf_warn_unused size_t convert_valid_utf16le_to_latin1(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16_to_windows1252(
+    const char16_t *input, size_t length, char *windows1252_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
-convert_valid_utf16le_to_latin1(
-    std::span<const char16_t> valid_utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert_valid_impl<endianness::LITTLE>(
-        detail::constexpr_cast_ptr<uint16_t>(valid_utf16_input.data()),
-        valid_utf16_input.size(),
-        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
-  } else
-    #endif
-  {
-    return convert_valid_utf16le_to_latin1(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_utf16_to_windows1252(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&windows1252_output) noexcept {
+  return convert_utf16_to_windows1252(
+      utf16_input.data(), utf16_input.size(),
+      reinterpret_cast<char *>(windows1252_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-16BE string into Latin1 string.
+ * Using native endianness, convert possibly broken UTF-16 string into
+ * windows-1252 string and stop on error.
  *
- * This function assumes that the input string is valid UTF-16BE and that it can
- * be represented as Latin1. If you violate this assumption, the result is
- * implementation defined and may include system-dependent behavior such as
- * crashes.
+ * If a character cannot be represented as windows-1252, the TOO_LARGE error
+ * code is returned.
  *
- * This function is for expert users only and not part of our public API. Use
- * convert_utf16be_to_latin1 instead. The function may be removed from the
- * library in the future.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input               the UTF-16 string to convert
+ * @param length              the length of the string in 2-byte code units
+ * (char16_t)
+ * @param windows1252_output  the pointer to buffer that can hold conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t convert_valid_utf16be_to_latin1(
-    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+simdutf_warn_unused result convert_utf16_to_windows1252_with_errors(
+    const char16_t *input, size_t length, char *windows1252_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
-convert_valid_utf16be_to_latin1(
-    std::span<const char16_t> valid_utf16_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_latin1::convert_valid_impl<endianness::BIG>(
-        detail::constexpr_cast_ptr<uint16_t>(valid_utf16_input.data()),
-        valid_utf16_input.size(),
-        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
-  } else
-    #endif
-  {
-    return convert_valid_utf16be_to_latin1(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_windows1252_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&windows1252_output) noexcept {
+  return convert_utf16_to_windows1252_with_errors(
+      utf16_input.data(), utf16_input.size(),
+      reinterpret_cast<char *>(windows1252_output.data()));
 }
   #endif // SIMDUTF_SPAN
 #endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert valid UTF-16LE string into UTF-8 string.
- *
- * This function assumes that the input string is valid UTF-16LE
+ * Convert windows-1252 string into UTF-32 string.
  *
- * This function is not BOM-aware.
+ * Every byte is a valid windows-1252 character, so the conversion cannot fail.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input         the windows-1252 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to buffer that can hold conversion result
+ * (length char32_t)
+ * @return the number of written char32_t
  */
-simdutf_warn_unused size_t convert_valid_utf16le_to_utf8(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused size_t convert_windows1252_to_utf32(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16le_to_utf8(
-    std::span<const char16_t> valid_utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_valid<endianness::NATIVE>(
-        valid_utf16_input.data(), valid_utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf16le_to_utf8(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_windows1252_to_utf32(
+    const detail::input_span_of_byte_like auto &input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_windows1252_to_utf32(
+      reinterpret_cast<const char *>(input.data()), input.size(),
+      utf32_output.data());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32 &&
+         // SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert valid UTF-16BE string into UTF-8 string.
- *
- * This function assumes that the input string is valid UTF-16BE.
+ * Convert possibly broken UTF-32 string into windows-1252 string.
  *
- * This function is not BOM-aware.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf8_buffer   the pointer to a buffer that can hold the conversion
+ * @param input               the UTF-32 string to convert
+ * @param length              the length of the string in 4-byte code units
+ * (char32_t)
+ * @param windows1252_output  the pointer to buffer that can hold conversion
  * result
- * @return number of written code units; 0 if conversion is not possible
+ * @return the number of written char; 0 if the input is not a valid UTF-32
+ * string or if it cannot be represented as windows-1252
  */
-simdutf_warn_unused size_t convert_valid_utf16be_to_utf8(
-    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf32_to_windows1252(
+    const char32_t *input, size_t length, char *windows1252_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16be_to_utf8(
-    std::span<const char16_t> valid_utf16_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf8::convert_valid<endianness::BIG>(
-        valid_utf16_input.data(), valid_utf16_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf16be_to_utf8(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_utf32_to_windows1252(
+    std::span<const char32_t> utf32_input,
+    detail::output_span_of_byte_like auto &&windows1252_output) noexcept {
+  return convert_utf32_to_windows1252(
+      utf32_input.data(), utf32_input.size(),
+      reinterpret_cast<char *>(windows1252_output.data()));
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 /**
- * Using native endianness, convert possibly broken UTF-16 string into UTF-32
- * string.
+ * Convert possibly broken UTF-32 string into windows-1252 string and stop on
+ * error.
+ *
+ * If a character cannot be represented as windows-1252, the TOO_LARGE error
+ * code is returned.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16LE
- * string
+ * @param input               the UTF-32 string to convert
+ * @param length              the length of the string in 4-byte code units
+ * (char32_t)
+ * @param windows1252_output  the pointer to buffer that can hold conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t convert_utf16_to_utf32(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused result convert_utf32_to_windows1252_with_errors(
+    const char32_t *input, size_t length, char *windows1252_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16_to_utf32(std::span<const char16_t> utf16_input,
-                       std::span<char32_t> utf32_output) noexcept {
-
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert<endianness::NATIVE>(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16_to_utf32(utf16_input.data(), utf16_input.size(),
-                                  utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32_to_windows1252_with_errors(
+    std::span<const char32_t> utf32_input,
+    detail::output_span_of_byte_like auto &&windows1252_output) noexcept {
+  return convert_utf32_to_windows1252_with_errors(
+      utf32_input.data(), utf32_input.size(),
+      reinterpret_cast<char *>(windows1252_output.data()));
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_LATIN1
+/**
+ * Single-byte encodings of the WHATWG Encoding Standard that have a built-in
+ * table, see sbcs_table.
+ */
+enum sbcs_encoding {
+  sbcs_ibm866,
+  sbcs_iso_8859_2,
+  sbcs_iso_8859_3,
+  sbcs_iso_8859_4,
+  sbcs_iso_8859_5,
+  sbcs_iso_8859_6,
+  sbcs_iso_8859_7,
+  sbcs_iso_8859_8,
+  sbcs_iso_8859_10,
+  sbcs_iso_8859_13,
+  sbcs_iso_8859_14,
+  sbcs_iso_8859_15,
+  sbcs_iso_8859_16,
+  sbcs_koi8_r,
+  sbcs_koi8_u,
+  sbcs_macintosh,
+  sbcs_windows_874,
+  sbcs_windows_1250,
+  sbcs_windows_1251,
+  sbcs_windows_1252,
+  sbcs_windows_1253,
+  sbcs_windows_1254,
+  sbcs_windows_1255,
+  sbcs_windows_1256,
+  sbcs_windows_1257,
+  sbcs_windows_1258,
+  sbcs_x_mac_cyrillic,
+};
 
 /**
- * Convert possibly broken UTF-16LE string into UTF-32 string.
+ * Return the table of a single-byte encoding, for use with the sbcs
+ * conversion functions.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * A single-byte encoding (SBCS) is ASCII for the bytes 0x00 to 0x7F. Its
+ * table gives the UTF-16 code unit of each of the bytes 0x80 to 0xFF: it has
+ * 128 entries, which are characters of the Basic Multilingual Plane. The
+ * entry U+FFFD marks an unassigned byte. You may pass your own table to the
+ * sbcs conversion functions, which treat the entries that are surrogates as
+ * unassigned bytes, so that they always produce valid Unicode.
  *
- * This function is not BOM-aware.
+ * The built-in tables follow the WHATWG Encoding Standard: the bytes that
+ * the windows code pages leave unassigned in 0x80-0x9F map to the C1 control
+ * of the same value, and the other unassigned bytes to U+FFFD.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16LE
- * string
+ * @param encoding      the single-byte encoding
+ * @return a pointer to the 128-entry table; nullptr if the encoding is unknown
  */
-simdutf_warn_unused size_t convert_utf16le_to_utf32(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused const char16_t *
+sbcs_table(sbcs_encoding encoding) noexcept;
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 &&                          \
+    SIMDUTF_FEATURE_LATIN1
+/**
+ * Compute the number of bytes that this string in a single-byte encoding
+ * would require in UTF-8 format.
+ *
+ * @param input         the string to process
+ * @param length        the length of the string in bytes
+ * @param table         the 128-entry table of the encoding, see sbcs_table
+ * @return the number of bytes required to encode the string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_sbcs(
+    const char *input, size_t length, const char16_t *table) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16le_to_utf32(std::span<const char16_t> utf16_input,
-                         std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_utf32(utf16_input.data(), utf16_input.size(),
-                                    utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused size_t
+utf8_length_from_sbcs(const detail::input_span_of_byte_like auto &input,
+                      const char16_t *table) noexcept {
+  return utf8_length_from_sbcs(reinterpret_cast<const char *>(input.data()),
+                               input.size(), table);
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-16BE string into UTF-32 string.
+ * Convert a string in a single-byte encoding into UTF-8 string.
  *
- * During the conversion also validation of the input string is done.
+ * Unassigned bytes (U+FFFD in the table) become U+FFFD, as in web browsers.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-16LE
- * string
+ * @param input         the string to convert
+ * @param length        the length of the string in bytes
+ * @param table         the 128-entry table of the encoding, see sbcs_table
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * (utf8_length_from_sbcs bytes, or at most 3 * length)
+ * @return the number of written char
  */
-simdutf_warn_unused size_t convert_utf16be_to_utf32(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused size_t convert_sbcs_to_utf8(const char *input,
+                                                size_t length,
+                                                const char16_t *table,
+                                                char *utf8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf16be_to_utf32(std::span<const char16_t> utf16_input,
-                         std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_utf32(utf16_input.data(), utf16_input.size(),
-                                    utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_sbcs_to_utf8(
+    const detail::input_span_of_byte_like auto &input, const char16_t *table,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_sbcs_to_utf8(reinterpret_cast<const char *>(input.data()),
+                              input.size(), table,
+                              reinterpret_cast<char *>(utf8_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Using native endianness, convert possibly broken UTF-16 string into
- * UTF-32 string and stop on error.
+ * Convert possibly broken UTF-8 string into a single-byte encoding and stop
+ * on error.
+ *
+ * If a character is not in the encoding, the TOO_LARGE error code is
+ * returned. U+FFFD is never converted to an unassigned byte. A string in a
+ * single-byte encoding has one byte per character: latin1_length_from_utf8
+ * gives the output length.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param table         the 128-entry table of the encoding, see sbcs_table
+ * @param sbcs_output   the pointer to buffer that can hold conversion result
  * @return a result pair struct (of type simdutf::result containing the two
  * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char32_t written if
+ * (in the input in code units) if any, or the number of char written if
  * successful.
  */
-simdutf_warn_unused result convert_utf16_to_utf32_with_errors(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused result convert_utf8_to_sbcs_with_errors(
+    const char *input, size_t length, const char16_t *table,
+    char *sbcs_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16_to_utf32_with_errors(std::span<const char16_t> utf16_input,
-                                   std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert_with_errors<endianness::NATIVE>(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16_to_utf32_with_errors(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_sbcs_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    const char16_t *table,
+    detail::output_span_of_byte_like auto &&sbcs_output) noexcept {
+  return convert_utf8_to_sbcs_with_errors(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      table, reinterpret_cast<char *>(sbcs_output.data()));
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 &&
+         // SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-16LE string into UTF-32 string and stop on error.
+ * Convert a string in a single-byte encoding into UTF-16 string, using native
+ * endianness.
  *
- * During the conversion also validation of the input string is done.
+ * Unassigned bytes (U+FFFD in the table) become U+FFFD, as in web browsers.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char32_t written if
- * successful.
+ * @param input         the string to convert
+ * @param length        the length of the string in bytes
+ * @param table         the 128-entry table of the encoding, see sbcs_table
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * (length char16_t)
+ * @return the number of written char16_t
  */
-simdutf_warn_unused result convert_utf16le_to_utf32_with_errors(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused size_t convert_sbcs_to_utf16(
+    const char *input, size_t length, const char16_t *table,
+    char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16le_to_utf32_with_errors(
-    std::span<const char16_t> utf16_input,
-    std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert_with_errors<endianness::LITTLE>(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16le_to_utf32_with_errors(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused size_t
+convert_sbcs_to_utf16(const detail::input_span_of_byte_like auto &input,
+                      const char16_t *table,
+                      std::span<char16_t> utf16_output) noexcept {
+  return convert_sbcs_to_utf16(reinterpret_cast<const char *>(input.data()),
+                               input.size(), table, utf16_output.data());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-16BE string into UTF-32 string and stop on error.
+ * Using native endianness, convert possibly broken UTF-16 string into a
+ * single-byte encoding and stop on error.
+ *
+ * If a character is not in the encoding, the TOO_LARGE error code is
+ * returned. U+FFFD is never converted to an unassigned byte.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16BE string to convert
+ * @param input         the UTF-16 string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @param table         the 128-entry table of the encoding, see sbcs_table
+ * @param sbcs_output   the pointer to buffer that can hold conversion result
+ * (length bytes)
  * @return a result pair struct (of type simdutf::result containing the two
  * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char32_t written if
+ * (in the input in code units) if any, or the number of char written if
  * successful.
  */
-simdutf_warn_unused result convert_utf16be_to_utf32_with_errors(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused result convert_utf16_to_sbcs_with_errors(
+    const char16_t *input, size_t length, const char16_t *table,
+    char *sbcs_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf16be_to_utf32_with_errors(
-    std::span<const char16_t> utf16_input,
-    std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert_with_errors<endianness::BIG>(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_utf16be_to_utf32_with_errors(
-        utf16_input.data(), utf16_input.size(), utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_sbcs_with_errors(
+    std::span<const char16_t> utf16_input, const char16_t *table,
+    detail::output_span_of_byte_like auto &&sbcs_output) noexcept {
+  return convert_utf16_to_sbcs_with_errors(
+      utf16_input.data(), utf16_input.size(), table,
+      reinterpret_cast<char *>(sbcs_output.data()));
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Using native endianness, convert valid UTF-16 string into UTF-32 string.
- *
- * This function assumes that the input string is valid UTF-16 (native
- * endianness).
+ * Validate a CESU-8 string.
  *
- * This function is not BOM-aware.
+ * CESU-8 is UTF-8 where a character above U+FFFF is written as its UTF-16
+ * surrogate pair, each surrogate as a three-byte sequence. The four-byte
+ * sequences of UTF-8 are invalid (HEADER_BITS), and a surrogate that is not
+ * part of a pair is invalid (SURROGATE).
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param buf the CESU-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @return true if and only if the string is valid CESU-8.
  */
-simdutf_warn_unused size_t convert_valid_utf16_to_utf32(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused bool validate_cesu8(const char *buf, size_t len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16_to_utf32(std::span<const char16_t> valid_utf16_input,
-                             std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert_valid<endianness::NATIVE>(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf16_to_utf32(valid_utf16_input.data(),
-                                        valid_utf16_input.size(),
-                                        utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused bool
+validate_cesu8(const detail::input_span_of_byte_like auto &input) noexcept {
+  return validate_cesu8(reinterpret_cast<const char *>(input.data()),
+                        input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-16LE string into UTF-32 string.
- *
- * This function assumes that the input string is valid UTF-16LE.
- *
- * This function is not BOM-aware.
+ * Validate a CESU-8 string and stop on error, see validate_cesu8.
  *
- * @param input         the UTF-16LE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param buf the CESU-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of code units validated
+ * if successful.
  */
-simdutf_warn_unused size_t convert_valid_utf16le_to_utf32(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused result validate_cesu8_with_errors(const char *buf,
+                                                      size_t len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16le_to_utf32(std::span<const char16_t> valid_utf16_input,
-                               std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert_valid<endianness::LITTLE>(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf16le_to_utf32(valid_utf16_input.data(),
-                                          valid_utf16_input.size(),
-                                          utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused result validate_cesu8_with_errors(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+  return validate_cesu8_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-16BE string into UTF-32 string.
- *
- * This function assumes that the input string is valid UTF-16LE.
+ * Validate a modified UTF-8 string, the encoding of strings in JNI and in
+ * Java class files.
  *
- * This function is not BOM-aware.
+ * Modified UTF-8 is CESU-8 where the null character is written as the
+ * two bytes C0 80, so that the string contains no zero byte. A zero byte is
+ * invalid (HEADER_BITS). Unlike CESU-8, it may contain a surrogate that is not
+ * part of a pair, as Java strings may.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @param utf32_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param buf the modified UTF-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @return true if and only if the string is valid modified UTF-8.
  */
-simdutf_warn_unused size_t convert_valid_utf16be_to_utf32(
-    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+simdutf_warn_unused bool validate_mutf8(const char *buf, size_t len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf16be_to_utf32(std::span<const char16_t> valid_utf16_input,
-                               std::span<char32_t> utf32_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16_to_utf32::convert_valid<endianness::BIG>(
-        valid_utf16_input.data(), valid_utf16_input.size(),
-        utf32_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf16be_to_utf32(valid_utf16_input.data(),
-                                          valid_utf16_input.size(),
-                                          utf32_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused bool
+validate_mutf8(const detail::input_span_of_byte_like auto &input) noexcept {
+  return validate_mutf8(reinterpret_cast<const char *>(input.data()),
+                        input.size());
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Using native endianness; Compute the number of bytes that this UTF-16
- * string would require in UTF-8 format.
- *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-16 strings but in such cases the result is implementation defined.
+ * Validate a modified UTF-8 string and stop on error, see validate_mutf8.
  *
- * @param input         the UTF-16 string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @return the number of bytes required to encode the UTF-16LE string as UTF-8
+ * @param buf the modified UTF-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of code units validated
+ * if successful.
  */
-simdutf_warn_unused size_t utf8_length_from_utf16(const char16_t *input,
-                                                  size_t length) noexcept;
+simdutf_warn_unused result validate_mutf8_with_errors(const char *buf,
+                                                      size_t len) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf8_length_from_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16::utf8_length_from_utf16<endianness::NATIVE>(
-        valid_utf16_input.data(), valid_utf16_input.size());
-  } else
-    #endif
-  {
-    return utf8_length_from_utf16(valid_utf16_input.data(),
-                                  valid_utf16_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused result validate_mutf8_with_errors(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+  return validate_mutf8_with_errors(
+      reinterpret_cast<const char *>(input.data()), input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Using native endianness; compute the number of bytes that this UTF-16
- * string would require in UTF-8 format even when the UTF-16LE content contains
- * mismatched surrogates that have to be replaced by the replacement character
- * (0xFFFD).
+ * Compute the number of bytes that this UTF-16 string would require in
+ * CESU-8 format. Each surrogate, paired or not, takes three bytes.
+ *
+ * This function does not validate the input.
  *
  * @param input         the UTF-16 string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) where the count is the number of bytes required to
- * encode the UTF-16 string as UTF-8, and the error code is either SUCCESS or
- * SURROGATE. The count is correct regardless of the error field.
- * When SURROGATE is returned, it does not indicate an error in the case of this
- * function: it indicates that at least one surrogate has been encountered: the
- * surrogates may be matched or not (thus this function does not validate). If
- * the returned error code is SUCCESS, then the input contains no surrogate, is
- * in the Basic Multilingual Plane, and is necessarily valid.
+ * @return the number of bytes required to encode the UTF-16 string as CESU-8
  */
-simdutf_warn_unused result utf8_length_from_utf16_with_replacement(
-    const char16_t *input, size_t length) noexcept;
+simdutf_warn_unused size_t cesu8_length_from_utf16(const char16_t *input,
+                                                   size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-utf8_length_from_utf16_with_replacement(
-    std::span<const char16_t> valid_utf16_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16::utf8_length_from_utf16_with_replacement<
-        endianness::NATIVE>(valid_utf16_input.data(), valid_utf16_input.size());
-  } else
-    #endif
-  {
-    return utf8_length_from_utf16_with_replacement(valid_utf16_input.data(),
-                                                   valid_utf16_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused size_t
+cesu8_length_from_utf16(std::span<const char16_t> utf16_input) noexcept {
+  return cesu8_length_from_utf16(utf16_input.data(), utf16_input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Compute the number of bytes that this UTF-16LE string would require in UTF-8
- * format.
+ * Compute the number of bytes that this UTF-16 string would require in
+ * modified UTF-8 format. Each surrogate, paired or not, takes three bytes and
+ * the null character takes two bytes.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-16 strings but in such cases the result is implementation defined.
+ * This function does not validate the input.
  *
- * @param input         the UTF-16LE string to convert
+ * @param input         the UTF-16 string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return the number of bytes required to encode the UTF-16LE string as UTF-8
+ * @return the number of bytes required to encode the UTF-16 string as
+ * modified UTF-8
  */
-simdutf_warn_unused size_t utf8_length_from_utf16le(const char16_t *input,
-                                                    size_t length) noexcept;
+simdutf_warn_unused size_t mutf8_length_from_utf16(const char16_t *input,
+                                                   size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
-utf8_length_from_utf16le(std::span<const char16_t> valid_utf16_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16::utf8_length_from_utf16<endianness::LITTLE>(
-        valid_utf16_input.data(), valid_utf16_input.size());
-  } else
-    #endif
-  {
-    return utf8_length_from_utf16le(valid_utf16_input.data(),
-                                    valid_utf16_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused size_t
+mutf8_length_from_utf16(std::span<const char16_t> utf16_input) noexcept {
+  return mutf8_length_from_utf16(utf16_input.data(), utf16_input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Compute the number of bytes that this UTF-16BE string would require in UTF-8
- * format.
+ * Compute the number of bytes that this UTF-8 string would require in CESU-8
+ * format: six bytes instead of four for each character above U+FFFF.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-16 strings but in such cases the result is implementation defined.
+ * This function does not validate the input.
  *
- * @param input         the UTF-16BE string to convert
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @return the number of bytes required to encode the UTF-16BE string as UTF-8
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @return the number of bytes required to encode the UTF-8 string as CESU-8
  */
-simdutf_warn_unused size_t utf8_length_from_utf16be(const char16_t *input,
-                                                    size_t length) noexcept;
+simdutf_warn_unused size_t cesu8_length_from_utf8(const char *input,
+                                                  size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf8_length_from_utf16be(std::span<const char16_t> valid_utf16_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16::utf8_length_from_utf16<endianness::BIG>(
-        valid_utf16_input.data(), valid_utf16_input.size());
-  } else
-    #endif
-  {
-    return utf8_length_from_utf16be(valid_utf16_input.data(),
-                                    valid_utf16_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused size_t cesu8_length_from_utf8(
+    const detail::input_span_of_byte_like auto &valid_utf8_input) noexcept {
+  return cesu8_length_from_utf8(
+      reinterpret_cast<const char *>(valid_utf8_input.data()),
+      valid_utf8_input.size());
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-32 string into UTF-8 string.
- *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * Compute the number of bytes that this UTF-8 string would require in
+ * modified UTF-8 format: six bytes instead of four for each character above
+ * U+FFFF and two bytes for each null character.
  *
- * This function is not BOM-aware.
+ * This function does not validate the input.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-32 string
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @return the number of bytes required to encode the UTF-8 string as
+ * modified UTF-8
  */
-simdutf_warn_unused size_t convert_utf32_to_utf8(const char32_t *input,
-                                                 size_t length,
-                                                 char *utf8_buffer) noexcept;
+simdutf_warn_unused size_t mutf8_length_from_utf8(const char *input,
+                                                  size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf32_to_utf8(
-    std::span<const char32_t> utf32_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf8::convert(
-        utf32_input.data(), utf32_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf8(utf32_input.data(), utf32_input.size(),
-                                 reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t mutf8_length_from_utf8(
+    const detail::input_span_of_byte_like auto &valid_utf8_input) noexcept {
+  return mutf8_length_from_utf8(
+      reinterpret_cast<const char *>(valid_utf8_input.data()),
+      valid_utf8_input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-32 string into UTF-8 string and stop on error.
+ * Convert possibly broken CESU-8 string into UTF-16 string, using native
+ * endianness, and stop on error.
+ *
+ * The output needs at most length char16_t; count_utf8 gives the exact
+ * number for valid input.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @param input         the CESU-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
  * @return a result pair struct (of type simdutf::result containing the two
  * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char written if
+ * (in the input in code units) if any, or the number of char16_t written if
  * successful.
  */
-simdutf_warn_unused result convert_utf32_to_utf8_with_errors(
-    const char32_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused result convert_cesu8_to_utf16_with_errors(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf32_to_utf8_with_errors(
-    std::span<const char32_t> utf32_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf8::convert_with_errors(
-        utf32_input.data(), utf32_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf8_with_errors(
-        utf32_input.data(), utf32_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_cesu8_to_utf16_with_errors(
+    const detail::input_span_of_byte_like auto &cesu8_input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_cesu8_to_utf16_with_errors(
+      reinterpret_cast<const char *>(cesu8_input.data()), cesu8_input.size(),
+      utf16_output.data());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-32 string into UTF-8 string.
+ * Convert possibly broken modified UTF-8 string into UTF-16 string, using
+ * native endianness, and stop on error.
  *
- * This function assumes that the input string is valid UTF-32.
+ * The output needs at most length char16_t; count_utf8 gives the exact
+ * number for valid input.
  *
- * This function is not BOM-aware.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf8_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * A surrogate that is not part of a pair is written as a lone surrogate.
+ *
+ * @param input         the modified UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
  */
-simdutf_warn_unused size_t convert_valid_utf32_to_utf8(
-    const char32_t *input, size_t length, char *utf8_buffer) noexcept;
+simdutf_warn_unused result convert_mutf8_to_utf16_with_errors(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf32_to_utf8(
-    std::span<const char32_t> valid_utf32_input,
-    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf8::convert_valid(
-        valid_utf32_input.data(), valid_utf32_input.size(), utf8_output.data());
-  } else
-    #endif
-  {
-    return convert_valid_utf32_to_utf8(
-        valid_utf32_input.data(), valid_utf32_input.size(),
-        reinterpret_cast<char *>(utf8_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_mutf8_to_utf16_with_errors(
+    const detail::input_span_of_byte_like auto &mutf8_input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_mutf8_to_utf16_with_errors(
+      reinterpret_cast<const char *>(mutf8_input.data()), mutf8_input.size(),
+      utf16_output.data());
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 /**
- * Using native endianness, convert possibly broken UTF-32 string into a UTF-16
- * string.
+ * Convert possibly broken CESU-8 string into UTF-8 string and stop on error.
+ *
+ * The UTF-8 string is never longer than the input.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-32 string
+ * @param input         the CESU-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * (length bytes)
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t convert_utf32_to_utf16(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused result convert_cesu8_to_utf8_with_errors(
+    const char *input, size_t length, char *utf8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf32_to_utf16(std::span<const char32_t> utf32_input,
-                       std::span<char16_t> utf16_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf16::convert<endianness::NATIVE>(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf16(utf32_input.data(), utf32_input.size(),
-                                  utf16_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_cesu8_to_utf8_with_errors(
+    const detail::input_span_of_byte_like auto &cesu8_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_cesu8_to_utf8_with_errors(
+      reinterpret_cast<const char *>(cesu8_input.data()), cesu8_input.size(),
+      reinterpret_cast<char *>(utf8_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-32 string into UTF-16LE string.
+ * Convert possibly broken modified UTF-8 string into UTF-8 string and stop on
+ * error.
+ *
+ * The UTF-8 string is never longer than the input. A surrogate that is not
+ * part of a pair has no UTF-8 form, and is an error (SURROGATE).
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-32 string
+ * @param input         the modified UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf8_output   the pointer to buffer that can hold conversion result
+ * (length bytes)
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t convert_utf32_to_utf16le(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused result convert_mutf8_to_utf8_with_errors(
+    const char *input, size_t length, char *utf8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf32_to_utf16le(std::span<const char32_t> utf32_input,
-                         std::span<char16_t> utf16_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf16::convert<endianness::LITTLE>(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf16le(utf32_input.data(), utf32_input.size(),
-                                    utf16_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_mutf8_to_utf8_with_errors(
+    const detail::input_span_of_byte_like auto &mutf8_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_mutf8_to_utf8_with_errors(
+      reinterpret_cast<const char *>(mutf8_input.data()), mutf8_input.size(),
+      reinterpret_cast<char *>(utf8_output.data()));
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-32 string into Latin1 string.
+ * Using native endianness, convert possibly broken UTF-16 string into CESU-8
+ * string.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * Each surrogate of a pair is written as a three-byte sequence. CESU-8 only
+ * encodes valid UTF-16: a lone surrogate is an error, see
+ * convert_utf16_to_mutf8 for Java strings.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-32 string
- * or if it cannot be represented as Latin1
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param cesu8_output  the pointer to buffer that can hold conversion result,
+ * see cesu8_length_from_utf16
+ * @return number of written char; 0 if input is not a valid UTF-16 string
  */
-simdutf_warn_unused size_t convert_utf32_to_latin1(
-    const char32_t *input, size_t length, char *latin1_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16_to_cesu8(const char16_t *input,
+                                                  size_t length,
+                                                  char *cesu8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf32_to_latin1(
-    std::span<const char32_t> utf32_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_latin1::convert(
-        utf32_input.data(), utf32_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_latin1(
-        utf32_input.data(), utf32_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_utf16_to_cesu8(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&cesu8_output) noexcept {
+  return convert_utf16_to_cesu8(utf16_input.data(), utf16_input.size(),
+                                reinterpret_cast<char *>(cesu8_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-32 string into Latin1 string and stop on error.
- * If the string cannot be represented as Latin1, an error is returned.
- *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * Using native endianness, convert possibly broken UTF-16 string into CESU-8
+ * string and stop on error, see convert_utf16_to_cesu8.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param cesu8_output  the pointer to buffer that can hold conversion result,
+ * see cesu8_length_from_utf16
  * @return a result pair struct (of type simdutf::result containing the two
  * fields error and count) with an error code and either position of the error
  * (in the input in code units) if any, or the number of char written if
  * successful.
  */
-simdutf_warn_unused result convert_utf32_to_latin1_with_errors(
-    const char32_t *input, size_t length, char *latin1_buffer) noexcept;
+simdutf_warn_unused result convert_utf16_to_cesu8_with_errors(
+    const char16_t *input, size_t length, char *cesu8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf32_to_latin1_with_errors(
-    std::span<const char32_t> utf32_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_latin1::convert_with_errors(
-        utf32_input.data(), utf32_input.size(), latin1_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_latin1_with_errors(
-        utf32_input.data(), utf32_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_cesu8_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&cesu8_output) noexcept {
+  return convert_utf16_to_cesu8_with_errors(
+      utf16_input.data(), utf16_input.size(),
+      reinterpret_cast<char *>(cesu8_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-32 string into Latin1 string.
- *
- * This function assumes that the input string is valid UTF-32 and that it can
- * be represented as Latin1. If you violate this assumption, the result is
- * implementation defined and may include system-dependent behavior such as
- * crashes.
+ * Convert a UTF-16 string, using native endianness, into modified UTF-8
+ * string, as JNI's GetStringUTFChars does.
  *
- * This function is for expert users only and not part of our public API. Use
- * convert_utf32_to_latin1 instead. The function may be removed from the library
- * in the future.
+ * Each surrogate is written as a three-byte sequence and the null character
+ * as C0 80. The conversion cannot fail, and a lone surrogate, which Java
+ * strings may contain, survives a round trip through
+ * convert_mutf8_to_utf16_with_errors.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param latin1_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param mutf8_output  the pointer to buffer that can hold conversion result,
+ * see mutf8_length_from_utf16
+ * @return the number of written char
  */
-simdutf_warn_unused size_t convert_valid_utf32_to_latin1(
-    const char32_t *input, size_t length, char *latin1_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16_to_mutf8(const char16_t *input,
+                                                  size_t length,
+                                                  char *mutf8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
-convert_valid_utf32_to_latin1(
-    std::span<const char32_t> valid_utf32_input,
-    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_latin1::convert_valid(
-        detail::constexpr_cast_ptr<uint32_t>(valid_utf32_input.data()),
-        valid_utf32_input.size(),
-        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
-  }
-    #endif
-  {
-    return convert_valid_utf32_to_latin1(
-        valid_utf32_input.data(), valid_utf32_input.size(),
-        reinterpret_cast<char *>(latin1_output.data()));
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_utf16_to_mutf8(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&mutf8_output) noexcept {
+  return convert_utf16_to_mutf8(utf16_input.data(), utf16_input.size(),
+                                reinterpret_cast<char *>(mutf8_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Compute the number of bytes that this UTF-32 string would require in Latin1
- * format.
+ * Convert possibly broken UTF-8 string into CESU-8 string and stop on error.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-32 strings but in such cases the result is implementation defined.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param cesu8_output  the pointer to buffer that can hold conversion result,
+ * see cesu8_length_from_utf8
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_cesu8_with_errors(
+    const char *input, size_t length, char *cesu8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_cesu8_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    detail::output_span_of_byte_like auto &&cesu8_output) noexcept {
+  return convert_utf8_to_cesu8_with_errors(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      reinterpret_cast<char *>(cesu8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into modified UTF-8 string and stop on
+ * error.
  *
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @return the number of bytes required to encode the UTF-32 string as Latin1
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param mutf8_output  the pointer to buffer that can hold conversion result,
+ * see mutf8_length_from_utf8
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused simdutf_really_inline simdutf_constexpr23 size_t
-latin1_length_from_utf32(size_t length) noexcept {
-  return length;
+simdutf_warn_unused result convert_utf8_to_mutf8_with_errors(
+    const char *input, size_t length, char *mutf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_mutf8_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    detail::output_span_of_byte_like auto &&mutf8_output) noexcept {
+  return convert_utf8_to_mutf8_with_errors(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      reinterpret_cast<char *>(mutf8_output.data()));
 }
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Compute the number of bytes that this Latin1 string would require in UTF-32
- * format.
+ * Validate a WTF-8 string.
  *
- * @param length        the length of the string in Latin1 code units (char)
- * @return the length of the string in 4-byte code units (char32_t) required to
- * encode the Latin1 string as UTF-32
+ * WTF-8 is UTF-8 that may also contain unpaired surrogates, each written as a
+ * three-byte sequence. It can hold any UTF-16 string, such as a Windows file
+ * name or a JavaScript string, without loss. Valid UTF-8 is valid WTF-8. A
+ * surrogate pair must be written as a four-byte sequence: a high surrogate
+ * sequence followed by a low surrogate sequence is invalid (SURROGATE).
+ *
+ * @param buf the WTF-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @return true if and only if the string is valid WTF-8.
  */
-simdutf_warn_unused simdutf_really_inline simdutf_constexpr23 size_t
-utf32_length_from_latin1(size_t length) noexcept {
-  return length;
+simdutf_warn_unused bool validate_wtf8(const char *buf, size_t len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused bool
+validate_wtf8(const detail::input_span_of_byte_like auto &input) noexcept {
+  return validate_wtf8(reinterpret_cast<const char *>(input.data()),
+                       input.size());
 }
-#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+  #endif // SIMDUTF_SPAN
 
-#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 /**
- * Convert possibly broken UTF-32 string into UTF-16BE string.
+ * Validate a WTF-8 string and stop on error, see validate_wtf8.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * @param buf the WTF-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of code units validated
+ * if successful.
+ */
+simdutf_warn_unused result validate_wtf8_with_errors(const char *buf,
+                                                     size_t len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result validate_wtf8_with_errors(
+    const detail::input_span_of_byte_like auto &input) noexcept {
+  return validate_wtf8_with_errors(reinterpret_cast<const char *>(input.data()),
+                                   input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-16 string, using native
+ * endianness, would require in WTF-8 format. An unpaired surrogate takes
+ * three bytes.
  *
- * This function is not BOM-aware.
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16 string as WTF-8
+ */
+simdutf_warn_unused size_t wtf8_length_from_utf16(const char16_t *input,
+                                                  size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+wtf8_length_from_utf16(std::span<const char16_t> utf16_input) noexcept {
+  return wtf8_length_from_utf16(utf16_input.data(), utf16_input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of char16_t that this WTF-8 string would require in
+ * UTF-16 format.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to buffer that can hold conversion result
- * @return number of written code units; 0 if input is not a valid UTF-32 string
+ * This function does not validate the input. It is acceptable to pass invalid
+ * WTF-8 strings but in such cases the result is implementation defined.
+ *
+ * @param input         the WTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @return the number of char16_t code units required to encode the WTF-8
+ * string as UTF-16
  */
-simdutf_warn_unused size_t convert_utf32_to_utf16be(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused size_t utf16_length_from_wtf8(const char *input,
+                                                  size_t length) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_utf32_to_utf16be(std::span<const char32_t> utf32_input,
-                         std::span<char16_t> utf16_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf16::convert<endianness::BIG>(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf16be(utf32_input.data(), utf32_input.size(),
-                                    utf16_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused size_t utf16_length_from_wtf8(
+    const detail::input_span_of_byte_like auto &valid_wtf8_input) noexcept {
+  return utf16_length_from_wtf8(
+      reinterpret_cast<const char *>(valid_wtf8_input.data()),
+      valid_wtf8_input.size());
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Using native endianness, convert possibly broken UTF-32 string into UTF-16
- * string and stop on error.
+ * Convert a UTF-16 string, using native endianness, into WTF-8 string.
  *
- * During the conversion also validation of the input string is done.
- * This function is suitable to work with inputs from untrusted sources.
+ * Unlike convert_utf16_to_utf8, unpaired surrogates are kept, so that
+ * convert_wtf8_to_utf16_with_errors gives back the input. The conversion
+ * cannot fail.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char16_t written if
- * successful.
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param wtf8_output   the pointer to buffer that can hold conversion result,
+ * see wtf8_length_from_utf16
+ * @return the number of written char
  */
-simdutf_warn_unused result convert_utf32_to_utf16_with_errors(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16_to_wtf8(const char16_t *input,
+                                                 size_t length,
+                                                 char *wtf8_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf32_to_utf16_with_errors(std::span<const char32_t> utf32_input,
-                                   std::span<char16_t> utf16_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf16::convert_with_errors<endianness::NATIVE>(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf16_with_errors(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  }
+simdutf_really_inline simdutf_warn_unused size_t convert_utf16_to_wtf8(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&wtf8_output) noexcept {
+  return convert_utf16_to_wtf8(utf16_input.data(), utf16_input.size(),
+                               reinterpret_cast<char *>(wtf8_output.data()));
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert possibly broken UTF-32 string into UTF-16LE string and stop on error.
+ * Convert possibly broken WTF-8 string into UTF-16 string, using native
+ * endianness, and stop on error.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
- * This function is not BOM-aware.
- *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @param input         the WTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to buffer that can hold conversion result
  * @return a result pair struct (of type simdutf::result containing the two
  * fields error and count) with an error code and either position of the error
  * (in the input in code units) if any, or the number of char16_t written if
  * successful.
  */
-simdutf_warn_unused result convert_utf32_to_utf16le_with_errors(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused result convert_wtf8_to_utf16_with_errors(
+    const char *input, size_t length, char16_t *utf16_output) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf32_to_utf16le_with_errors(
-    std::span<const char32_t> utf32_input,
+simdutf_really_inline simdutf_warn_unused result
+convert_wtf8_to_utf16_with_errors(
+    const detail::input_span_of_byte_like auto &wtf8_input,
     std::span<char16_t> utf16_output) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf32_to_utf16::convert_with_errors<endianness::LITTLE>(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  } else
-    #endif
-  {
-    return convert_utf32_to_utf16le_with_errors(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
-  }
+  return convert_wtf8_to_utf16_with_errors(
+      reinterpret_cast<const char *>(wtf8_input.data()), wtf8_input.size(),
+      utf16_output.data());
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 /**
- * Convert possibly broken UTF-32 string into UTF-16BE string and stop on error.
+ * Using native endianness, convert possibly broken UTF-16 string into Latin1
+ * string.
  *
  * During the conversion also validation of the input string is done.
  * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to buffer that can hold conversion result
- * @return a result pair struct (of type simdutf::result containing the two
- * fields error and count) with an error code and either position of the error
- * (in the input in code units) if any, or the number of char16_t written if
- * successful.
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16 string
+ * or if it cannot be represented as Latin1
  */
-simdutf_warn_unused result convert_utf32_to_utf16be_with_errors(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16_to_latin1(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
-convert_utf32_to_utf16be_with_errors(
-    std::span<const char32_t> utf32_input,
-    std::span<char16_t> utf16_output) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf16_to_latin1(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf32_to_utf16::convert_with_errors<endianness::BIG>(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
+    return scalar::utf16_to_latin1::convert<endianness::NATIVE>(
+        utf16_input.data(), utf16_input.size(), latin1_output.data());
   } else
     #endif
   {
-    return convert_utf32_to_utf16be_with_errors(
-        utf32_input.data(), utf32_input.size(), utf16_output.data());
+    return convert_utf16_to_latin1(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Using native endianness, convert valid UTF-32 string into a UTF-16 string.
+ * Convert possibly broken UTF-16LE string into Latin1 string.
+ * If the string cannot be represented as Latin1, an error
+ * is returned.
  *
- * This function assumes that the input string is valid UTF-32.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16LE
+ * string or if it cannot be represented as Latin1
  */
-simdutf_warn_unused size_t convert_valid_utf32_to_utf16(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16le_to_latin1(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf32_to_utf16(std::span<const char32_t> valid_utf32_input,
-                             std::span<char16_t> utf16_output) noexcept {
-
+convert_utf16le_to_latin1(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf32_to_utf16::convert_valid<endianness::NATIVE>(
-        valid_utf32_input.data(), valid_utf32_input.size(),
-        utf16_output.data());
+    return scalar::utf16_to_latin1::convert<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), latin1_output.data());
   } else
     #endif
   {
-    return convert_valid_utf32_to_utf16(valid_utf32_input.data(),
-                                        valid_utf32_input.size(),
-                                        utf16_output.data());
+    return convert_utf16le_to_latin1(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Convert valid UTF-32 string into UTF-16LE string.
+ * Convert possibly broken UTF-16BE string into Latin1 string.
  *
- * This function assumes that the input string is valid UTF-32.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16BE
+ * string or if it cannot be represented as Latin1
  */
-simdutf_warn_unused size_t convert_valid_utf32_to_utf16le(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16be_to_latin1(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf32_to_utf16le(std::span<const char32_t> valid_utf32_input,
-                               std::span<char16_t> utf16_output) noexcept {
+convert_utf16be_to_latin1(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf32_to_utf16::convert_valid<endianness::LITTLE>(
-        valid_utf32_input.data(), valid_utf32_input.size(),
-        utf16_output.data());
+    return scalar::utf16_to_latin1::convert<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), latin1_output.data());
   } else
     #endif
   {
-    return convert_valid_utf32_to_utf16le(valid_utf32_input.data(),
-                                          valid_utf32_input.size(),
-                                          utf16_output.data());
+    return convert_utf16be_to_latin1(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Convert valid UTF-32 string into UTF-16BE string.
+ * Convert possibly broken UTF-16LE string into UTF-8 string.
  *
- * This function assumes that the input string is valid UTF-32.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @param utf16_buffer   the pointer to a buffer that can hold the conversion
- * result
- * @return number of written code units; 0 if conversion is not possible
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16LE
+ * string
  */
-simdutf_warn_unused size_t convert_valid_utf32_to_utf16be(
-    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+simdutf_warn_unused size_t convert_utf16le_to_utf8(const char16_t *input,
+                                                   size_t length,
+                                                   char *utf8_buffer) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-convert_valid_utf32_to_utf16be(std::span<const char32_t> valid_utf32_input,
-                               std::span<char16_t> utf16_output) noexcept {
+convert_utf16le_to_utf8(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf32_to_utf16::convert_valid<endianness::BIG>(
-        valid_utf32_input.data(), valid_utf32_input.size(),
-        utf16_output.data());
+    return scalar::utf16_to_utf8::convert<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
   } else
     #endif
   {
-    return convert_valid_utf32_to_utf16be(valid_utf32_input.data(),
-                                          valid_utf32_input.size(),
-                                          utf16_output.data());
+    return convert_utf16le_to_utf8(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF16
 /**
- * Change the endianness of the input. Can be used to go from UTF-16LE to
- * UTF-16BE or from UTF-16BE to UTF-16LE.
+ * Convert possibly broken UTF-16BE string into UTF-8 string.
  *
- * This function does not validate the input.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16 string to process
+ * @param input         the UTF-16BE string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @param output        the pointer to a buffer that can hold the conversion
- * result
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16LE
+ * string
  */
-void change_endianness_utf16(const char16_t *input, size_t length,
-                             char16_t *output) noexcept;
+simdutf_warn_unused size_t convert_utf16be_to_utf8(const char16_t *input,
+                                                   size_t length,
+                                                   char *utf8_buffer) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_constexpr23 void
-change_endianness_utf16(std::span<const char16_t> utf16_input,
-                        std::span<char16_t> utf16_output) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf16be_to_utf8(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf16::change_endianness_utf16(
-        utf16_input.data(), utf16_input.size(), utf16_output.data());
+    return scalar::utf16_to_utf8::convert<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
   } else
     #endif
   {
-    return change_endianness_utf16(utf16_input.data(), utf16_input.size(),
-                                   utf16_output.data());
+    return convert_utf16be_to_utf8(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 /**
- * Compute the number of bytes that this UTF-32 string would require in UTF-8
- * format.
+ * Using native endianness, convert possibly broken UTF-16 string into Latin1
+ * string.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-32 strings but in such cases the result is implementation defined.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @return the number of bytes required to encode the UTF-32 string as UTF-8
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t utf8_length_from_utf32(const char32_t *input,
-                                                  size_t length) noexcept;
+simdutf_warn_unused result convert_utf16_to_latin1_with_errors(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf8_length_from_utf32(std::span<const char32_t> valid_utf32_input) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16_to_latin1_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf32::utf8_length_from_utf32(valid_utf32_input.data(),
-                                                 valid_utf32_input.size());
+    return scalar::utf16_to_latin1::convert_with_errors<endianness::NATIVE>(
+        utf16_input.data(), utf16_input.size(), latin1_output.data());
   } else
     #endif
   {
-    return utf8_length_from_utf32(valid_utf32_input.data(),
-                                  valid_utf32_input.size());
+    return convert_utf16_to_latin1_with_errors(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 /**
- * Compute the number of two-byte code units that this UTF-32 string would
- * require in UTF-16 format.
+ * Convert possibly broken UTF-16LE string into Latin1 string.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-32 strings but in such cases the result is implementation defined.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ * This function is not BOM-aware.
  *
- * @param input         the UTF-32 string to convert
- * @param length        the length of the string in 4-byte code units (char32_t)
- * @return the number of bytes required to encode the UTF-32 string as UTF-16
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t utf16_length_from_utf32(const char32_t *input,
-                                                   size_t length) noexcept;
+simdutf_warn_unused result convert_utf16le_to_latin1_with_errors(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf16_length_from_utf32(std::span<const char32_t> valid_utf32_input) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16le_to_latin1_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf32::utf16_length_from_utf32(valid_utf32_input.data(),
-                                                  valid_utf32_input.size());
+    return scalar::utf16_to_latin1::convert_with_errors<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), latin1_output.data());
   } else
     #endif
   {
-    return utf16_length_from_utf32(valid_utf32_input.data(),
-                                   valid_utf32_input.size());
+    return convert_utf16le_to_latin1_with_errors(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Using native endianness; Compute the number of bytes that this UTF-16
- * string would require in UTF-32 format.
- *
- * This function is equivalent to count_utf16.
- *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-16 strings but in such cases the result is implementation defined.
+ * Convert possibly broken UTF-16BE string into Latin1 string.
+ * If the string cannot be represented as Latin1, an error
+ * is returned.
  *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16 string to convert
+ * @param input         the UTF-16BE string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return the number of bytes required to encode the UTF-16LE string as UTF-32
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t utf32_length_from_utf16(const char16_t *input,
-                                                   size_t length) noexcept;
+simdutf_warn_unused result convert_utf16be_to_latin1_with_errors(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf32_length_from_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16be_to_latin1_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf16::utf32_length_from_utf16<endianness::NATIVE>(
-        valid_utf16_input.data(), valid_utf16_input.size());
+    return scalar::utf16_to_latin1::convert_with_errors<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), latin1_output.data());
   } else
     #endif
   {
-    return utf32_length_from_utf16(valid_utf16_input.data(),
-                                   valid_utf16_input.size());
+    return convert_utf16be_to_latin1_with_errors(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Compute the number of bytes that this UTF-16LE string would require in UTF-32
- * format.
+ * Using native endianness, convert possibly broken UTF-16 string into UTF-8
+ * string and stop on error.
  *
- * This function is equivalent to count_utf16le.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-16 strings but in such cases the result is implementation defined.
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16_to_utf8_with_errors(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16_to_utf8_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf8::convert_with_errors<endianness::NATIVE>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16_to_utf8_with_errors(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16LE string into UTF-8 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
  * This function is not BOM-aware.
  *
  * @param input         the UTF-16LE string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return the number of bytes required to encode the UTF-16LE string as UTF-32
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
  */
-simdutf_warn_unused size_t utf32_length_from_utf16le(const char16_t *input,
-                                                     size_t length) noexcept;
+simdutf_warn_unused result convert_utf16le_to_utf8_with_errors(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf32_length_from_utf16le(
-    std::span<const char16_t> valid_utf16_input) noexcept {
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16le_to_utf8_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf16::utf32_length_from_utf16<endianness::LITTLE>(
-        valid_utf16_input.data(), valid_utf16_input.size());
+    return scalar::utf16_to_utf8::convert_with_errors<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
   } else
     #endif
   {
-    return utf32_length_from_utf16le(valid_utf16_input.data(),
-                                     valid_utf16_input.size());
+    return convert_utf16le_to_utf8_with_errors(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Compute the number of bytes that this UTF-16BE string would require in UTF-32
- * format.
+ * Convert possibly broken UTF-16BE string into UTF-8 string and stop on error.
  *
- * This function is equivalent to count_utf16be.
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
  *
- * This function does not validate the input. It is acceptable to pass invalid
- * UTF-16 strings but in such cases the result is implementation defined.
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16be_to_utf8_with_errors(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16be_to_utf8_with_errors(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf8::convert_with_errors<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16be_to_utf8_with_errors(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16LE string into UTF-8 string, replacing
+ * unpaired surrogates with the Unicode replacement character U+FFFD.
+ *
+ * This function always succeeds: unpaired surrogates are replaced with
+ * U+FFFD (3 bytes in UTF-8: 0xEF 0xBF 0xBD).
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units
+ */
+simdutf_warn_unused size_t convert_utf16le_to_utf8_with_replacement(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf16le_to_utf8_with_replacement(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf8::convert_with_replacement<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16le_to_utf8_with_replacement(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16BE string into UTF-8 string, replacing
+ * unpaired surrogates with the Unicode replacement character U+FFFD.
+ *
+ * This function always succeeds: unpaired surrogates are replaced with
+ * U+FFFD (3 bytes in UTF-8: 0xEF 0xBF 0xBD).
  *
  * This function is not BOM-aware.
  *
  * @param input         the UTF-16BE string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return the number of bytes required to encode the UTF-16BE string as UTF-32
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units
  */
-simdutf_warn_unused size_t utf32_length_from_utf16be(const char16_t *input,
-                                                     size_t length) noexcept;
+simdutf_warn_unused size_t convert_utf16be_to_utf8_with_replacement(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-utf32_length_from_utf16be(
-    std::span<const char16_t> valid_utf16_input) noexcept {
+convert_utf16be_to_utf8_with_replacement(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf16::utf32_length_from_utf16<endianness::BIG>(
-        valid_utf16_input.data(), valid_utf16_input.size());
+    return scalar::utf16_to_utf8::convert_with_replacement<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
   } else
     #endif
   {
-    return utf32_length_from_utf16be(valid_utf16_input.data(),
-                                     valid_utf16_input.size());
+    return convert_utf16be_to_utf8_with_replacement(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF16
 /**
- * Count the number of code points (characters) in the string assuming that
- * it is valid.
+ * Convert possibly broken UTF-16 string (native endianness) into UTF-8 string,
+ * replacing unpaired surrogates with the Unicode replacement character U+FFFD.
  *
- * This function assumes that the input string is valid UTF-16 (native
- * endianness). It is acceptable to pass invalid UTF-16 strings but in such
- * cases the result is implementation defined.
+ * This function always succeeds: unpaired surrogates are replaced with
+ * U+FFFD (3 bytes in UTF-8: 0xEF 0xBF 0xBD).
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16 string to process
+ * @param input         the UTF-16 string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return number of code points
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units
  */
-simdutf_warn_unused size_t count_utf16(const char16_t *input,
-                                       size_t length) noexcept;
+simdutf_warn_unused size_t convert_utf16_to_utf8_with_replacement(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
   #if SIMDUTF_SPAN
 simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-count_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
+convert_utf16_to_utf8_with_replacement(
+    std::span<const char16_t> utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
     #if SIMDUTF_CPLUSPLUS23
   if consteval {
-    return scalar::utf16::count_code_points<endianness::NATIVE>(
-        valid_utf16_input.data(), valid_utf16_input.size());
+    return scalar::utf16_to_utf8::convert_with_replacement<endianness::NATIVE>(
+        utf16_input.data(), utf16_input.size(), utf8_output.data());
   } else
     #endif
   {
-    return count_utf16(valid_utf16_input.data(), valid_utf16_input.size());
+    return convert_utf16_to_utf8_with_replacement(
+        utf16_input.data(), utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
   }
 }
   #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 /**
- * Count the number of code points (characters) in the string assuming that
- * it is valid.
+ * Using native endianness, convert valid UTF-16 string into UTF-8 string.
  *
- * This function assumes that the input string is valid UTF-16LE.
- * It is acceptable to pass invalid UTF-16 strings but in such cases
- * the result is implementation defined.
+ * This function assumes that the input string is valid UTF-16.
  *
  * This function is not BOM-aware.
  *
- * @param input         the UTF-16LE string to process
+ * @param input         the UTF-16 string to convert
  * @param length        the length of the string in 2-byte code units (char16_t)
- * @return number of code points
+ * @param utf8_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16_to_utf8(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16_to_utf8(
+    std::span<const char16_t> valid_utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf8::convert_valid<endianness::NATIVE>(
+        valid_utf16_input.data(), valid_utf16_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf16_to_utf8(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+/**
+ * Using native endianness, convert UTF-16 string into Latin1 string.
+ *
+ * This function assumes that the input string is valid UTF-16 and that it can
+ * be represented as Latin1. If you violate this assumption, the result is
+ * implementation defined and may include system-dependent behavior such as
+ * crashes.
+ *
+ * This function is for expert users only and not part of our public API. Use
+ * convert_utf16_to_latin1 instead. The function may be removed from the library
+ * in the future.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16_to_latin1(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16_to_latin1(
+    std::span<const char16_t> valid_utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_latin1::convert_valid_impl<endianness::NATIVE>(
+        detail::constexpr_cast_ptr<uint16_t>(valid_utf16_input.data()),
+        valid_utf16_input.size(),
+        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
+  } else
+    #endif
+  {
+    return convert_valid_utf16_to_latin1(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16LE string into Latin1 string.
+ *
+ * This function assumes that the input string is valid UTF-16LE and that it can
+ * be represented as Latin1. If you violate this assumption, the result is
+ * implementation defined and may include system-dependent behavior such as
+ * crashes.
+ *
+ * This function is for expert users only and not part of our public API. Use
+ * convert_utf16le_to_latin1 instead. The function may be removed from the
+ * library in the future.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16le_to_latin1(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
+convert_valid_utf16le_to_latin1(
+    std::span<const char16_t> valid_utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_latin1::convert_valid_impl<endianness::LITTLE>(
+        detail::constexpr_cast_ptr<uint16_t>(valid_utf16_input.data()),
+        valid_utf16_input.size(),
+        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
+  } else
+    #endif
+  {
+    return convert_valid_utf16le_to_latin1(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16BE string into Latin1 string.
+ *
+ * This function assumes that the input string is valid UTF-16BE and that it can
+ * be represented as Latin1. If you violate this assumption, the result is
+ * implementation defined and may include system-dependent behavior such as
+ * crashes.
+ *
+ * This function is for expert users only and not part of our public API. Use
+ * convert_utf16be_to_latin1 instead. The function may be removed from the
+ * library in the future.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16be_to_latin1(
+    const char16_t *input, size_t length, char *latin1_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
+convert_valid_utf16be_to_latin1(
+    std::span<const char16_t> valid_utf16_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_latin1::convert_valid_impl<endianness::BIG>(
+        detail::constexpr_cast_ptr<uint16_t>(valid_utf16_input.data()),
+        valid_utf16_input.size(),
+        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
+  } else
+    #endif
+  {
+    return convert_valid_utf16be_to_latin1(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Convert valid UTF-16LE string into UTF-8 string.
+ *
+ * This function assumes that the input string is valid UTF-16LE
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf8_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16le_to_utf8(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16le_to_utf8(
+    std::span<const char16_t> valid_utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf8::convert_valid<endianness::NATIVE>(
+        valid_utf16_input.data(), valid_utf16_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf16le_to_utf8(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16BE string into UTF-8 string.
+ *
+ * This function assumes that the input string is valid UTF-16BE.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf8_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16be_to_utf8(
+    const char16_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16be_to_utf8(
+    std::span<const char16_t> valid_utf16_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf8::convert_valid<endianness::BIG>(
+        valid_utf16_input.data(), valid_utf16_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf16be_to_utf8(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+/**
+ * Using native endianness, convert possibly broken UTF-16 string into UTF-32
+ * string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16LE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf16_to_utf32(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf16_to_utf32(std::span<const char16_t> utf16_input,
+                       std::span<char32_t> utf32_output) noexcept {
+
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert<endianness::NATIVE>(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16_to_utf32(utf16_input.data(), utf16_input.size(),
+                                  utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16LE string into UTF-32 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16LE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf16le_to_utf32(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf16le_to_utf32(std::span<const char16_t> utf16_input,
+                         std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16le_to_utf32(utf16_input.data(), utf16_input.size(),
+                                    utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16BE string into UTF-32 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-16LE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf16be_to_utf32(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf16be_to_utf32(std::span<const char16_t> utf16_input,
+                         std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16be_to_utf32(utf16_input.data(), utf16_input.size(),
+                                    utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Using native endianness, convert possibly broken UTF-16 string into
+ * UTF-32 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16_to_utf32_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16_to_utf32_with_errors(std::span<const char16_t> utf16_input,
+                                   std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert_with_errors<endianness::NATIVE>(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16_to_utf32_with_errors(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16LE string into UTF-32 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16le_to_utf32_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16le_to_utf32_with_errors(
+    std::span<const char16_t> utf16_input,
+    std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert_with_errors<endianness::LITTLE>(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16le_to_utf32_with_errors(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16BE string into UTF-32 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16be_to_utf32_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf16be_to_utf32_with_errors(
+    std::span<const char16_t> utf16_input,
+    std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert_with_errors<endianness::BIG>(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_utf16be_to_utf32_with_errors(
+        utf16_input.data(), utf16_input.size(), utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Using native endianness, convert valid UTF-16 string into UTF-32 string.
+ *
+ * This function assumes that the input string is valid UTF-16 (native
+ * endianness).
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16_to_utf32(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16_to_utf32(std::span<const char16_t> valid_utf16_input,
+                             std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert_valid<endianness::NATIVE>(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf16_to_utf32(valid_utf16_input.data(),
+                                        valid_utf16_input.size(),
+                                        utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16LE string into UTF-32 string.
+ *
+ * This function assumes that the input string is valid UTF-16LE.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16le_to_utf32(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16le_to_utf32(std::span<const char16_t> valid_utf16_input,
+                               std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert_valid<endianness::LITTLE>(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf16le_to_utf32(valid_utf16_input.data(),
+                                          valid_utf16_input.size(),
+                                          utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16BE string into UTF-32 string.
+ *
+ * This function assumes that the input string is valid UTF-16LE.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16be_to_utf32(
+    const char16_t *input, size_t length, char32_t *utf32_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf16be_to_utf32(std::span<const char16_t> valid_utf16_input,
+                               std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16_to_utf32::convert_valid<endianness::BIG>(
+        valid_utf16_input.data(), valid_utf16_input.size(),
+        utf32_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf16be_to_utf32(valid_utf16_input.data(),
+                                          valid_utf16_input.size(),
+                                          utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Using native endianness; Compute the number of bytes that this UTF-16
+ * string would require in UTF-8 format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-16 strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16LE string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_utf16(const char16_t *input,
+                                                  size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf8_length_from_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf8_length_from_utf16<endianness::NATIVE>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf8_length_from_utf16(valid_utf16_input.data(),
+                                  valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Using native endianness; compute the number of bytes that this UTF-16
+ * string would require in UTF-8 format even when the UTF-16LE content contains
+ * mismatched surrogates that have to be replaced by the replacement character
+ * (0xFFFD).
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) where the count is the number of bytes required to
+ * encode the UTF-16 string as UTF-8, and the error code is either SUCCESS or
+ * SURROGATE. The count is correct regardless of the error field.
+ * When SURROGATE is returned, it does not indicate an error in the case of this
+ * function: it indicates that at least one surrogate has been encountered: the
+ * surrogates may be matched or not (thus this function does not validate). If
+ * the returned error code is SUCCESS, then the input contains no surrogate, is
+ * in the Basic Multilingual Plane, and is necessarily valid.
+ */
+simdutf_warn_unused result utf8_length_from_utf16_with_replacement(
+    const char16_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+utf8_length_from_utf16_with_replacement(
+    std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf8_length_from_utf16_with_replacement<
+        endianness::NATIVE>(valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf8_length_from_utf16_with_replacement(valid_utf16_input.data(),
+                                                   valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-16LE string would require in UTF-8
+ * format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-16 strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16LE string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_utf16le(const char16_t *input,
+                                                    size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
+utf8_length_from_utf16le(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf8_length_from_utf16<endianness::LITTLE>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf8_length_from_utf16le(valid_utf16_input.data(),
+                                    valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-16BE string would require in UTF-8
+ * format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-16 strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16BE string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_utf16be(const char16_t *input,
+                                                    size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf8_length_from_utf16be(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf8_length_from_utf16<endianness::BIG>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf8_length_from_utf16be(valid_utf16_input.data(),
+                                    valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+/**
+ * Convert possibly broken UTF-32 string into UTF-8 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-32 string
+ */
+simdutf_warn_unused size_t convert_utf32_to_utf8(const char32_t *input,
+                                                 size_t length,
+                                                 char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf32_to_utf8(
+    std::span<const char32_t> utf32_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf8::convert(
+        utf32_input.data(), utf32_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf8(utf32_input.data(), utf32_input.size(),
+                                 reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32 string into UTF-8 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32_to_utf8_with_errors(
+    const char32_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf32_to_utf8_with_errors(
+    std::span<const char32_t> utf32_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf8::convert_with_errors(
+        utf32_input.data(), utf32_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf8_with_errors(
+        utf32_input.data(), utf32_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32 string into UTF-8 string.
+ *
+ * This function assumes that the input string is valid UTF-32.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32_to_utf8(
+    const char32_t *input, size_t length, char *utf8_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf32_to_utf8(
+    std::span<const char32_t> valid_utf32_input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf8::convert_valid(
+        valid_utf32_input.data(), valid_utf32_input.size(), utf8_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf32_to_utf8(
+        valid_utf32_input.data(), valid_utf32_input.size(),
+        reinterpret_cast<char *>(utf8_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+/**
+ * Using native endianness, convert possibly broken UTF-32 string into a UTF-16
+ * string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-32 string
+ */
+simdutf_warn_unused size_t convert_utf32_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf32_to_utf16(std::span<const char32_t> utf32_input,
+                       std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert<endianness::NATIVE>(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf16(utf32_input.data(), utf32_input.size(),
+                                  utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32 string into UTF-16LE string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-32 string
+ */
+simdutf_warn_unused size_t convert_utf32_to_utf16le(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf32_to_utf16le(std::span<const char32_t> utf32_input,
+                         std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert<endianness::LITTLE>(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf16le(utf32_input.data(), utf32_input.size(),
+                                    utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+/**
+ * Convert possibly broken UTF-32 string into Latin1 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-32 string
+ * or if it cannot be represented as Latin1
+ */
+simdutf_warn_unused size_t convert_utf32_to_latin1(
+    const char32_t *input, size_t length, char *latin1_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf32_to_latin1(
+    std::span<const char32_t> utf32_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_latin1::convert(
+        utf32_input.data(), utf32_input.size(), latin1_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_latin1(
+        utf32_input.data(), utf32_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32 string into Latin1 string and stop on error.
+ * If the string cannot be represented as Latin1, an error is returned.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param latin1_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32_to_latin1_with_errors(
+    const char32_t *input, size_t length, char *latin1_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf32_to_latin1_with_errors(
+    std::span<const char32_t> utf32_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_latin1::convert_with_errors(
+        utf32_input.data(), utf32_input.size(), latin1_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_latin1_with_errors(
+        utf32_input.data(), utf32_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32 string into Latin1 string.
+ *
+ * This function assumes that the input string is valid UTF-32 and that it can
+ * be represented as Latin1. If you violate this assumption, the result is
+ * implementation defined and may include system-dependent behavior such as
+ * crashes.
+ *
+ * This function is for expert users only and not part of our public API. Use
+ * convert_utf32_to_latin1 instead. The function may be removed from the library
+ * in the future.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param latin1_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32_to_latin1(
+    const char32_t *input, size_t length, char *latin1_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_constexpr23 simdutf_warn_unused size_t
+convert_valid_utf32_to_latin1(
+    std::span<const char32_t> valid_utf32_input,
+    detail::output_span_of_byte_like auto &&latin1_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_latin1::convert_valid(
+        detail::constexpr_cast_ptr<uint32_t>(valid_utf32_input.data()),
+        valid_utf32_input.size(),
+        detail::constexpr_cast_writeptr<char>(latin1_output.data()));
+  }
+    #endif
+  {
+    return convert_valid_utf32_to_latin1(
+        valid_utf32_input.data(), valid_utf32_input.size(),
+        reinterpret_cast<char *>(latin1_output.data()));
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-32 string would require in Latin1
+ * format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32 strings but in such cases the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of bytes required to encode the UTF-32 string as Latin1
+ */
+simdutf_warn_unused simdutf_really_inline simdutf_constexpr23 size_t
+latin1_length_from_utf32(size_t length) noexcept {
+  return length;
+}
+
+/**
+ * Compute the number of bytes that this Latin1 string would require in UTF-32
+ * format.
+ *
+ * @param length        the length of the string in Latin1 code units (char)
+ * @return the length of the string in 4-byte code units (char32_t) required to
+ * encode the Latin1 string as UTF-32
+ */
+simdutf_warn_unused simdutf_really_inline simdutf_constexpr23 size_t
+utf32_length_from_latin1(size_t length) noexcept {
+  return length;
+}
+#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+/**
+ * Convert possibly broken UTF-32 string into UTF-16BE string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @return number of written code units; 0 if input is not a valid UTF-32 string
+ */
+simdutf_warn_unused size_t convert_utf32_to_utf16be(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_utf32_to_utf16be(std::span<const char32_t> utf32_input,
+                         std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert<endianness::BIG>(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf16be(utf32_input.data(), utf32_input.size(),
+                                    utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Using native endianness, convert possibly broken UTF-32 string into UTF-16
+ * string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32_to_utf16_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf32_to_utf16_with_errors(std::span<const char32_t> utf32_input,
+                                   std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert_with_errors<endianness::NATIVE>(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf16_with_errors(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32 string into UTF-16LE string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32_to_utf16le_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf32_to_utf16le_with_errors(
+    std::span<const char32_t> utf32_input,
+    std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert_with_errors<endianness::LITTLE>(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf16le_with_errors(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32 string into UTF-16BE string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to buffer that can hold conversion result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32_to_utf16be_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 result
+convert_utf32_to_utf16be_with_errors(
+    std::span<const char32_t> utf32_input,
+    std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert_with_errors<endianness::BIG>(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_utf32_to_utf16be_with_errors(
+        utf32_input.data(), utf32_input.size(), utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Using native endianness, convert valid UTF-32 string into a UTF-16 string.
+ *
+ * This function assumes that the input string is valid UTF-32.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf32_to_utf16(std::span<const char32_t> valid_utf32_input,
+                             std::span<char16_t> utf16_output) noexcept {
+
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert_valid<endianness::NATIVE>(
+        valid_utf32_input.data(), valid_utf32_input.size(),
+        utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf32_to_utf16(valid_utf32_input.data(),
+                                        valid_utf32_input.size(),
+                                        utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32 string into UTF-16LE string.
+ *
+ * This function assumes that the input string is valid UTF-32.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32_to_utf16le(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf32_to_utf16le(std::span<const char32_t> valid_utf32_input,
+                               std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert_valid<endianness::LITTLE>(
+        valid_utf32_input.data(), valid_utf32_input.size(),
+        utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf32_to_utf16le(valid_utf32_input.data(),
+                                          valid_utf32_input.size(),
+                                          utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32 string into UTF-16BE string.
+ *
+ * This function assumes that the input string is valid UTF-32.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_buffer   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32_to_utf16be(
+    const char32_t *input, size_t length, char16_t *utf16_buffer) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+convert_valid_utf32_to_utf16be(std::span<const char32_t> valid_utf32_input,
+                               std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32_to_utf16::convert_valid<endianness::BIG>(
+        valid_utf32_input.data(), valid_utf32_input.size(),
+        utf16_output.data());
+  } else
+    #endif
+  {
+    return convert_valid_utf32_to_utf16be(valid_utf32_input.data(),
+                                          valid_utf32_input.size(),
+                                          utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16
+/**
+ * Change the endianness of the input. Can be used to go from UTF-16LE to
+ * UTF-16BE or from UTF-16BE to UTF-16LE.
+ *
+ * This function does not validate the input.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to process
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result
+ */
+void change_endianness_utf16(const char16_t *input, size_t length,
+                             char16_t *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_constexpr23 void
+change_endianness_utf16(std::span<const char16_t> utf16_input,
+                        std::span<char16_t> utf16_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::change_endianness_utf16(
+        utf16_input.data(), utf16_input.size(), utf16_output.data());
+  } else
+    #endif
+  {
+    return change_endianness_utf16(utf16_input.data(), utf16_input.size(),
+                                   utf16_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF32
+/**
+ * Change the endianness of the input. Can be used to go from UTF-32LE to
+ * UTF-32BE or from UTF-32BE to UTF-32LE.
+ *
+ * This function does not validate the input.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32 string to process
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result
+ */
+void change_endianness_utf32(const char32_t *input, size_t length,
+                             char32_t *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_constexpr23 void
+change_endianness_utf32(std::span<const char32_t> utf32_input,
+                        std::span<char32_t> utf32_output) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32::change_endianness_utf32(
+        utf32_input.data(), utf32_input.size(), utf32_output.data());
+  } else
+    #endif
+  {
+    return change_endianness_utf32(utf32_input.data(), utf32_input.size(),
+                                   utf32_output.data());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-32LE string. The input is byte-swapped block by block as
+ * needed and validated with validate_utf32.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param buf the UTF-32LE string to validate.
+ * @param len the length of the string in number of 4-byte code units
+ * (char32_t).
+ * @return true if and only if the string is valid UTF-32LE.
+ */
+simdutf_warn_unused bool validate_utf32le(
+    const char32_t *buf, size_t len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused bool
+validate_utf32le(std::span<const char32_t> input) noexcept {
+  return validate_utf32le(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-32LE string and stop on error.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param buf the UTF-32LE string to validate.
+ * @param len the length of the string in number of 4-byte code units
+ * (char32_t).
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of code units validated if
+ * successful.
+ */
+simdutf_warn_unused result validate_utf32le_with_errors(
+    const char32_t *buf, size_t len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+validate_utf32le_with_errors(std::span<const char32_t> input) noexcept {
+  return validate_utf32le_with_errors(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-32BE string. The input is byte-swapped block by block as
+ * needed and validated with validate_utf32.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param buf the UTF-32BE string to validate.
+ * @param len the length of the string in number of 4-byte code units
+ * (char32_t).
+ * @return true if and only if the string is valid UTF-32BE.
+ */
+simdutf_warn_unused bool validate_utf32be(
+    const char32_t *buf, size_t len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused bool
+validate_utf32be(std::span<const char32_t> input) noexcept {
+  return validate_utf32be(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-32BE string and stop on error.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param buf the UTF-32BE string to validate.
+ * @param len the length of the string in number of 4-byte code units
+ * (char32_t).
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of code units validated if
+ * successful.
+ */
+simdutf_warn_unused result validate_utf32be_with_errors(
+    const char32_t *buf, size_t len) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+validate_utf32be_with_errors(std::span<const char32_t> input) noexcept {
+  return validate_utf32be_with_errors(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+/**
+ * Compute the number of bytes that this UTF-32LE string would require in UTF-8
+ * format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32LE strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of bytes required to encode the UTF-32LE string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_utf32le(
+    const char32_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+utf8_length_from_utf32le(std::span<const char32_t> input) noexcept {
+  return utf8_length_from_utf32le(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32LE string into UTF-8 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_output   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if input is not a valid UTF-32LE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf32le_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf32le_to_utf8(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_utf32le_to_utf8(input.data(), input.size(),
+                                 reinterpret_cast<char *>(utf8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32LE string into UTF-8 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_output   the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of bytes written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32le_to_utf8_with_errors(
+    const char32_t *input, size_t length, char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32le_to_utf8_with_errors(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_utf32le_to_utf8_with_errors(
+      input.data(), input.size(), reinterpret_cast<char *>(utf8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32LE string into UTF-8 string.
+ *
+ * This function assumes that the input string is valid UTF-32LE.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_output   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32le_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf32le_to_utf8(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_valid_utf32le_to_utf8(
+      input.data(), input.size(), reinterpret_cast<char *>(utf8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into UTF-32LE string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if the input was not valid
+ * UTF-8 string
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf32le(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf8_to_utf32le(const detail::input_span_of_byte_like auto &utf8_input,
+                        std::span<char32_t> utf32_output) noexcept {
+  return convert_utf8_to_utf32le(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into UTF-32LE string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf32le_with_errors(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_utf32le_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_utf8_to_utf32le_with_errors(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-8 string into UTF-32LE string.
+ *
+ * This function assumes that the input string is valid UTF-8.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf8_to_utf32le(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf8_to_utf32le(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_valid_utf8_to_utf32le(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-32BE string would require in UTF-8
+ * format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32BE strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of bytes required to encode the UTF-32BE string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_utf32be(
+    const char32_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+utf8_length_from_utf32be(std::span<const char32_t> input) noexcept {
+  return utf8_length_from_utf32be(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32BE string into UTF-8 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_output   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if input is not a valid UTF-32BE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf32be_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf32be_to_utf8(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_utf32be_to_utf8(input.data(), input.size(),
+                                 reinterpret_cast<char *>(utf8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32BE string into UTF-8 string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_output   the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of bytes written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32be_to_utf8_with_errors(
+    const char32_t *input, size_t length, char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32be_to_utf8_with_errors(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_utf32be_to_utf8_with_errors(
+      input.data(), input.size(), reinterpret_cast<char *>(utf8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32BE string into UTF-8 string.
+ *
+ * This function assumes that the input string is valid UTF-32BE.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf8_output   the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32be_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf32be_to_utf8(
+    std::span<const char32_t> input,
+    detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+  return convert_valid_utf32be_to_utf8(
+      input.data(), input.size(), reinterpret_cast<char *>(utf8_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into UTF-32BE string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if the input was not valid
+ * UTF-8 string
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf32be(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf8_to_utf32be(const detail::input_span_of_byte_like auto &utf8_input,
+                        std::span<char32_t> utf32_output) noexcept {
+  return convert_utf8_to_utf32be(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-8 string into UTF-32BE string and stop on error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf32be_with_errors(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_utf32be_with_errors(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_utf8_to_utf32be_with_errors(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-8 string into UTF-32BE string.
+ *
+ * This function assumes that the input string is valid UTF-8.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf8_to_utf32be(
+    const char *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf8_to_utf32be(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_valid_utf8_to_utf32be(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+/**
+ * Compute the number of 16-bit code units that this UTF-32LE string would
+ * require in UTF-16 format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32LE strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of 16-bit code units required to encode the UTF-32LE
+ * string as UTF-16
+ */
+simdutf_warn_unused size_t utf16_length_from_utf32le(
+    const char32_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+utf16_length_from_utf32le(std::span<const char32_t> input) noexcept {
+  return utf16_length_from_utf32le(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32LE string into UTF-16 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 output has the native endianness.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if input is not a valid UTF-32LE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf32le_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf32le_to_utf16(std::span<const char32_t> input,
+                         std::span<char16_t> utf16_output) noexcept {
+  return convert_utf32le_to_utf16(input.data(), input.size(),
+                                  utf16_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32LE string into UTF-16 string and stop on
+ * error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 output has the native endianness.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32le_to_utf16_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32le_to_utf16_with_errors(
+    std::span<const char32_t> input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_utf32le_to_utf16_with_errors(input.data(), input.size(),
+                                              utf16_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32LE string into UTF-16 string.
+ *
+ * This function assumes that the input string is valid UTF-32LE.
+ *
+ * The UTF-16 output has the native endianness.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32LE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32le_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf32le_to_utf16(std::span<const char32_t> input,
+                               std::span<char16_t> utf16_output) noexcept {
+  return convert_valid_utf32le_to_utf16(input.data(), input.size(),
+                                        utf16_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16 string into UTF-32LE string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 input has the native endianness.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if the input was not valid
+ * UTF-16 string
+ */
+simdutf_warn_unused size_t convert_utf16_to_utf32le(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf16_to_utf32le(std::span<const char16_t> utf16_input,
+                         std::span<char32_t> utf32_output) noexcept {
+  return convert_utf16_to_utf32le(utf16_input.data(), utf16_input.size(),
+                                  utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16 string into UTF-32LE string and stop on
+ * error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 input has the native endianness.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16_to_utf32le_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_utf32le_with_errors(
+    std::span<const char16_t> utf16_input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_utf16_to_utf32le_with_errors(utf16_input.data(),
+                                              utf16_input.size(),
+                                              utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16 string into UTF-32LE string.
+ *
+ * This function assumes that the input string is valid UTF-16.
+ *
+ * The UTF-16 input has the native endianness.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16_to_utf32le(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf16_to_utf32le(std::span<const char16_t> utf16_input,
+                               std::span<char32_t> utf32_output) noexcept {
+  return convert_valid_utf16_to_utf32le(utf16_input.data(), utf16_input.size(),
+                                        utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of 16-bit code units that this UTF-32BE string would
+ * require in UTF-16 format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32BE strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of 16-bit code units required to encode the UTF-32BE
+ * string as UTF-16
+ */
+simdutf_warn_unused size_t utf16_length_from_utf32be(
+    const char32_t *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+utf16_length_from_utf32be(std::span<const char32_t> input) noexcept {
+  return utf16_length_from_utf32be(input.data(), input.size());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32BE string into UTF-16 string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 output has the native endianness.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if input is not a valid UTF-32BE
+ * string
+ */
+simdutf_warn_unused size_t convert_utf32be_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf32be_to_utf16(std::span<const char32_t> input,
+                         std::span<char16_t> utf16_output) noexcept {
+  return convert_utf32be_to_utf16(input.data(), input.size(),
+                                  utf16_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-32BE string into UTF-16 string and stop on
+ * error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 output has the native endianness.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32be_to_utf16_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32be_to_utf16_with_errors(
+    std::span<const char32_t> input,
+    std::span<char16_t> utf16_output) noexcept {
+  return convert_utf32be_to_utf16_with_errors(input.data(), input.size(),
+                                              utf16_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-32BE string into UTF-16 string.
+ *
+ * This function assumes that the input string is valid UTF-32BE.
+ *
+ * The UTF-16 output has the native endianness.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-32BE string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @param utf16_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return number of written code units; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf32be_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf32be_to_utf16(std::span<const char32_t> input,
+                               std::span<char16_t> utf16_output) noexcept {
+  return convert_valid_utf32be_to_utf16(input.data(), input.size(),
+                                        utf16_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16 string into UTF-32BE string.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 input has the native endianness.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if the input was not valid
+ * UTF-16 string
+ */
+simdutf_warn_unused size_t convert_utf16_to_utf32be(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_utf16_to_utf32be(std::span<const char16_t> utf16_input,
+                         std::span<char32_t> utf32_output) noexcept {
+  return convert_utf16_to_utf32be(utf16_input.data(), utf16_input.size(),
+                                  utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert possibly broken UTF-16 string into UTF-32BE string and stop on
+ * error.
+ *
+ * During the conversion also validation of the input string is done.
+ * This function is suitable to work with inputs from untrusted sources.
+ *
+ * The UTF-16 input has the native endianness.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16_to_utf32be_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_utf32be_with_errors(
+    std::span<const char16_t> utf16_input,
+    std::span<char32_t> utf32_output) noexcept {
+  return convert_utf16_to_utf32be_with_errors(utf16_input.data(),
+                                              utf16_input.size(),
+                                              utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert valid UTF-16 string into UTF-32BE string.
+ *
+ * This function assumes that the input string is valid UTF-16.
+ *
+ * The UTF-16 input has the native endianness.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @param utf32_output  the pointer to a buffer that can hold the conversion
+ * result
+ * @return the number of written char32_t; 0 if conversion is not possible
+ */
+simdutf_warn_unused size_t convert_valid_utf16_to_utf32be(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+convert_valid_utf16_to_utf32be(std::span<const char16_t> utf16_input,
+                               std::span<char32_t> utf32_output) noexcept {
+  return convert_valid_utf16_to_utf32be(utf16_input.data(), utf16_input.size(),
+                                        utf32_output.data());
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+/**
+ * Compute the number of bytes that this UTF-32 string would require in UTF-8
+ * format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32 strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of bytes required to encode the UTF-32 string as UTF-8
+ */
+simdutf_warn_unused size_t utf8_length_from_utf32(const char32_t *input,
+                                                  size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf8_length_from_utf32(std::span<const char32_t> valid_utf32_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32::utf8_length_from_utf32(valid_utf32_input.data(),
+                                                 valid_utf32_input.size());
+  } else
+    #endif
+  {
+    return utf8_length_from_utf32(valid_utf32_input.data(),
+                                  valid_utf32_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+/**
+ * Compute the number of two-byte code units that this UTF-32 string would
+ * require in UTF-16 format.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-32 strings but in such cases the result is implementation defined.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in 4-byte code units (char32_t)
+ * @return the number of bytes required to encode the UTF-32 string as UTF-16
+ */
+simdutf_warn_unused size_t utf16_length_from_utf32(const char32_t *input,
+                                                   size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf16_length_from_utf32(std::span<const char32_t> valid_utf32_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf32::utf16_length_from_utf32(valid_utf32_input.data(),
+                                                  valid_utf32_input.size());
+  } else
+    #endif
+  {
+    return utf16_length_from_utf32(valid_utf32_input.data(),
+                                   valid_utf32_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Using native endianness; Compute the number of bytes that this UTF-16
+ * string would require in UTF-32 format.
+ *
+ * This function is equivalent to count_utf16.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-16 strings but in such cases the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16LE string as UTF-32
+ */
+simdutf_warn_unused size_t utf32_length_from_utf16(const char16_t *input,
+                                                   size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf32_length_from_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf32_length_from_utf16<endianness::NATIVE>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf32_length_from_utf16(valid_utf16_input.data(),
+                                   valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-16LE string would require in UTF-32
+ * format.
+ *
+ * This function is equivalent to count_utf16le.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-16 strings but in such cases the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16LE string as UTF-32
+ */
+simdutf_warn_unused size_t utf32_length_from_utf16le(const char16_t *input,
+                                                     size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf32_length_from_utf16le(
+    std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf32_length_from_utf16<endianness::LITTLE>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf32_length_from_utf16le(valid_utf16_input.data(),
+                                     valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Compute the number of bytes that this UTF-16BE string would require in UTF-32
+ * format.
+ *
+ * This function is equivalent to count_utf16be.
+ *
+ * This function does not validate the input. It is acceptable to pass invalid
+ * UTF-16 strings but in such cases the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return the number of bytes required to encode the UTF-16BE string as UTF-32
+ */
+simdutf_warn_unused size_t utf32_length_from_utf16be(const char16_t *input,
+                                                     size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+utf32_length_from_utf16be(
+    std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::utf32_length_from_utf16<endianness::BIG>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return utf32_length_from_utf16be(valid_utf16_input.data(),
+                                     valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16
+/**
+ * Count the number of code points (characters) in the string assuming that
+ * it is valid.
+ *
+ * This function assumes that the input string is valid UTF-16 (native
+ * endianness). It is acceptable to pass invalid UTF-16 strings but in such
+ * cases the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to process
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return number of code points
+ */
+simdutf_warn_unused size_t count_utf16(const char16_t *input,
+                                       size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+count_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::count_code_points<endianness::NATIVE>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return count_utf16(valid_utf16_input.data(), valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Count the number of code points (characters) in the string assuming that
+ * it is valid.
+ *
+ * This function assumes that the input string is valid UTF-16LE.
+ * It is acceptable to pass invalid UTF-16 strings but in such cases
+ * the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16LE string to process
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return number of code points
+ */
+simdutf_warn_unused size_t count_utf16le(const char16_t *input,
+                                         size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+count_utf16le(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::count_code_points<endianness::LITTLE>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return count_utf16le(valid_utf16_input.data(), valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Count the number of code points (characters) in the string assuming that
+ * it is valid.
+ *
+ * This function assumes that the input string is valid UTF-16BE.
+ * It is acceptable to pass invalid UTF-16 strings but in such cases
+ * the result is implementation defined.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16BE string to process
+ * @param length        the length of the string in 2-byte code units (char16_t)
+ * @return number of code points
+ */
+simdutf_warn_unused size_t count_utf16be(const char16_t *input,
+                                         size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+count_utf16be(std::span<const char16_t> valid_utf16_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf16::count_code_points<endianness::BIG>(
+        valid_utf16_input.data(), valid_utf16_input.size());
+  } else
+    #endif
+  {
+    return count_utf16be(valid_utf16_input.data(), valid_utf16_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Count the number of code points (characters) in the string assuming that
+ * it is valid.
+ *
+ * This function assumes that the input string is valid UTF-8.
+ * It is acceptable to pass invalid UTF-8 strings but in such cases
+ * the result is implementation defined.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return number of code points
+ */
+simdutf_warn_unused size_t count_utf8(const char *input,
+                                      size_t length) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t count_utf8(
+    const detail::input_span_of_byte_like auto &valid_utf8_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::count_code_points(valid_utf8_input.data(),
+                                           valid_utf8_input.size());
+  } else
+    #endif
+  {
+    return count_utf8(reinterpret_cast<const char *>(valid_utf8_input.data()),
+                      valid_utf8_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Given a valid UTF-8 string having a possibly truncated last character,
+ * this function checks the end of string. If the last character is truncated
+ * (or partial), then it returns a shorter length (shorter by 1 to 3 bytes) so
+ * that the short UTF-8 strings only contain complete characters. If there is no
+ * truncated character, the original length is returned.
+ *
+ * This function assumes that the input string is valid UTF-8, but possibly
+ * truncated.
+ *
+ * @param input         the UTF-8 string to process
+ * @param length        the length of the string in bytes
+ * @return the length of the string in bytes, possibly shorter by 1 to 3 bytes
+ */
+simdutf_warn_unused size_t trim_partial_utf8(const char *input, size_t length);
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
+trim_partial_utf8(
+    const detail::input_span_of_byte_like auto &valid_utf8_input) noexcept {
+    #if SIMDUTF_CPLUSPLUS23
+  if consteval {
+    return scalar::utf8::trim_partial_utf8(valid_utf8_input.data(),
+                                           valid_utf8_input.size());
+  } else
+    #endif
+  {
+    return trim_partial_utf8(
+        reinterpret_cast<const char *>(valid_utf8_input.data()),
+        valid_utf8_input.size());
+  }
+}
+  #endif // SIMDUTF_SPAN
+
+namespace detail {
+// State shared by the UTF-8 stream objects: the position in the stream, the
+// sticky error and the incomplete character left over by the last chunk.
+struct utf8_stream_state {
+  size_t validated{0}; // bytes of the stream before pending[0]
+  size_t error_position{0};
+  error_code error{error_code::SUCCESS};
+  uint8_t pending_length{0};
+  char pending[4]{};
+};
+} // namespace detail
+
+/**
+ * Incremental UTF-8 validator for inputs that arrive piece by piece (e.g., from
+ * a socket or a pipe). The chunks may be split anywhere, including in the
+ * middle of a multi-byte character.
+ *
+ * The validator carries at most three bytes (an incomplete character) from one
+ * chunk to the next. Everything else is validated in place by the active
+ * implementation, so each byte of the stream is read once and nothing needs to
+ * be buffered or copied by the caller.
+ *
+ * Error positions are absolute offsets in the stream: they are the positions
+ * that validate_utf8_with_errors would report if it were given the
+ * concatenation of all the chunks. Once an error is found, it is sticky: feed()
+ * and finish() keep returning it until reset() is called.
+ *
+ * Example:
+ *
+ *   simdutf::utf8_stream_validator validator;
+ *   while (size_t len = read_chunk(buffer, sizeof(buffer))) {
+ *     if (validator.feed(buffer, len).is_err()) { break; }
+ *   }
+ *   simdutf::result r = validator.finish();
+ */
+class utf8_stream_validator {
+public:
+  /**
+   * Validate the next chunk of the stream.
+   *
+   * An incomplete character at the end of the chunk is not an error: it is
+   * completed by the next chunk, or reported by finish().
+   *
+   * @param input the next chunk of the UTF-8 stream.
+   * @param length the length of the chunk in bytes.
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error in the stream if any, or the number of bytes of the stream made of
+   * complete, valid characters so far.
+   */
+  simdutf_warn_unused result feed(const char *input, size_t length) noexcept;
+  #if SIMDUTF_SPAN
+  simdutf_really_inline simdutf_warn_unused result
+  feed(const detail::input_span_of_byte_like auto &input) noexcept {
+    return feed(reinterpret_cast<const char *>(input.data()), input.size());
+  }
+  #endif // SIMDUTF_SPAN
+
+  /**
+   * Signal the end of the stream. A character truncated by the end of the
+   * stream is an error (TOO_SHORT) located at its leading byte.
+   *
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error in the stream if any, or the length of the stream in bytes if
+   * successful.
+   */
+  simdutf_warn_unused result finish() noexcept;
+
+  /**
+   * Forget everything about the current stream so that a new stream can be
+   * validated.
+   */
+  void reset() noexcept;
+
+private:
+  detail::utf8_stream_state state{};
+};
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Incremental UTF-8 to UTF-16 transcoder for inputs that arrive piece by piece.
+ * The chunks may be split anywhere, including in the middle of a multi-byte
+ * character: the incomplete character (at most three bytes) is carried over to
+ * the next chunk, and the rest of each chunk is transcoded by the active
+ * implementation.
+ *
+ * The input is validated. Once an error is found, it is sticky: convert() and
+ * finish() keep returning it until reset() is called.
+ *
+ * Example:
+ *
+ *   simdutf::utf8_to_utf16_stream stream(simdutf::endianness::LITTLE);
+ *   while (size_t len = read_chunk(buffer, sizeof(buffer))) {
+ *     simdutf::full_result r = stream.convert(buffer, len, utf16_buffer);
+ *     if (r.error != simdutf::SUCCESS) { break; }
+ *     write_utf16(utf16_buffer, r.output_count);
+ *   }
+ *   simdutf::result r = stream.finish();
+ */
+class utf8_to_utf16_stream {
+public:
+  /**
+   * @param utf16_endianness the byte order of the UTF-16 output (LITTLE, BIG,
+   * or NATIVE for the byte order of the system).
+   */
+  explicit utf8_to_utf16_stream(
+      endianness utf16_endianness = endianness::NATIVE) noexcept
+      : big_endian{utf16_endianness == endianness::BIG} {}
+
+  /**
+   * Transcode the next chunk of the stream.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input the next chunk of the UTF-8 stream.
+   * @param length the length of the chunk in bytes.
+   * @param utf16_output the pointer to a buffer that can hold at least
+   * length + 1 char16_t.
+   * @return a full_result struct (of type simdutf::full_result containing the
+   * three fields error, input_count and output_count). On success, input_count
+   * is length and output_count is the number of char16_t written. On error,
+   * input_count is the position of the error in the stream and output_count is
+   * the number of char16_t written for the characters of the chunk that precede
+   * the error.
+   */
+  simdutf_warn_unused full_result convert(const char *input, size_t length,
+                                          char16_t *utf16_output) noexcept;
+  #if SIMDUTF_SPAN
+  simdutf_really_inline simdutf_warn_unused full_result
+  convert(const detail::input_span_of_byte_like auto &input,
+          std::span<char16_t> utf16_output) noexcept {
+    return convert(reinterpret_cast<const char *>(input.data()), input.size(),
+                   utf16_output.data());
+  }
+  #endif // SIMDUTF_SPAN
+
+  /**
+   * Signal the end of the stream. A character truncated by the end of the
+   * stream is an error (TOO_SHORT) located at its leading byte.
+   *
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error in the stream if any, or the length of the stream in bytes if
+   * successful.
+   */
+  simdutf_warn_unused result finish() noexcept;
+
+  /**
+   * Forget everything about the current stream so that a new stream can be
+   * transcoded. The byte order of the output is kept.
+   */
+  void reset() noexcept;
+
+private:
+  detail::utf8_stream_state state{};
+  bool big_endian;
+};
+
+/**
+ * Incremental UTF-16 to UTF-8 transcoder for inputs that arrive piece by piece
+ * (e.g., from a named pipe or the chunks of a JavaScript string). A chunk may
+ * end with a high surrogate: it is held back until the next chunk provides the
+ * matching low surrogate. The rest of each chunk is transcoded by the active
+ * implementation.
+ *
+ * By default, unpaired surrogates are errors and, once an error is found, it is
+ * sticky: convert() and finish() keep returning it until reset() is called.
+ * With replace_invalid set, unpaired surrogates are replaced by U+FFFD as in
+ * convert_utf16_to_utf8_with_replacement, and the conversion never fails.
+ *
+ * Example:
+ *
+ *   simdutf::utf16_to_utf8_stream stream(simdutf::endianness::LITTLE);
+ *   while (size_t len = read_chunk(buffer, std::size(buffer))) {
+ *     simdutf::full_result r = stream.convert(buffer, len, utf8_buffer);
+ *     write_utf8(utf8_buffer, r.output_count);
+ *     if (r.error != simdutf::SUCCESS) { break; }
+ *   }
+ *   simdutf::full_result r = stream.finish(utf8_buffer);
+ */
+class utf16_to_utf8_stream {
+public:
+  /**
+   * @param utf16_endianness the byte order of the UTF-16 input (LITTLE, BIG,
+   * or NATIVE for the byte order of the system).
+   * @param replace_invalid whether to replace unpaired surrogates by U+FFFD
+   * instead of reporting an error.
+   */
+  explicit utf16_to_utf8_stream(
+      endianness utf16_endianness = endianness::NATIVE,
+      bool replace_invalid = false) noexcept
+      : big_endian{utf16_endianness == endianness::BIG},
+        replace{replace_invalid} {}
+
+  /**
+   * Transcode the next chunk of the stream.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input the next chunk of the UTF-16 stream.
+   * @param length the length of the chunk in 2-byte code units (char16_t).
+   * @param utf8_output the pointer to a buffer that can hold at least
+   * 3 * (length + 1) bytes.
+   * @return a full_result struct (of type simdutf::full_result containing the
+   * three fields error, input_count and output_count). On success, input_count
+   * is length and output_count is the number of bytes written. On error,
+   * input_count is the position of the error in the stream (in code units) and
+   * output_count is the number of bytes written for the characters of the
+   * chunk that precede the error.
+   */
+  simdutf_warn_unused full_result convert(const char16_t *input, size_t length,
+                                          char *utf8_output) noexcept;
+  #if SIMDUTF_SPAN
+  simdutf_really_inline simdutf_warn_unused full_result
+  convert(std::span<const char16_t> input,
+          detail::output_span_of_byte_like auto &&utf8_output) noexcept {
+    return convert(input.data(), input.size(),
+                   reinterpret_cast<char *>(utf8_output.data()));
+  }
+  #endif // SIMDUTF_SPAN
+
+  /**
+   * Signal the end of the stream. A high surrogate at the end of the stream is
+   * unpaired: it is an error (SURROGATE) located at the surrogate or, with
+   * replace_invalid, it is written as U+FFFD.
+   *
+   * @param utf8_output the pointer to a buffer that can hold at least 3 bytes.
+   * @return a full_result struct (of type simdutf::full_result containing the
+   * three fields error, input_count and output_count) with an error code,
+   * either the position of the error in the stream if any or the length of the
+   * stream in code units, and the number of bytes written.
+   */
+  simdutf_warn_unused full_result finish(char *utf8_output) noexcept;
+
+  /**
+   * Forget everything about the current stream so that a new stream can be
+   * transcoded. The byte order and the replacement mode are kept.
+   */
+  void reset() noexcept;
+
+private:
+  size_t converted{0}; // code units of the stream before the pending one
+  size_t error_position{0};
+  error_code error{error_code::SUCCESS};
+  char16_t pending{0};
+  bool has_pending{false};
+  bool big_endian;
+  bool replace;
+};
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+/**
+ * Incremental UTF-8 to UTF-32 transcoder for inputs that arrive piece by piece.
+ * The chunks may be split anywhere, including in the middle of a multi-byte
+ * character: the incomplete character (at most three bytes) is carried over to
+ * the next chunk, and the rest of each chunk is transcoded by the active
+ * implementation.
+ *
+ * The input is validated. Once an error is found, it is sticky: convert() and
+ * finish() keep returning it until reset() is called.
+ */
+class utf8_to_utf32_stream {
+public:
+  /**
+   * Transcode the next chunk of the stream.
+   *
+   * @param input the next chunk of the UTF-8 stream.
+   * @param length the length of the chunk in bytes.
+   * @param utf32_output the pointer to a buffer that can hold at least length
+   * char32_t.
+   * @return a full_result struct (of type simdutf::full_result containing the
+   * three fields error, input_count and output_count). On success, input_count
+   * is length and output_count is the number of char32_t written. On error,
+   * input_count is the position of the error in the stream and output_count is
+   * the number of char32_t written for the characters of the chunk that precede
+   * the error.
+   */
+  simdutf_warn_unused full_result convert(const char *input, size_t length,
+                                          char32_t *utf32_output) noexcept;
+  #if SIMDUTF_SPAN
+  simdutf_really_inline simdutf_warn_unused full_result
+  convert(const detail::input_span_of_byte_like auto &input,
+          std::span<char32_t> utf32_output) noexcept {
+    return convert(reinterpret_cast<const char *>(input.data()), input.size(),
+                   utf32_output.data());
+  }
+  #endif // SIMDUTF_SPAN
+
+  /**
+   * Signal the end of the stream. A character truncated by the end of the
+   * stream is an error (TOO_SHORT) located at its leading byte.
+   *
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error in the stream if any, or the length of the stream in bytes if
+   * successful.
+   */
+  simdutf_warn_unused result finish() noexcept;
+
+  /**
+   * Forget everything about the current stream so that a new stream can be
+   * transcoded.
+   */
+  void reset() noexcept;
+
+private:
+  detail::utf8_stream_state state{};
+};
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+/**
+ * An executor runs the tasks of the parallel functions (such as
+ * convert_utf8_to_utf16le_parallel) on behalf of simdutf. Implement this
+ * interface on top of the thread pool or the scheduler of your application,
+ * or use default_executor().
+ *
+ * A parallel function cuts its input into at most concurrency() segments and
+ * calls run() once or twice, each time with one task per segment. The tasks
+ * are independent of each other: they may run in any order, concurrently or
+ * one after the other, including on the calling thread.
+ *
+ * The library never destroys an executor: the caller keeps ownership.
+ */
+class executor {
+public:
+  /**
+   * The signature of the tasks: task(context, index) runs the task number
+   * index of the batch.
+   */
+  using task_function = void (*)(void *context, size_t index);
+
+  /**
+   * The number of tasks that can usefully run at the same time, typically
+   * the number of worker threads. A value of 0 or 1 disables the splitting.
+   */
+  virtual size_t concurrency() const noexcept = 0;
+
+  /**
+   * Run task(context, i) for every i in [0, task_count) and return once all
+   * of the tasks have completed. The tasks do not throw.
+   */
+  virtual void run(size_t task_count, task_function task,
+                   void *context) noexcept = 0;
+
+protected:
+  ~executor() = default;
+};
+
+/**
+ * The executor of the parallel functions when none is given. It is a pool of
+ * std::thread::hardware_concurrency() - 1 worker threads, started on first use
+ * and kept until the end of the process, so that no thread is created per
+ * call. The thread that calls run() works on the tasks too. Several threads
+ * may submit tasks at the same time: they share the workers. If threads
+ * cannot be started, the pool keeps those that did, possibly none.
+ *
+ * When simdutf is built without thread support (SIMDUTF_NO_THREADS or
+ * SIMDUTF_NO_LIBCXX) or without exceptions, the default executor runs the
+ * tasks one after the other on the calling thread.
+ */
+simdutf_warn_unused executor &default_executor() noexcept;
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+/**
+ * Validate the UTF-8 string and stop on error, using the executor to validate
+ * several segments of the input at the same time. The input is cut at
+ * arbitrary points, moved back to the start of the character they fall in.
+ * Short inputs are validated on the calling thread.
+ *
+ * @param buf the UTF-8 string to validate.
+ * @param len the length of the string in bytes.
+ * @param exec the executor that runs the segments, default_executor() if
+ * omitted.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with the same error code and position as
+ * validate_utf8_with_errors: the position of the first error (in the input in
+ * code units) if any, or the number of code units validated if successful.
+ */
+simdutf_warn_unused result validate_utf8_parallel(
+    const char *buf, size_t len, executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+validate_utf8_parallel(const detail::input_span_of_byte_like auto &input,
+                       executor &exec = default_executor()) noexcept {
+  return validate_utf8_parallel(reinterpret_cast<const char *>(input.data()),
+                                input.size(), exec);
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+/**
+ * Validate the UTF-16 string (native endianness) and stop on error, using the
+ * executor to validate several segments of the input at the same time. The
+ * split points never separate the two halves of a surrogate pair. Short
+ * inputs are validated on the calling thread.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param buf the UTF-16 string to validate.
+ * @param len the length of the string in number of 2-byte code units
+ * (char16_t).
+ * @param exec the executor that runs the segments, default_executor() if
+ * omitted.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with the same error code and position as
+ * validate_utf16_with_errors: the position of the first error (in the input
+ * in code units) if any, or the number of code units validated if successful.
+ */
+simdutf_warn_unused result validate_utf16_parallel(
+    const char16_t *buf, size_t len,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+validate_utf16_parallel(std::span<const char16_t> input,
+                        executor &exec = default_executor()) noexcept {
+  return validate_utf16_parallel(input.data(), input.size(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-16LE string and stop on error, using the executor to
+ * validate several segments of the input at the same time. See
+ * validate_utf16_parallel.
+ *
+ * @param buf the UTF-16LE string to validate.
+ * @param len the length of the string in number of 2-byte code units
+ * (char16_t).
+ * @param exec the executor that runs the segments, default_executor() if
+ * omitted.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with the same error code and position as
+ * validate_utf16le_with_errors.
+ */
+simdutf_warn_unused result validate_utf16le_parallel(
+    const char16_t *buf, size_t len,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+validate_utf16le_parallel(std::span<const char16_t> input,
+                          executor &exec = default_executor()) noexcept {
+  return validate_utf16le_parallel(input.data(), input.size(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Validate the UTF-16BE string and stop on error, using the executor to
+ * validate several segments of the input at the same time. See
+ * validate_utf16_parallel.
+ *
+ * @param buf the UTF-16BE string to validate.
+ * @param len the length of the string in number of 2-byte code units
+ * (char16_t).
+ * @param exec the executor that runs the segments, default_executor() if
+ * omitted.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with the same error code and position as
+ * validate_utf16be_with_errors.
+ */
+simdutf_warn_unused result validate_utf16be_parallel(
+    const char16_t *buf, size_t len,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+validate_utf16be_parallel(std::span<const char16_t> input,
+                          executor &exec = default_executor()) noexcept {
+  return validate_utf16be_parallel(input.data(), input.size(), exec);
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Convert a possibly broken UTF-8 string into a UTF-16LE string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to a buffer that can hold at least
+ * utf16_length_from_utf8(input, length) char16_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf16le_parallel(
+    const char *input, size_t length, char16_t *utf16_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_utf16le_parallel(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char16_t> utf16_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf8_to_utf16le_parallel(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf16_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-8 string into a UTF-16BE string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to a buffer that can hold at least
+ * utf16_length_from_utf8(input, length) char16_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf16be_parallel(
+    const char *input, size_t length, char16_t *utf16_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_utf16be_parallel(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char16_t> utf16_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf8_to_utf16be_parallel(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf16_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-8 string into a UTF-16 (native endianness)
+ * string, using the executor to convert several segments of the input at the
+ * same time. The segments are cut at character boundaries and the output of
+ * each segment is written at its final position, so the output is the same
+ * as with the single-threaded function. Short inputs are converted on the
+ * calling thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf16_output  the pointer to a buffer that can hold at least
+ * utf16_length_from_utf8(input, length) char16_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf16_parallel(
+    const char *input, size_t length, char16_t *utf16_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_utf16_parallel(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char16_t> utf16_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf8_to_utf16_parallel(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf16_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-16LE string into a UTF-8 string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in char16_t
+ * @param utf8_output   the pointer to a buffer that can hold at least
+ * utf8_length_from_utf16le(input, length) char
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16le_to_utf8_parallel(
+    const char16_t *input, size_t length, char *utf8_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16le_to_utf8_parallel(std::span<const char16_t> utf16_input,
+                                 std::span<char> utf8_output,
+                                 executor &exec = default_executor()) noexcept {
+  return convert_utf16le_to_utf8_parallel(
+      utf16_input.data(), utf16_input.size(), utf8_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-16BE string into a UTF-8 string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in char16_t
+ * @param utf8_output   the pointer to a buffer that can hold at least
+ * utf8_length_from_utf16be(input, length) char
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16be_to_utf8_parallel(
+    const char16_t *input, size_t length, char *utf8_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16be_to_utf8_parallel(std::span<const char16_t> utf16_input,
+                                 std::span<char> utf8_output,
+                                 executor &exec = default_executor()) noexcept {
+  return convert_utf16be_to_utf8_parallel(
+      utf16_input.data(), utf16_input.size(), utf8_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-16 (native endianness) string into a UTF-8
+ * string, using the executor to convert several segments of the input at the
+ * same time. The segments are cut at character boundaries and the output of
+ * each segment is written at its final position, so the output is the same
+ * as with the single-threaded function. Short inputs are converted on the
+ * calling thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-16 (native endianness) string to convert
+ * @param length        the length of the string in char16_t
+ * @param utf8_output   the pointer to a buffer that can hold at least
+ * utf8_length_from_utf16(input, length) char
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16_to_utf8_parallel(
+    const char16_t *input, size_t length, char *utf8_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_utf8_parallel(std::span<const char16_t> utf16_input,
+                               std::span<char> utf8_output,
+                               executor &exec = default_executor()) noexcept {
+  return convert_utf16_to_utf8_parallel(
+      utf16_input.data(), utf16_input.size(), utf8_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+/**
+ * Convert a possibly broken UTF-8 string into a UTF-32 string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param length        the length of the string in bytes
+ * @param utf32_output  the pointer to a buffer that can hold at least
+ * utf32_length_from_utf8(input, length) char32_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf8_to_utf32_parallel(
+    const char *input, size_t length, char32_t *utf32_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf8_to_utf32_parallel(
+    const detail::input_span_of_byte_like auto &utf8_input,
+    std::span<char32_t> utf32_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf8_to_utf32_parallel(
+      reinterpret_cast<const char *>(utf8_input.data()), utf8_input.size(),
+      utf32_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-32 string into a UTF-8 string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in char32_t
+ * @param utf8_output   the pointer to a buffer that can hold at least
+ * utf8_length_from_utf32(input, length) char
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf32_to_utf8_parallel(
+    const char32_t *input, size_t length, char *utf8_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32_to_utf8_parallel(std::span<const char32_t> utf32_input,
+                               std::span<char> utf8_output,
+                               executor &exec = default_executor()) noexcept {
+  return convert_utf32_to_utf8_parallel(
+      utf32_input.data(), utf32_input.size(), utf8_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+#endif   // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+/**
+ * Convert a possibly broken UTF-16LE string into a UTF-32 string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-16LE string to convert
+ * @param length        the length of the string in char16_t
+ * @param utf32_output  the pointer to a buffer that can hold at least
+ * utf32_length_from_utf16le(input, length) char32_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16le_to_utf32_parallel(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16le_to_utf32_parallel(
+    std::span<const char16_t> utf16_input, std::span<char32_t> utf32_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf16le_to_utf32_parallel(
+      utf16_input.data(), utf16_input.size(), utf32_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-16BE string into a UTF-32 string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-16BE string to convert
+ * @param length        the length of the string in char16_t
+ * @param utf32_output  the pointer to a buffer that can hold at least
+ * utf32_length_from_utf16be(input, length) char32_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
+ */
+simdutf_warn_unused result convert_utf16be_to_utf32_parallel(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    executor &exec = default_executor()) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16be_to_utf32_parallel(
+    std::span<const char16_t> utf16_input, std::span<char32_t> utf32_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf16be_to_utf32_parallel(
+      utf16_input.data(), utf16_input.size(), utf32_output.data(), exec);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a possibly broken UTF-16 (native endianness) string into a UTF-32
+ * string, using the executor to convert several segments of the input at the
+ * same time. The segments are cut at character boundaries and the output of
+ * each segment is written at its final position, so the output is the same
+ * as with the single-threaded function. Short inputs are converted on the
+ * calling thread.
+ *
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
+ *
+ * @param input         the UTF-16 (native endianness) string to convert
+ * @param length        the length of the string in char16_t
+ * @param utf32_output  the pointer to a buffer that can hold at least
+ * utf32_length_from_utf16(input, length) char32_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char32_t written if
+ * successful.
  */
-simdutf_warn_unused size_t count_utf16le(const char16_t *input,
-                                         size_t length) noexcept;
+simdutf_warn_unused result convert_utf16_to_utf32_parallel(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    executor &exec = default_executor()) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-count_utf16le(std::span<const char16_t> valid_utf16_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16::count_code_points<endianness::LITTLE>(
-        valid_utf16_input.data(), valid_utf16_input.size());
-  } else
-    #endif
-  {
-    return count_utf16le(valid_utf16_input.data(), valid_utf16_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf16_to_utf32_parallel(std::span<const char16_t> utf16_input,
+                                std::span<char32_t> utf32_output,
+                                executor &exec = default_executor()) noexcept {
+  return convert_utf16_to_utf32_parallel(
+      utf16_input.data(), utf16_input.size(), utf32_output.data(), exec);
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Count the number of code points (characters) in the string assuming that
- * it is valid.
- *
- * This function assumes that the input string is valid UTF-16BE.
- * It is acceptable to pass invalid UTF-16 strings but in such cases
- * the result is implementation defined.
+ * Convert a possibly broken UTF-32 string into a UTF-16LE string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
  *
- * This function is not BOM-aware.
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
  *
- * @param input         the UTF-16BE string to process
- * @param length        the length of the string in 2-byte code units (char16_t)
- * @return number of code points
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in char32_t
+ * @param utf16_output  the pointer to a buffer that can hold at least
+ * utf16_length_from_utf32(input, length) char16_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
  */
-simdutf_warn_unused size_t count_utf16be(const char16_t *input,
-                                         size_t length) noexcept;
+simdutf_warn_unused result convert_utf32_to_utf16le_parallel(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    executor &exec = default_executor()) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-count_utf16be(std::span<const char16_t> valid_utf16_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf16::count_code_points<endianness::BIG>(
-        valid_utf16_input.data(), valid_utf16_input.size());
-  } else
-    #endif
-  {
-    return count_utf16be(valid_utf16_input.data(), valid_utf16_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32_to_utf16le_parallel(
+    std::span<const char32_t> utf32_input, std::span<char16_t> utf16_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf32_to_utf16le_parallel(
+      utf32_input.data(), utf32_input.size(), utf16_output.data(), exec);
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF16
 
-#if SIMDUTF_FEATURE_UTF8
 /**
- * Count the number of code points (characters) in the string assuming that
- * it is valid.
+ * Convert a possibly broken UTF-32 string into a UTF-16BE string, using the
+ * executor to convert several segments of the input at the same time. The
+ * segments are cut at character boundaries and the output of each segment is
+ * written at its final position, so the output is the same as with the
+ * single-threaded function. Short inputs are converted on the calling
+ * thread.
  *
- * This function assumes that the input string is valid UTF-8.
- * It is acceptable to pass invalid UTF-8 strings but in such cases
- * the result is implementation defined.
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
  *
- * @param input         the UTF-8 string to process
- * @param length        the length of the string in bytes
- * @return number of code points
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in char32_t
+ * @param utf16_output  the pointer to a buffer that can hold at least
+ * utf16_length_from_utf32(input, length) char16_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
  */
-simdutf_warn_unused size_t count_utf8(const char *input,
-                                      size_t length) noexcept;
+simdutf_warn_unused result convert_utf32_to_utf16be_parallel(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    executor &exec = default_executor()) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t count_utf8(
-    const detail::input_span_of_byte_like auto &valid_utf8_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf8::count_code_points(valid_utf8_input.data(),
-                                           valid_utf8_input.size());
-  } else
-    #endif
-  {
-    return count_utf8(reinterpret_cast<const char *>(valid_utf8_input.data()),
-                      valid_utf8_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32_to_utf16be_parallel(
+    std::span<const char32_t> utf32_input, std::span<char16_t> utf16_output,
+    executor &exec = default_executor()) noexcept {
+  return convert_utf32_to_utf16be_parallel(
+      utf32_input.data(), utf32_input.size(), utf16_output.data(), exec);
 }
   #endif // SIMDUTF_SPAN
 
 /**
- * Given a valid UTF-8 string having a possibly truncated last character,
- * this function checks the end of string. If the last character is truncated
- * (or partial), then it returns a shorter length (shorter by 1 to 3 bytes) so
- * that the short UTF-8 strings only contain complete characters. If there is no
- * truncated character, the original length is returned.
+ * Convert a possibly broken UTF-32 string into a UTF-16 (native endianness)
+ * string, using the executor to convert several segments of the input at the
+ * same time. The segments are cut at character boundaries and the output of
+ * each segment is written at its final position, so the output is the same
+ * as with the single-threaded function. Short inputs are converted on the
+ * calling thread.
  *
- * This function assumes that the input string is valid UTF-8, but possibly
- * truncated.
+ * During the conversion also validation of the input string is done. On
+ * error, the reported position is the one the single-threaded function
+ * reports, but the content of the output buffer is unspecified.
  *
- * @param input         the UTF-8 string to process
- * @param length        the length of the string in bytes
- * @return the length of the string in bytes, possibly shorter by 1 to 3 bytes
+ * @param input         the UTF-32 string to convert
+ * @param length        the length of the string in char32_t
+ * @param utf16_output  the pointer to a buffer that can hold at least
+ * utf16_length_from_utf32(input, length) char16_t
+ * @param exec          the executor that runs the segments, default_executor()
+ *                      if omitted
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in code units) if any, or the number of char16_t written if
+ * successful.
  */
-simdutf_warn_unused size_t trim_partial_utf8(const char *input, size_t length);
+simdutf_warn_unused result convert_utf32_to_utf16_parallel(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    executor &exec = default_executor()) noexcept;
   #if SIMDUTF_SPAN
-simdutf_really_inline simdutf_warn_unused simdutf_constexpr23 size_t
-trim_partial_utf8(
-    const detail::input_span_of_byte_like auto &valid_utf8_input) noexcept {
-    #if SIMDUTF_CPLUSPLUS23
-  if consteval {
-    return scalar::utf8::trim_partial_utf8(valid_utf8_input.data(),
-                                           valid_utf8_input.size());
-  } else
-    #endif
-  {
-    return trim_partial_utf8(
-        reinterpret_cast<const char *>(valid_utf8_input.data()),
-        valid_utf8_input.size());
-  }
+simdutf_really_inline simdutf_warn_unused result
+convert_utf32_to_utf16_parallel(std::span<const char32_t> utf32_input,
+                                std::span<char16_t> utf16_output,
+                                executor &exec = default_executor()) noexcept {
+  return convert_utf32_to_utf16_parallel(
+      utf32_input.data(), utf32_input.size(), utf16_output.data(), exec);
 }
   #endif // SIMDUTF_SPAN
-#endif   // SIMDUTF_FEATURE_UTF8
+#endif   // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Convert many possibly broken UTF-8 strings into UTF-16 strings with the
+ * native endianness in one call. This is a convenience wrapper: the strings are
+ * converted one after the other, each by its own call to
+ * convert_utf8_to_utf16_with_errors, and the outputs are written back to back
+ * in utf16_output. It is not faster than a loop over the strings, but it keeps
+ * track of where each output starts.
+ *
+ * The output of inputs[i] starts at utf16_output + output_offsets[i] and ends
+ * at utf16_output + output_offsets[i + 1]. An invalid input produces no
+ * output: its two offsets are equal.
+ *
+ * @param inputs          the UTF-8 strings to convert
+ * @param lengths         the length of each string in bytes
+ * @param count           the number of strings
+ * @param utf16_output    the pointer to a buffer that can hold the sum of
+ * utf16_length_from_utf8(inputs[i], lengths[i]) char16_t (the sum of the
+ * lengths is always enough)
+ * @param output_offsets  the pointer to an array of count + 1 offsets
+ * @param results         the pointer to an array of count results, which
+ * receive the result of convert_utf8_to_utf16_with_errors for each string,
+ * or nullptr
+ * @return the number of strings that are not valid UTF-8, 0 if they all are.
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf16_batch(
+    const char *const *inputs, const size_t *lengths, size_t count,
+    char16_t *utf16_output, size_t *output_offsets, result *results) noexcept;
+
+/**
+ * Convert many possibly broken UTF-8 strings into UTF-16LE strings in one call.
+ * This is a convenience wrapper: the strings are converted one after the other,
+ * each by its own call to convert_utf8_to_utf16le_with_errors, and the outputs
+ * are written back to back in utf16_output. It is not faster than a loop over
+ * the strings, but it keeps track of where each output starts.
+ *
+ * The output of inputs[i] starts at utf16_output + output_offsets[i] and ends
+ * at utf16_output + output_offsets[i + 1]. An invalid input produces no
+ * output: its two offsets are equal.
+ *
+ * @param inputs          the UTF-8 strings to convert
+ * @param lengths         the length of each string in bytes
+ * @param count           the number of strings
+ * @param utf16_output    the pointer to a buffer that can hold the sum of
+ * utf16_length_from_utf8(inputs[i], lengths[i]) char16_t (the sum of the
+ * lengths is always enough)
+ * @param output_offsets  the pointer to an array of count + 1 offsets
+ * @param results         the pointer to an array of count results, which
+ * receive the result of convert_utf8_to_utf16le_with_errors for each string,
+ * or nullptr
+ * @return the number of strings that are not valid UTF-8, 0 if they all are.
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf16le_batch(
+    const char *const *inputs, const size_t *lengths, size_t count,
+    char16_t *utf16_output, size_t *output_offsets, result *results) noexcept;
+
+/**
+ * Convert many possibly broken UTF-8 strings into UTF-16BE strings in one call.
+ * This is a convenience wrapper: the strings are converted one after the other,
+ * each by its own call to convert_utf8_to_utf16be_with_errors, and the outputs
+ * are written back to back in utf16_output. It is not faster than a loop over
+ * the strings, but it keeps track of where each output starts.
+ *
+ * The output of inputs[i] starts at utf16_output + output_offsets[i] and ends
+ * at utf16_output + output_offsets[i + 1]. An invalid input produces no
+ * output: its two offsets are equal.
+ *
+ * @param inputs          the UTF-8 strings to convert
+ * @param lengths         the length of each string in bytes
+ * @param count           the number of strings
+ * @param utf16_output    the pointer to a buffer that can hold the sum of
+ * utf16_length_from_utf8(inputs[i], lengths[i]) char16_t (the sum of the
+ * lengths is always enough)
+ * @param output_offsets  the pointer to an array of count + 1 offsets
+ * @param results         the pointer to an array of count results, which
+ * receive the result of convert_utf8_to_utf16be_with_errors for each string,
+ * or nullptr
+ * @return the number of strings that are not valid UTF-8, 0 if they all are.
+ */
+simdutf_warn_unused size_t convert_utf8_to_utf16be_batch(
+    const char *const *inputs, const size_t *lengths, size_t count,
+    char16_t *utf16_output, size_t *output_offsets, result *results) noexcept;
+
+/**
+ * Convert many possibly broken UTF-16 strings with the native endianness into
+ * UTF-8 strings in one call. This is a convenience wrapper: the strings are
+ * converted one after the other, each by its own call to
+ * convert_utf16_to_utf8_with_errors, and the outputs are written back to back
+ * in utf8_output. It is not faster than a loop over the strings, but it keeps
+ * track of where each output starts.
+ *
+ * The output of inputs[i] starts at utf8_output + output_offsets[i] and ends
+ * at utf8_output + output_offsets[i + 1]. An invalid input produces no output:
+ * its two offsets are equal.
+ *
+ * @param inputs          the UTF-16 strings to convert
+ * @param lengths         the length of each string in char16_t
+ * @param count           the number of strings
+ * @param utf8_output     the pointer to a buffer that can hold the sum of
+ * utf8_length_from_utf16(inputs[i], lengths[i]) bytes (three times the sum
+ * of the lengths is always enough)
+ * @param output_offsets  the pointer to an array of count + 1 offsets
+ * @param results         the pointer to an array of count results, which
+ * receive the result of convert_utf16_to_utf8_with_errors for each string,
+ * or nullptr
+ * @return the number of strings that are not valid UTF-16, 0 if they all are.
+ */
+simdutf_warn_unused size_t convert_utf16_to_utf8_batch(
+    const char16_t *const *inputs, const size_t *lengths, size_t count,
+    char *utf8_output, size_t *output_offsets, result *results) noexcept;
+
+/**
+ * Convert many possibly broken UTF-16LE strings into UTF-8 strings in one call.
+ * This is a convenience wrapper: the strings are converted one after the other,
+ * each by its own call to convert_utf16le_to_utf8_with_errors, and the outputs
+ * are written back to back in utf8_output. It is not faster than a loop over
+ * the strings, but it keeps track of where each output starts.
+ *
+ * The output of inputs[i] starts at utf8_output + output_offsets[i] and ends
+ * at utf8_output + output_offsets[i + 1]. An invalid input produces no output:
+ * its two offsets are equal.
+ *
+ * @param inputs          the UTF-16LE strings to convert
+ * @param lengths         the length of each string in char16_t
+ * @param count           the number of strings
+ * @param utf8_output     the pointer to a buffer that can hold the sum of
+ * utf8_length_from_utf16le(inputs[i], lengths[i]) bytes (three times the sum
+ * of the lengths is always enough)
+ * @param output_offsets  the pointer to an array of count + 1 offsets
+ * @param results         the pointer to an array of count results, which
+ * receive the result of convert_utf16le_to_utf8_with_errors for each string,
+ * or nullptr
+ * @return the number of strings that are not valid UTF-16LE, 0 if they all are.
+ */
+simdutf_warn_unused size_t convert_utf16le_to_utf8_batch(
+    const char16_t *const *inputs, const size_t *lengths, size_t count,
+    char *utf8_output, size_t *output_offsets, result *results) noexcept;
+
+/**
+ * Convert many possibly broken UTF-16BE strings into UTF-8 strings in one call.
+ * This is a convenience wrapper: the strings are converted one after the other,
+ * each by its own call to convert_utf16be_to_utf8_with_errors, and the outputs
+ * are written back to back in utf8_output. It is not faster than a loop over
+ * the strings, but it keeps track of where each output starts.
+ *
+ * The output of inputs[i] starts at utf8_output + output_offsets[i] and ends
+ * at utf8_output + output_offsets[i + 1]. An invalid input produces no output:
+ * its two offsets are equal.
+ *
+ * @param inputs          the UTF-16BE strings to convert
+ * @param lengths         the length of each string in char16_t
+ * @param count           the number of strings
+ * @param utf8_output     the pointer to a buffer that can hold the sum of
+ * utf8_length_from_utf16be(inputs[i], lengths[i]) bytes (three times the sum
+ * of the lengths is always enough)
+ * @param output_offsets  the pointer to an array of count + 1 offsets
+ * @param results         the pointer to an array of count results, which
+ * receive the result of convert_utf16be_to_utf8_with_errors for each string,
+ * or nullptr
+ * @return the number of strings that are not valid UTF-16BE, 0 if they all are.
+ */
+simdutf_warn_unused size_t convert_utf16be_to_utf8_batch(
+    const char16_t *const *inputs, const size_t *lengths, size_t count,
+    char *utf8_output, size_t *output_offsets, result *results) noexcept;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF16
 /**
@@ -4094,12 +8281,19 @@ trim_partial_utf16(std::span<const char16_t> valid_utf16_input) noexcept {
 #endif   // SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_BASE64 || SIMDUTF_FEATURE_UTF16 ||                         \
-    SIMDUTF_FEATURE_DETECT_ENCODING
+    SIMDUTF_FEATURE_DETECT_ENCODING || SIMDUTF_FEATURE_UTF8
   #ifndef SIMDUTF_NEED_TRAILING_ZEROES
     #define SIMDUTF_NEED_TRAILING_ZEROES 1
   #endif
 #endif // SIMDUTF_FEATURE_BASE64 || SIMDUTF_FEATURE_UTF16 ||
-       // SIMDUTF_FEATURE_DETECT_ENCODING
+       // SIMDUTF_FEATURE_DETECT_ENCODING || SIMDUTF_FEATURE_UTF8
+
+// The windows-1252 functions scan for C1 controls with bitmasks.
+#if SIMDUTF_FEATURE_LATIN1
+  #ifndef SIMDUTF_NEED_TRAILING_ZEROES
+    #define SIMDUTF_NEED_TRAILING_ZEROES 1
+  #endif
+#endif // SIMDUTF_FEATURE_LATIN1
 
 #if SIMDUTF_FEATURE_BASE64
 // base64_options are used to specify the base64 encoding options.
@@ -4148,6 +8342,13 @@ is_partial(last_chunk_handling_options options) {
   return (options == stop_before_partial) || (options == only_full_chunks);
 }
 
+// hex_options are used to specify the letter case of hexadecimal encoding.
+// The hexadecimal functions are part of SIMDUTF_FEATURE_BASE64.
+enum hex_options : uint64_t {
+  hex_lowercase = 0, /* digits 0-9 and a-f */
+  hex_uppercase = 1  /* digits 0-9 and A-F */
+};
+
 namespace detail {
 simdutf_warn_unused const char *find(const char *start, const char *end,
                                      char character) noexcept;
@@ -4199,6 +8400,7 @@ find(const char16_t *start, const char16_t *end, char16_t character) noexcept {
   // We include base64_tables once.
   #include <simdutf/base64_tables.h>
   #include <simdutf/scalar/base64.h>
+  #include <simdutf/scalar/hex.h>
 
 namespace simdutf {
 
@@ -4568,6 +8770,98 @@ binary_to_base64_with_lines(
 }
   #endif // SIMDUTF_SPAN
 
+/**
+ * Incremental base64 encoder for binary inputs that arrive piece by piece
+ * (e.g., a large MIME attachment). The chunks may have any size: at most two
+ * bytes (an incomplete 3-byte group) are carried from one chunk to the next,
+ * and the rest of each chunk is encoded by the active implementation. When
+ * lines are requested, the current column is also kept across chunks.
+ *
+ * The concatenation of the outputs of encode() and finish() is identical to
+ * the output of binary_to_base64 (or binary_to_base64_with_lines) given the
+ * concatenation of the inputs.
+ *
+ * Example:
+ *
+ *   simdutf::base64_encoder encoder(simdutf::base64_default, 76);
+ *   while (size_t len = read_chunk(buffer, sizeof(buffer))) {
+ *     std::vector<char> out(encoder.encoded_length(len));
+ *     write(out.data(), encoder.encode(buffer, len, out.data()));
+ *   }
+ *   char tail[5];
+ *   write(tail, encoder.finish(tail));
+ */
+class base64_encoder {
+public:
+  /**
+   * @param base64_encoding_options the base64 options to use, can be
+   * base64_default or base64_url (with or without padding), is base64_default
+   * by default.
+   * @param base64_line_length the length of lines, 0 (the default) for no line
+   * breaks; otherwise it must be at least 4 (otherwise it is interpreted as 4).
+   */
+  explicit base64_encoder(
+      base64_options base64_encoding_options = base64_default,
+      size_t base64_line_length = 0) noexcept
+      : options{base64_encoding_options},
+        line_length{base64_line_length == 0
+                        ? 0
+                        : (base64_line_length < 4 ? 4 : base64_line_length)} {}
+
+  /**
+   * Provide the exact number of bytes that encode() writes for the next chunk.
+   *
+   * @param length        the length of the next chunk in bytes
+   * @return number of base64 bytes, including line breaks
+   */
+  simdutf_warn_unused size_t encoded_length(size_t length) const noexcept;
+
+  /**
+   * Encode the next chunk. Only complete 3-byte groups are encoded: up to two
+   * trailing bytes are kept for the next chunk or for finish().
+   *
+   * @param input         the next chunk of binary data
+   * @param length        the length of the chunk in bytes
+   * @param output        the pointer to a buffer that can hold the conversion
+   * result (should be at least encoded_length(length) bytes long)
+   * @return number of written bytes, will be equal to encoded_length(length)
+   */
+  size_t encode(const char *input, size_t length, char *output) noexcept;
+  #if SIMDUTF_SPAN
+  simdutf_really_inline size_t
+  encode(const detail::input_span_of_byte_like auto &input,
+         detail::output_span_of_byte_like auto &&output) noexcept {
+    return encode(reinterpret_cast<const char *>(input.data()), input.size(),
+                  reinterpret_cast<char *>(output.data()));
+  }
+  #endif // SIMDUTF_SPAN
+
+  /**
+   * Signal the end of the input: encode the last bytes, if any, and add the
+   * padding required by the options. The encoder is then ready for a new
+   * input.
+   *
+   * @param output        the pointer to a buffer that can hold at least 5 bytes
+   * @return number of written bytes
+   */
+  size_t finish(char *output) noexcept;
+
+  /**
+   * Forget everything about the current input so that a new input can be
+   * encoded. The options and the line length are kept.
+   */
+  void reset() noexcept;
+
+private:
+  char *write_base64(const char *input, size_t length, char *output) noexcept;
+
+  base64_options options;
+  size_t line_length;
+  size_t column{0}; // characters on the current line, up to line_length
+  uint8_t carry_length{0};
+  char carry[3]{};
+};
+
   #if SIMDUTF_ATOMIC_REF
 /**
  * Convert a binary input to a base64 output, using atomic accesses.
@@ -5006,6 +9300,144 @@ base64_to_binary_safe(const char16_t *input, size_t length, char *output,
                       bool decode_up_to_bad_char = false) noexcept;
   // span overload moved to bottom of file
 
+/**
+ * Incremental base64 decoder for inputs that arrive piece by piece (e.g., a
+ * base64 file read in blocks, or a network stream). The chunks may be split
+ * anywhere, including inside a 4-character group or between padding
+ * characters: the result does not depend on where the input is split, and it
+ * is the result of base64_to_binary_safe on the whole stream. The decoder
+ * keeps the few characters of an incomplete or padded group between chunks,
+ * and the rest of each chunk is decoded by the active implementation: consumed
+ * characters are never scanned again.
+ *
+ * The options and the last chunk handling options have the same meaning as
+ * with base64_to_binary_safe: the last chunk handling applies to the end of the
+ * stream, when finish() is called. The input may be made of char or char16_t
+ * chunks.
+ *
+ * Error positions are absolute offsets in the stream (in characters). Once an
+ * error is found, it is sticky: decode() and finish() keep returning it until
+ * reset() is called.
+ *
+ * Example:
+ *
+ *   simdutf::base64_decoder decoder;
+ *   while (size_t len = read_chunk(buffer, sizeof(buffer))) {
+ *     std::vector<char> out(decoder.maximal_binary_length(len));
+ *     simdutf::full_result r = decoder.decode(buffer, len, out.data());
+ *     if (r.error != simdutf::SUCCESS) { break; }
+ *     write(out.data(), r.output_count);
+ *   }
+ *   char tail[2];
+ *   simdutf::full_result r = decoder.finish(tail);
+ */
+class base64_decoder {
+public:
+  /**
+   * @param base64_decoding_options the base64 options to use, usually
+   * base64_default or base64_url, is base64_default by default.
+   * @param base64_last_chunk_options the last chunk handling options,
+   * last_chunk_handling_options::loose by default but can also be
+   * last_chunk_handling_options::strict,
+   * last_chunk_handling_options::stop_before_partial or
+   * last_chunk_handling_options::only_full_chunks.
+   */
+  explicit base64_decoder(
+      base64_options base64_decoding_options = base64_default,
+      last_chunk_handling_options base64_last_chunk_options = loose) noexcept
+      : options{base64_decoding_options},
+        last_chunk_options{base64_last_chunk_options} {}
+
+  /**
+   * Provide the size of an output buffer that is large enough for decode()
+   * given the length of the next chunk.
+   *
+   * @param length        the length of the next chunk in characters
+   * @return number of bytes
+   */
+  simdutf_warn_unused size_t
+  maximal_binary_length(size_t length) const noexcept;
+
+  /**
+   * Decode the next chunk. Only complete 4-character groups are decoded: the
+   * characters of an incomplete or padded group are kept for the next chunk or
+   * for finish(), since what follows them decides how they are decoded.
+   *
+   * @param input         the next chunk of base64 characters
+   * @param length        the length of the chunk in characters
+   * @param output        the pointer to a buffer that can hold the conversion
+   * result (should be at least maximal_binary_length(length) bytes long)
+   * @return a full_result struct (of type simdutf::full_result containing the
+   * three fields error, input_count and output_count). On success, input_count
+   * is length and output_count is the number of bytes written. On error,
+   * input_count is the position of the error in the stream and output_count is
+   * the number of bytes written for the groups of the chunk that precede the
+   * error.
+   */
+  simdutf_warn_unused full_result decode(const char *input, size_t length,
+                                         char *output) noexcept;
+  simdutf_warn_unused full_result decode(const char16_t *input, size_t length,
+                                         char *output) noexcept;
+  #if SIMDUTF_SPAN
+  simdutf_really_inline simdutf_warn_unused full_result
+  decode(const detail::input_span_of_byte_like auto &input,
+         detail::output_span_of_byte_like auto &&output) noexcept {
+    return decode(reinterpret_cast<const char *>(input.data()), input.size(),
+                  reinterpret_cast<char *>(output.data()));
+  }
+  simdutf_really_inline simdutf_warn_unused full_result
+  decode(std::span<const char16_t> input,
+         detail::output_span_of_byte_like auto &&output) noexcept {
+    return decode(input.data(), input.size(),
+                  reinterpret_cast<char *>(output.data()));
+  }
+  #endif // SIMDUTF_SPAN
+
+  /**
+   * Signal the end of the stream: the characters of an incomplete last group,
+   * if any, are handled according to the last chunk handling options.
+   *
+   * @param output        the pointer to a buffer that can hold at least 2 bytes
+   * @return a full_result struct (of type simdutf::full_result containing the
+   * three fields error, input_count and output_count) with an error code,
+   * either the position of the error in the stream if any or the number of
+   * characters consumed (the length of the stream, unless a partial group is
+   * left undecoded by stop_before_partial or only_full_chunks), and the number
+   * of bytes written.
+   */
+  simdutf_warn_unused full_result finish(char *output) noexcept;
+
+  /**
+   * Forget everything about the current stream so that a new stream can be
+   * decoded. The options are kept.
+   */
+  void reset() noexcept;
+
+private:
+  template <typename char_type>
+  full_result decode_impl(const char_type *input, size_t length,
+                          char *output) noexcept;
+  template <typename char_type>
+  bool keep_character(char_type c, size_t position, char *&output) noexcept;
+
+  base64_options options;
+  last_chunk_handling_options last_chunk_options;
+  size_t consumed{0}; // characters of the stream seen so far
+  size_t error_position{0};
+  size_t padding_position{0}; // position of the first '=' if any
+  error_code error{error_code::SUCCESS};
+  bool ended{false};      // with garbage, the stream ends with the first '='
+  uint8_t significant{0}; // base64 characters among the kept characters
+  uint8_t padding{0};     // '=' characters among the kept characters
+  uint8_t kept_length{0};
+  // The characters that follow the last decoded group, along with their
+  // positions in the stream. A run of ignorable characters is kept as its
+  // first character: there are at most three base64 characters and two '='
+  // characters, with runs around them.
+  char16_t kept[12]{};
+  size_t kept_position[12]{};
+};
+
   #if SIMDUTF_ATOMIC_REF
 /**
  * Convert a base64 input to a binary output with a size limit and using atomic
@@ -5063,40 +9495,209 @@ simdutf_warn_unused result atomic_base64_to_binary_safe(
  * @return a tuple of result and outlen
  */
 simdutf_really_inline simdutf_warn_unused std::tuple<result, std::size_t>
-atomic_base64_to_binary_safe(
-    const detail::input_span_of_byte_like auto &binary_input,
-    detail::output_span_of_byte_like auto &&output,
-    base64_options options = base64_default,
-    last_chunk_handling_options last_chunk_options =
-        last_chunk_handling_options::loose,
-    bool decode_up_to_bad_char = false) noexcept {
-  size_t outlen = output.size();
-  auto ret = atomic_base64_to_binary_safe(
-      reinterpret_cast<const char *>(binary_input.data()), binary_input.size(),
-      reinterpret_cast<char *>(output.data()), outlen, options,
-      last_chunk_options, decode_up_to_bad_char);
-  return {ret, outlen};
+atomic_base64_to_binary_safe(
+    const detail::input_span_of_byte_like auto &binary_input,
+    detail::output_span_of_byte_like auto &&output,
+    base64_options options = base64_default,
+    last_chunk_handling_options last_chunk_options =
+        last_chunk_handling_options::loose,
+    bool decode_up_to_bad_char = false) noexcept {
+  size_t outlen = output.size();
+  auto ret = atomic_base64_to_binary_safe(
+      reinterpret_cast<const char *>(binary_input.data()), binary_input.size(),
+      reinterpret_cast<char *>(output.data()), outlen, options,
+      last_chunk_options, decode_up_to_bad_char);
+  return {ret, outlen};
+}
+/**
+ * @brief span overload
+ * @return a tuple of result and outlen
+ */
+simdutf_warn_unused std::tuple<result, std::size_t>
+atomic_base64_to_binary_safe(
+    std::span<const char16_t> base64_input,
+    detail::output_span_of_byte_like auto &&binary_output,
+    base64_options options = base64_default,
+    last_chunk_handling_options last_chunk_options = loose,
+    bool decode_up_to_bad_char = false) noexcept {
+  size_t outlen = binary_output.size();
+  auto ret = atomic_base64_to_binary_safe(
+      base64_input.data(), base64_input.size(),
+      reinterpret_cast<char *>(binary_output.data()), outlen, options,
+      last_chunk_options, decode_up_to_bad_char);
+  return {ret, outlen};
+}
+    #endif // SIMDUTF_SPAN
+  #endif   // SIMDUTF_ATOMIC_REF
+
+
+/**
+ * Provide the hexadecimal length in bytes given the length of a binary input:
+ * two digits per byte.
+ *
+ * @param length        the length of the input in bytes
+ * @return number of hexadecimal digits
+ */
+inline simdutf_warn_unused simdutf_constexpr23 size_t
+hex_length_from_binary(size_t length) noexcept {
+  return 2 * length;
+}
+
+/**
+ * Provide the binary length in bytes given the length of a hexadecimal input.
+ * The result is exact for valid input.
+ *
+ * @param length        the length of the hexadecimal input in units
+ * @return number of bytes
+ */
+inline simdutf_warn_unused simdutf_constexpr23 size_t
+binary_length_from_hex(size_t length) noexcept {
+  return length / 2;
+}
+
+/**
+ * Convert a binary input to hexadecimal (base16), two digits per byte with the
+ * most significant digit first.
+ *
+ * This function always succeeds.
+ *
+ * @param input         the binary to process
+ * @param length        the length of the input in bytes
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result (should be at least hex_length_from_binary(length) bytes long)
+ * @param options       the letter case of the digits a to f, hex_lowercase by
+ * default or hex_uppercase
+ * @return number of written bytes, will be equal to
+ * hex_length_from_binary(length)
+ */
+size_t binary_to_hex(const char *input, size_t length, char *output,
+                     hex_options options = hex_lowercase) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused size_t
+binary_to_hex(const detail::input_span_of_byte_like auto &input,
+              detail::output_span_of_byte_like auto &&hex_output,
+              hex_options options = hex_lowercase) noexcept {
+  return binary_to_hex(reinterpret_cast<const char *>(input.data()),
+                       input.size(),
+                       reinterpret_cast<char *>(hex_output.data()), options);
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a hexadecimal (base16) input to binary. Digits may be of either
+ * case. No other character, such as spaces or a 0x prefix, is allowed.
+ *
+ * If the input contains a character that is not a hexadecimal digit, the
+ * INVALID_HEX_CHARACTER error is returned and r.count contains its index in
+ * the input; the bytes of the digit pairs before it have been written. If
+ * the input has an odd number of digits, the HEX_INPUT_REMAINDER error is
+ * returned and r.count contains the number of bytes decoded.
+ *
+ * You should call this function with a buffer that is at least
+ * binary_length_from_hex(length) bytes long. If you fail to provide that much
+ * space, the function may cause a buffer overflow.
+ *
+ * @param input         the hexadecimal string to process
+ * @param length        the length of the string in bytes
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result (should be at least binary_length_from_hex(length) bytes long)
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in bytes) if any, or the number of bytes written if successful.
+ */
+simdutf_warn_unused result hex_to_binary(const char *input, size_t length,
+                                         char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+hex_to_binary(const detail::input_span_of_byte_like auto &input,
+              detail::output_span_of_byte_like auto &&binary_output) noexcept {
+  return hex_to_binary(reinterpret_cast<const char *>(input.data()),
+                       input.size(),
+                       reinterpret_cast<char *>(binary_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a hexadecimal (base16) input stored as 16-bit units to binary, see
+ * hex_to_binary.
+ *
+ * @param input         the hexadecimal string to process, in ASCII stored as
+ * 16-bit units
+ * @param length        the length of the string in 16-bit units
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result (should be at least binary_length_from_hex(length) bytes long)
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in units) if any, or the number of bytes written if successful.
+ */
+simdutf_warn_unused result hex_to_binary(const char16_t *input, size_t length,
+                                         char *output) noexcept;
+  #if SIMDUTF_SPAN
+simdutf_really_inline simdutf_warn_unused result
+hex_to_binary(std::span<const char16_t> input,
+              detail::output_span_of_byte_like auto &&binary_output) noexcept {
+  return hex_to_binary(input.data(), input.size(),
+                       reinterpret_cast<char *>(binary_output.data()));
+}
+  #endif // SIMDUTF_SPAN
+
+/**
+ * Convert a hexadecimal (base16) input to binary, writing at most outlen
+ * bytes, see hex_to_binary.
+ *
+ * If the output buffer is too small, the OUTPUT_BUFFER_TOO_SMALL error is
+ * returned, r.count contains the number of units processed and outlen the
+ * number of bytes written. Otherwise the result is the one of hex_to_binary,
+ * and outlen is the number of bytes written.
+ *
+ * @param input         the hexadecimal string to process, in ASCII stored as
+ * 8-bit or 16-bit units
+ * @param length        the length of the string in 8-bit or 16-bit units
+ * @param output        the pointer to a buffer that can hold the conversion
+ * result.
+ * @param outlen        the number of bytes that can be written in the output
+ * buffer. Upon return, it is modified to reflect how many bytes were written.
+ * @return a result pair struct (of type simdutf::result containing the two
+ * fields error and count) with an error code and either position of the error
+ * (in the input in units) if any, or the number of bytes written if successful.
+ */
+simdutf_warn_unused result hex_to_binary_safe(const char *input, size_t length,
+                                              char *output,
+                                              size_t &outlen) noexcept;
+simdutf_warn_unused result hex_to_binary_safe(const char16_t *input,
+                                              size_t length, char *output,
+                                              size_t &outlen) noexcept;
+  #if SIMDUTF_SPAN
+/**
+ * @brief span overload
+ * @return a tuple of result and outlen
+ */
+simdutf_really_inline simdutf_warn_unused std::tuple<result, std::size_t>
+hex_to_binary_safe(
+    const detail::input_span_of_byte_like auto &input,
+    detail::output_span_of_byte_like auto &&binary_output) noexcept {
+  size_t outlen = binary_output.size();
+  auto r = hex_to_binary_safe(reinterpret_cast<const char *>(input.data()),
+                              input.size(),
+                              reinterpret_cast<char *>(binary_output.data()),
+                              outlen);
+  return {r, outlen};
 }
 /**
  * @brief span overload
  * @return a tuple of result and outlen
  */
-simdutf_warn_unused std::tuple<result, std::size_t>
-atomic_base64_to_binary_safe(
-    std::span<const char16_t> base64_input,
-    detail::output_span_of_byte_like auto &&binary_output,
-    base64_options options = base64_default,
-    last_chunk_handling_options last_chunk_options = loose,
-    bool decode_up_to_bad_char = false) noexcept {
+simdutf_really_inline simdutf_warn_unused std::tuple<result, std::size_t>
+hex_to_binary_safe(
+    std::span<const char16_t> input,
+    detail::output_span_of_byte_like auto &&binary_output) noexcept {
   size_t outlen = binary_output.size();
-  auto ret = atomic_base64_to_binary_safe(
-      base64_input.data(), base64_input.size(),
-      reinterpret_cast<char *>(binary_output.data()), outlen, options,
-      last_chunk_options, decode_up_to_bad_char);
-  return {ret, outlen};
+  auto r = hex_to_binary_safe(input.data(), input.size(),
+                              reinterpret_cast<char *>(binary_output.data()),
+                              outlen);
+  return {r, outlen};
 }
-    #endif // SIMDUTF_SPAN
-  #endif   // SIMDUTF_ATOMIC_REF
+  #endif // SIMDUTF_SPAN
 
 #endif // SIMDUTF_FEATURE_BASE64
 
@@ -5202,8 +9803,102 @@ public:
    */
   simdutf_warn_unused virtual result
   validate_utf8_with_errors(const char *buf, size_t len) const noexcept = 0;
+
+  /**
+   * Validate the UTF-8 string and record the positions of its newline
+   * characters ('\n') in the same pass.
+   *
+   * Overridden by each implementation.
+   *
+   * @param input the UTF-8 string to validate.
+   * @param length the length of the string in bytes.
+   * @param line_positions the array where the positions of the newlines are
+   * written.
+   * @param line_count the number of positions that can be written. Upon
+   * return, it is modified to reflect how many positions were written.
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error (or of the newline that did not fit for OUTPUT_BUFFER_TOO_SMALL) if
+   * any, or the number of code units validated if successful.
+   */
+  simdutf_warn_unused virtual result
+  validate_utf8_and_index_lines(const char *input, size_t length,
+                                size_t *line_positions,
+                                size_t &line_count) const noexcept = 0;
+
+  /**
+   * Validate the UTF-8 string and find the first byte that must be escaped in
+   * a JSON string (quotation mark, reverse solidus or control character).
+   *
+   * Overridden by each implementation.
+   *
+   * @param input the UTF-8 string to validate.
+   * @param length the length of the string in bytes.
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error (in the input in code units) if any, or the position of the first
+   * byte that must be escaped (length if there is none) if successful.
+   */
+  simdutf_warn_unused virtual result
+  validate_utf8_and_find_json_escape(const char *input,
+                                     size_t length) const noexcept = 0;
+
+  /**
+   * Escape a UTF-8 string so that it can appear in a JSON string.
+   *
+   * Overridden by each implementation.
+   *
+   * @param input the UTF-8 string to escape.
+   * @param length the length of the string in bytes.
+   * @param output the pointer to a buffer that can hold 6 * length bytes.
+   * @param ascii_only whether to escape the non-ASCII characters as well.
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * UTF-8 error (in the input in code units) if any, or the number of bytes
+   * written if successful.
+   */
+  simdutf_warn_unused virtual result
+  escape_json_utf8(const char *input, size_t length, char *output,
+                   bool ascii_only) const noexcept = 0;
+
+  /**
+   * Unescape the content of a JSON string into UTF-8.
+   *
+   * Overridden by each implementation.
+   *
+   * @param input the content of the JSON string, in UTF-8.
+   * @param length the length of the input in bytes.
+   * @param output the pointer to a buffer that can hold length bytes.
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error (in the input in code units) if any, or the number of bytes written
+   * if successful.
+   */
+  simdutf_warn_unused virtual result
+  unescape_json_to_utf8(const char *input, size_t length,
+                        char *output) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  /**
+   * Unescape the content of a JSON string into UTF-16 with the native
+   * endianness.
+   *
+   * Overridden by each implementation.
+   *
+   * @param input the content of the JSON string, in UTF-8.
+   * @param length the length of the input in bytes.
+   * @param output the pointer to a buffer that can hold length char16_t.
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either the position of the
+   * error (in the input in code units) if any, or the number of char16_t
+   * written if successful.
+   */
+  simdutf_warn_unused virtual result
+  unescape_json_to_utf16(const char *input, size_t length,
+                         char16_t *output) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_ASCII
   /**
    * Validate the ASCII string.
@@ -5343,7 +10038,8 @@ public:
   /**
    * Copies the UTF-16LE string while replacing mismatched surrogates with the
    * Unicode replacement character U+FFFD. We allow the input and output to be
-   * the same buffer so that the correction is done in-place.
+   * the same buffer so that the correction is done in-place; clean blocks are
+   * then not written to.
    *
    * Overridden by each implementation.
    *
@@ -5357,7 +10053,8 @@ public:
   /**
    * Copies the UTF-16BE string while replacing mismatched surrogates with the
    * Unicode replacement character U+FFFD. We allow the input and output to be
-   * the same buffer so that the correction is done in-place.
+   * the same buffer so that the correction is done in-place; clean blocks are
+   * then not written to.
    *
    * Overridden by each implementation.
    *
@@ -5406,6 +10103,44 @@ public:
   simdutf_warn_unused virtual result
   validate_utf32_with_errors(const char32_t *buf,
                              size_t len) const noexcept = 0;
+
+  /**
+   * Validate the UTF-32LE string and stop on error.
+   *
+   * Overridden by each implementation.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param buf the UTF-32LE string to validate.
+   * @param len the length of the string in number of 4-byte code units
+   * (char32_t).
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the error
+   * (in the input in code units) if any, or the number of code units validated
+   * if successful.
+   */
+  simdutf_warn_unused virtual result
+  validate_utf32le_with_errors(const char32_t *buf,
+                               size_t len) const noexcept = 0;
+
+  /**
+   * Validate the UTF-32BE string and stop on error.
+   *
+   * Overridden by each implementation.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param buf the UTF-32BE string to validate.
+   * @param len the length of the string in number of 4-byte code units
+   * (char32_t).
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the error
+   * (in the input in code units) if any, or the number of code units validated
+   * if successful.
+   */
+  simdutf_warn_unused virtual result
+  validate_utf32be_with_errors(const char32_t *buf,
+                               size_t len) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -5645,6 +10380,46 @@ public:
   virtual simdutf_warn_unused result utf8_length_from_utf16be_with_replacement(
       const char16_t *input, size_t length) const noexcept = 0;
 
+  /**
+   * Convert possibly broken UTF-8 string into UTF-16LE string, replacing each
+   * maximal subpart of an ill-formed sequence with U+FFFD.
+   *
+   * @param input         the UTF-8 string to convert
+   * @param length        the length of the string in bytes
+   * @param utf16_output  the pointer to buffer that can hold conversion result
+   * @return number of written code units
+   */
+  simdutf_warn_unused virtual size_t convert_utf8_to_utf16le_with_replacement(
+      const char *input, size_t length,
+      char16_t *utf16_output) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-8 string into UTF-16BE string, replacing each
+   * maximal subpart of an ill-formed sequence with U+FFFD.
+   *
+   * @param input         the UTF-8 string to convert
+   * @param length        the length of the string in bytes
+   * @param utf16_output  the pointer to buffer that can hold conversion result
+   * @return number of written code units
+   */
+  simdutf_warn_unused virtual size_t convert_utf8_to_utf16be_with_replacement(
+      const char *input, size_t length,
+      char16_t *utf16_output) const noexcept = 0;
+
+  /**
+   * Compute the number of 2-byte code units that this UTF-8 string would
+   * require in UTF-16 format when each maximal subpart of an ill-formed
+   * sequence is replaced with U+FFFD.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) where the count is the number of char16_t
+   * required, and the error code is either SUCCESS or the first error found.
+   */
+  virtual simdutf_warn_unused result utf16_length_from_utf8_with_replacement(
+      const char *input, size_t length) const noexcept = 0;
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -5681,6 +10456,33 @@ public:
   simdutf_warn_unused virtual result
   convert_utf8_to_utf32_with_errors(const char *input, size_t length,
                                     char32_t *utf32_output) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-8 string into UTF-32 string, replacing each
+   * maximal subpart of an ill-formed sequence with U+FFFD.
+   *
+   * @param input         the UTF-8 string to convert
+   * @param length        the length of the string in bytes
+   * @param utf32_output  the pointer to buffer that can hold conversion result
+   * @return number of written code units
+   */
+  simdutf_warn_unused virtual size_t convert_utf8_to_utf32_with_replacement(
+      const char *input, size_t length,
+      char32_t *utf32_output) const noexcept = 0;
+
+  /**
+   * Compute the number of 4-byte code units that this UTF-8 string would
+   * require in UTF-32 format when each maximal subpart of an ill-formed
+   * sequence is replaced with U+FFFD.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) where the count is the number of char32_t
+   * required, and the error code is either SUCCESS or the first error found.
+   */
+  virtual simdutf_warn_unused result utf32_length_from_utf8_with_replacement(
+      const char *input, size_t length) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
@@ -5744,6 +10546,22 @@ public:
    */
   simdutf_warn_unused virtual size_t
   utf16_length_from_utf8(const char *input, size_t length) const noexcept = 0;
+  /**
+   * Validate the UTF-8 string and, in the same pass, compute the number of
+   * 2-byte code units that it would require in UTF-16 format.
+   *
+   * Overridden by each implementation.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the
+   * error (in the input in code units) if any, or the number of
+   * char16_t code units required to encode the UTF-8 string if successful.
+   */
+  simdutf_warn_unused virtual result
+  utf16_length_from_utf8_with_errors(const char *input,
+                                    size_t length) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -5763,6 +10581,22 @@ public:
    */
   simdutf_warn_unused virtual size_t
   utf32_length_from_utf8(const char *input, size_t length) const noexcept = 0;
+  /**
+   * Validate the UTF-8 string and, in the same pass, compute the number of
+   * 4-byte code units that it would require in UTF-32 format.
+   *
+   * Overridden by each implementation.
+   *
+   * @param input         the UTF-8 string to process
+   * @param length        the length of the string in bytes
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the
+   * error (in the input in code units) if any, or the number of
+   * char32_t code units required to encode the UTF-8 string if successful.
+   */
+  simdutf_warn_unused virtual result
+  utf32_length_from_utf8_with_errors(const char *input,
+                                    size_t length) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
@@ -6279,44 +11113,103 @@ public:
    * @param input         the UTF-32 string to convert
    * @param length        the length of the string in 4-byte code units
    * (char32_t)
-   * @param latin1_buffer   the pointer to a buffer that can hold the conversion
+   * @param latin1_buffer   the pointer to a buffer that can hold the conversion
+   * result
+   * @return number of written code units; 0 if conversion is not possible
+   */
+  simdutf_warn_unused virtual size_t
+  convert_valid_utf32_to_latin1(const char32_t *input, size_t length,
+                                char *latin1_buffer) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+  /**
+   * Convert possibly broken UTF-32 string into UTF-8 string.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32 string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf8_buffer   the pointer to buffer that can hold conversion result
+   * @return number of written code units; 0 if input is not a valid UTF-32
+   * string
+   */
+  simdutf_warn_unused virtual size_t
+  convert_utf32_to_utf8(const char32_t *input, size_t length,
+                        char *utf8_buffer) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-32 string into UTF-8 string and stop on error.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32 string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf8_buffer   the pointer to buffer that can hold conversion result
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the error
+   * (in the input in code units) if any, or the number of char written if
+   * successful.
+   */
+  simdutf_warn_unused virtual result
+  convert_utf32_to_utf8_with_errors(const char32_t *input, size_t length,
+                                    char *utf8_buffer) const noexcept = 0;
+
+  /**
+   * Convert valid UTF-32 string into UTF-8 string.
+   *
+   * This function assumes that the input string is valid UTF-32.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32 string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf8_buffer   the pointer to a buffer that can hold the conversion
    * result
    * @return number of written code units; 0 if conversion is not possible
    */
   simdutf_warn_unused virtual size_t
-  convert_valid_utf32_to_latin1(const char32_t *input, size_t length,
-                                char *latin1_buffer) const noexcept = 0;
-#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+  convert_valid_utf32_to_utf8(const char32_t *input, size_t length,
+                              char *utf8_buffer) const noexcept = 0;
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
   /**
-   * Convert possibly broken UTF-32 string into UTF-8 string.
+   * Convert possibly broken UTF-32LE string into UTF-8 string.
    *
    * During the conversion also validation of the input string is done.
    * This function is suitable to work with inputs from untrusted sources.
    *
    * This function is not BOM-aware.
    *
-   * @param input         the UTF-32 string to convert
+   * @param input         the UTF-32LE string to convert
    * @param length        the length of the string in 4-byte code units
    * (char32_t)
    * @param utf8_buffer   the pointer to buffer that can hold conversion result
-   * @return number of written code units; 0 if input is not a valid UTF-32
+   * @return number of written code units; 0 if input is not a valid UTF-32LE
    * string
    */
   simdutf_warn_unused virtual size_t
-  convert_utf32_to_utf8(const char32_t *input, size_t length,
-                        char *utf8_buffer) const noexcept = 0;
+  convert_utf32le_to_utf8(const char32_t *input, size_t length,
+                          char *utf8_buffer) const noexcept = 0;
 
   /**
-   * Convert possibly broken UTF-32 string into UTF-8 string and stop on error.
+   * Convert possibly broken UTF-32LE string into UTF-8 string and stop on
+   * error.
    *
    * During the conversion also validation of the input string is done.
    * This function is suitable to work with inputs from untrusted sources.
    *
    * This function is not BOM-aware.
    *
-   * @param input         the UTF-32 string to convert
+   * @param input         the UTF-32LE string to convert
    * @param length        the length of the string in 4-byte code units
    * (char32_t)
    * @param utf8_buffer   the pointer to buffer that can hold conversion result
@@ -6326,26 +11219,49 @@ public:
    * successful.
    */
   simdutf_warn_unused virtual result
-  convert_utf32_to_utf8_with_errors(const char32_t *input, size_t length,
-                                    char *utf8_buffer) const noexcept = 0;
+  convert_utf32le_to_utf8_with_errors(const char32_t *input, size_t length,
+                                      char *utf8_buffer) const noexcept = 0;
 
   /**
-   * Convert valid UTF-32 string into UTF-8 string.
+   * Convert possibly broken UTF-32BE string into UTF-8 string.
    *
-   * This function assumes that the input string is valid UTF-32.
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
    *
    * This function is not BOM-aware.
    *
-   * @param input         the UTF-32 string to convert
+   * @param input         the UTF-32BE string to convert
    * @param length        the length of the string in 4-byte code units
    * (char32_t)
-   * @param utf8_buffer   the pointer to a buffer that can hold the conversion
-   * result
-   * @return number of written code units; 0 if conversion is not possible
+   * @param utf8_buffer   the pointer to buffer that can hold conversion result
+   * @return number of written code units; 0 if input is not a valid UTF-32BE
+   * string
    */
   simdutf_warn_unused virtual size_t
-  convert_valid_utf32_to_utf8(const char32_t *input, size_t length,
-                              char *utf8_buffer) const noexcept = 0;
+  convert_utf32be_to_utf8(const char32_t *input, size_t length,
+                          char *utf8_buffer) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-32BE string into UTF-8 string and stop on
+   * error.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32BE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf8_buffer   the pointer to buffer that can hold conversion result
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the error
+   * (in the input in code units) if any, or the number of char written if
+   * successful.
+   */
+  simdutf_warn_unused virtual result
+  convert_utf32be_to_utf8_with_errors(const char32_t *input, size_t length,
+                                      char *utf8_buffer) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
@@ -6482,6 +11398,90 @@ public:
   simdutf_warn_unused virtual size_t
   convert_valid_utf32_to_utf16be(const char32_t *input, size_t length,
                                  char16_t *utf16_buffer) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-32LE string into UTF-16 string with the
+   * native endianness.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32LE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf16_buffer   the pointer to buffer that can hold conversion result
+   * @return number of written code units; 0 if input is not a valid UTF-32LE
+   * string
+   */
+  simdutf_warn_unused virtual size_t
+  convert_utf32le_to_utf16(const char32_t *input, size_t length,
+                           char16_t *utf16_buffer) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-32LE string into UTF-16 string with the
+   * native endianness and stop on error.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32LE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf16_buffer   the pointer to buffer that can hold conversion result
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the error
+   * (in the input in code units) if any, or the number of char16_t written if
+   * successful.
+   */
+  simdutf_warn_unused virtual result convert_utf32le_to_utf16_with_errors(
+      const char32_t *input, size_t length,
+      char16_t *utf16_buffer) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-32BE string into UTF-16 string with the
+   * native endianness.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32BE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf16_buffer   the pointer to buffer that can hold conversion result
+   * @return number of written code units; 0 if input is not a valid UTF-32BE
+   * string
+   */
+  simdutf_warn_unused virtual size_t
+  convert_utf32be_to_utf16(const char32_t *input, size_t length,
+                           char16_t *utf16_buffer) const noexcept = 0;
+
+  /**
+   * Convert possibly broken UTF-32BE string into UTF-16 string with the
+   * native endianness and stop on error.
+   *
+   * During the conversion also validation of the input string is done.
+   * This function is suitable to work with inputs from untrusted sources.
+   *
+   * This function is not BOM-aware.
+   *
+   * @param input         the UTF-32BE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @param utf16_buffer   the pointer to buffer that can hold conversion result
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the error
+   * (in the input in code units) if any, or the number of char16_t written if
+   * successful.
+   */
+  simdutf_warn_unused virtual result convert_utf32be_to_utf16_with_errors(
+      const char32_t *input, size_t length,
+      char16_t *utf16_buffer) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16
@@ -6532,6 +11532,38 @@ public:
   simdutf_warn_unused virtual size_t
   utf8_length_from_utf32(const char32_t *input,
                          size_t length) const noexcept = 0;
+
+  /**
+   * Compute the number of bytes that this UTF-32LE string would require in
+   * UTF-8 format.
+   *
+   * This function does not validate the input. It is acceptable to pass invalid
+   * UTF-32 strings but in such cases the result is implementation defined.
+   *
+   * @param input         the UTF-32LE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @return the number of bytes required to encode the UTF-32LE string as UTF-8
+   */
+  simdutf_warn_unused virtual size_t
+  utf8_length_from_utf32le(const char32_t *input,
+                           size_t length) const noexcept = 0;
+
+  /**
+   * Compute the number of bytes that this UTF-32BE string would require in
+   * UTF-8 format.
+   *
+   * This function does not validate the input. It is acceptable to pass invalid
+   * UTF-32 strings but in such cases the result is implementation defined.
+   *
+   * @param input         the UTF-32BE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @return the number of bytes required to encode the UTF-32BE string as UTF-8
+   */
+  simdutf_warn_unused virtual size_t
+  utf8_length_from_utf32be(const char32_t *input,
+                           size_t length) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
@@ -6589,6 +11621,73 @@ public:
   }
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_LATIN1
+  /**
+   * Find the first byte in the range 0x80 to 0x9F, the C1 controls of Latin1,
+   * which windows-1252 maps to other characters. If there is none, return a
+   * pointer to the end of the string.
+   *
+   * @param start        the start of the string
+   * @param end          the end of the string
+   * @return a pointer to the first such byte, or end
+   */
+  simdutf_warn_unused virtual const char *
+  find_c1_control(const char *start, const char *end) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  /**
+   * Find the first byte which CESU-8 (or modified UTF-8) encodes differently
+   * from UTF-8: a byte in the range 0xF0 to 0xFF and, if modified is true, a
+   * null byte. If there is none, return a pointer to the end of the string.
+   *
+   * @param start        the start of the string
+   * @param end          the end of the string
+   * @param modified     whether the null byte is searched as well
+   * @return a pointer to the first such byte, or end
+   */
+  simdutf_warn_unused virtual const char *
+  find_cesu8_special(const char *start, const char *end,
+                     bool modified) const noexcept = 0;
+
+  /**
+   * Find the first UTF-16 code unit (native endianness) which CESU-8 (or
+   * modified UTF-8) encodes differently from UTF-8: a surrogate and, if
+   * modified is true, a null unit. If there is none, return a pointer to the
+   * end of the string.
+   *
+   * @param start        the start of the string
+   * @param end          the end of the string
+   * @param modified     whether the null unit is searched as well
+   * @return a pointer to the first such code unit, or end
+   */
+  simdutf_warn_unused virtual const char16_t *
+  find_cesu8_special(const char16_t *start, const char16_t *end,
+                     bool modified) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+  /**
+   * Convert a string in a single-byte encoding into UTF-16 string, using
+   * native endianness. The bytes 0x00 to 0x7F are ASCII and the bytes 0x80 to
+   * 0xFF are looked up in the table.
+   *
+   * The table must not contain surrogates: the sbcs functions of the simdutf
+   * namespace replace them by U+FFFD before calling this function.
+   *
+   * @param input         the string to convert
+   * @param length        the length of the string in bytes
+   * @param table         the 128-entry table of the encoding, see sbcs_table
+   * @param utf16_output  the pointer to buffer that can hold conversion result
+   * (length char16_t)
+   * @return the number of written char16_t
+   */
+  simdutf_warn_unused virtual size_t
+  convert_sbcs_to_utf16(const char *input, size_t length,
+                        const char16_t *table,
+                        char16_t *utf16_output) const noexcept = 0;
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
   /**
    * Compute the number of two-byte code units that this UTF-32 string would
@@ -6605,6 +11704,40 @@ public:
   simdutf_warn_unused virtual size_t
   utf16_length_from_utf32(const char32_t *input,
                           size_t length) const noexcept = 0;
+
+  /**
+   * Compute the number of two-byte code units that this UTF-32LE string would
+   * require in UTF-16 format.
+   *
+   * This function does not validate the input. It is acceptable to pass invalid
+   * UTF-32 strings but in such cases the result is implementation defined.
+   *
+   * @param input         the UTF-32LE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @return the number of bytes required to encode the UTF-32LE string as
+   * UTF-16
+   */
+  simdutf_warn_unused virtual size_t
+  utf16_length_from_utf32le(const char32_t *input,
+                            size_t length) const noexcept = 0;
+
+  /**
+   * Compute the number of two-byte code units that this UTF-32BE string would
+   * require in UTF-16 format.
+   *
+   * This function does not validate the input. It is acceptable to pass invalid
+   * UTF-32 strings but in such cases the result is implementation defined.
+   *
+   * @param input         the UTF-32BE string to convert
+   * @param length        the length of the string in 4-byte code units
+   * (char32_t)
+   * @return the number of bytes required to encode the UTF-32BE string as
+   * UTF-16
+   */
+  simdutf_warn_unused virtual size_t
+  utf16_length_from_utf32be(const char32_t *input,
+                            size_t length) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
@@ -7022,6 +12155,59 @@ public:
                            char character) const noexcept = 0;
   virtual const char16_t *find(const char16_t *start, const char16_t *end,
                                char16_t character) const noexcept = 0;
+
+  /**
+   * Convert a binary input to hexadecimal (base16), two digits per byte with
+   * the most significant digit first.
+   *
+   * This function always succeeds.
+   *
+   * @param input         the binary to process
+   * @param length        the length of the input in bytes
+   * @param output        the pointer to a buffer that can hold the conversion
+   * result (should be at least hex_length_from_binary(length) bytes long)
+   * @param options       the letter case of the digits a to f, hex_lowercase
+   * by default or hex_uppercase
+   * @return number of written bytes, will be equal to
+   * hex_length_from_binary(length)
+   */
+  virtual size_t
+  binary_to_hex(const char *input, size_t length, char *output,
+                hex_options options = hex_lowercase) const noexcept = 0;
+
+  /**
+   * Convert a hexadecimal (base16) input to binary, see
+   * simdutf::hex_to_binary.
+   *
+   * @param input         the hexadecimal string to process
+   * @param length        the length of the string in bytes
+   * @param output        the pointer to a buffer that can hold the conversion
+   * result (should be at least binary_length_from_hex(length) bytes long)
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the
+   * error (in the input in bytes) if any, or the number of bytes written if
+   * successful.
+   */
+  simdutf_warn_unused virtual result
+  hex_to_binary(const char *input, size_t length,
+                char *output) const noexcept = 0;
+
+  /**
+   * Convert a hexadecimal (base16) input stored as 16-bit units to binary,
+   * see simdutf::hex_to_binary.
+   *
+   * @param input         the hexadecimal string to process
+   * @param length        the length of the string in 16-bit units
+   * @param output        the pointer to a buffer that can hold the conversion
+   * result (should be at least binary_length_from_hex(length) bytes long)
+   * @return a result pair struct (of type simdutf::result containing the two
+   * fields error and count) with an error code and either position of the
+   * error (in the input in units) if any, or the number of bytes written if
+   * successful.
+   */
+  simdutf_warn_unused virtual result
+  hex_to_binary(const char16_t *input, size_t length,
+                char *output) const noexcept = 0;
 #endif // SIMDUTF_FEATURE_BASE64
 
 #ifdef SIMDUTF_INTERNAL_TESTS
@@ -7192,6 +12378,155 @@ get_available_implementations();
 extern SIMDUTF_DLLIMPORTEXPORT internal::atomic_ptr<const implementation> &
 get_active_implementation();
 
+#if SIMDUTF_FEATURE_UTF8
+namespace detail {
+// Inputs up to this many code units are converted into a buffer sized for the
+// worst case, which is then trimmed: a pass computing the exact size would
+// cost more than the memory it saves.
+constexpr size_t string_worst_case_limit = 4096;
+
+// Gives the string a size of capacity code units, lets convert write into
+// them and keeps the number of code units it returns. With C++23, the buffer
+// is not zero-filled first.
+template <typename String, typename Convert>
+void resize_and_convert(String &output, size_t capacity, Convert convert) {
+  #if __cpp_lib_string_resize_and_overwrite >= 202110L
+  output.resize_and_overwrite(
+      capacity, [&convert](typename String::value_type *buffer, size_t) {
+        return convert(buffer);
+      });
+  #else
+  output.resize(capacity);
+  output.resize(convert(&output[0]));
+  #endif
+}
+} // namespace detail
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+/**
+ * Convert a UTF-8 string into a newly allocated UTF-16 string (native
+ * endianness), replacing invalid UTF-8 with U+FFFD as in
+ * convert_utf8_to_utf16_with_replacement.
+ *
+ * Short inputs are converted in a single pass into a buffer that is large
+ * enough for any input, so the capacity of the result may exceed its size.
+ * Longer inputs are validated and measured in one pass, then converted into a
+ * buffer of the exact size. With C++23, the buffer is not zero-filled before
+ * the conversion.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param allocator     the allocator of the result
+ * @return the UTF-16 string
+ */
+template <typename Allocator = std::allocator<char16_t>>
+std::basic_string<char16_t, std::char_traits<char16_t>, Allocator>
+to_u16string(std::string_view input, const Allocator &allocator = Allocator()) {
+  std::basic_string<char16_t, std::char_traits<char16_t>, Allocator> output(
+      allocator);
+  size_t capacity = input.size();
+  bool valid = false;
+  if (input.size() > detail::string_worst_case_limit) {
+    const result r =
+        utf16_length_from_utf8_with_errors(input.data(), input.size());
+    valid = r.error == error_code::SUCCESS;
+    capacity = valid ? r.count
+                     : utf16_length_from_utf8_with_replacement(input.data(),
+                                                               input.size())
+                           .count;
+  }
+  detail::resize_and_convert(output, capacity, [&](char16_t *buffer) {
+    return valid ? convert_valid_utf8_to_utf16(input.data(), input.size(),
+                                               buffer)
+                 : convert_utf8_to_utf16_with_replacement(
+                       input.data(), input.size(), buffer);
+  });
+  return output;
+}
+
+/**
+ * Convert a UTF-16 string (native endianness) into a newly allocated UTF-8
+ * string, replacing unpaired surrogates with U+FFFD as in
+ * convert_utf16_to_utf8_with_replacement.
+ *
+ * Short inputs are converted in a single pass into a buffer that is large
+ * enough for any input, so the capacity of the result may exceed its size.
+ * Longer inputs are measured in one pass, then converted into a buffer of the
+ * exact size. With C++23, the buffer is not zero-filled before the conversion.
+ *
+ * This function is not BOM-aware.
+ *
+ * @param input         the UTF-16 string to convert
+ * @param allocator     the allocator of the result
+ * @return the UTF-8 string
+ */
+template <typename Allocator = std::allocator<char>>
+std::basic_string<char, std::char_traits<char>, Allocator>
+to_utf8_string(std::u16string_view input,
+               const Allocator &allocator = Allocator()) {
+  std::basic_string<char, std::char_traits<char>, Allocator> output(allocator);
+  size_t capacity = 3 * input.size();
+  bool valid = false;
+  if (input.size() > detail::string_worst_case_limit) {
+    const result r =
+        utf8_length_from_utf16_with_replacement(input.data(), input.size());
+    // Without any surrogate, the input is necessarily valid.
+    valid = r.error == error_code::SUCCESS;
+    capacity = r.count;
+  }
+  detail::resize_and_convert(output, capacity, [&](char *buffer) {
+    return valid ? convert_valid_utf16_to_utf8(input.data(), input.size(),
+                                               buffer)
+                 : convert_utf16_to_utf8_with_replacement(
+                       input.data(), input.size(), buffer);
+  });
+  return output;
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+/**
+ * Convert a UTF-8 string into a newly allocated UTF-32 string, replacing
+ * invalid UTF-8 with U+FFFD as in convert_utf8_to_utf32_with_replacement.
+ *
+ * Short inputs are converted in a single pass into a buffer that is large
+ * enough for any input, so the capacity of the result may exceed its size.
+ * Longer inputs are validated and measured in one pass, then converted into a
+ * buffer of the exact size. With C++23, the buffer is not zero-filled before
+ * the conversion.
+ *
+ * @param input         the UTF-8 string to convert
+ * @param allocator     the allocator of the result
+ * @return the UTF-32 string
+ */
+template <typename Allocator = std::allocator<char32_t>>
+std::basic_string<char32_t, std::char_traits<char32_t>, Allocator>
+to_u32string(std::string_view input, const Allocator &allocator = Allocator()) {
+  std::basic_string<char32_t, std::char_traits<char32_t>, Allocator> output(
+      allocator);
+  size_t capacity = input.size();
+  bool valid = false;
+  if (input.size() > detail::string_worst_case_limit) {
+    const result r =
+        utf32_length_from_utf8_with_errors(input.data(), input.size());
+    valid = r.error == error_code::SUCCESS;
+    capacity = valid ? r.count
+                     : utf32_length_from_utf8_with_replacement(input.data(),
+                                                               input.size())
+                           .count;
+  }
+  detail::resize_and_convert(output, capacity, [&](char32_t *buffer) {
+    return valid ? convert_valid_utf8_to_utf32(input.data(), input.size(),
+                                               buffer)
+                 : convert_utf8_to_utf32_with_replacement(
+                       input.data(), input.size(), buffer);
+  });
+  return output;
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
 } // namespace simdutf
 
 #if SIMDUTF_FEATURE_BASE64
@@ -0,0 +1,44 @@
+#ifndef SIMDUTF_CESU8_H
+#define SIMDUTF_CESU8_H
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace cesu8 {
+
+// CESU-8 and modified UTF-8 differ from UTF-8 only on the characters above
+// U+FFFF, that is on the bytes 0xF0 to 0xFF and on the surrogates, and, for
+// modified UTF-8, on the null character.
+template <bool modified>
+inline simdutf_constexpr23 bool is_special(uint8_t byte) noexcept {
+  return byte >= 0xf0 || (modified && byte == 0);
+}
+
+template <bool modified>
+inline simdutf_constexpr23 bool is_special(char16_t unit) noexcept {
+  return (unit & 0xf800) == 0xd800 || (modified && unit == 0);
+}
+
+// Returns the position of the first special byte or code unit in
+// data[from, len), or len. The backends have vectorized versions of this scan
+// (implementation::find_cesu8_special).
+template <bool modified, typename char_type>
+inline size_t find_special(const char_type *data, size_t from,
+                           size_t len) noexcept {
+  using unit_type =
+      typename std::conditional<sizeof(char_type) == 1, uint8_t,
+                                char16_t>::type;
+  for (size_t pos = from; pos < len; pos++) {
+    if (is_special<modified>(unit_type(data[pos]))) {
+      return pos;
+    }
+  }
+  return len;
+}
+
+} // namespace cesu8
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
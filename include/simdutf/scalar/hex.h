@@ -0,0 +1,63 @@
+#ifndef SIMDUTF_HEX_H
+#define SIMDUTF_HEX_H
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace hex {
+
+constexpr char lower_digits[17] = "0123456789abcdef";
+constexpr char upper_digits[17] = "0123456789ABCDEF";
+
+// The value of a hexadecimal digit of either case, or 0xff.
+simdutf_constexpr23 uint8_t digit_value(uint32_t c) noexcept {
+  if (c - '0' < 10) {
+    return uint8_t(c - '0');
+  }
+  const uint32_t lower = (c | 0x20) - 'a';
+  return lower < 6 ? uint8_t(lower + 10) : 0xff;
+}
+
+// Writes two digits per byte and returns the number of digits written.
+inline size_t encode(const char *input, size_t length, char *output,
+                     hex_options options) noexcept {
+  const char *digits =
+      options == hex_options::hex_uppercase ? upper_digits : lower_digits;
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t byte = uint8_t(input[i]);
+    output[2 * i] = digits[byte >> 4];
+    output[2 * i + 1] = digits[byte & 0xf];
+  }
+  return 2 * length;
+}
+
+// Decodes pairs of digits. On error, the bytes of the pairs before it are
+// written and r.count is the position of the invalid digit. An odd number of
+// digits gives HEX_INPUT_REMAINDER with the number of bytes written.
+template <class char_type>
+result decode(const char_type *input, size_t length, char *output) noexcept {
+  const size_t pairs = length / 2;
+  for (size_t i = 0; i < pairs; i++) {
+    const uint8_t high = digit_value(uint32_t(input[2 * i]));
+    const uint8_t low = digit_value(uint32_t(input[2 * i + 1]));
+    if ((high | low) == 0xff) {
+      return result(error_code::INVALID_HEX_CHARACTER,
+                    high == 0xff ? 2 * i : 2 * i + 1);
+    }
+    output[i] = char((high << 4) | low);
+  }
+  if (length % 2 != 0) {
+    if (digit_value(uint32_t(input[length - 1])) == 0xff) {
+      return result(error_code::INVALID_HEX_CHARACTER, length - 1);
+    }
+    return result(error_code::HEX_INPUT_REMAINDER, pairs);
+  }
+  return result(error_code::SUCCESS, pairs);
+}
+
+} // namespace hex
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
@@ -0,0 +1,341 @@
+#ifndef SIMDUTF_JSON_H
+#define SIMDUTF_JSON_H
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace json {
+
+// A JSON string cannot contain the quotation mark, the reverse solidus or the
+// control characters U+0000 to U+001F unescaped (RFC 8259, section 7).
+simdutf_constexpr23 bool needs_escape(uint8_t byte) noexcept {
+  return byte < 0x20 || byte == '"' || byte == '\\';
+}
+
+// Returns the position of the first byte in data[from, len) that must be
+// escaped, or len.
+template <typename BytePtr>
+simdutf_constexpr23 size_t find_escape(BytePtr data, size_t from,
+                                       size_t len) noexcept {
+  for (size_t i = from; i < len; i++) {
+    if (needs_escape(uint8_t(data[i]))) {
+      return i;
+    }
+  }
+  return len;
+}
+
+template <typename BytePtr>
+simdutf_constexpr23 simdutf_warn_unused result
+validate_utf8_and_find_escape(BytePtr data, size_t len) noexcept {
+  const result r = utf8::validate_with_errors(data, len);
+  if (r.error != error_code::SUCCESS) {
+    return r;
+  }
+  return result(error_code::SUCCESS, find_escape(data, 0, len));
+}
+
+// Validates the UTF-8 character that starts with the non-ASCII byte at
+// input[pos], reading only its own bytes. The count of an error is relative to
+// pos.
+inline result validate_char(const char *input, size_t length,
+                            size_t pos) noexcept {
+  const uint8_t byte = uint8_t(input[pos]);
+  const size_t expected = byte >= 0xf0   ? 4
+                          : byte >= 0xe0 ? 3
+                          : byte >= 0xc0 ? 2
+                                         : 1;
+  return utf8::validate_with_errors(
+      input + pos, expected < length - pos ? expected : length - pos);
+}
+
+// Scalar counterpart of the vectorized kernels: validates and copies the bytes
+// before the first one that must be escaped (or that is not ASCII, when
+// ascii_only is true), and returns their number or the first UTF-8 error
+// among them.
+inline result validate_and_copy_until_escape(const char *input, size_t length,
+                                             char *output,
+                                             bool ascii_only) noexcept {
+  size_t i = 0;
+  while (i < length) {
+    const uint8_t byte = uint8_t(input[i]);
+    if (needs_escape(byte) || (ascii_only && byte >= 0x80)) {
+      break;
+    }
+    if (byte < 0x80) {
+      output[i] = input[i];
+      i++;
+      continue;
+    }
+    const result r = validate_char(input, length, i);
+    if (r.error != error_code::SUCCESS) {
+      return result(r.error, i + r.count);
+    }
+    for (const size_t end = i + r.count; i < end; i++) {
+      output[i] = input[i];
+    }
+  }
+  return result(error_code::SUCCESS, i);
+}
+
+// Writes \uXXXX, with lowercase hexadecimal digits as JSON.stringify does.
+inline char *write_unicode_escape(char *output, uint32_t unit) noexcept {
+  constexpr char digits[] = "0123456789abcdef";
+  output[0] = '\\';
+  output[1] = 'u';
+  output[2] = digits[(unit >> 12) & 0xf];
+  output[3] = digits[(unit >> 8) & 0xf];
+  output[4] = digits[(unit >> 4) & 0xf];
+  output[5] = digits[unit & 0xf];
+  return output + 6;
+}
+
+// Escapes the character at input[pos], a byte that must be escaped or the
+// leading byte of a non-ASCII character, and moves pos past it. Returns the
+// number of bytes written, at most 12. The input must be valid UTF-8.
+inline size_t escape_char(const char *input, size_t &pos,
+                          char *output) noexcept {
+  const uint8_t byte = uint8_t(input[pos]);
+  if (byte < 0x80) {
+    pos++;
+    char short_form = 0;
+    switch (byte) {
+    case '"':
+      short_form = '"';
+      break;
+    case '\\':
+      short_form = '\\';
+      break;
+    case '\b':
+      short_form = 'b';
+      break;
+    case '\f':
+      short_form = 'f';
+      break;
+    case '\n':
+      short_form = 'n';
+      break;
+    case '\r':
+      short_form = 'r';
+      break;
+    case '\t':
+      short_form = 't';
+      break;
+    default:
+      write_unicode_escape(output, byte);
+      return 6;
+    }
+    output[0] = '\\';
+    output[1] = short_form;
+    return 2;
+  }
+  uint32_t code_point;
+  if (byte < 0xe0) {
+    code_point = uint32_t(byte & 0x1f) << 6 | (uint8_t(input[pos + 1]) & 0x3f);
+    pos += 2;
+  } else if (byte < 0xf0) {
+    code_point = uint32_t(byte & 0x0f) << 12 |
+                 uint32_t(uint8_t(input[pos + 1]) & 0x3f) << 6 |
+                 (uint8_t(input[pos + 2]) & 0x3f);
+    pos += 3;
+  } else {
+    code_point = uint32_t(byte & 0x07) << 18 |
+                 uint32_t(uint8_t(input[pos + 1]) & 0x3f) << 12 |
+                 uint32_t(uint8_t(input[pos + 2]) & 0x3f) << 6 |
+                 (uint8_t(input[pos + 3]) & 0x3f);
+    pos += 4;
+  }
+  if (code_point < 0x10000) {
+    write_unicode_escape(output, code_point);
+    return 6;
+  }
+  code_point -= 0x10000;
+  write_unicode_escape(output, 0xd800 + (code_point >> 10));
+  write_unicode_escape(output + 6, 0xdc00 + (code_point & 0x3ff));
+  return 12;
+}
+
+// Escapes UTF-8 input, which is validated on the way: the input is read once.
+// copy_until_escape(input, length, output) validates and copies the bytes that
+// can be kept as they are and returns their number, or the first UTF-8 error
+// among them; it may write up to 64 bytes past them.
+template <typename CopyUntilEscape>
+result escape(const char *input, size_t length, char *output,
+              CopyUntilEscape copy_until_escape) noexcept {
+  size_t pos = 0;
+  size_t written = 0;
+  while (true) {
+    const result run =
+        copy_until_escape(input + pos, length - pos, output + written);
+    if (run.error != error_code::SUCCESS) {
+      return result(run.error, pos + run.count);
+    }
+    pos += run.count;
+    written += run.count;
+    if (pos == length) {
+      return result(error_code::SUCCESS, written);
+    }
+    // With ascii_only, the runs stop before the non-ASCII characters.
+    if (uint8_t(input[pos]) >= 0x80) {
+      const result r = validate_char(input, length, pos);
+      if (r.error != error_code::SUCCESS) {
+        return result(r.error, pos + r.count);
+      }
+    }
+    written += escape_char(input, pos, output + written);
+  }
+}
+
+inline bool parse_hex4(const char *input, uint32_t &value) noexcept {
+  value = 0;
+  for (size_t i = 0; i < 4; i++) {
+    const char c = input[i];
+    uint32_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = uint32_t(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      digit = uint32_t(c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      digit = uint32_t(c - 'A' + 10);
+    } else {
+      return false;
+    }
+    value = value << 4 | digit;
+  }
+  return true;
+}
+
+// Decodes the escape sequence at input[pos], which is a backslash, and moves
+// pos past it. A \uXXXX escape of a high surrogate must be followed by the
+// escape of a low surrogate.
+inline error_code unescape_char(const char *input, size_t length, size_t &pos,
+                                uint32_t &code_point) noexcept {
+  if (length - pos < 2) {
+    return error_code::INVALID_JSON_ESCAPE;
+  }
+  switch (input[pos + 1]) {
+  case '"':
+  case '\\':
+  case '/':
+    code_point = uint8_t(input[pos + 1]);
+    pos += 2;
+    return error_code::SUCCESS;
+  case 'b':
+    code_point = '\b';
+    pos += 2;
+    return error_code::SUCCESS;
+  case 'f':
+    code_point = '\f';
+    pos += 2;
+    return error_code::SUCCESS;
+  case 'n':
+    code_point = '\n';
+    pos += 2;
+    return error_code::SUCCESS;
+  case 'r':
+    code_point = '\r';
+    pos += 2;
+    return error_code::SUCCESS;
+  case 't':
+    code_point = '\t';
+    pos += 2;
+    return error_code::SUCCESS;
+  case 'u':
+    break;
+  default:
+    return error_code::INVALID_JSON_ESCAPE;
+  }
+  if (length - pos < 6 || !parse_hex4(input + pos + 2, code_point)) {
+    return error_code::INVALID_JSON_ESCAPE;
+  }
+  if ((code_point & 0xf800) != 0xd800) {
+    pos += 6;
+    return error_code::SUCCESS;
+  }
+  uint32_t low;
+  if (code_point >= 0xdc00 || length - pos < 12 || input[pos + 6] != '\\' ||
+      input[pos + 7] != 'u' || !parse_hex4(input + pos + 8, low) ||
+      (low & 0xfc00) != 0xdc00) {
+    return error_code::SURROGATE;
+  }
+  code_point = 0x10000 + ((code_point - 0xd800) << 10) + (low - 0xdc00);
+  pos += 12;
+  return error_code::SUCCESS;
+}
+
+inline size_t encode(uint32_t code_point, char *output) noexcept {
+  if (code_point < 0x80) {
+    output[0] = char(code_point);
+    return 1;
+  }
+  if (code_point < 0x800) {
+    output[0] = char(0xc0 | (code_point >> 6));
+    output[1] = char(0x80 | (code_point & 0x3f));
+    return 2;
+  }
+  if (code_point < 0x10000) {
+    output[0] = char(0xe0 | (code_point >> 12));
+    output[1] = char(0x80 | ((code_point >> 6) & 0x3f));
+    output[2] = char(0x80 | (code_point & 0x3f));
+    return 3;
+  }
+  output[0] = char(0xf0 | (code_point >> 18));
+  output[1] = char(0x80 | ((code_point >> 12) & 0x3f));
+  output[2] = char(0x80 | ((code_point >> 6) & 0x3f));
+  output[3] = char(0x80 | (code_point & 0x3f));
+  return 4;
+}
+
+inline size_t encode(uint32_t code_point, char16_t *output) noexcept {
+  if (code_point < 0x10000) {
+    output[0] = char16_t(code_point);
+    return 1;
+  }
+  code_point -= 0x10000;
+  output[0] = char16_t(0xd800 + (code_point >> 10));
+  output[1] = char16_t(0xdc00 + (code_point & 0x3ff));
+  return 2;
+}
+
+// Unescapes UTF-8 input, which is validated on the way: the input is read
+// once. copy_run(input, length, output, units) validates and copies (or
+// transcodes) the characters before the first byte that must be escaped,
+// stores the number of code units written in units and returns the number of
+// bytes consumed, or the first UTF-8 error among them.
+template <typename char_type, typename CopyRun>
+result unescape(const char *input, size_t length, char_type *output,
+                CopyRun copy_run) noexcept {
+  size_t pos = 0;
+  size_t written = 0;
+  while (true) {
+    size_t units = 0;
+    const result run =
+        copy_run(input + pos, length - pos, output + written, units);
+    if (run.error != error_code::SUCCESS) {
+      return result(run.error, pos + run.count);
+    }
+    pos += run.count;
+    written += units;
+    if (pos == length) {
+      return result(error_code::SUCCESS, written);
+    }
+    // A quotation mark or a control character that is not escaped.
+    if (input[pos] != '\\') {
+      return result(error_code::INVALID_JSON_ESCAPE, pos);
+    }
+    const size_t start = pos;
+    uint32_t code_point;
+    const error_code error = unescape_char(input, length, pos, code_point);
+    if (error != error_code::SUCCESS) {
+      return result(error, start);
+    }
+    written += encode(code_point, output + written);
+  }
+}
+
+} // namespace json
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef SIMDUTF_SBCS_H
+#define SIMDUTF_SBCS_H
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace sbcs {
+
+// The bytes 0x00 to 0x7F are ASCII and the 128-entry table gives the code
+// units of the bytes 0x80 to 0xFF.
+inline size_t convert(const char *input, size_t length, const char16_t *table,
+                      char16_t *output) noexcept {
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t byte = uint8_t(input[i]);
+    output[i] = byte < 0x80 ? char16_t(byte) : table[byte - 0x80];
+  }
+  return length;
+}
+
+} // namespace sbcs
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
@@ -201,7 +201,7 @@ simdutf_constexpr23 void to_well_formed_utf16(const char16_t *input, size_t len,
 
     if (!high_surrogate_prev && low_surrogate) {
       output[i] = replacement;
-    } else {
+    } else if (input != output) {
       output[i] = input[i];
     }
     high_surrogate_prev = high_surrogate;
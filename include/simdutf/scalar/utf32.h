@@ -26,7 +26,7 @@ simdutf_warn_unused simdutf_really_inline bool validate(const char32_t *buf,
   return validate(reinterpret_cast<const uint32_t *>(buf), len);
 }
 
-template <typename InputPtr>
+template <endianness utf32_endian = endianness::NATIVE, typename InputPtr>
 #if SIMDUTF_CPLUSPLUS20
   requires simdutf::detail::indexes_into_uint32<InputPtr>
 #endif
@@ -34,7 +34,7 @@ simdutf_warn_unused simdutf_constexpr23 result
 validate_with_errors(InputPtr data, size_t len) noexcept {
   size_t pos = 0;
   for (; pos < len; pos++) {
-    uint32_t word = data[pos];
+    uint32_t word = swap_if_needed<utf32_endian>(data[pos]);
     if (word > 0x10FFFF) {
       return result(error_code::TOO_LARGE, pos);
     }
@@ -45,36 +45,50 @@ validate_with_errors(InputPtr data, size_t len) noexcept {
   return result(error_code::SUCCESS, pos);
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 simdutf_warn_unused simdutf_really_inline result
 validate_with_errors(const char32_t *buf, size_t len) noexcept {
-  return validate_with_errors(reinterpret_cast<const uint32_t *>(buf), len);
+  return validate_with_errors<utf32_endian>(
+      reinterpret_cast<const uint32_t *>(buf), len);
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 inline simdutf_constexpr23 size_t utf8_length_from_utf32(const char32_t *p,
                                                          size_t len) {
   // We are not BOM aware.
   size_t counter{0};
   for (size_t i = 0; i < len; i++) {
+    const uint32_t word = swap_if_needed<utf32_endian>(p[i]);
     // credit: @ttsugriy  for the vectorizable approach
     counter++;                                     // ASCII
-    counter += static_cast<size_t>(p[i] > 0x7F);   // two-byte
-    counter += static_cast<size_t>(p[i] > 0x7FF);  // three-byte
-    counter += static_cast<size_t>(p[i] > 0xFFFF); // four-bytes
+    counter += static_cast<size_t>(word > 0x7F);   // two-byte
+    counter += static_cast<size_t>(word > 0x7FF);  // three-byte
+    counter += static_cast<size_t>(word > 0xFFFF); // four-bytes
   }
   return counter;
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 inline simdutf_warn_unused simdutf_constexpr23 size_t
 utf16_length_from_utf32(const char32_t *p, size_t len) {
   // We are not BOM aware.
   size_t counter{0};
   for (size_t i = 0; i < len; i++) {
-    counter++;                                     // non-surrogate word
-    counter += static_cast<size_t>(p[i] > 0xFFFF); // surrogate pair
+    counter++; // non-surrogate word
+    counter += static_cast<size_t>(swap_if_needed<utf32_endian>(p[i]) >
+                                   0xFFFF); // surrogate pair
   }
   return counter;
 }
 
+// A plain loop: compilers turn it into vector byte shuffles.
+simdutf_really_inline simdutf_constexpr23 void
+change_endianness_utf32(const char32_t *input, size_t size, char32_t *output) {
+  for (size_t i = 0; i < size; i++) {
+    output[i] = char32_t(u32_swap_bytes(uint32_t(input[i])));
+  }
+}
+
 } // namespace utf32
 } // namespace scalar
 } // namespace simdutf
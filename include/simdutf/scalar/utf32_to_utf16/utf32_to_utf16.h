@@ -6,13 +6,13 @@ namespace scalar {
 namespace {
 namespace utf32_to_utf16 {
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 simdutf_constexpr23 size_t convert(const char32_t *data, size_t len,
                                    char16_t *utf16_output) {
   size_t pos = 0;
   char16_t *start{utf16_output};
   while (pos < len) {
-    uint32_t word = data[pos];
+    uint32_t word = utf32::swap_if_needed<utf32_endian>(data[pos]);
     if ((word & 0xFFFF0000) == 0) {
       if (word >= 0xD800 && word <= 0xDFFF) {
         return 0;
@@ -41,13 +41,13 @@ simdutf_constexpr23 size_t convert(const char32_t *data, size_t len,
   return utf16_output - start;
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 simdutf_constexpr23 result convert_with_errors(const char32_t *data, size_t len,
                                                char16_t *utf16_output) {
   size_t pos = 0;
   char16_t *start{utf16_output};
   while (pos < len) {
-    uint32_t word = data[pos];
+    uint32_t word = utf32::swap_if_needed<utf32_endian>(data[pos]);
     if ((word & 0xFFFF0000) == 0) {
       if (word >= 0xD800 && word <= 0xDFFF) {
         return result(error_code::SURROGATE, pos);
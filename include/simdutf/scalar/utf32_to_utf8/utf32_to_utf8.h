@@ -8,7 +8,8 @@ namespace scalar {
 namespace {
 namespace utf32_to_utf8 {
 
-template <typename InputPtr, typename OutputPtr>
+template <endianness utf32_endian = endianness::NATIVE, typename InputPtr,
+          typename OutputPtr>
 #if SIMDUTF_CPLUSPLUS20
   requires(simdutf::detail::indexes_into_utf32<InputPtr> &&
            simdutf::detail::index_assignable_from_char<OutputPtr>)
@@ -24,18 +25,24 @@ simdutf_constexpr23 size_t convert(InputPtr data, size_t len,
     { // try to convert the next block of 2 ASCII characters
       if (pos + 2 <= len) { // if it is safe to read 8 more bytes, check that
                             // they are ascii
+        // the mask is applied before swapping the code units
+        constexpr uint64_t non_ascii = match_system(utf32_endian)
+                                           ? 0xFFFFFF80FFFFFF80
+                                           : 0x80FFFFFF80FFFFFF;
         uint64_t v;
         ::memcpy(&v, data + pos, sizeof(uint64_t));
-        if ((v & 0xFFFFFF80FFFFFF80) == 0) {
-          *utf8_output++ = char(data[pos]);
-          *utf8_output++ = char(data[pos + 1]);
+        if ((v & non_ascii) == 0) {
+          *utf8_output++ =
+              char(utf32::swap_if_needed<utf32_endian>(data[pos]));
+          *utf8_output++ =
+              char(utf32::swap_if_needed<utf32_endian>(data[pos + 1]));
           pos += 2;
           continue;
         }
       }
     }
 
-    uint32_t word = data[pos];
+    uint32_t word = utf32::swap_if_needed<utf32_endian>(data[pos]);
     if ((word & 0xFFFFFF80) == 0) {
       // will generate one UTF-8 bytes
       *utf8_output++ = char(word);
@@ -72,7 +79,8 @@ simdutf_constexpr23 size_t convert(InputPtr data, size_t len,
   return utf8_output - start;
 }
 
-template <typename InputPtr, typename OutputPtr>
+template <endianness utf32_endian = endianness::NATIVE, typename InputPtr,
+          typename OutputPtr>
 #if SIMDUTF_CPLUSPLUS20
   requires(simdutf::detail::indexes_into_utf32<InputPtr> &&
            simdutf::detail::index_assignable_from_char<OutputPtr>)
@@ -88,18 +96,24 @@ simdutf_constexpr23 result convert_with_errors(InputPtr data, size_t len,
     { // try to convert the next block of 2 ASCII characters
       if (pos + 2 <= len) { // if it is safe to read 8 more bytes, check that
                             // they are ascii
+        // the mask is applied before swapping the code units
+        constexpr uint64_t non_ascii = match_system(utf32_endian)
+                                           ? 0xFFFFFF80FFFFFF80
+                                           : 0x80FFFFFF80FFFFFF;
         uint64_t v;
         ::memcpy(&v, data + pos, sizeof(uint64_t));
-        if ((v & 0xFFFFFF80FFFFFF80) == 0) {
-          *utf8_output++ = char(data[pos]);
-          *utf8_output++ = char(data[pos + 1]);
+        if ((v & non_ascii) == 0) {
+          *utf8_output++ =
+              char(utf32::swap_if_needed<utf32_endian>(data[pos]));
+          *utf8_output++ =
+              char(utf32::swap_if_needed<utf32_endian>(data[pos + 1]));
           pos += 2;
           continue;
         }
       }
     }
 
-    uint32_t word = data[pos];
+    uint32_t word = utf32::swap_if_needed<utf32_endian>(data[pos]);
     if ((word & 0xFFFFFF80) == 0) {
       // will generate one UTF-8 bytes
       *utf8_output++ = char(word);
@@ -284,6 +284,236 @@ simdutf_constexpr23 size_t utf16_length_from_utf8(InputPtr data, size_t len) {
   return counter;
 }
 
+// Returns the UTF-16 length of the string if it is valid, or its first error.
+template <typename BytePtr>
+simdutf_constexpr23 simdutf_warn_unused result
+utf16_length_from_utf8_with_errors(BytePtr data, size_t len) noexcept {
+  const result r = validate_with_errors(data, len);
+  if (r.error != error_code::SUCCESS) {
+    return r;
+  }
+  return result(error_code::SUCCESS, utf16_length_from_utf8(data, len));
+}
+
+// Returns the UTF-32 length of the string if it is valid, or its first error.
+template <typename BytePtr>
+simdutf_constexpr23 simdutf_warn_unused result
+utf32_length_from_utf8_with_errors(BytePtr data, size_t len) noexcept {
+  const result r = validate_with_errors(data, len);
+  if (r.error != error_code::SUCCESS) {
+    return r;
+  }
+  return result(error_code::SUCCESS, count_code_points(data, len));
+}
+
+// Records in line_positions the position of each newline ('\n') in data[from,
+// to), as long as there is room for it: on return, line_count is the number of
+// recorded positions. Returns the position of the first newline that did not
+// fit, or to.
+inline size_t index_lines(const char *data, size_t from, size_t to,
+                          size_t *line_positions, size_t capacity,
+                          size_t &line_count) noexcept {
+  for (size_t i = from; i < to; i++) {
+    if (data[i] == '\n') {
+      if (line_count == capacity) {
+        return i;
+      }
+      line_positions[line_count++] = i;
+    }
+  }
+  return to;
+}
+
+// Used by the vectorized validate_and_index_lines once an error is known to be
+// at or after start, when the newlines before indexed have been recorded:
+// finds the error, forgets the newlines after it and records the ones in
+// [indexed, error).
+inline result index_lines_until_error(const char *data, size_t len,
+                                      size_t start, size_t indexed,
+                                      size_t *line_positions, size_t capacity,
+                                      size_t &line_count) noexcept {
+  result r = rewind_and_validate_with_errors(data, data + start, len - start);
+  r.count += start;
+  while (line_count > 0 && line_positions[line_count - 1] >= r.count) {
+    line_count--;
+  }
+  const size_t stop =
+      index_lines(data, indexed, r.count, line_positions, capacity, line_count);
+  if (stop != r.count) {
+    return result(error_code::OUTPUT_BUFFER_TOO_SMALL, stop);
+  }
+  return r;
+}
+
+// Validates the string and records the positions of its newlines before the
+// first error. On entry, line_count is the capacity of line_positions. When
+// it is too small, OUTPUT_BUFFER_TOO_SMALL is returned with the position of
+// the first newline that did not fit: the input before it is valid.
+inline result validate_and_index_lines(const char *data, size_t len,
+                                       size_t *line_positions,
+                                       size_t &line_count) noexcept {
+  const size_t capacity = line_count;
+  line_count = 0;
+  const result r = validate_with_errors(data, len);
+  const size_t end = r.error == error_code::SUCCESS ? len : r.count;
+  const size_t stop =
+      index_lines(data, 0, end, line_positions, capacity, line_count);
+  if (stop != end) {
+    return result(error_code::OUTPUT_BUFFER_TOO_SMALL, stop);
+  }
+  return r;
+}
+
+// Returns the length of the maximal subpart of the ill-formed sequence that
+// starts at data: the longest prefix of a well-formed character, or a single
+// byte. The WHATWG Encoding Standard replaces each maximal subpart by one
+// U+FFFD.
+template <typename InputPtr>
+#if SIMDUTF_CPLUSPLUS20
+  requires simdutf::detail::indexes_into_byte_like<InputPtr>
+#endif
+simdutf_constexpr23 size_t maximal_subpart_length(InputPtr data, size_t len) {
+  const uint8_t leading_byte = uint8_t(data[0]);
+  size_t continuations;
+  uint8_t lower = 0x80;
+  uint8_t upper = 0xbf;
+  if (leading_byte >= 0xc2 && leading_byte <= 0xdf) {
+    continuations = 1;
+  } else if (leading_byte >= 0xe0 && leading_byte <= 0xef) {
+    continuations = 2;
+    if (leading_byte == 0xe0) {
+      lower = 0xa0; // overlong
+    } else if (leading_byte == 0xed) {
+      upper = 0x9f; // surrogate
+    }
+  } else if (leading_byte >= 0xf0 && leading_byte <= 0xf4) {
+    continuations = 3;
+    if (leading_byte == 0xf0) {
+      lower = 0x90; // overlong
+    } else if (leading_byte == 0xf4) {
+      upper = 0x8f; // too large
+    }
+  } else {
+    return 1;
+  }
+  size_t pos = 1;
+  while (pos <= continuations && pos < len) {
+    const uint8_t byte = uint8_t(data[pos]);
+    if (byte < lower || byte > upper) {
+      break;
+    }
+    lower = 0x80;
+    upper = 0xbf;
+    pos++;
+  }
+  return pos;
+}
+
+// Converts with convert_with_errors, replacing each maximal subpart of an
+// ill-formed sequence by the replacement character. On error,
+// convert_with_errors only reports the position of the error: valid_prefix
+// must then leave the conversion of the valid bytes before it in the output,
+// and return its length.
+template <typename InputPtr, typename char_type, typename ConvertWithErrors,
+          typename ValidPrefix>
+simdutf_constexpr23 size_t convert_with_replacement_via(
+    ConvertWithErrors convert_with_errors, ValidPrefix valid_prefix,
+    InputPtr data, size_t len, char_type *output, char_type replacement) {
+  char_type *const start = output;
+  size_t pos = 0;
+  while (pos < len) {
+    const result r = convert_with_errors(data + pos, len - pos, output);
+    if (r.error == error_code::SUCCESS) {
+      output += r.count;
+      break;
+    }
+    output += valid_prefix(data + pos, r.count, output);
+    *output++ = replacement;
+    pos += r.count;
+    pos += maximal_subpart_length(data + pos, len - pos);
+  }
+  return size_t(output - start);
+}
+
+// Returns the output length when each maximal subpart of an ill-formed
+// sequence is replaced by U+FFFD, which takes replacement_length code units
+// (one in UTF-16 and UTF-32, three in UTF-8), along with the first error that
+// validate_with_errors reports.
+template <typename InputPtr, typename ValidateWithErrors, typename Length>
+simdutf_constexpr23 result length_with_replacement_via(
+    ValidateWithErrors validate_with_errors, Length length, InputPtr data,
+    size_t len, size_t replacement_length = 1) {
+  result answer(error_code::SUCCESS, 0);
+  size_t pos = 0;
+  while (pos < len) {
+    const result r = validate_with_errors(data + pos, len - pos);
+    if (r.error == error_code::SUCCESS) {
+      answer.count += length(data + pos, len - pos);
+      break;
+    }
+    if (answer.error == error_code::SUCCESS) {
+      answer.error = r.error;
+    }
+    answer.count += length(data + pos, r.count) + replacement_length;
+    pos += r.count;
+    pos += maximal_subpart_length(data + pos, len - pos);
+  }
+  return answer;
+}
+
+template <typename BytePtr>
+simdutf_constexpr23 simdutf_warn_unused result
+utf16_length_from_utf8_with_replacement(BytePtr data, size_t len) noexcept {
+  return length_with_replacement_via(
+      [](BytePtr d, size_t l) { return validate_with_errors(d, l); },
+      [](BytePtr d, size_t l) { return utf16_length_from_utf8(d, l); }, data,
+      len);
+}
+
+template <typename BytePtr>
+simdutf_constexpr23 simdutf_warn_unused result
+utf32_length_from_utf8_with_replacement(BytePtr data, size_t len) noexcept {
+  return length_with_replacement_via(
+      [](BytePtr d, size_t l) { return validate_with_errors(d, l); },
+      [](BytePtr d, size_t l) { return count_code_points(d, l); }, data, len);
+}
+
+template <typename BytePtr>
+simdutf_constexpr23 simdutf_warn_unused result
+well_formed_length(BytePtr data, size_t len) noexcept {
+  return length_with_replacement_via(
+      [](BytePtr d, size_t l) { return validate_with_errors(d, l); },
+      [](BytePtr, size_t l) { return l; }, data, len, 3);
+}
+
+// Copies the UTF-8 string, replacing each maximal subpart of an ill-formed
+// sequence by U+FFFD (EF BF BD).
+template <typename BytePtr, typename OutputPtr>
+#if SIMDUTF_CPLUSPLUS20
+  requires simdutf::detail::index_assignable_from_char<OutputPtr>
+#endif
+simdutf_constexpr23 size_t to_well_formed(BytePtr data, size_t len,
+                                          OutputPtr output) noexcept {
+  size_t pos = 0;
+  size_t output_pos = 0;
+  while (pos < len) {
+    const result r = validate_with_errors(data + pos, len - pos);
+    const size_t valid = r.error == error_code::SUCCESS ? len - pos : r.count;
+    for (size_t i = 0; i < valid; i++) {
+      output[output_pos++] = char(data[pos + i]);
+    }
+    if (r.error == error_code::SUCCESS) {
+      break;
+    }
+    output[output_pos++] = char(0xef);
+    output[output_pos++] = char(0xbf);
+    output[output_pos++] = char(0xbd);
+    pos += r.count;
+    pos += maximal_subpart_length(data + pos, len - pos);
+  }
+  return output_pos;
+}
+
 template <typename InputPtr>
 #if SIMDUTF_CPLUSPLUS20
   requires simdutf::detail::indexes_into_byte_like<InputPtr>
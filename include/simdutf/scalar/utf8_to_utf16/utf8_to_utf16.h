@@ -271,6 +271,24 @@ simdutf_constexpr23 result convert_with_errors(InputPtr data, size_t len,
   return result(error_code::SUCCESS, utf16_output - start);
 }
 
+template <endianness big_endian, typename InputPtr>
+#if SIMDUTF_CPLUSPLUS20
+  requires simdutf::detail::indexes_into_byte_like<InputPtr>
+#endif
+simdutf_constexpr23 size_t convert_with_replacement(InputPtr data, size_t len,
+                                                    char16_t *utf16_output) {
+  return utf8::convert_with_replacement_via(
+      [](InputPtr d, size_t l, char16_t *o) {
+        return convert_with_errors<big_endian>(d, l, o);
+      },
+      // convert_with_errors wrote the valid prefix already.
+      [](InputPtr d, size_t l, char16_t *) {
+        return utf8::utf16_length_from_utf8(d, l);
+      },
+      data, len, utf16_output,
+      char16_t(utf16::swap_if_needed<big_endian>(0xfffd)));
+}
+
 /**
  * When rewind_and_convert_with_errors is called, we are pointing at 'buf' and
  * we have up to len input bytes left, and we encountered some error. It is
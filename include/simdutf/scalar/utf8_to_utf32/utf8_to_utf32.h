@@ -229,6 +229,23 @@ simdutf_constexpr23 result convert_with_errors(InputPtr data, size_t len,
   return result(error_code::SUCCESS, utf32_output - start);
 }
 
+template <typename InputPtr>
+#if SIMDUTF_CPLUSPLUS20
+  requires simdutf::detail::indexes_into_byte_like<InputPtr>
+#endif
+simdutf_constexpr23 size_t convert_with_replacement(InputPtr data, size_t len,
+                                                    char32_t *utf32_output) {
+  return utf8::convert_with_replacement_via(
+      [](InputPtr d, size_t l, char32_t *o) {
+        return convert_with_errors(d, l, o);
+      },
+      // convert_with_errors wrote the valid prefix already.
+      [](InputPtr d, size_t l, char32_t *) {
+        return utf8::count_code_points(d, l);
+      },
+      data, len, utf32_output, char32_t(0xfffd));
+}
+
 /**
  * When rewind_and_convert_with_errors is called, we are pointing at 'buf' and
  * we have up to len input bytes left, and we encountered some error. It is
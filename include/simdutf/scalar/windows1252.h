@@ -0,0 +1,32 @@
+#ifndef SIMDUTF_WINDOWS1252_H
+#define SIMDUTF_WINDOWS1252_H
+
+namespace simdutf {
+namespace scalar {
+namespace {
+namespace windows1252 {
+
+// The bytes 0x80 to 0x9F are the only ones in which windows-1252 differs from
+// Latin1. The code points are in the single-byte encoding tables.
+inline simdutf_constexpr23 bool is_c1(uint8_t byte) noexcept {
+  return (byte & 0xe0) == 0x80;
+}
+
+// Returns the position of the first byte in data[from, len) in the range
+// 0x80 to 0x9F, or len. The backends have vectorized versions of this scan
+// (implementation::find_c1_control).
+inline size_t find_c1(const char *data, size_t from, size_t len) noexcept {
+  for (size_t pos = from; pos < len; pos++) {
+    if (is_c1(uint8_t(data[pos]))) {
+      return pos;
+    }
+  }
+  return len;
+}
+
+} // namespace windows1252
+} // unnamed namespace
+} // namespace scalar
+} // namespace simdutf
+
+#endif
@@ -41,7 +41,10 @@ typedef enum simdutf_error_code {
   SIMDUTF_ERROR_BASE64_INPUT_REMAINDER,
   SIMDUTF_ERROR_BASE64_EXTRA_BITS,
   SIMDUTF_ERROR_OUTPUT_BUFFER_TOO_SMALL,
-  SIMDUTF_ERROR_OTHER
+  SIMDUTF_ERROR_OTHER,
+  SIMDUTF_ERROR_INVALID_JSON_ESCAPE,
+  SIMDUTF_ERROR_INVALID_HEX_CHARACTER,
+  SIMDUTF_ERROR_HEX_INPUT_REMAINDER
 } simdutf_error_code;
 
 typedef struct simdutf_result {
@@ -99,6 +102,22 @@ bool simdutf_validate_utf32(const char32_t *buf, size_t len);
 simdutf_result simdutf_validate_utf32_with_errors(const char32_t *buf,
                                                   size_t len);
 
+/* Incremental UTF-8 validation of a stream received in arbitrary chunks.
+   Initialize the state with simdutf_utf8_stream_validator_init, pass each
+   chunk to simdutf_utf8_stream_validator_feed and call
+   simdutf_utf8_stream_validator_finish at the end of the stream. Error
+   positions are absolute offsets in the stream. The state is opaque. */
+typedef struct simdutf_utf8_stream_validator {
+  uint64_t opaque[4];
+} simdutf_utf8_stream_validator;
+
+void simdutf_utf8_stream_validator_init(simdutf_utf8_stream_validator *state);
+simdutf_result
+simdutf_utf8_stream_validator_feed(simdutf_utf8_stream_validator *state,
+                                   const char *input, size_t length);
+simdutf_result
+simdutf_utf8_stream_validator_finish(simdutf_utf8_stream_validator *state);
+
 /* to_well_formed UTF-16 helpers */
 void simdutf_to_well_formed_utf16le(const char16_t *input, size_t len,
                                     char16_t *output);
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Generates src/tables/sbcs_tables.h, the upper halves (bytes 0x80 to 0xFF) of
+the single-byte encodings of the WHATWG Encoding Standard.
+
+The tables come from the Python codecs, adjusted to the WHATWG indexes:
+bytes that the windows code pages leave unassigned in 0x80-0x9F map to the
+C1 control of the same value, the few characters that WHATWG adds are
+patched in, and the remaining unassigned bytes map to U+FFFD.
+
+Usage: python3 scripts/sbcs_tables.py > src/tables/sbcs_tables.h
+"""
+
+# (name in the sbcs_encoding enum, Python codec)
+ENCODINGS = [
+    ('ibm866', 'cp866'),
+    ('iso_8859_2', 'iso8859_2'),
+    ('iso_8859_3', 'iso8859_3'),
+    ('iso_8859_4', 'iso8859_4'),
+    ('iso_8859_5', 'iso8859_5'),
+    ('iso_8859_6', 'iso8859_6'),
+    ('iso_8859_7', 'iso8859_7'),
+    ('iso_8859_8', 'iso8859_8'),
+    ('iso_8859_10', 'iso8859_10'),
+    ('iso_8859_13', 'iso8859_13'),
+    ('iso_8859_14', 'iso8859_14'),
+    ('iso_8859_15', 'iso8859_15'),
+    ('iso_8859_16', 'iso8859_16'),
+    ('koi8_r', 'koi8_r'),
+    ('koi8_u', 'koi8_u'),
+    ('macintosh', 'mac_roman'),
+    ('windows_874', 'cp874'),
+    ('windows_1250', 'cp1250'),
+    ('windows_1251', 'cp1251'),
+    ('windows_1252', 'cp1252'),
+    ('windows_1253', 'cp1253'),
+    ('windows_1254', 'cp1254'),
+    ('windows_1255', 'cp1255'),
+    ('windows_1256', 'cp1256'),
+    ('windows_1257', 'cp1257'),
+    ('windows_1258', 'cp1258'),
+    ('x_mac_cyrillic', 'mac_cyrillic'),
+]
+
+# Where the WHATWG indexes differ from the Python codecs.
+PATCHES = {
+    # WHATWG KOI8-U is KOI8-RU: it has the Belarusian short u.
+    'koi8_u': {0xAE: 0x045E, 0xBE: 0x040E},
+    'windows_1255': {0xCA: 0x05BA},
+}
+
+
+def high_half(name, codec):
+    table = []
+    for byte in range(0x80, 0x100):
+        try:
+            code_point = ord(bytes([byte]).decode(codec))
+        except UnicodeDecodeError:
+            if name.startswith('windows_') and byte < 0xA0:
+                code_point = byte
+            else:
+                code_point = 0xFFFD
+        table.append(PATCHES.get(name, {}).get(byte, code_point))
+    return table
+
+
+def main():
+    print('// file generated by scripts/sbcs_tables.py')
+    print('#ifndef SIMDUTF_SBCS_TABLES_H')
+    print('#define SIMDUTF_SBCS_TABLES_H')
+    print()
+    print('namespace simdutf {')
+    print('namespace {')
+    print('namespace tables {')
+    print('namespace sbcs {')
+    print()
+    print('// Indexed by sbcs_encoding.')
+    print('const char16_t high_halves[][128] = {')
+    for name, codec in ENCODINGS:
+        table = high_half(name, codec)
+        print('    // %s' % name)
+        print('    {')
+        for row in range(0, 128, 8):
+            values = ', '.join('0x%04X' % v for v in table[row:row + 8])
+            print('        %s,' % values)
+        print('    },')
+    print('};')
+    print()
+    print('} // namespace sbcs')
+    print('} // namespace tables')
+    print('} // unnamed namespace')
+    print('} // namespace simdutf')
+    print()
+    print('#endif // SIMDUTF_SBCS_TABLES_H')
+
+
+if __name__ == '__main__':
+    main()
@@ -64,7 +64,7 @@ neon_expand_surrogate(const uint32x4_t in) {
   return {u16count, compressed_v};
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char16_t *>
 arm_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                            char16_t *utf16_out) {
@@ -76,6 +76,12 @@ arm_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   const size_t safety_margin = 4;
   while (end - buf >= std::ptrdiff_t(8 + safety_margin)) {
     uint32x4x2_t in = vld1q_u32_x2(reinterpret_cast<const uint32_t *>(buf));
+    if constexpr (!match_system(utf32_endian)) {
+      in.val[0] =
+          vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in.val[0])));
+      in.val[1] =
+          vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in.val[1])));
+    }
 
     // Check if no bits set above 16th
     uint32_t max_val = vmaxvq_u32(vmaxq_u32(in.val[0], in.val[1]));
@@ -119,7 +125,7 @@ arm_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   return std::make_pair(buf, reinterpret_cast<char16_t *>(utf16_output));
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char16_t *>
 arm_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
                                        char16_t *utf16_out) {
@@ -131,6 +137,12 @@ arm_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
   const size_t safety_margin = 4;
   while (end - buf >= std::ptrdiff_t(8 + safety_margin)) {
     uint32x4x2_t in = vld1q_u32_x2(reinterpret_cast<const uint32_t *>(buf));
+    if constexpr (!match_system(utf32_endian)) {
+      in.val[0] =
+          vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in.val[0])));
+      in.val[1] =
+          vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in.val[1])));
+    }
 
     // Check if no bits set above 16th
     uint32_t max_val = vmaxvq_u32(vmaxq_u32(in.val[0], in.val[1]));
@@ -160,7 +172,7 @@ arm_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
       if (simdutf_unlikely(err)) {
         const size_t pos = trailing_zeroes(err) / 8;
         for (size_t k = 0; k < pos; k++) {
-          uint32_t word = buf[k];
+          uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
           if ((word & 0xFFFF0000) == 0) {
             // will not generate a surrogate pair
             *utf16_output++ = !match_system(big_endian)
@@ -180,7 +192,8 @@ arm_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
             *utf16_output++ = char16_t(low_surrogate);
           }
         }
-        const uint32_t word = buf[pos];
+        const uint32_t word =
+            scalar::utf32::swap_if_needed<utf32_endian>(buf[pos]);
         const size_t error_pos = buf - start + pos;
         if (word > 0x10FFFF) {
           return {result(error_code::TOO_LARGE, error_pos),
@@ -1,3 +1,4 @@
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char *>
 arm_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   uint8_t *utf8_output = reinterpret_cast<uint8_t *>(utf8_out);
@@ -13,6 +14,10 @@ arm_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   while (buf + 16 + safety_margin < end) {
     uint32x4_t in = vld1q_u32(reinterpret_cast<const uint32_t *>(buf));
     uint32x4_t nextin = vld1q_u32(reinterpret_cast<const uint32_t *>(buf + 4));
+    if constexpr (!match_system(utf32_endian)) {
+      in = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in)));
+      nextin = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(nextin)));
+    }
 
     // Check if no bits set above 16th
     if (vmaxvq_u32(vorrq_u32(in, nextin)) <= 0xFFFF) {
@@ -213,7 +218,7 @@ arm_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -249,6 +254,7 @@ arm_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   return std::make_pair(buf, reinterpret_cast<char *>(utf8_output));
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char *>
 arm_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
                                       char *utf8_out) {
@@ -264,6 +270,10 @@ arm_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
   while (buf + 16 + safety_margin < end) {
     uint32x4_t in = vld1q_u32(reinterpret_cast<const uint32_t *>(buf));
     uint32x4_t nextin = vld1q_u32(reinterpret_cast<const uint32_t *>(buf + 4));
+    if constexpr (!match_system(utf32_endian)) {
+      in = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in)));
+      nextin = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(nextin)));
+    }
 
     // Check if no bits set above 16th
     if (vmaxvq_u32(vorrq_u32(in, nextin)) <= 0xFFFF) {
@@ -469,7 +479,7 @@ arm_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -0,0 +1,17 @@
+// Stores the bytes of the two vectors alternately: first[0], second[0],
+// first[1], second[1]...
+simdutf_really_inline void store_interleaved(const simd8<uint8_t> first,
+                                             const simd8<uint8_t> second,
+                                             uint8_t *output) {
+  vst2q_u8(output, uint8x16x2_t{{first, second}});
+}
+
+// Splits the bytes of two consecutive vectors into those at even and those at
+// odd positions, the inverse of store_interleaved.
+simdutf_really_inline void deinterleave(const simd8<uint8_t> first,
+                                        const simd8<uint8_t> second,
+                                        simd8<uint8_t> &even,
+                                        simd8<uint8_t> &odd) {
+  even = simd8<uint8_t>(vuzp1q_u8(first, second));
+  odd = simd8<uint8_t>(vuzp2q_u8(first, second));
+}
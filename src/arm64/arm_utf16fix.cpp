@@ -150,8 +150,11 @@ void utf16fix_neon_64bits(const char16_t *in, size_t n, char16_t *out) {
   if (n < 17) {
     return scalar::utf16::to_well_formed_utf16<big_endian>(in, n, out);
   }
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
   i = 1;
 
   /* duplicate code to have the compiler specialise utf16fix_block() */
@@ -176,7 +179,7 @@ void utf16fix_neon_64bits(const char16_t *in, size_t n, char16_t *out) {
 
     utf16fix_block<big_endian, false>(out + n - 16, in + n - 16);
   }
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
@@ -24,6 +24,7 @@ const char32_t *arm_validate_utf32le(const char32_t *input, size_t size) {
   return input;
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 const result arm_validate_utf32le_with_errors(const char32_t *input,
                                               size_t size) {
   const char32_t *start = input;
@@ -36,7 +37,10 @@ const result arm_validate_utf32le_with_errors(const char32_t *input,
   uint32x4_t currentoffsetmax = vmovq_n_u32(0x0);
 
   while (end - input >= 4) {
-    const uint32x4_t in = vld1q_u32(reinterpret_cast<const uint32_t *>(input));
+    uint32x4_t in = vld1q_u32(reinterpret_cast<const uint32_t *>(input));
+    if constexpr (!match_system(utf32_endian)) {
+      in = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(in)));
+    }
     currentmax = vmaxq_u32(in, currentmax);
     currentoffsetmax = vmaxq_u32(vaddq_u32(in, offset), currentoffsetmax);
 
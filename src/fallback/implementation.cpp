@@ -44,8 +44,62 @@ simdutf_warn_unused result implementation::validate_utf8_with_errors(
     const char *buf, size_t len) const noexcept {
   return scalar::utf8::validate_with_errors(buf, len);
 }
+
+simdutf_warn_unused result implementation::validate_utf8_and_index_lines(
+    const char *input, size_t length, size_t *line_positions,
+    size_t &line_count) const noexcept {
+  return scalar::utf8::validate_and_index_lines(input, length, line_positions,
+                                                line_count);
+}
+
+simdutf_warn_unused result implementation::validate_utf8_and_find_json_escape(
+    const char *input, size_t length) const noexcept {
+  return scalar::json::validate_utf8_and_find_escape(input, length);
+}
+simdutf_warn_unused result implementation::escape_json_utf8(
+    const char *input, size_t length, char *output,
+    bool ascii_only) const noexcept {
+  return scalar::json::escape(
+      input, length, output,
+      [ascii_only](const char *in, size_t len, char *out) {
+        return scalar::json::validate_and_copy_until_escape(in, len, out,
+                                                            ascii_only);
+      });
+}
+
+simdutf_warn_unused result implementation::unescape_json_to_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::json::unescape(
+      input, length, output,
+      [](const char *in, size_t len, char *out, size_t &units) {
+        const result run =
+            scalar::json::validate_and_copy_until_escape(in, len, out, false);
+        units = run.count;
+        return run;
+      });
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused result implementation::unescape_json_to_utf16(
+    const char *input, size_t length, char16_t *output) const noexcept {
+  // The runs between the escapes are validated by the transcoding kernel.
+  return scalar::json::unescape(
+      input, length, output,
+      [this](const char *in, size_t len, char16_t *out, size_t &units) {
+        const size_t run = scalar::json::find_escape(in, 0, len);
+  #if SIMDUTF_IS_BIG_ENDIAN
+        const result r = convert_utf8_to_utf16be_with_errors(in, run, out);
+  #else
+        const result r = convert_utf8_to_utf16le_with_errors(in, run, out);
+  #endif
+        units = r.count;
+        return r.error == error_code::SUCCESS ? result(error_code::SUCCESS, run)
+                                              : r;
+      });
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_ASCII
 simdutf_warn_unused bool
 implementation::validate_ascii(const char *buf, size_t len) const noexcept {
@@ -121,6 +175,16 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
     const char32_t *buf, size_t len) const noexcept {
   return scalar::utf32::validate_with_errors(buf, len);
 }
+
+simdutf_warn_unused result implementation::validate_utf32le_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return scalar::utf32::validate_with_errors<endianness::LITTLE>(buf, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32be_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return scalar::utf32::validate_with_errors<endianness::BIG>(buf, len);
+}
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -217,6 +281,20 @@ simdutf_warn_unused result implementation::convert_utf8_to_utf32_with_errors(
   return scalar::utf8_to_utf32::convert_with_errors(buf, len, utf32_output);
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf32_with_replacement(
+    const char *input, size_t length, char32_t *utf32_output) const noexcept {
+  return scalar::utf8_to_utf32::convert_with_replacement(input, length,
+                                                         utf32_output);
+}
+
+simdutf_warn_unused result
+implementation::utf32_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::utf32_length_from_utf8_with_replacement(
+      reinterpret_cast<const uint8_t *>(input), length);
+}
+
 simdutf_warn_unused size_t implementation::convert_valid_utf8_to_utf32(
     const char *input, size_t size, char32_t *utf32_output) const noexcept {
   return scalar::utf8_to_utf32::convert_valid(input, size, utf32_output);
@@ -328,6 +406,29 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
   return scalar::utf32_to_utf8::convert_with_errors(buf, len, utf8_output);
 }
 
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf8(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return scalar::utf32_to_utf8::convert<endianness::LITTLE>(buf, len,
+                                                            utf8_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf8(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return scalar::utf32_to_utf8::convert<endianness::BIG>(buf, len, utf8_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return scalar::utf32_to_utf8::convert_with_errors<endianness::LITTLE>(
+      buf, len, utf8_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return scalar::utf32_to_utf8::convert_with_errors<endianness::BIG>(
+      buf, len, utf8_output);
+}
+
 simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf8(
     const char32_t *buf, size_t len, char *utf8_output) const noexcept {
   return scalar::utf32_to_utf8::convert_valid(buf, len, utf8_output);
@@ -359,6 +460,34 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf16be_with_errors(
       buf, len, utf16_output);
 }
 
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf16(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return scalar::utf32_to_utf16::convert<endianness::NATIVE,
+                                         endianness::LITTLE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf16(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return scalar::utf32_to_utf16::convert<endianness::NATIVE,
+                                         endianness::BIG>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf16_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return scalar::utf32_to_utf16::convert_with_errors<endianness::NATIVE,
+                                                     endianness::LITTLE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf16_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return scalar::utf32_to_utf16::convert_with_errors<endianness::NATIVE,
+                                                     endianness::BIG>(
+      buf, len, utf16_output);
+}
+
 simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf16le(
     const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
   return scalar::utf32_to_utf16::convert_valid<endianness::LITTLE>(
@@ -479,6 +608,11 @@ simdutf_warn_unused size_t implementation::utf16_length_from_utf8(
   return scalar::utf8::utf16_length_from_utf8(input, length);
 }
 simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_errors(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::utf16_length_from_utf8_with_errors(input, length);
+}
+simdutf_warn_unused result
 implementation::utf8_length_from_utf16le_with_replacement(
     const char16_t *input, size_t length) const noexcept {
   return scalar::utf16::utf8_length_from_utf16_with_replacement<
@@ -506,6 +640,27 @@ implementation::convert_utf16be_to_utf8_with_replacement(
       input, length, utf8_buffer);
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16le_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8_to_utf16::convert_with_replacement<endianness::LITTLE>(
+      input, length, utf16_output);
+}
+
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16be_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8_to_utf16::convert_with_replacement<endianness::BIG>(
+      input, length, utf16_output);
+}
+
+simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::utf16_length_from_utf8_with_replacement(
+      reinterpret_cast<const uint8_t *>(input), length);
+}
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -513,6 +668,17 @@ simdutf_warn_unused size_t implementation::utf8_length_from_utf32(
     const char32_t *input, size_t length) const noexcept {
   return scalar::utf32::utf8_length_from_utf32(input, length);
 }
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32le(
+    const char32_t *input, size_t length) const noexcept {
+  return scalar::utf32::utf8_length_from_utf32<endianness::LITTLE>(input,
+                                                                  length);
+}
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32be(
+    const char32_t *input, size_t length) const noexcept {
+  return scalar::utf32::utf8_length_from_utf32<endianness::BIG>(input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -520,6 +686,17 @@ simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
     const char32_t *input, size_t length) const noexcept {
   return scalar::utf32::utf16_length_from_utf32(input, length);
 }
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32le(
+    const char32_t *input, size_t length) const noexcept {
+  return scalar::utf32::utf16_length_from_utf32<endianness::LITTLE>(input,
+                                                                   length);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32be(
+    const char32_t *input, size_t length) const noexcept {
+  return scalar::utf32::utf16_length_from_utf32<endianness::BIG>(input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -527,8 +704,47 @@ simdutf_warn_unused size_t implementation::utf32_length_from_utf8(
     const char *input, size_t length) const noexcept {
   return scalar::utf8::count_code_points(input, length);
 }
+simdutf_warn_unused result
+implementation::utf32_length_from_utf8_with_errors(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::utf32_length_from_utf8_with_errors(input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused const char *
+implementation::find_c1_control(const char *start,
+                                const char *end) const noexcept {
+  return start + scalar::windows1252::find_c1(start, 0, size_t(end - start));
+}
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused const char *
+implementation::find_cesu8_special(const char *start, const char *end,
+                                   bool modified) const noexcept {
+  const size_t len = size_t(end - start);
+  return start + (modified ? scalar::cesu8::find_special<true>(start, 0, len)
+                           : scalar::cesu8::find_special<false>(start, 0, len));
+}
+
+simdutf_warn_unused const char16_t *
+implementation::find_cesu8_special(const char16_t *start, const char16_t *end,
+                                   bool modified) const noexcept {
+  const size_t len = size_t(end - start);
+  return start + (modified ? scalar::cesu8::find_special<true>(start, 0, len)
+                           : scalar::cesu8::find_special<false>(start, 0, len));
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused size_t implementation::convert_sbcs_to_utf16(
+    const char *input, size_t length, const char16_t *table,
+    char16_t *utf16_output) const noexcept {
+  return scalar::sbcs::convert(input, length, table, utf16_output);
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_BASE64
 
 simdutf_warn_unused result implementation::base64_to_binary(
@@ -591,6 +807,22 @@ const char16_t *implementation::find(const char16_t *start, const char16_t *end,
   }
   return end;
 }
+
+size_t implementation::binary_to_hex(const char *input, size_t length,
+                                     char *output,
+                                     hex_options options) const noexcept {
+  return scalar::hex::encode(input, length, output, options);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::hex::decode(input, length, output);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char16_t *input, size_t length, char *output) const noexcept {
+  return scalar::hex::decode(input, length, output);
+}
 #endif // SIMDUTF_FEATURE_BASE64
 
 } // namespace SIMDUTF_IMPLEMENTATION
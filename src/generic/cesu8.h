@@ -0,0 +1,59 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace cesu8 {
+
+// Returns a pointer to the first byte in the range 0xF0 to 0xFF, or, if
+// modified is true, to the first null byte, or end.
+template <bool modified>
+simdutf_really_inline const char *find_special(const char *start,
+                                               const char *end) noexcept {
+  for (; end - start >= 64; start += 64) {
+    const simd::simd8x64<uint8_t> in(reinterpret_cast<const uint8_t *>(start));
+    uint64_t special = in.gteq_unsigned(0xf0);
+    if (modified) {
+      special |= in.eq(0);
+    }
+    if (special != 0) {
+      return start + trailing_zeroes(special);
+    }
+  }
+  return start + scalar::cesu8::find_special<modified>(start, 0,
+                                                       size_t(end - start));
+}
+
+// Returns a pointer to the first surrogate or, if modified is true, to the
+// first null code unit, or end. The 32 code units are loaded as 64 bytes: a
+// unit is a surrogate when its most significant byte is in the range 0xD8 to
+// 0xDF and it is null when both of its bytes are.
+template <bool modified>
+simdutf_really_inline const char16_t *
+find_special(const char16_t *start, const char16_t *end) noexcept {
+#if SIMDUTF_IS_BIG_ENDIAN
+  constexpr uint64_t high_bytes = 0x5555555555555555;
+#else
+  constexpr uint64_t high_bytes = 0xaaaaaaaaaaaaaaaa;
+#endif // SIMDUTF_IS_BIG_ENDIAN
+  for (; end - start >= 32; start += 32) {
+    const simd::simd8x64<uint8_t> in(reinterpret_cast<const uint8_t *>(start));
+    const uint64_t surrogate =
+        in.gteq_unsigned(0xd8) & ~in.gteq_unsigned(0xe0) & high_bytes;
+    // Each unit is marked on its first byte.
+    uint64_t special = surrogate | (surrogate >> 1);
+    if (modified) {
+      const uint64_t zero = in.eq(0);
+      special |= zero & (zero >> 1);
+    }
+    special &= 0x5555555555555555;
+    if (special != 0) {
+      return start + trailing_zeroes(special) / 2;
+    }
+  }
+  return start + scalar::cesu8::find_special<modified>(start, 0,
+                                                       size_t(end - start));
+}
+
+} // namespace cesu8
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
@@ -0,0 +1,124 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace hex {
+
+using namespace simd;
+
+simdutf_really_inline simd8<uint8_t> digits(hex_options options) {
+  return options == hex_options::hex_uppercase
+             ? simd8<uint8_t>::repeat_16('0', '1', '2', '3', '4', '5', '6',
+                                         '7', '8', '9', 'A', 'B', 'C', 'D',
+                                         'E', 'F')
+             : simd8<uint8_t>::repeat_16('0', '1', '2', '3', '4', '5', '6',
+                                         '7', '8', '9', 'a', 'b', 'c', 'd',
+                                         'e', 'f');
+}
+
+// The digits of the high and of the low nibbles are interleaved in registers.
+size_t encode(const char *input, size_t length, char *output,
+              hex_options options) {
+  const simd8<uint8_t> table = digits(options);
+  constexpr size_t chunk_size = sizeof(simd8<uint8_t>);
+  size_t pos = 0;
+  for (; length - pos >= chunk_size; pos += chunk_size) {
+    const simd8<uint8_t> bytes =
+        simd8<uint8_t>::load(reinterpret_cast<const uint8_t *>(input + pos));
+    store_interleaved(bytes.shr<4>().lookup_16(table),
+                      (bytes & 0x0F).lookup_16(table),
+                      reinterpret_cast<uint8_t *>(output + 2 * pos));
+  }
+  return 2 * pos + scalar::hex::encode(input + pos, length - pos,
+                                       output + 2 * pos, options);
+}
+
+// Loads two vectors of digits.
+simdutf_really_inline void load_digits(const char *input,
+                                       simd8<uint8_t> &first,
+                                       simd8<uint8_t> &second) {
+  constexpr size_t chunk_size = sizeof(simd8<uint8_t>);
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(input);
+  first = simd8<uint8_t>::load(bytes);
+  second = simd8<uint8_t>::load(bytes + chunk_size);
+}
+
+// Code units above 0xff saturate to 0xff, which is not a digit.
+simdutf_really_inline void load_digits(const char16_t *input,
+                                       simd8<uint8_t> &first,
+                                       simd8<uint8_t> &second) {
+  constexpr size_t units = sizeof(simd16<uint16_t>) / sizeof(char16_t);
+  first = simd16<uint16_t>::pack(simd16<uint16_t>(input),
+                                 simd16<uint16_t>(input + units));
+  second = simd16<uint16_t>::pack(simd16<uint16_t>(input + 2 * units),
+                                  simd16<uint16_t>(input + 3 * units));
+}
+
+// The class of a byte is 1 for '0' to '9', 2 for 'A' to 'F' and 'a' to 'f',
+// and 0 for the other bytes: the classes of its nibbles have a bit in common.
+simdutf_really_inline simd8<uint8_t> classes(const simd8<uint8_t> in) {
+  const simd8<uint8_t> high = in.shr<4>().lookup_16<uint8_t>(
+      0, 0, 0, 1, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  const simd8<uint8_t> low = (in & 0x0F).lookup_16<uint8_t>(
+      1, 3, 3, 3, 3, 3, 3, 1, 1, 1, 0, 0, 0, 0, 0, 0);
+  return high & low;
+}
+
+// The values of the digits that end up in the high nibbles of the output.
+simdutf_really_inline simd8<uint8_t> high_values(const simd8<uint8_t> in,
+                                                 const simd8<uint8_t> kind) {
+  const simd8<uint8_t> low = in & 0x0F;
+  const simd8<uint8_t> decimal = low.lookup_16<uint8_t>(
+      0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0, 0, 0, 0,
+      0, 0);
+  const simd8<uint8_t> letter = low.lookup_16<uint8_t>(
+      0, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  return (decimal & kind.lookup_16<uint8_t>(0, 0xff, 0, 0, 0, 0, 0, 0, 0, 0,
+                                            0, 0, 0, 0, 0, 0)) |
+         (letter & kind.lookup_16<uint8_t>(0, 0, 0xff, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0));
+}
+
+// The values of the digits that end up in the low nibbles of the output.
+simdutf_really_inline simd8<uint8_t> low_values(const simd8<uint8_t> in,
+                                                const simd8<uint8_t> kind) {
+  const simd8<uint8_t> low = in & 0x0F;
+  const simd8<uint8_t> letter = low.lookup_16<uint8_t>(
+      0, 10, 11, 12, 13, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+  return (low & kind.lookup_16<uint8_t>(0, 0xff, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                        0, 0, 0, 0, 0)) |
+         (letter & kind.lookup_16<uint8_t>(0, 0, 0xff, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0));
+}
+
+// The digits are split into those of the high and of the low nibbles, and
+// their values are combined in registers.
+template <typename char_type>
+result decode(const char_type *input, size_t length, char *output) {
+  constexpr size_t chunk_size = sizeof(simd8<uint8_t>);
+  size_t pos = 0;
+  for (; length - pos >= 2 * chunk_size; pos += 2 * chunk_size) {
+    simd8<uint8_t> first, second;
+    load_digits(input + pos, first, second);
+    simd8<uint8_t> high, low;
+    deinterleave(first, second, high, low);
+    const simd8<uint8_t> high_kind = classes(high);
+    const simd8<uint8_t> low_kind = classes(low);
+    const simd8<uint8_t> not_digit = simd8<uint8_t>::repeat_16(
+        0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    if (!(high_kind.lookup_16(not_digit) | low_kind.lookup_16(not_digit))
+             .is_ascii()) {
+      // The scalar code writes the pairs before the invalid digit.
+      break;
+    }
+    (high_values(high, high_kind) | low_values(low, low_kind))
+        .store(reinterpret_cast<uint8_t *>(output + pos / 2));
+  }
+  result r = scalar::hex::decode(input + pos, length - pos, output + pos / 2);
+  r.count += r.error == error_code::INVALID_HEX_CHARACTER ? pos : pos / 2;
+  return r;
+}
+
+} // namespace hex
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
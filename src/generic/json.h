@@ -0,0 +1,91 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace json {
+
+// Bytes that must be escaped in a JSON string: the quotation mark, the reverse
+// solidus and the control characters, and the non-ASCII bytes if ascii_only.
+simdutf_really_inline uint64_t
+escape_mask(const simd::simd8x64<uint8_t> &in, bool ascii_only) {
+  uint64_t mask = in.eq('"') | in.eq('\\') | ~in.gteq_unsigned(0x20);
+  if (ascii_only) {
+    mask |= in.gteq_unsigned(0x80);
+  }
+  return mask;
+}
+
+// Validates and copies the bytes before the first one that must be escaped,
+// in the same pass, and returns their number or the first UTF-8 error among
+// them. Whole blocks of 64 bytes are stored, so that up to 64 bytes past the
+// copied ones may be overwritten.
+simdutf_really_inline result validate_and_copy_until_escape(const char *input,
+                                                            size_t length,
+                                                            char *output,
+                                                            bool ascii_only) {
+  utf8_validation::utf8_checker checker{};
+  size_t pos = 0;
+  size_t run = length;
+  for (; length - pos >= 64; pos += 64) {
+    const simd::simd8x64<uint8_t> in(
+        reinterpret_cast<const uint8_t *>(input + pos));
+    in.store(reinterpret_cast<uint8_t *>(output + pos));
+    const uint64_t escapes = escape_mask(in, ascii_only);
+    if (escapes != 0) {
+      run = pos + trailing_zeroes(escapes);
+      break;
+    }
+    checker.check_next_input(in);
+    if (simdutf_unlikely(checker.errors())) {
+      break;
+    }
+  }
+  // The last block is checked up to the end of the run: the bytes from there
+  // on are replaced by zeros, which end any character like the escaped byte.
+  uint8_t block[64]{};
+  if (!checker.errors()) {
+    if (run == length && pos != length) {
+      std::memcpy(block, input + pos, length - pos);
+      std::memcpy(output + pos, block, length - pos);
+      // The padding is made of zeros, which would need escaping.
+      const uint64_t escapes =
+          escape_mask(simd::simd8x64<uint8_t>(block), ascii_only) &
+          (~uint64_t(0) >> (64 - (length - pos)));
+      if (escapes != 0) {
+        run = pos + trailing_zeroes(escapes);
+        std::memset(block + (run - pos), 0, length - run);
+      }
+    } else {
+      std::memcpy(block, input + pos, run - pos);
+    }
+    checker.check_next_input(simd::simd8x64<uint8_t>(block));
+    checker.check_eof();
+  }
+  if (simdutf_unlikely(checker.errors())) {
+    // Sometimes the error is only detected in the next block.
+    const size_t safe = pos != 0 ? pos - 1 : 0;
+    result res = scalar::utf8::rewind_and_validate_with_errors(
+        input, input + safe, run - safe);
+    res.count += safe;
+    return res;
+  }
+  return result(error_code::SUCCESS, run);
+}
+
+// Returns the position of the first byte that must be escaped, or length.
+simdutf_really_inline size_t find_escape(const char *input, size_t length) {
+  size_t pos = 0;
+  for (; length - pos >= 64; pos += 64) {
+    const simd::simd8x64<uint8_t> in(
+        reinterpret_cast<const uint8_t *>(input + pos));
+    const uint64_t escapes = escape_mask(in, false);
+    if (escapes != 0) {
+      return pos + trailing_zeroes(escapes);
+    }
+  }
+  return scalar::json::find_escape(input, pos, length);
+}
+
+} // namespace json
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
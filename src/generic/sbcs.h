@@ -0,0 +1,89 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace sbcs {
+
+using namespace simd;
+
+simdutf_really_inline simd8<uint8_t> repeat(const uint8_t (&bytes)[16]) {
+  return simd8<uint8_t>::repeat_16(bytes[0], bytes[1], bytes[2], bytes[3],
+                                   bytes[4], bytes[5], bytes[6], bytes[7],
+                                   bytes[8], bytes[9], bytes[10], bytes[11],
+                                   bytes[12], bytes[13], bytes[14], bytes[15]);
+}
+
+// The 128 entries of the table form eight rows of sixteen code units, whose
+// low and high bytes are looked up separately. The high nibble of a byte
+// selects a row, through a lookup as well, and its low nibble an entry.
+struct rows {
+  explicit rows(const char16_t *table) {
+    for (size_t row = 0; row < 8; row++) {
+      uint8_t low_bytes[16];
+      uint8_t high_bytes[16];
+      for (size_t i = 0; i < 16; i++) {
+        low_bytes[i] = uint8_t(table[16 * row + i]);
+        high_bytes[i] = uint8_t(table[16 * row + i] >> 8);
+      }
+      uint8_t selector[16] = {};
+      selector[8 + row] = 0xff;
+      low[row] = repeat(low_bytes);
+      high[row] = repeat(high_bytes);
+      selectors[row] = repeat(selector);
+    }
+  }
+
+  simd8<uint8_t> low[8];
+  simd8<uint8_t> high[8];
+  simd8<uint8_t> selectors[8];
+};
+
+simdutf_really_inline void decode(const simd8<uint8_t> in, const rows &table,
+                                  char16_t *output) {
+  const simd8<uint8_t> high_nibbles = in.shr<4>();
+  const simd8<uint8_t> low_nibbles = in & 0x0F;
+  const simd8<uint8_t> ascii = high_nibbles.lookup_16<uint8_t>(
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0, 0, 0, 0, 0);
+  simd8<uint8_t> low_bytes = in & ascii;
+  simd8<uint8_t> high_bytes = simd8<uint8_t>::zero();
+  for (size_t row = 0; row < 8; row++) {
+    const simd8<uint8_t> selected =
+        high_nibbles.lookup_16(table.selectors[row]);
+    low_bytes = low_bytes | (low_nibbles.lookup_16(table.low[row]) & selected);
+    high_bytes =
+        high_bytes | (low_nibbles.lookup_16(table.high[row]) & selected);
+  }
+  uint8_t *bytes = reinterpret_cast<uint8_t *>(output);
+  if (match_system(endianness::LITTLE)) {
+    store_interleaved(low_bytes, high_bytes, bytes);
+  } else {
+    store_interleaved(high_bytes, low_bytes, bytes);
+  }
+}
+
+size_t convert(const char *input, size_t length, const char16_t *table,
+               char16_t *output) noexcept {
+  size_t pos = 0;
+  if (length >= 64) {
+    const rows vectors(table);
+    constexpr size_t chunk_size = sizeof(simd8<uint8_t>);
+    for (; length - pos >= 64; pos += 64) {
+      const simd8x64<int8_t> in(reinterpret_cast<const int8_t *>(input + pos));
+      if (in.is_ascii()) {
+        in.store_ascii_as_utf16<endianness::NATIVE>(output + pos);
+        continue;
+      }
+      for (size_t i = 0; i < 64; i += chunk_size) {
+        decode(simd8<uint8_t>::load(
+                   reinterpret_cast<const uint8_t *>(input + pos + i)),
+               vectors, output + pos + i);
+      }
+    }
+  }
+  scalar::sbcs::convert(input + pos, length - pos, table, output + pos);
+  return length;
+}
+
+} // namespace sbcs
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
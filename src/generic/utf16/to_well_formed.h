@@ -62,8 +62,11 @@ void to_well_formed(const char16_t *in, size_t n, char16_t *out) {
 
   const char16_t replacement = scalar::utf16::replacement<big_endian>();
 
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
 
   /* duplicate code to have the compiler specialise utf16fix_block() */
   if (in == out) {
@@ -82,9 +85,9 @@ void to_well_formed(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_block<big_endian, copy_data>(out + n - N, in + n - N);
   }
 
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
 
 } // namespace utf16
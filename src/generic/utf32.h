@@ -7,6 +7,17 @@ namespace utf32 {
 
 template <typename T> T min(T a, T b) { return a <= b ? a : b; }
 
+// Loads native-endian code units from UTF-32 in the given byte order.
+template <endianness utf32_endian>
+simdutf_really_inline simd32<uint32_t> load(const char32_t *input) {
+  const simd32<uint32_t> in(input);
+  if constexpr (!match_system(utf32_endian)) {
+    return in.swap_bytes();
+  }
+  return in;
+}
+
+template <endianness utf32_endian = endianness::NATIVE>
 simdutf_really_inline size_t utf8_length_from_utf32(const char32_t *input,
                                                     size_t length) {
   using vector_u32 = simd32<uint32_t>;
@@ -45,10 +56,10 @@ simdutf_really_inline size_t utf8_length_from_utf32(const char32_t *input,
 
       simd32<uint32_t> acc = vector_u32::zero();
       for (size_t i = 0; i < iterations; i++) {
-        const auto in0 = vector_u32(input + 0 * N);
-        const auto in1 = vector_u32(input + 1 * N);
-        const auto in2 = vector_u32(input + 2 * N);
-        const auto in3 = vector_u32(input + 3 * N);
+        const auto in0 = load<utf32_endian>(input + 0 * N);
+        const auto in1 = load<utf32_endian>(input + 1 * N);
+        const auto in2 = load<utf32_endian>(input + 2 * N);
+        const auto in3 = load<utf32_endian>(input + 3 * N);
 
 #if SIMDUTF_SIMD_HAS_UNSIGNED_CMP
         acc -= as_vector_u32(in0 > v_0000007f);
@@ -101,7 +112,7 @@ simdutf_really_inline size_t utf8_length_from_utf32(const char32_t *input,
 
       auto acc = vector_u32::zero();
       for (size_t i = 0; i < iterations; i++) {
-        const auto in = vector_u32(input);
+        const auto in = load<utf32_endian>(input);
 
 #if SIMDUTF_SIMD_HAS_UNSIGNED_CMP
         acc -= as_vector_u32(in > v_0000007f);
@@ -127,7 +138,8 @@ simdutf_really_inline size_t utf8_length_from_utf32(const char32_t *input,
     counter += consumed;
   }
 
-  return counter + scalar::utf32::utf8_length_from_utf32(input, length);
+  return counter + scalar::utf32::utf8_length_from_utf32<utf32_endian>(
+                       input, length);
 }
 
 } // namespace utf32
@@ -78,6 +78,220 @@ result generic_validate_utf8_with_errors(const char *input, size_t length) {
       reinterpret_cast<const uint8_t *>(input), length);
 }
 
+/**
+ * Validates that the string is actual UTF-8 and, in the same pass, counts the
+ * code units needed to store it in UTF-16 (or in UTF-32 when utf16 is false).
+ * Stops on errors: the count is then the position of the error.
+ */
+template <class checker, bool utf16>
+result generic_length_from_utf8_with_errors(const uint8_t *input,
+                                            size_t length) {
+  checker c{};
+  buf_block_reader<64> reader(input, length);
+  size_t count{0};
+  size_t units{0};
+  while (reader.has_full_block()) {
+    simd::simd8x64<uint8_t> in(reader.full_block());
+    c.check_next_input(in);
+    if (c.errors()) {
+      if (count != 0) {
+        count--;
+      } // Sometimes the error is only detected in the next chunk
+      result res = scalar::utf8::rewind_and_validate_with_errors(
+          reinterpret_cast<const char *>(input),
+          reinterpret_cast<const char *>(input + count), length - count);
+      res.count += count;
+      return res;
+    }
+    // Every byte but the continuation bytes starts a character, and 4-byte
+    // characters take a surrogate pair.
+    simd::simd8x64<int8_t> signed_in(
+        reinterpret_cast<const int8_t *>(reader.full_block()));
+    units += count_ones(signed_in.gt(-65));
+    if (utf16) {
+      units += count_ones(in.gteq_unsigned(240));
+    }
+    reader.advance();
+    count += 64;
+  }
+  uint8_t block[64]{};
+  reader.get_remainder(block);
+  simd::simd8x64<uint8_t> in(block);
+  c.check_next_input(in);
+  reader.advance();
+  c.check_eof();
+  if (c.errors()) {
+    if (count != 0) {
+      count--;
+    } // Sometimes the error is only detected in the next chunk
+    result res = scalar::utf8::rewind_and_validate_with_errors(
+        reinterpret_cast<const char *>(input),
+        reinterpret_cast<const char *>(input) + count, length - count);
+    res.count += count;
+    return res;
+  }
+  if (utf16) {
+    units += scalar::utf8::utf16_length_from_utf8(block, length - count);
+  } else {
+    units += scalar::utf8::count_code_points(block, length - count);
+  }
+  return result(error_code::SUCCESS, units);
+}
+
+result generic_utf16_length_from_utf8_with_errors(const char *input,
+                                                  size_t length) {
+  return generic_length_from_utf8_with_errors<utf8_checker, true>(
+      reinterpret_cast<const uint8_t *>(input), length);
+}
+
+result generic_utf32_length_from_utf8_with_errors(const char *input,
+                                                  size_t length) {
+  return generic_length_from_utf8_with_errors<utf8_checker, false>(
+      reinterpret_cast<const uint8_t *>(input), length);
+}
+
+/**
+ * Validates that the string is actual UTF-8 and, in the same pass, records the
+ * positions of its newlines ('\n'). On entry, line_count is the capacity of
+ * line_positions; on return, it is the number of recorded positions.
+ */
+template <class checker>
+result generic_validate_utf8_and_index_lines(const uint8_t *input,
+                                             size_t length,
+                                             size_t *line_positions,
+                                             size_t &line_count) {
+  const size_t capacity = line_count;
+  line_count = 0;
+  const char *data = reinterpret_cast<const char *>(input);
+  checker c{};
+  buf_block_reader<64> reader(input, length);
+  size_t count{0};
+  while (reader.has_full_block()) {
+    simd::simd8x64<uint8_t> in(reader.full_block());
+    c.check_next_input(in);
+    if (c.errors()) {
+      // Sometimes the error is only detected in the next chunk
+      return scalar::utf8::index_lines_until_error(
+          data, length, count == 0 ? 0 : count - 1, count, line_positions,
+          capacity, line_count);
+    }
+    uint64_t newlines = in.eq('\n');
+    while (newlines != 0) {
+      const size_t position = count + trailing_zeroes(newlines);
+      if (line_count == capacity) {
+        return result(error_code::OUTPUT_BUFFER_TOO_SMALL, position);
+      }
+      line_positions[line_count++] = position;
+      newlines &= newlines - 1;
+    }
+    reader.advance();
+    count += 64;
+  }
+  uint8_t block[64]{};
+  reader.get_remainder(block);
+  simd::simd8x64<uint8_t> in(block);
+  c.check_next_input(in);
+  reader.advance();
+  c.check_eof();
+  if (c.errors()) {
+    return scalar::utf8::index_lines_until_error(
+        data, length, count == 0 ? 0 : count - 1, count, line_positions,
+        capacity, line_count);
+  }
+  // The padding is made of zeros, not of newlines.
+  uint64_t newlines = in.eq('\n');
+  while (newlines != 0) {
+    const size_t position = count + trailing_zeroes(newlines);
+    if (line_count == capacity) {
+      return result(error_code::OUTPUT_BUFFER_TOO_SMALL, position);
+    }
+    line_positions[line_count++] = position;
+    newlines &= newlines - 1;
+  }
+  return result(error_code::SUCCESS, length);
+}
+
+result generic_validate_utf8_and_index_lines(const char *input, size_t length,
+                                             size_t *line_positions,
+                                             size_t &line_count) {
+  return generic_validate_utf8_and_index_lines<utf8_checker>(
+      reinterpret_cast<const uint8_t *>(input), length, line_positions,
+      line_count);
+}
+
+// Bytes that must be escaped in a JSON string: the quotation mark, the reverse
+// solidus and the control characters.
+simdutf_really_inline uint64_t
+json_escape_mask(const simd::simd8x64<uint8_t> &in) {
+  return in.eq('"') | in.eq('\\') | ~in.gteq_unsigned(0x20);
+}
+
+/**
+ * Validates that the string is actual UTF-8 and, in the same pass, finds the
+ * first byte that must be escaped in a JSON string. Stops on errors.
+ */
+template <class checker>
+result generic_validate_utf8_and_find_json_escape(const uint8_t *input,
+                                                  size_t length) {
+  checker c{};
+  buf_block_reader<64> reader(input, length);
+  size_t count{0};
+  size_t escape{length};
+  while (reader.has_full_block()) {
+    simd::simd8x64<uint8_t> in(reader.full_block());
+    c.check_next_input(in);
+    if (c.errors()) {
+      if (count != 0) {
+        count--;
+      } // Sometimes the error is only detected in the next chunk
+      result res = scalar::utf8::rewind_and_validate_with_errors(
+          reinterpret_cast<const char *>(input),
+          reinterpret_cast<const char *>(input + count), length - count);
+      res.count += count;
+      return res;
+    }
+    if (escape == length) {
+      const uint64_t escapes = json_escape_mask(in);
+      if (escapes != 0) {
+        escape = count + trailing_zeroes(escapes);
+      }
+    }
+    reader.advance();
+    count += 64;
+  }
+  uint8_t block[64]{};
+  reader.get_remainder(block);
+  simd::simd8x64<uint8_t> in(block);
+  c.check_next_input(in);
+  reader.advance();
+  c.check_eof();
+  if (c.errors()) {
+    if (count != 0) {
+      count--;
+    } // Sometimes the error is only detected in the next chunk
+    result res = scalar::utf8::rewind_and_validate_with_errors(
+        reinterpret_cast<const char *>(input),
+        reinterpret_cast<const char *>(input) + count, length - count);
+    res.count += count;
+    return res;
+  }
+  if (escape == length && count != length) {
+    // The padding is made of zeros, which would need escaping.
+    const uint64_t escapes =
+        json_escape_mask(in) & (~uint64_t(0) >> (64 - (length - count)));
+    if (escapes != 0) {
+      escape = count + trailing_zeroes(escapes);
+    }
+  }
+  return result(error_code::SUCCESS, escape);
+}
+
+result generic_validate_utf8_and_find_json_escape(const char *input,
+                                                  size_t length) {
+  return generic_validate_utf8_and_find_json_escape<utf8_checker>(
+      reinterpret_cast<const uint8_t *>(input), length);
+}
+
 } // namespace utf8_validation
 } // unnamed namespace
 } // namespace SIMDUTF_IMPLEMENTATION
@@ -46,6 +46,7 @@ simdutf_really_inline bool validate(const char32_t *input, size_t size) {
   return scalar::utf32::validate(input, end - input);
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 simdutf_really_inline result validate_with_errors(const char32_t *input,
                                                   size_t size) {
   if (simdutf_unlikely(size == 0)) {
@@ -67,8 +68,8 @@ simdutf_really_inline result validate_with_errors(const char32_t *input,
 
   while (input + N < end) {
     auto in = vector_u32(input);
-    if constexpr (!match_system(endianness::BIG)) {
-      in.swap_bytes();
+    if constexpr (!match_system(utf32_endian)) {
+      in = in.swap_bytes();
     }
 
     const auto too_large = in >= standardmax;
@@ -77,7 +78,8 @@ simdutf_really_inline result validate_with_errors(const char32_t *input,
     const auto combined = too_large | surrogate;
     if (simdutf_unlikely(combined.any())) {
       const size_t consumed = input - start;
-      auto sr = scalar::utf32::validate_with_errors(input, end - input);
+      auto sr =
+          scalar::utf32::validate_with_errors<utf32_endian>(input, end - input);
       sr.count += consumed;
 
       return sr;
@@ -87,7 +89,8 @@ simdutf_really_inline result validate_with_errors(const char32_t *input,
   }
 
   const size_t consumed = input - start;
-  auto sr = scalar::utf32::validate_with_errors(input, end - input);
+  auto sr =
+      scalar::utf32::validate_with_errors<utf32_endian>(input, end - input);
   sr.count += consumed;
 
   return sr;
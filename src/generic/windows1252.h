@@ -0,0 +1,22 @@
+namespace simdutf {
+namespace SIMDUTF_IMPLEMENTATION {
+namespace {
+namespace windows1252 {
+
+// Returns a pointer to the first byte in the range 0x80 to 0x9F, or end.
+simdutf_really_inline const char *find_c1(const char *start,
+                                          const char *end) noexcept {
+  for (; end - start >= 64; start += 64) {
+    const simd::simd8x64<uint8_t> in(reinterpret_cast<const uint8_t *>(start));
+    const uint64_t c1 = in.gteq_unsigned(0x80) & ~in.gteq_unsigned(0xa0);
+    if (c1 != 0) {
+      return start + trailing_zeroes(c1);
+    }
+  }
+  return start + scalar::windows1252::find_c1(start, 0, size_t(end - start));
+}
+
+} // namespace windows1252
+} // unnamed namespace
+} // namespace SIMDUTF_IMPLEMENTATION
+} // namespace simdutf
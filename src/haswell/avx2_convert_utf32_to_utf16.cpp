@@ -1,4 +1,4 @@
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char16_t *>
 avx2_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                             char16_t *utf16_output) {
@@ -14,7 +14,13 @@ avx2_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   const __m256i v_d800 = _mm256_set1_epi32((uint32_t)0xd800);
 
   while (end - buf >= std::ptrdiff_t(8 + safety_margin)) {
-    const __m256i in = _mm256_loadu_si256((__m256i *)buf);
+    __m256i in = _mm256_loadu_si256((__m256i *)buf);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m256i swap = _mm256_setr_epi8(
+          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7,
+          6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm256_shuffle_epi8(in, swap);
+    }
 
     if (simdutf_likely(_mm256_testz_si256(in, v_ffff0000))) {
       // no bits set above 16th bit <=> can pack to UTF16
@@ -40,7 +46,7 @@ avx2_convert_utf32_to_utf16(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
@@ -80,7 +86,7 @@ avx2_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   return std::make_pair(buf, utf16_output);
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char16_t *>
 avx2_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
                                         char16_t *utf16_output) {
@@ -96,7 +102,13 @@ avx2_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
   const __m256i v_d800 = _mm256_set1_epi32((uint32_t)0xd800);
 
   while (end - buf >= std::ptrdiff_t(8 + safety_margin)) {
-    const __m256i in = _mm256_loadu_si256((__m256i *)buf);
+    __m256i in = _mm256_loadu_si256((__m256i *)buf);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m256i swap = _mm256_setr_epi8(
+          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7,
+          6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm256_shuffle_epi8(in, swap);
+    }
 
     if (simdutf_likely(_mm256_testz_si256(in, v_ffff0000))) {
       // no bits set above 16th bit <=> can pack to UTF16 without surrogate
@@ -126,7 +138,7 @@ avx2_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
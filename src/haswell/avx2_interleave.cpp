@@ -0,0 +1,33 @@
+// Stores the bytes of the two vectors alternately: first[0], second[0],
+// first[1], second[1]...
+simdutf_really_inline void store_interleaved(const simd8<uint8_t> first,
+                                             const simd8<uint8_t> second,
+                                             uint8_t *output) {
+  // The unpack instructions work within 128-bit lanes: low holds the
+  // interleaved bytes 0-7 and 16-23, high the bytes 8-15 and 24-31.
+  const __m256i low = _mm256_unpacklo_epi8(first, second);
+  const __m256i high = _mm256_unpackhi_epi8(first, second);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(output),
+                      _mm256_permute2x128_si256(low, high, 0x20));
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + 32),
+                      _mm256_permute2x128_si256(low, high, 0x31));
+}
+
+// Splits the bytes of two consecutive vectors into those at even and those at
+// odd positions, the inverse of store_interleaved.
+simdutf_really_inline void deinterleave(const simd8<uint8_t> first,
+                                        const simd8<uint8_t> second,
+                                        simd8<uint8_t> &even,
+                                        simd8<uint8_t> &odd) {
+  // Each 128-bit lane is split into its even and its odd bytes, and the
+  // 64-bit halves are then gathered in order.
+  const __m256i split = _mm256_setr_epi8(
+      0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10,
+      12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+  const __m256i first_split = _mm256_shuffle_epi8(first, split);
+  const __m256i second_split = _mm256_shuffle_epi8(second, split);
+  even = simd8<uint8_t>(_mm256_permute4x64_epi64(
+      _mm256_unpacklo_epi64(first_split, second_split), 0xd8));
+  odd = simd8<uint8_t>(_mm256_permute4x64_epi64(
+      _mm256_unpackhi_epi64(first_split, second_split), 0xd8));
+}
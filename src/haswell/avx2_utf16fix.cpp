@@ -116,8 +116,11 @@ void utf16fix_sse(const char16_t *in, size_t n, char16_t *out) {
     return;
   }
 
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
 
   /* duplicate code to have the compiler specialise utf16fix_block() */
   if (in == out) {
@@ -134,9 +137,9 @@ void utf16fix_sse(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_block_sse<big_endian, false>(out + n - 8, in + n - 8);
   }
 
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
 
 template <endianness big_endian>
@@ -149,8 +152,11 @@ void utf16fix_avx(const char16_t *in, size_t n, char16_t *out) {
     return;
   }
 
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
 
   /* duplicate code to have the compiler specialise utf16fix_block() */
   if (in == out) {
@@ -167,7 +173,7 @@ void utf16fix_avx(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_block<big_endian, false>(out + n - 16, in + n - 16);
   }
 
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
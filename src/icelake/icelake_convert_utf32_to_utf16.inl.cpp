@@ -1,6 +1,6 @@
 // file included directly
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char16_t *>
 avx512_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                               char16_t *utf16_output) {
@@ -18,6 +18,13 @@ avx512_convert_utf32_to_utf16(const char32_t *buf, size_t len,
 
   while (end - buf >= std::ptrdiff_t(16)) {
     __m512i in = _mm512_loadu_si512(buf);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m512i byteflip = _mm512_setr_epi64(
+          0x0405060700010203, 0x0c0d0e0f08090a0b, 0x0405060700010203,
+          0x0c0d0e0f08090a0b, 0x0405060700010203, 0x0c0d0e0f08090a0b,
+          0x0405060700010203, 0x0c0d0e0f08090a0b);
+      in = _mm512_shuffle_epi8(in, byteflip);
+    }
 
     // no bits set above 16th bit <=> can pack to UTF16 without surrogate pairs
     const __mmask16 saturation_bitmask =
@@ -86,6 +93,13 @@ avx512_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   if (remaining_len) {
     __mmask16 input_mask = __mmask16((1U << remaining_len) - 1);
     __m512i in = _mm512_maskz_loadu_epi32(input_mask, buf);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m512i byteflip = _mm512_setr_epi64(
+          0x0405060700010203, 0x0c0d0e0f08090a0b, 0x0405060700010203,
+          0x0c0d0e0f08090a0b, 0x0405060700010203, 0x0c0d0e0f08090a0b,
+          0x0405060700010203, 0x0c0d0e0f08090a0b);
+      in = _mm512_shuffle_epi8(in, byteflip);
+    }
     const __mmask16 saturation_bitmask =
         _mm512_cmpeq_epi32_mask(_mm512_and_si512(in, v_ffff0000), v_00000000) &
         input_mask;
@@ -152,7 +166,7 @@ avx512_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   return std::make_pair(buf, utf16_output);
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char16_t *>
 avx512_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
                                           char16_t *utf16_output) {
@@ -173,6 +187,13 @@ avx512_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
 
   while (end - buf >= std::ptrdiff_t(16)) {
     __m512i in = _mm512_loadu_si512(buf);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m512i byteflip = _mm512_setr_epi64(
+          0x0405060700010203, 0x0c0d0e0f08090a0b, 0x0405060700010203,
+          0x0c0d0e0f08090a0b, 0x0405060700010203, 0x0c0d0e0f08090a0b,
+          0x0405060700010203, 0x0c0d0e0f08090a0b);
+      in = _mm512_shuffle_epi8(in, byteflip);
+    }
 
     // no bits set above 16th bit <=> can pack to UTF16 without surrogate pairs
     const __mmask16 saturation_bitmask =
@@ -257,6 +278,13 @@ avx512_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
   if (remaining_len) {
     __mmask16 input_mask = __mmask16((1U << remaining_len) - 1);
     __m512i in = _mm512_maskz_loadu_epi32(input_mask, buf);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m512i byteflip = _mm512_setr_epi64(
+          0x0405060700010203, 0x0c0d0e0f08090a0b, 0x0405060700010203,
+          0x0c0d0e0f08090a0b, 0x0405060700010203, 0x0c0d0e0f08090a0b,
+          0x0405060700010203, 0x0c0d0e0f08090a0b);
+      in = _mm512_shuffle_epi8(in, byteflip);
+    }
     const __mmask16 saturation_bitmask =
         _mm512_cmpeq_epi32_mask(_mm512_and_si512(in, v_ffff0000), v_00000000) &
         input_mask;
@@ -1,6 +1,7 @@
 // file included directly
 
 // Todo: currently, this is just the haswell code, optimize for icelake kernel.
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char *>
 avx512_convert_utf32_to_utf8(const char32_t *buf, size_t len,
                              char *utf8_output) {
@@ -21,6 +22,13 @@ avx512_convert_utf32_to_utf8(const char32_t *buf, size_t len,
   while (end - buf >= std::ptrdiff_t(16 + safety_margin)) {
     __m256i in = _mm256_loadu_si256((__m256i *)buf);
     __m256i nextin = _mm256_loadu_si256((__m256i *)buf + 1);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m256i swap = _mm256_setr_epi8(
+          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7,
+          6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm256_shuffle_epi8(in, swap);
+      nextin = _mm256_shuffle_epi8(nextin, swap);
+    }
     running_max = _mm256_max_epu32(_mm256_max_epu32(in, running_max), nextin);
 
     // Pack 32-bit UTF-32 code units to 16-bit UTF-16 code units with unsigned
@@ -243,7 +251,7 @@ avx512_convert_utf32_to_utf8(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) { // 1-byte (ASCII)
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) { // 2-byte
@@ -285,6 +293,7 @@ avx512_convert_utf32_to_utf8(const char32_t *buf, size_t len,
 }
 
 // Todo: currently, this is just the haswell code, optimize for icelake kernel.
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char *>
 avx512_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
                                          char *utf8_output) {
@@ -306,6 +315,13 @@ avx512_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
   while (end - buf >= std::ptrdiff_t(16 + safety_margin)) {
     __m256i in = _mm256_loadu_si256((__m256i *)buf);
     __m256i nextin = _mm256_loadu_si256((__m256i *)buf + 1);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m256i swap = _mm256_setr_epi8(
+          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7,
+          6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm256_shuffle_epi8(in, swap);
+      nextin = _mm256_shuffle_epi8(nextin, swap);
+    }
     // Check for too large input
     const __m256i max_input =
         _mm256_max_epu32(_mm256_max_epu32(in, nextin), v_10ffff);
@@ -541,7 +557,7 @@ avx512_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) { // 1-byte (ASCII)
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) { // 2-byte
@@ -0,0 +1,110 @@
+namespace hex {
+
+// Spreads 32 bytes, zero-extended to 16 bits, into two digits each.
+simdutf_really_inline __m512i encode_bytes(const __m512i bytes,
+                                           const __m512i digits) {
+  const __m512i nibbles = _mm512_or_si512(
+      _mm512_srli_epi16(bytes, 4),
+      _mm512_slli_epi16(_mm512_and_si512(bytes, _mm512_set1_epi16(0x0f)), 8));
+  return _mm512_shuffle_epi8(digits, nibbles);
+}
+
+size_t encode(const char *input, size_t length, char *output,
+              hex_options options) {
+  const __m512i digits = _mm512_broadcast_i32x4(
+      options == hex_options::hex_uppercase
+          ? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+                          'A', 'B', 'C', 'D', 'E', 'F')
+          : _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
+                          'a', 'b', 'c', 'd', 'e', 'f'));
+  size_t pos = 0;
+  for (; length - pos >= 32; pos += 32) {
+    const __m512i bytes = _mm512_cvtepu8_epi16(
+        _mm256_loadu_si256((const __m256i *)(input + pos)));
+    _mm512_storeu_si512((__m512i *)(output + 2 * pos),
+                        encode_bytes(bytes, digits));
+  }
+  if (pos < length) {
+    const size_t remaining = length - pos;
+    const __m512i bytes = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(
+        __mmask32(~UINT32_C(0) >> (32 - remaining)), input + pos));
+    _mm512_mask_storeu_epi8(output + 2 * pos,
+                            ~UINT64_C(0) >> (64 - 2 * remaining),
+                            encode_bytes(bytes, digits));
+  }
+  return 2 * length;
+}
+
+simdutf_really_inline __m512i load_digits(const char *input, __mmask64 mask,
+                                          uint64_t &invalid) {
+  invalid = 0;
+  return _mm512_maskz_loadu_epi8(mask, input);
+}
+
+// Units above 0xff are narrowed, so they are marked as invalid here.
+simdutf_really_inline __m512i load_digits(const char16_t *input,
+                                          __mmask64 mask, uint64_t &invalid) {
+  const __m512i first = _mm512_maskz_loadu_epi16(__mmask32(mask), input);
+  const __m512i second =
+      _mm512_maskz_loadu_epi16(__mmask32(mask >> 32), input + 32);
+  const __m512i max = _mm512_set1_epi16(0xff);
+  invalid = uint64_t(_mm512_cmpgt_epu16_mask(first, max)) |
+            (uint64_t(_mm512_cmpgt_epu16_mask(second, max)) << 32);
+  return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi16_epi8(first)),
+                            _mm512_cvtepi16_epi8(second), 1);
+}
+
+// Replaces the digits by their values and adds the other bytes to invalid.
+simdutf_really_inline __m512i digit_values(const __m512i in,
+                                           uint64_t &invalid) {
+  const __m512i decimal = _mm512_sub_epi8(in, _mm512_set1_epi8('0'));
+  const __m512i lower = _mm512_or_si512(in, _mm512_set1_epi8(0x20));
+  const __mmask64 is_decimal =
+      _mm512_cmplt_epu8_mask(decimal, _mm512_set1_epi8(10));
+  const __mmask64 is_letter = _mm512_cmplt_epu8_mask(
+      _mm512_sub_epi8(lower, _mm512_set1_epi8('a')), _mm512_set1_epi8(6));
+  invalid |= ~uint64_t(is_decimal | is_letter);
+  return _mm512_mask_sub_epi8(decimal, is_letter, lower,
+                              _mm512_set1_epi8('a' - 10));
+}
+
+// Combines pairs of digit values into 32 bytes.
+simdutf_really_inline __m256i pack(const __m512i values) {
+  return _mm512_cvtepi16_epi8(
+      _mm512_maddubs_epi16(values, _mm512_set1_epi16(0x0110)));
+}
+
+template <typename char_type>
+result decode(const char_type *input, size_t length, char *output) {
+  size_t pos = 0;
+  uint64_t invalid = 0;
+  for (; length - pos >= 64; pos += 64) {
+    const __m512i values = digit_values(
+        load_digits(input + pos, ~UINT64_C(0), invalid), invalid);
+    if (invalid != 0) {
+      break;
+    }
+    _mm256_storeu_si256((__m256i *)(output + pos / 2), pack(values));
+  }
+  const size_t remaining = length - pos;
+  if (remaining == 0) {
+    return result(error_code::SUCCESS, length / 2);
+  }
+  if (remaining < 64 && remaining % 2 == 0) {
+    const __mmask64 mask = ~UINT64_C(0) >> (64 - remaining);
+    const __m512i values =
+        digit_values(load_digits(input + pos, mask, invalid), invalid);
+    if ((invalid & mask) == 0) {
+      _mm256_mask_storeu_epi8(output + pos / 2,
+                              __mmask32(~UINT32_C(0) >> (32 - remaining / 2)),
+                              pack(values));
+      return result(error_code::SUCCESS, length / 2);
+    }
+  }
+  // The scalar code finds the error and writes the pairs before it.
+  result r = scalar::hex::decode(input + pos, remaining, output + pos / 2);
+  r.count += r.error == error_code::INVALID_HEX_CHARACTER ? pos : pos / 2;
+  return r;
+}
+
+} // namespace hex
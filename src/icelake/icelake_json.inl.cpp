@@ -0,0 +1,83 @@
+namespace json {
+
+// Validates and copies the bytes before the first one that must be escaped in
+// a JSON string (or that is not ASCII, if ascii_only), in the same pass, and
+// returns their number or the first UTF-8 error among them. Whole blocks of 64
+// bytes are stored, so that up to 64 bytes past the copied ones may be
+// overwritten.
+simdutf_really_inline result validate_and_copy_until_escape(const char *input,
+                                                            size_t length,
+                                                            char *output,
+                                                            bool ascii_only) {
+  avx512_utf8_checker checker{};
+  size_t pos = 0;
+  __m512i in = _mm512_setzero_si512();
+  __mmask64 escapes = 0;
+  for (; length - pos >= 64; pos += 64) {
+    in = _mm512_loadu_si512((const __m512i *)(input + pos));
+    _mm512_storeu_si512((__m512i *)(output + pos), in);
+    escapes = json_escape_mask(in);
+    if (ascii_only) {
+      escapes |= _mm512_movepi8_mask(in);
+    }
+    if (escapes != 0) {
+      break;
+    }
+    checker.check_next_input(in);
+    if (simdutf_unlikely(checker.errors())) {
+      break;
+    }
+  }
+  size_t run = length;
+  if (!checker.errors()) {
+    __mmask64 kept = 0;
+    if (escapes == 0 && pos != length) {
+      kept = ~UINT64_C(0) >> (64 - (length - pos));
+      in = _mm512_maskz_loadu_epi8(kept, input + pos);
+      _mm512_mask_storeu_epi8(output + pos, kept, in);
+      escapes = json_escape_mask(in);
+      if (ascii_only) {
+        escapes |= _mm512_movepi8_mask(in);
+      }
+      escapes &= kept;
+    }
+    if (escapes != 0) {
+      run = pos + _tzcnt_u64(escapes);
+      kept = (escapes - 1) & ~escapes;
+    }
+    // The bytes from the end of the run on are replaced by zeros, which end
+    // any character like the escaped byte.
+    checker.check_next_input(_mm512_maskz_mov_epi8(kept, in));
+    checker.check_eof();
+  }
+  if (simdutf_unlikely(checker.errors())) {
+    // Sometimes the error is only detected in the next block.
+    const size_t safe = pos != 0 ? pos - 1 : 0;
+    result res = scalar::utf8::rewind_and_validate_with_errors(
+        input, input + safe, run - safe);
+    res.count += safe;
+    return res;
+  }
+  return result(error_code::SUCCESS, run);
+}
+
+// Returns the position of the first byte that must be escaped, or length.
+simdutf_really_inline size_t find_escape(const char *input, size_t length) {
+  size_t pos = 0;
+  for (; length - pos >= 64; pos += 64) {
+    const __m512i in = _mm512_loadu_si512((const __m512i *)(input + pos));
+    const __mmask64 escapes = json_escape_mask(in);
+    if (escapes != 0) {
+      return pos + _tzcnt_u64(escapes);
+    }
+  }
+  if (pos == length) {
+    return length;
+  }
+  const __mmask64 tail = ~UINT64_C(0) >> (64 - (length - pos));
+  const __m512i in = _mm512_maskz_loadu_epi8(tail, input + pos);
+  const __mmask64 escapes = json_escape_mask(in) & tail;
+  return escapes != 0 ? pos + _tzcnt_u64(escapes) : length;
+}
+
+} // namespace json
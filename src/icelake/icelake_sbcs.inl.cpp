@@ -0,0 +1,48 @@
+namespace sbcs {
+
+// The 128 entries of the table fill four registers: vpermi2w looks up the
+// bytes 0x80 to 0xBF in the first two and the bytes 0xC0 to 0xFF in the last
+// two, from the low six bits of the zero-extended bytes.
+struct decoder {
+  explicit decoder(const char16_t *table)
+      : first(_mm512_loadu_si512((const __m512i *)table)),
+        second(_mm512_loadu_si512((const __m512i *)(table + 32))),
+        third(_mm512_loadu_si512((const __m512i *)(table + 64))),
+        fourth(_mm512_loadu_si512((const __m512i *)(table + 96))) {}
+
+  simdutf_really_inline __m512i decode(const __m512i bytes) const {
+    const __mmask32 ascii =
+        _mm512_cmplt_epu16_mask(bytes, _mm512_set1_epi16(0x80));
+    const __mmask32 upper =
+        _mm512_test_epi16_mask(bytes, _mm512_set1_epi16(0x40));
+    const __m512i units = _mm512_mask_blend_epi16(
+        upper, _mm512_permutex2var_epi16(first, bytes, second),
+        _mm512_permutex2var_epi16(third, bytes, fourth));
+    return _mm512_mask_blend_epi16(ascii, units, bytes);
+  }
+
+  const __m512i first;
+  const __m512i second;
+  const __m512i third;
+  const __m512i fourth;
+};
+
+size_t convert(const char *input, size_t length, const char16_t *table,
+               char16_t *output) {
+  const decoder d(table);
+  size_t pos = 0;
+  for (; length - pos >= 32; pos += 32) {
+    const __m512i bytes = _mm512_cvtepu8_epi16(
+        _mm256_loadu_si256((const __m256i *)(input + pos)));
+    _mm512_storeu_si512((__m512i *)(output + pos), d.decode(bytes));
+  }
+  if (pos < length) {
+    const __mmask32 mask = __mmask32(~UINT32_C(0) >> (32 - (length - pos)));
+    const __m512i bytes =
+        _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(mask, input + pos));
+    _mm512_mask_storeu_epi16(output + pos, mask, d.decode(bytes));
+  }
+  return length;
+}
+
+} // namespace sbcs
@@ -95,12 +95,12 @@ void utf16fix_short(const char16_t *in, size_t n, char16_t *out) {
         (uint16_t *)out, _cvtmask32_u32(mask),
         _mm512_mask_blend_epi16(block_illseq, block,
                                 _mm512_set1_epi16(replacement)));
-  } else {
+  } else if (in != out) {
     _mm512_mask_storeu_epi16((uint16_t *)out, _cvtmask32_u32(mask), block);
   }
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
 
 template <endianness big_endian>
@@ -114,8 +114,11 @@ void utf16fix_avx512(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_short<big_endian>(in, n, out);
     return;
   }
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
 
   /* duplicate code to have the compiler specialise utf16fix_block() */
   if (in == out) {
@@ -132,7 +135,7 @@ void utf16fix_avx512(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_block<big_endian, false>(out + n - 32, in + n - 32);
   }
 
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
@@ -114,3 +114,187 @@ struct avx512_utf8_checker {
     return _mm512_test_epi8_mask(this->error, this->error) != 0;
   }
 }; // struct avx512_utf8_checker
+
+// Validates the UTF-8 string and counts the UTF-16 code units (UTF-32 when
+// utf16 is false) that it needs while each block is in a register. As in
+// validate_utf8_with_errors, errors are only tested every eighth block, and
+// the scalar rewind finds the exact position.
+template <bool utf16>
+simdutf_really_inline result icelake_length_from_utf8_with_errors(
+    const char *buf, size_t len) {
+  avx512_utf8_checker checker{};
+  const char *ptr = buf;
+  const char *end = buf + len;
+  const __m512i continuation = _mm512_set1_epi8(-65);
+  const __m512i four_byte_lead = _mm512_set1_epi8(char(0xf0));
+  size_t count{0};
+  size_t safe{0};
+  size_t units{0};
+  unsigned since = 0;
+  for (; end - ptr >= 64; ptr += 64) {
+    const __m512i utf8 = _mm512_loadu_si512((const __m512i *)ptr);
+    if (checker.check_next_input(utf8)) {
+      units += 64;
+    } else {
+      units += count_ones(_mm512_cmpgt_epi8_mask(utf8, continuation));
+      if (utf16) {
+        units += count_ones(_mm512_cmpge_epu8_mask(utf8, four_byte_lead));
+      }
+    }
+    count += 64;
+    if (++since == 8) {
+      since = 0;
+      if (simdutf_unlikely(checker.errors())) {
+        break;
+      }
+      safe = count >= 64 ? count - 64 : 0;
+    }
+  }
+  if (!checker.errors() && end != ptr) {
+    const __mmask64 tail = ~UINT64_C(0) >> (64 - (end - ptr));
+    const __m512i utf8 = _mm512_maskz_loadu_epi8(tail, (const __m512i *)ptr);
+    checker.check_next_input(utf8);
+    units += count_ones(_mm512_mask_cmpgt_epi8_mask(tail, utf8, continuation));
+    if (utf16) {
+      units += count_ones(_mm512_cmpge_epu8_mask(utf8, four_byte_lead));
+    }
+  }
+  checker.check_eof();
+  if (checker.errors()) {
+    if (safe != 0) {
+      safe--;
+    } // Sometimes the error is only detected in the next chunk
+    result res = scalar::utf8::rewind_and_validate_with_errors(
+        buf, buf + safe, len - safe);
+    res.count += safe;
+    return res;
+  }
+  return result(error_code::SUCCESS, units);
+}
+
+// Validates the string and records the positions of its newlines, see
+// implementation::validate_utf8_and_index_lines.
+simdutf_really_inline result icelake_validate_utf8_and_index_lines(
+    const char *buf, size_t len, size_t *line_positions, size_t &line_count) {
+  const size_t capacity = line_count;
+  line_count = 0;
+  avx512_utf8_checker checker{};
+  const char *ptr = buf;
+  const char *end = buf + len;
+  const __m512i newline = _mm512_set1_epi8('\n');
+  size_t count{0};
+  size_t safe{0};
+  unsigned since = 0;
+  // Records the newlines of the block starting at count. When there is no
+  // room left, the input before the newline is valid unless the checker
+  // already saw an error.
+  auto record = [&](uint64_t newlines) -> bool {
+    while (newlines != 0) {
+      const size_t position = count + _tzcnt_u64(newlines);
+      if (line_count == capacity) {
+        count = position;
+        return false;
+      }
+      line_positions[line_count++] = position;
+      newlines &= newlines - 1;
+    }
+    return true;
+  };
+  for (; end - ptr >= 64; ptr += 64) {
+    const __m512i utf8 = _mm512_loadu_si512((const __m512i *)ptr);
+    checker.check_next_input(utf8);
+    if (!record(_mm512_cmpeq_epi8_mask(utf8, newline))) {
+      break;
+    }
+    count += 64;
+    if (++since == 8) {
+      since = 0;
+      if (simdutf_unlikely(checker.errors())) {
+        break;
+      }
+      safe = count >= 64 ? count - 64 : 0;
+    }
+  }
+  if (end - ptr < 64 && !checker.errors() && end != ptr) {
+    const __mmask64 tail = ~UINT64_C(0) >> (64 - (end - ptr));
+    const __m512i utf8 = _mm512_maskz_loadu_epi8(tail, (const __m512i *)ptr);
+    checker.check_next_input(utf8);
+    if (record(_mm512_cmpeq_epi8_mask(utf8, newline))) {
+      count = len;
+    }
+  }
+  if (count == len) {
+    checker.check_eof();
+  }
+  if (checker.errors()) {
+    // Sometimes the error is only detected in the next chunk
+    return scalar::utf8::index_lines_until_error(
+        buf, len, safe == 0 ? 0 : safe - 1, count, line_positions, capacity,
+        line_count);
+  }
+  if (count != len) {
+    return result(error_code::OUTPUT_BUFFER_TOO_SMALL, count);
+  }
+  return result(error_code::SUCCESS, len);
+}
+
+// Bytes that must be escaped in a JSON string: the quotation mark, the reverse
+// solidus and the control characters.
+simdutf_really_inline __mmask64 json_escape_mask(__m512i utf8) {
+  return _mm512_cmpeq_epi8_mask(utf8, _mm512_set1_epi8('"')) |
+         _mm512_cmpeq_epi8_mask(utf8, _mm512_set1_epi8('\\')) |
+         _mm512_cmplt_epu8_mask(utf8, _mm512_set1_epi8(0x20));
+}
+
+// Validates the string and finds the first byte that must be escaped in a
+// JSON string, see implementation::validate_utf8_and_find_json_escape.
+simdutf_really_inline result
+icelake_validate_utf8_and_find_json_escape(const char *buf, size_t len) {
+  avx512_utf8_checker checker{};
+  const char *ptr = buf;
+  const char *end = buf + len;
+  size_t count{0};
+  size_t safe{0};
+  size_t escape{len};
+  unsigned since = 0;
+  for (; end - ptr >= 64; ptr += 64) {
+    const __m512i utf8 = _mm512_loadu_si512((const __m512i *)ptr);
+    checker.check_next_input(utf8);
+    if (escape == len) {
+      const __mmask64 escapes = json_escape_mask(utf8);
+      if (escapes != 0) {
+        escape = count + _tzcnt_u64(escapes);
+      }
+    }
+    count += 64;
+    if (++since == 8) {
+      since = 0;
+      if (simdutf_unlikely(checker.errors())) {
+        break;
+      }
+      safe = count >= 64 ? count - 64 : 0;
+    }
+  }
+  if (!checker.errors() && end != ptr) {
+    const __mmask64 tail = ~UINT64_C(0) >> (64 - (end - ptr));
+    const __m512i utf8 = _mm512_maskz_loadu_epi8(tail, (const __m512i *)ptr);
+    checker.check_next_input(utf8);
+    if (escape == len) {
+      const __mmask64 escapes = json_escape_mask(utf8) & tail;
+      if (escapes != 0) {
+        escape = count + _tzcnt_u64(escapes);
+      }
+    }
+  }
+  checker.check_eof();
+  if (checker.errors()) {
+    if (safe != 0) {
+      safe--;
+    } // Sometimes the error is only detected in the next chunk
+    result res = scalar::utf8::rewind_and_validate_with_errors(
+        buf, buf + safe, len - safe);
+    res.count += safe;
+    return res;
+  }
+  return result(error_code::SUCCESS, escape);
+}
@@ -26,6 +26,9 @@ using namespace simd;
 #if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_DETECT_ENCODING
   #include "icelake/icelake_utf8_validation.inl.cpp"
 #endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_DETECT_ENCODING
+#if SIMDUTF_FEATURE_UTF8
+  #include "icelake/icelake_json.inl.cpp"
+#endif // SIMDUTF_FEATURE_UTF8
 
 #if SIMDUTF_FEATURE_UTF8 &&                                                    \
     (SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_UTF32 || SIMDUTF_FEATURE_LATIN1)
@@ -80,12 +83,16 @@ using namespace simd;
 #if SIMDUTF_FEATURE_UTF16
   #include "icelake/icelake_convert_latin1_to_utf16.inl.cpp"
 #endif // SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+  #include "icelake/icelake_sbcs.inl.cpp"
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 #if SIMDUTF_FEATURE_UTF32
   #include "icelake/icelake_convert_latin1_to_utf32.inl.cpp"
 #endif // SIMDUTF_FEATURE_UTF32
 #if SIMDUTF_FEATURE_BASE64
   #include "icelake/icelake_base64.inl.cpp"
   #include "icelake/icelake_find.inl.cpp"
+  #include "icelake/icelake_hex.inl.cpp"
 #endif // SIMDUTF_FEATURE_BASE64
 
 #include <cstdint>
@@ -309,8 +316,62 @@ simdutf_warn_unused result implementation::validate_utf8_with_errors(
   }
   return result(error_code::SUCCESS, len);
 }
+
+simdutf_warn_unused result implementation::validate_utf8_and_index_lines(
+    const char *input, size_t length, size_t *line_positions,
+    size_t &line_count) const noexcept {
+  return icelake_validate_utf8_and_index_lines(input, length, line_positions,
+                                               line_count);
+}
+
+simdutf_warn_unused result implementation::validate_utf8_and_find_json_escape(
+    const char *input, size_t length) const noexcept {
+  return icelake_validate_utf8_and_find_json_escape(input, length);
+}
+simdutf_warn_unused result implementation::escape_json_utf8(
+    const char *input, size_t length, char *output,
+    bool ascii_only) const noexcept {
+  return scalar::json::escape(
+      input, length, output,
+      [ascii_only](const char *in, size_t len, char *out) {
+        return json::validate_and_copy_until_escape(in, len, out,
+                                                    ascii_only);
+      });
+}
+
+simdutf_warn_unused result implementation::unescape_json_to_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::json::unescape(
+      input, length, output,
+      [](const char *in, size_t len, char *out, size_t &units) {
+        const result run =
+            json::validate_and_copy_until_escape(in, len, out, false);
+        units = run.count;
+        return run;
+      });
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused result implementation::unescape_json_to_utf16(
+    const char *input, size_t length, char16_t *output) const noexcept {
+  // The runs between the escapes are validated by the transcoding kernel.
+  return scalar::json::unescape(
+      input, length, output,
+      [this](const char *in, size_t len, char16_t *out, size_t &units) {
+        const size_t run = json::find_escape(in, len);
+  #if SIMDUTF_IS_BIG_ENDIAN
+        const result r = convert_utf8_to_utf16be_with_errors(in, run, out);
+  #else
+        const result r = convert_utf8_to_utf16le_with_errors(in, run, out);
+  #endif
+        units = r.count;
+        return r.error == error_code::SUCCESS ? result(error_code::SUCCESS, run)
+                                              : r;
+      });
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_ASCII
 simdutf_warn_unused bool
 implementation::validate_ascii(const char *buf, size_t len) const noexcept {
@@ -830,8 +891,21 @@ implementation::validate_utf32(const char32_t *buf, size_t len) const noexcept {
 #endif // SIMDUTF_FEATURE_UTF32 || SIMDUTF_FEATURE_DETECT_ENCODING
 
 #if SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused result implementation::validate_utf32_with_errors(
-    const char32_t *buf, size_t len) const noexcept {
+template <endianness utf32_endian>
+simdutf_really_inline __m512i swap_utf32_if_needed(__m512i in) {
+  if constexpr (!match_system(utf32_endian)) {
+    const __m512i byteflip = _mm512_setr_epi64(
+        0x0405060700010203, 0x0c0d0e0f08090a0b, 0x0405060700010203,
+        0x0c0d0e0f08090a0b, 0x0405060700010203, 0x0c0d0e0f08090a0b,
+        0x0405060700010203, 0x0c0d0e0f08090a0b);
+    in = _mm512_shuffle_epi8(in, byteflip);
+  }
+  return in;
+}
+
+template <endianness utf32_endian>
+simdutf_really_inline result
+validate_utf32_with_errors_impl(const char32_t *buf, size_t len) {
   const char32_t *buf_orig = buf;
   if (len >= 16) {
     const char32_t *end = buf + len - 16;
@@ -840,7 +914,8 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
     // known to be clean we may jump to the 64-byte boundary; re-reading the
     // values in between is harmless because no state crosses blocks.
     {
-      __m512i utf32 = _mm512_loadu_si512((const __m512i *)buf);
+      __m512i utf32 = swap_utf32_if_needed<utf32_endian>(
+          _mm512_loadu_si512((const __m512i *)buf));
       __mmask16 outside_range = _mm512_cmp_epu32_mask(
           utf32, _mm512_set1_epi32(0x10ffff), _MM_CMPINT_GT);
       __m512i utf32_off =
@@ -864,10 +939,14 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
     const __m512i offset = _mm512_set1_epi32(0xffff2000);
     const __m512i surrmax = _mm512_set1_epi32(0xfffff7ff);
     while (buf + 48 <= end) {
-      __m512i a = _mm512_loadu_si512((const __m512i *)buf);
-      __m512i b = _mm512_loadu_si512((const __m512i *)(buf + 16));
-      __m512i c = _mm512_loadu_si512((const __m512i *)(buf + 32));
-      __m512i d = _mm512_loadu_si512((const __m512i *)(buf + 48));
+      __m512i a = swap_utf32_if_needed<utf32_endian>(
+          _mm512_loadu_si512((const __m512i *)buf));
+      __m512i b = swap_utf32_if_needed<utf32_endian>(
+          _mm512_loadu_si512((const __m512i *)(buf + 16)));
+      __m512i c = swap_utf32_if_needed<utf32_endian>(
+          _mm512_loadu_si512((const __m512i *)(buf + 32)));
+      __m512i d = swap_utf32_if_needed<utf32_endian>(
+          _mm512_loadu_si512((const __m512i *)(buf + 48)));
       __m512i mx =
           _mm512_max_epu32(_mm512_max_epu32(a, b), _mm512_max_epu32(c, d));
       __m512i ox =
@@ -882,7 +961,8 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
       buf += 64;
     }
     while (buf <= end) {
-      __m512i utf32 = _mm512_loadu_si512((const __m512i *)buf);
+      __m512i utf32 = swap_utf32_if_needed<utf32_endian>(
+          _mm512_loadu_si512((const __m512i *)buf));
       __mmask16 outside_range = _mm512_cmp_epu32_mask(
           utf32, _mm512_set1_epi32(0x10ffff), _MM_CMPINT_GT);
 
@@ -906,8 +986,10 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
     }
   }
   if (len > 0) {
-    __m512i utf32 = _mm512_maskz_loadu_epi32(
-        __mmask16((1U << (buf_orig + len - buf)) - 1), (const __m512i *)buf);
+    __m512i utf32 =
+        swap_utf32_if_needed<utf32_endian>(_mm512_maskz_loadu_epi32(
+            __mmask16((1U << (buf_orig + len - buf)) - 1),
+            (const __m512i *)buf));
     __mmask16 outside_range = _mm512_cmp_epu32_mask(
         utf32, _mm512_set1_epi32(0x10ffff), _MM_CMPINT_GT);
     __m512i utf32_off = _mm512_add_epi32(utf32, _mm512_set1_epi32(0xffff2000));
@@ -928,6 +1010,21 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
 
   return result(error_code::SUCCESS, len);
 }
+
+simdutf_warn_unused result implementation::validate_utf32_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return validate_utf32_with_errors_impl<endianness::NATIVE>(buf, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32le_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return validate_utf32_with_errors_impl<endianness::LITTLE>(buf, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32be_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return validate_utf32_with_errors_impl<endianness::BIG>(buf, len);
+}
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -978,7 +1075,7 @@ simdutf_warn_unused result implementation::convert_utf8_to_latin1_with_errors(
   }
   size_t pos = obuf - buf;
   result res = scalar::utf8_to_latin1::rewind_and_convert_with_errors(
-      pos, buf + pos, len - pos, latin1_output);
+      pos, buf + pos, len - pos, olatin1_output);
   res.count += pos;
   return res;
 }
@@ -1150,12 +1247,16 @@ simdutf_warn_unused result implementation::convert_utf8_to_utf32_with_errors(
         return {simdutf::TOO_LONG, pos};
       }
     }
-    // todo: we reset the output to utf32 instead of using std::get<2.(ret) as
-    // you'd expect. that is because
+    // We do not resume at std::get<1>(ret) because
     // validating_utf8_to_fixed_length_with_constant_checks may have processed
-    // data beyond the error.
+    // data beyond the error. The scalar code restarts at the last leading byte
+    // at or before pos, so the code points before that byte are kept.
+    size_t written = count_utf8(buf, pos);
+    if ((buf[pos] & 0xc0) == 0x80 && written > 0) {
+      written--;
+    }
     result res = scalar::utf8_to_utf32::rewind_and_convert_with_errors(
-        pos, buf + pos, len - pos, utf32);
+        pos, buf + pos, len - pos, utf32 + written);
     res.count += pos;
     return res;
   }
@@ -1190,6 +1291,30 @@ simdutf_warn_unused result implementation::convert_utf8_to_utf32_with_errors(
   return {simdutf::SUCCESS, size_t(std::get<1>(ret) - utf32_output)};
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf32_with_replacement(
+    const char *input, size_t length, char32_t *utf32_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char32_t *o) {
+        return convert_utf8_to_utf32_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char32_t *o) {
+        return convert_valid_utf8_to_utf32(b, l, o);
+      },
+      input, length, utf32_output, char32_t(0xfffd));
+}
+
+simdutf_warn_unused result
+implementation::utf32_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::length_with_replacement_via(
+      [this](const char *b, size_t l) {
+        return validate_utf8_with_errors(b, l);
+      },
+      [this](const char *b, size_t l) { return utf32_length_from_utf8(b, l); },
+      input, length);
+}
+
 simdutf_warn_unused size_t implementation::convert_valid_utf8_to_utf32(
     const char *buf, size_t len, char32_t *utf32_out) const noexcept {
   uint32_t *utf32_output = reinterpret_cast<uint32_t *>(utf32_out);
@@ -1347,17 +1472,20 @@ simdutf_warn_unused size_t implementation::convert_valid_utf32_to_latin1(
 #endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::convert_utf32_to_utf8(
-    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+template <endianness utf32_endian>
+simdutf_really_inline size_t convert_utf32_to_utf8_impl(const char32_t *buf,
+                                                        size_t len,
+                                                        char *utf8_output) {
   std::pair<const char32_t *, char *> ret =
-      avx512_convert_utf32_to_utf8(buf, len, utf8_output);
+      avx512_convert_utf32_to_utf8<utf32_endian>(buf, len, utf8_output);
   if (ret.first == nullptr) {
     return 0;
   }
   size_t saved_bytes = ret.second - utf8_output;
   if (ret.first != buf + len) {
-    const size_t scalar_saved_bytes = scalar::utf32_to_utf8::convert(
-        ret.first, len - (ret.first - buf), ret.second);
+    const size_t scalar_saved_bytes =
+        scalar::utf32_to_utf8::convert<utf32_endian>(
+            ret.first, len - (ret.first - buf), ret.second);
     if (scalar_saved_bytes == 0) {
       return 0;
     }
@@ -1366,15 +1494,33 @@ simdutf_warn_unused size_t implementation::convert_utf32_to_utf8(
   return saved_bytes;
 }
 
-simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
+simdutf_warn_unused size_t implementation::convert_utf32_to_utf8(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_impl<endianness::NATIVE>(buf, len, utf8_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf8(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_impl<endianness::LITTLE>(buf, len, utf8_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf8(
     const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_impl<endianness::BIG>(buf, len, utf8_output);
+}
+
+template <endianness utf32_endian>
+simdutf_really_inline result convert_utf32_to_utf8_with_errors_impl(
+    const char32_t *buf, size_t len, char *utf8_output) {
   // ret.first.count is always the position in the buffer, not the number of
   // code units written even if finished
   std::pair<result, char *> ret =
-      icelake::avx512_convert_utf32_to_utf8_with_errors(buf, len, utf8_output);
+      icelake::avx512_convert_utf32_to_utf8_with_errors<utf32_endian>(
+          buf, len, utf8_output);
   if (ret.first.count != len) {
-    result scalar_res = scalar::utf32_to_utf8::convert_with_errors(
-        buf + ret.first.count, len - ret.first.count, ret.second);
+    result scalar_res =
+        scalar::utf32_to_utf8::convert_with_errors<utf32_endian>(
+            buf + ret.first.count, len - ret.first.count, ret.second);
     if (scalar_res.error) {
       scalar_res.count += ret.first.count;
       return scalar_res;
@@ -1388,6 +1534,24 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
   return ret.first;
 }
 
+simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_with_errors_impl<endianness::NATIVE>(
+      buf, len, utf8_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_with_errors_impl<endianness::LITTLE>(
+      buf, len, utf8_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_with_errors_impl<endianness::BIG>(
+      buf, len, utf8_output);
+}
+
 simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf8(
     const char32_t *buf, size_t len, char *utf8_output) const noexcept {
   return convert_utf32_to_utf8(buf, len, utf8_output);
@@ -1395,10 +1559,12 @@ simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf8(
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::convert_utf32_to_utf16le(
-    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+template <endianness big_endian, endianness utf32_endian>
+simdutf_really_inline size_t convert_utf32_to_utf16_impl(
+    const char32_t *buf, size_t len, char16_t *utf16_output) {
   std::pair<const char32_t *, char16_t *> ret =
-      avx512_convert_utf32_to_utf16<endianness::LITTLE>(buf, len, utf16_output);
+      avx512_convert_utf32_to_utf16<big_endian, utf32_endian>(buf, len,
+                                                              utf16_output);
   if (ret.first == nullptr) {
     return 0;
   }
@@ -1406,23 +1572,13 @@ simdutf_warn_unused size_t implementation::convert_utf32_to_utf16le(
   return saved_bytes;
 }
 
-simdutf_warn_unused size_t implementation::convert_utf32_to_utf16be(
-    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
-  std::pair<const char32_t *, char16_t *> ret =
-      avx512_convert_utf32_to_utf16<endianness::BIG>(buf, len, utf16_output);
-  if (ret.first == nullptr) {
-    return 0;
-  }
-  size_t saved_bytes = ret.second - utf16_output;
-  return saved_bytes;
-}
-
-simdutf_warn_unused result implementation::convert_utf32_to_utf16le_with_errors(
-    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+template <endianness big_endian, endianness utf32_endian>
+simdutf_really_inline result convert_utf32_to_utf16_with_errors_impl(
+    const char32_t *buf, size_t len, char16_t *utf16_output) {
   // ret.first.count is always the position in the buffer, not the number of
   // code units written even if finished
   std::pair<result, char16_t *> ret =
-      avx512_convert_utf32_to_utf16_with_errors<endianness::LITTLE>(
+      avx512_convert_utf32_to_utf16_with_errors<big_endian, utf32_endian>(
           buf, len, utf16_output);
   if (ret.first.error) {
     return ret.first;
@@ -1433,20 +1589,56 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf16le_with_errors(
   return ret.first;
 }
 
+simdutf_warn_unused size_t implementation::convert_utf32_to_utf16le(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::LITTLE, endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32_to_utf16be(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::BIG, endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf16(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::NATIVE, endianness::LITTLE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf16(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::NATIVE, endianness::BIG>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32_to_utf16le_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_with_errors_impl<endianness::LITTLE,
+                                                 endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
 simdutf_warn_unused result implementation::convert_utf32_to_utf16be_with_errors(
     const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
-  // ret.first.count is always the position in the buffer, not the number of
-  // code units written even if finished
-  std::pair<result, char16_t *> ret =
-      avx512_convert_utf32_to_utf16_with_errors<endianness::BIG>(buf, len,
-                                                                 utf16_output);
-  if (ret.first.error) {
-    return ret.first;
-  }
-  ret.first.count =
-      ret.second -
-      utf16_output; // Set count to the number of 8-bit code units written
-  return ret.first;
+  return convert_utf32_to_utf16_with_errors_impl<endianness::BIG,
+                                                 endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf16_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_with_errors_impl<endianness::NATIVE,
+                                                 endianness::LITTLE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf16_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_with_errors_impl<endianness::NATIVE,
+                                                 endianness::BIG>(
+      buf, len, utf16_output);
 }
 
 simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf16le(
@@ -1927,6 +2119,11 @@ simdutf_warn_unused size_t implementation::utf16_length_from_utf8(
          scalar::utf8::utf16_length_from_utf8(input + pos, length - pos);
 }
 simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_errors(
+    const char *input, size_t length) const noexcept {
+  return icelake_length_from_utf8_with_errors<true>(input, length);
+}
+simdutf_warn_unused result
 implementation::utf8_length_from_utf16le_with_replacement(
     const char16_t *input, size_t length) const noexcept {
   return icelake_utf8_length_from_utf16_with_replacement<endianness::LITTLE>(
@@ -1960,36 +2157,103 @@ implementation::convert_utf16be_to_utf8_with_replacement(
       input, length, utf8_buffer);
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16le_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_utf8_to_utf16le_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_valid_utf8_to_utf16le(b, l, o);
+      },
+      input, length, utf16_output,
+      char16_t(scalar::utf16::swap_if_needed<endianness::LITTLE>(0xfffd)));
+}
+
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16be_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_utf8_to_utf16be_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_valid_utf8_to_utf16be(b, l, o);
+      },
+      input, length, utf16_output,
+      char16_t(scalar::utf16::swap_if_needed<endianness::BIG>(0xfffd)));
+}
+
+simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::length_with_replacement_via(
+      [this](const char *b, size_t l) {
+        return validate_utf8_with_errors(b, l);
+      },
+      [this](const char *b, size_t l) { return utf16_length_from_utf8(b, l); },
+      input, length);
+}
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 simdutf_warn_unused size_t implementation::utf8_length_from_utf32(
     const char32_t *input, size_t length) const noexcept {
   return utf32::utf8_length_from_utf32(input, length);
 }
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32le(
+    const char32_t *input, size_t length) const noexcept {
+  return utf32::utf8_length_from_utf32<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32be(
+    const char32_t *input, size_t length) const noexcept {
+  return utf32::utf8_length_from_utf32<endianness::BIG>(input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
-    const char32_t *input, size_t length) const noexcept {
+template <endianness utf32_endian>
+simdutf_really_inline size_t
+utf16_length_from_utf32_impl(const char32_t *input, size_t length) {
   const char32_t *ptr = input;
   size_t count{0};
 
   if (length >= 16) {
     const char32_t *end = input + length - 16;
 
-    const __m512i v_0000_ffff = _mm512_set1_epi32((uint32_t)0x0000ffff);
+    // the high bits of the code units, before swapping the bytes
+    const __m512i v_ffff_0000 = _mm512_set1_epi32(
+        match_system(utf32_endian) ? 0xffff0000 : 0x0000ffff);
 
     while (ptr <= end) {
       __m512i utf32 = _mm512_loadu_si512((const __m512i *)ptr);
       ptr += 16;
       __mmask16 surrogates_bitmask =
-          _mm512_cmpgt_epu32_mask(utf32, v_0000_ffff);
+          _mm512_test_epi32_mask(utf32, v_ffff_0000);
 
       count += 16 + count_ones(surrogates_bitmask);
     }
   }
 
-  return count +
-         scalar::utf32::utf16_length_from_utf32(ptr, length - (ptr - input));
+  return count + scalar::utf32::utf16_length_from_utf32<utf32_endian>(
+                     ptr, length - (ptr - input));
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
+    const char32_t *input, size_t length) const noexcept {
+  return utf16_length_from_utf32_impl<endianness::NATIVE>(input, length);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32le(
+    const char32_t *input, size_t length) const noexcept {
+  return utf16_length_from_utf32_impl<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32be(
+    const char32_t *input, size_t length) const noexcept {
+  return utf16_length_from_utf32_impl<endianness::BIG>(input, length);
 }
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
@@ -1998,8 +2262,105 @@ simdutf_warn_unused size_t implementation::utf32_length_from_utf8(
     const char *input, size_t length) const noexcept {
   return implementation::count_utf8(input, length);
 }
+simdutf_warn_unused result
+implementation::utf32_length_from_utf8_with_errors(
+    const char *input, size_t length) const noexcept {
+  return icelake_length_from_utf8_with_errors<false>(input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused const char *
+implementation::find_c1_control(const char *start,
+                                const char *end) const noexcept {
+  const __m512i c1_start = _mm512_set1_epi8(char(0x80));
+  const __m512i c1_count = _mm512_set1_epi8(0x20);
+  for (; end - start >= 64; start += 64) {
+    const __m512i in = _mm512_loadu_si512((const __m512i *)start);
+    const __mmask64 c1 =
+        _mm512_cmplt_epu8_mask(_mm512_sub_epi8(in, c1_start), c1_count);
+    if (c1 != 0) {
+      return start + _tzcnt_u64(c1);
+    }
+  }
+  if (start == end) {
+    return end;
+  }
+  const __mmask64 tail = ~UINT64_C(0) >> (64 - (end - start));
+  const __m512i in = _mm512_maskz_loadu_epi8(tail, start);
+  const __mmask64 c1 = _mm512_mask_cmplt_epu8_mask(
+      tail, _mm512_sub_epi8(in, c1_start), c1_count);
+  return c1 != 0 ? start + _tzcnt_u64(c1) : end;
+}
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused const char *
+implementation::find_cesu8_special(const char *start, const char *end,
+                                   bool modified) const noexcept {
+  const __m512i f0 = _mm512_set1_epi8(char(0xf0));
+  for (; end - start >= 64; start += 64) {
+    const __m512i in = _mm512_loadu_si512((const __m512i *)start);
+    __mmask64 special = _mm512_cmpge_epu8_mask(in, f0);
+    if (modified) {
+      special |= _mm512_testn_epi8_mask(in, in);
+    }
+    if (special != 0) {
+      return start + _tzcnt_u64(special);
+    }
+  }
+  if (start == end) {
+    return end;
+  }
+  const __mmask64 tail = ~UINT64_C(0) >> (64 - (end - start));
+  const __m512i in = _mm512_maskz_loadu_epi8(tail, start);
+  __mmask64 special = _mm512_cmpge_epu8_mask(in, f0);
+  if (modified) {
+    special |= _mm512_testn_epi8_mask(in, in);
+  }
+  special &= tail;
+  return special != 0 ? start + _tzcnt_u64(special) : end;
+}
+
+simdutf_warn_unused const char16_t *
+implementation::find_cesu8_special(const char16_t *start, const char16_t *end,
+                                   bool modified) const noexcept {
+  const __m512i d800 = _mm512_set1_epi16(-0x2800);
+  const __m512i surrogate_count = _mm512_set1_epi16(0x800);
+  for (; end - start >= 32; start += 32) {
+    const __m512i in = _mm512_loadu_si512((const __m512i *)start);
+    __mmask32 special = _mm512_cmplt_epu16_mask(_mm512_sub_epi16(in, d800),
+                                                surrogate_count);
+    if (modified) {
+      special |= _mm512_testn_epi16_mask(in, in);
+    }
+    if (special != 0) {
+      return start + _tzcnt_u32(special);
+    }
+  }
+  if (start == end) {
+    return end;
+  }
+  const __mmask32 tail = ~UINT32_C(0) >> (32 - (end - start));
+  const __m512i in = _mm512_maskz_loadu_epi16(tail, start);
+  __mmask32 special =
+      _mm512_cmplt_epu16_mask(_mm512_sub_epi16(in, d800), surrogate_count);
+  if (modified) {
+    special |= _mm512_testn_epi16_mask(in, in);
+  }
+  special &= tail;
+  return special != 0 ? start + _tzcnt_u32(special) : end;
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused size_t implementation::convert_sbcs_to_utf16(
+    const char *input, size_t length, const char16_t *table,
+    char16_t *utf16_output) const noexcept {
+  return sbcs::convert(input, length, table, utf16_output);
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_BASE64
 simdutf_warn_unused result implementation::base64_to_binary(
     const char *input, size_t length, char *output, base64_options options,
@@ -2152,6 +2513,22 @@ const char16_t *implementation::find(const char16_t *start, const char16_t *end,
   return util_find(start, end, character);
 }
 
+size_t implementation::binary_to_hex(const char *input, size_t length,
+                                     char *output,
+                                     hex_options options) const noexcept {
+  return hex::encode(input, length, output, options);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char *input, size_t length, char *output) const noexcept {
+  return hex::decode(input, length, output);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char16_t *input, size_t length, char *output) const noexcept {
+  return hex::decode(input, length, output);
+}
+
 simdutf_warn_unused size_t implementation::binary_length_from_base64(
     const char *input, size_t length) const noexcept {
   return icelake_binary_length_from_base64(input, length);
@@ -1,5 +1,6 @@
 #include "simdutf.h"
 #include <climits>
+#include <cstring>
 #include <initializer_list>
 #include <type_traits>
 #if SIMDUTF_ATOMIC_REF
@@ -35,6 +36,20 @@
   #endif // SIMDUTF_NO_LIBCXX
 #endif   // SIMDUTF_USE_STATIC_INITIALIZATION
 
+// The default executor of the parallel functions is a pool of threads, unless
+// the library is built without threads, without the C++ standard library or
+// without exceptions, which report the failures to start a thread.
+#if !defined(SIMDUTF_NO_THREADS) && !SIMDUTF_NO_LIBCXX &&                      \
+    (defined(__cpp_exceptions) || defined(_CPPUNWIND))
+  #define SIMDUTF_THREAD_POOL 1
+  #include <condition_variable>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+#else
+  #define SIMDUTF_THREAD_POOL 0
+#endif
+
 // When building without libc++abi (SIMDUTF_NO_LIBCXX=1) on GCC/Clang, provide
 // a weak stub for __cxa_pure_virtual so the abstract implementation vtable
 // does not drag in libc++abi just for this unreachable hook. Kept weak so a
@@ -313,8 +328,40 @@ public:
       const char *buf, size_t len) const noexcept final override {
     return set_best()->validate_utf8_with_errors(buf, len);
   }
+
+  simdutf_warn_unused result validate_utf8_and_index_lines(
+      const char *input, size_t length, size_t *line_positions,
+      size_t &line_count) const noexcept final override {
+    return set_best()->validate_utf8_and_index_lines(
+        input, length, line_positions, line_count);
+  }
+
+  simdutf_warn_unused result validate_utf8_and_find_json_escape(
+      const char *input, size_t length) const noexcept final override {
+    return set_best()->validate_utf8_and_find_json_escape(input, length);
+  }
+
+  simdutf_warn_unused result
+  escape_json_utf8(const char *input, size_t length, char *output,
+                   bool ascii_only) const noexcept final override {
+    return set_best()->escape_json_utf8(input, length, output, ascii_only);
+  }
+
+  simdutf_warn_unused result
+  unescape_json_to_utf8(const char *input, size_t length,
+                        char *output) const noexcept final override {
+    return set_best()->unescape_json_to_utf8(input, length, output);
+  }
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused result
+  unescape_json_to_utf16(const char *input, size_t length,
+                         char16_t *output) const noexcept final override {
+    return set_best()->unescape_json_to_utf16(input, length, output);
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_ASCII
   simdutf_warn_unused bool
   validate_ascii(const char *buf, size_t len) const noexcept final override {
@@ -386,6 +433,16 @@ public:
       const char32_t *buf, size_t len) const noexcept final override {
     return set_best()->validate_utf32_with_errors(buf, len);
   }
+
+  simdutf_warn_unused result validate_utf32le_with_errors(
+      const char32_t *buf, size_t len) const noexcept final override {
+    return set_best()->validate_utf32le_with_errors(buf, len);
+  }
+
+  simdutf_warn_unused result validate_utf32be_with_errors(
+      const char32_t *buf, size_t len) const noexcept final override {
+    return set_best()->validate_utf32be_with_errors(buf, len);
+  }
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -501,6 +558,25 @@ public:
                                                                 utf8_buffer);
   }
 
+  simdutf_warn_unused size_t convert_utf8_to_utf16le_with_replacement(
+      const char *input, size_t length,
+      char16_t *utf16_output) const noexcept final override {
+    return set_best()->convert_utf8_to_utf16le_with_replacement(input, length,
+                                                                utf16_output);
+  }
+
+  simdutf_warn_unused size_t convert_utf8_to_utf16be_with_replacement(
+      const char *input, size_t length,
+      char16_t *utf16_output) const noexcept final override {
+    return set_best()->convert_utf8_to_utf16be_with_replacement(input, length,
+                                                                utf16_output);
+  }
+
+  simdutf_warn_unused result utf16_length_from_utf8_with_replacement(
+      const char *input, size_t length) const noexcept final override {
+    return set_best()->utf16_length_from_utf8_with_replacement(input, length);
+  }
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -517,6 +593,18 @@ public:
                                                          utf32_output);
   }
 
+  simdutf_warn_unused size_t convert_utf8_to_utf32_with_replacement(
+      const char *input, size_t length,
+      char32_t *utf32_output) const noexcept final override {
+    return set_best()->convert_utf8_to_utf32_with_replacement(input, length,
+                                                              utf32_output);
+  }
+
+  simdutf_warn_unused result utf32_length_from_utf8_with_replacement(
+      const char *input, size_t length) const noexcept final override {
+    return set_best()->utf32_length_from_utf8_with_replacement(input, length);
+  }
+
   simdutf_warn_unused size_t convert_valid_utf8_to_utf32(
       const char *buf, size_t len,
       char32_t *utf32_output) const noexcept final override {
@@ -643,6 +731,32 @@ public:
                               char *utf8_output) const noexcept final override {
     return set_best()->convert_valid_utf32_to_utf8(buf, len, utf8_output);
   }
+
+  simdutf_warn_unused size_t
+  convert_utf32le_to_utf8(const char32_t *buf, size_t len,
+                          char *utf8_output) const noexcept final override {
+    return set_best()->convert_utf32le_to_utf8(buf, len, utf8_output);
+  }
+
+  simdutf_warn_unused result convert_utf32le_to_utf8_with_errors(
+      const char32_t *buf, size_t len,
+      char *utf8_output) const noexcept final override {
+    return set_best()->convert_utf32le_to_utf8_with_errors(buf, len,
+                                                          utf8_output);
+  }
+
+  simdutf_warn_unused size_t
+  convert_utf32be_to_utf8(const char32_t *buf, size_t len,
+                          char *utf8_output) const noexcept final override {
+    return set_best()->convert_utf32be_to_utf8(buf, len, utf8_output);
+  }
+
+  simdutf_warn_unused result convert_utf32be_to_utf8_with_errors(
+      const char32_t *buf, size_t len,
+      char *utf8_output) const noexcept final override {
+    return set_best()->convert_utf32be_to_utf8_with_errors(buf, len,
+                                                          utf8_output);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -684,6 +798,32 @@ public:
     return set_best()->convert_valid_utf32_to_utf16be(buf, len, utf16_output);
   }
 
+  simdutf_warn_unused size_t convert_utf32le_to_utf16(
+      const char32_t *buf, size_t len,
+      char16_t *utf16_output) const noexcept final override {
+    return set_best()->convert_utf32le_to_utf16(buf, len, utf16_output);
+  }
+
+  simdutf_warn_unused result convert_utf32le_to_utf16_with_errors(
+      const char32_t *buf, size_t len,
+      char16_t *utf16_output) const noexcept final override {
+    return set_best()->convert_utf32le_to_utf16_with_errors(buf, len,
+                                                           utf16_output);
+  }
+
+  simdutf_warn_unused size_t convert_utf32be_to_utf16(
+      const char32_t *buf, size_t len,
+      char16_t *utf16_output) const noexcept final override {
+    return set_best()->convert_utf32be_to_utf16(buf, len, utf16_output);
+  }
+
+  simdutf_warn_unused result convert_utf32be_to_utf16_with_errors(
+      const char32_t *buf, size_t len,
+      char16_t *utf16_output) const noexcept final override {
+    return set_best()->convert_utf32be_to_utf16_with_errors(buf, len,
+                                                           utf16_output);
+  }
+
   simdutf_warn_unused size_t convert_utf16le_to_utf32(
       const char16_t *buf, size_t len,
       char32_t *utf32_output) const noexcept final override {
@@ -761,6 +901,36 @@ public:
   }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_LATIN1
+  simdutf_warn_unused const char *
+  find_c1_control(const char *start, const char *end) const noexcept override {
+    return set_best()->find_c1_control(start, end);
+  }
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused const char *
+  find_cesu8_special(const char *start, const char *end,
+                     bool modified) const noexcept override {
+    return set_best()->find_cesu8_special(start, end, modified);
+  }
+
+  simdutf_warn_unused const char16_t *
+  find_cesu8_special(const char16_t *start, const char16_t *end,
+                     bool modified) const noexcept override {
+    return set_best()->find_cesu8_special(start, end, modified);
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+  simdutf_warn_unused size_t
+  convert_sbcs_to_utf16(const char *input, size_t length, const char16_t *table,
+                        char16_t *utf16_output) const noexcept override {
+    return set_best()->convert_sbcs_to_utf16(input, length, table,
+                                             utf16_output);
+  }
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
   simdutf_warn_unused size_t utf8_length_from_utf16le(
       const char16_t *buf, size_t len) const noexcept override {
@@ -790,6 +960,11 @@ public:
   utf16_length_from_utf8(const char *buf, size_t len) const noexcept override {
     return set_best()->utf16_length_from_utf8(buf, len);
   }
+
+  simdutf_warn_unused result utf16_length_from_utf8_with_errors(
+      const char *buf, size_t len) const noexcept override {
+    return set_best()->utf16_length_from_utf8_with_errors(buf, len);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -797,6 +972,16 @@ public:
       const char32_t *buf, size_t len) const noexcept override {
     return set_best()->utf8_length_from_utf32(buf, len);
   }
+
+  simdutf_warn_unused size_t utf8_length_from_utf32le(
+      const char32_t *buf, size_t len) const noexcept override {
+    return set_best()->utf8_length_from_utf32le(buf, len);
+  }
+
+  simdutf_warn_unused size_t utf8_length_from_utf32be(
+      const char32_t *buf, size_t len) const noexcept override {
+    return set_best()->utf8_length_from_utf32be(buf, len);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -804,6 +989,16 @@ public:
       const char32_t *buf, size_t len) const noexcept override {
     return set_best()->utf16_length_from_utf32(buf, len);
   }
+
+  simdutf_warn_unused size_t utf16_length_from_utf32le(
+      const char32_t *buf, size_t len) const noexcept override {
+    return set_best()->utf16_length_from_utf32le(buf, len);
+  }
+
+  simdutf_warn_unused size_t utf16_length_from_utf32be(
+      const char32_t *buf, size_t len) const noexcept override {
+    return set_best()->utf16_length_from_utf32be(buf, len);
+  }
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -811,6 +1006,11 @@ public:
   utf32_length_from_utf8(const char *buf, size_t len) const noexcept override {
     return set_best()->utf32_length_from_utf8(buf, len);
   }
+
+  simdutf_warn_unused result utf32_length_from_utf8_with_errors(
+      const char *buf, size_t len) const noexcept override {
+    return set_best()->utf32_length_from_utf8_with_errors(buf, len);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_BASE64
@@ -861,6 +1061,23 @@ public:
                                                    line_length, options);
   }
 
+  size_t binary_to_hex(const char *input, size_t length, char *output,
+                       hex_options options) const noexcept override {
+    return set_best()->binary_to_hex(input, length, output, options);
+  }
+
+  simdutf_warn_unused result
+  hex_to_binary(const char *input, size_t length,
+                char *output) const noexcept override {
+    return set_best()->hex_to_binary(input, length, output);
+  }
+
+  simdutf_warn_unused result
+  hex_to_binary(const char16_t *input, size_t length,
+                char *output) const noexcept override {
+    return set_best()->hex_to_binary(input, length, output);
+  }
+
   const char *find(const char *start, const char *end,
                    char character) const noexcept override {
     return set_best()->find(start, end, character);
@@ -999,8 +1216,38 @@ public:
       const char *, size_t) const noexcept final override {
     return result(error_code::OTHER, 0);
   }
+
+  simdutf_warn_unused result validate_utf8_and_index_lines(
+      const char *, size_t, size_t *,
+      size_t &line_count) const noexcept final override {
+    line_count = 0;
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused result validate_utf8_and_find_json_escape(
+      const char *, size_t) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused result
+  escape_json_utf8(const char *, size_t, char *,
+                   bool) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused result unescape_json_to_utf8(
+      const char *, size_t, char *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused result unescape_json_to_utf16(
+      const char *, size_t, char16_t *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_ASCII
   simdutf_warn_unused bool
   validate_ascii(const char *, size_t) const noexcept final override {
@@ -1067,6 +1314,16 @@ public:
       const char32_t *, size_t) const noexcept final override {
     return result(error_code::OTHER, 0);
   }
+
+  simdutf_warn_unused result validate_utf32le_with_errors(
+      const char32_t *, size_t) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused result validate_utf32be_with_errors(
+      const char32_t *, size_t) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -1162,6 +1419,21 @@ public:
     return 0; // Not supported
   }
 
+  simdutf_warn_unused size_t convert_utf8_to_utf16le_with_replacement(
+      const char *, size_t, char16_t *) const noexcept final override {
+    return 0; // Not supported
+  }
+
+  simdutf_warn_unused size_t convert_utf8_to_utf16be_with_replacement(
+      const char *, size_t, char16_t *) const noexcept final override {
+    return 0; // Not supported
+  }
+
+  simdutf_warn_unused result utf16_length_from_utf8_with_replacement(
+      const char *, size_t) const noexcept final override {
+    return {OTHER, 0}; // Not supported
+  }
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -1175,6 +1447,16 @@ public:
     return result(error_code::OTHER, 0);
   }
 
+  simdutf_warn_unused size_t convert_utf8_to_utf32_with_replacement(
+      const char *, size_t, char32_t *) const noexcept final override {
+    return 0; // Not supported
+  }
+
+  simdutf_warn_unused result utf32_length_from_utf8_with_replacement(
+      const char *, size_t) const noexcept final override {
+    return {OTHER, 0}; // Not supported
+  }
+
   simdutf_warn_unused size_t convert_valid_utf8_to_utf32(
       const char *, size_t, char32_t *) const noexcept final override {
     return 0;
@@ -1277,6 +1559,26 @@ public:
       const char32_t *, size_t, char *) const noexcept final override {
     return 0;
   }
+
+  simdutf_warn_unused size_t convert_utf32le_to_utf8(
+      const char32_t *, size_t, char *) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused result convert_utf32le_to_utf8_with_errors(
+      const char32_t *, size_t, char *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused size_t convert_utf32be_to_utf8(
+      const char32_t *, size_t, char *) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused result convert_utf32be_to_utf8_with_errors(
+      const char32_t *, size_t, char *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -1310,6 +1612,26 @@ public:
     return 0;
   }
 
+  simdutf_warn_unused size_t convert_utf32le_to_utf16(
+      const char32_t *, size_t, char16_t *) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused result convert_utf32le_to_utf16_with_errors(
+      const char32_t *, size_t, char16_t *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
+  simdutf_warn_unused size_t convert_utf32be_to_utf16(
+      const char32_t *, size_t, char16_t *) const noexcept final override {
+    return 0;
+  }
+
+  simdutf_warn_unused result convert_utf32be_to_utf16_with_errors(
+      const char32_t *, size_t, char16_t *) const noexcept final override {
+    return result(error_code::OTHER, 0);
+  }
+
   simdutf_warn_unused size_t convert_utf16le_to_utf32(
       const char16_t *, size_t, char32_t *) const noexcept final override {
     return 0;
@@ -1377,6 +1699,34 @@ public:
   }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_LATIN1
+  simdutf_warn_unused const char *
+  find_c1_control(const char *, const char *) const noexcept override {
+    return nullptr;
+  }
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused const char *
+  find_cesu8_special(const char *, const char *, bool) const noexcept override {
+    return nullptr;
+  }
+
+  simdutf_warn_unused const char16_t *
+  find_cesu8_special(const char16_t *, const char16_t *,
+                     bool) const noexcept override {
+    return nullptr;
+  }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+  simdutf_warn_unused size_t
+  convert_sbcs_to_utf16(const char *, size_t, const char16_t *,
+                        char16_t *) const noexcept override {
+    return 0;
+  }
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
   simdutf_warn_unused size_t
   utf8_length_from_utf16le(const char16_t *, size_t) const noexcept override {
@@ -1406,6 +1756,11 @@ public:
   utf16_length_from_utf8(const char *, size_t) const noexcept override {
     return 0;
   }
+
+  simdutf_warn_unused result utf16_length_from_utf8_with_errors(
+      const char *, size_t) const noexcept override {
+    return result(error_code::OTHER, 0);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -1413,6 +1768,16 @@ public:
   utf8_length_from_utf32(const char32_t *, size_t) const noexcept override {
     return 0;
   }
+
+  simdutf_warn_unused size_t
+  utf8_length_from_utf32le(const char32_t *, size_t) const noexcept override {
+    return 0;
+  }
+
+  simdutf_warn_unused size_t
+  utf8_length_from_utf32be(const char32_t *, size_t) const noexcept override {
+    return 0;
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -1420,6 +1785,16 @@ public:
   utf16_length_from_utf32(const char32_t *, size_t) const noexcept override {
     return 0;
   }
+
+  simdutf_warn_unused size_t
+  utf16_length_from_utf32le(const char32_t *, size_t) const noexcept override {
+    return 0;
+  }
+
+  simdutf_warn_unused size_t
+  utf16_length_from_utf32be(const char32_t *, size_t) const noexcept override {
+    return 0;
+  }
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -1427,6 +1802,11 @@ public:
   utf32_length_from_utf8(const char *, size_t) const noexcept override {
     return 0;
   }
+
+  simdutf_warn_unused result utf32_length_from_utf8_with_errors(
+      const char *, size_t) const noexcept override {
+    return result(error_code::OTHER, 0);
+  }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_BASE64
@@ -1462,6 +1842,18 @@ public:
                                      base64_options) const noexcept override {
     return 0;
   }
+  size_t binary_to_hex(const char *, size_t, char *,
+                       hex_options) const noexcept override {
+    return 0;
+  }
+  simdutf_warn_unused result hex_to_binary(const char *, size_t,
+                                           char *) const noexcept override {
+    return result(error_code::OTHER, 0);
+  }
+  simdutf_warn_unused result hex_to_binary(const char16_t *, size_t,
+                                           char *) const noexcept override {
+    return result(error_code::OTHER, 0);
+  }
   const char *find(const char *, const char *, char) const noexcept override {
     return nullptr;
   }
@@ -1621,6 +2013,104 @@ simdutf_warn_unused result validate_utf8_with_errors(const char *buf,
                                                      size_t len) noexcept {
   return get_default_implementation()->validate_utf8_with_errors(buf, len);
 }
+simdutf_warn_unused result validate_utf8_and_index_lines(
+    const char *input, size_t length, size_t *line_positions,
+    size_t &line_count) noexcept {
+  return get_default_implementation()->validate_utf8_and_index_lines(
+      input, length, line_positions, line_count);
+}
+simdutf_warn_unused result
+validate_utf8_and_find_json_escape(const char *input, size_t length) noexcept {
+  return get_default_implementation()->validate_utf8_and_find_json_escape(
+      input, length);
+}
+simdutf_warn_unused result escape_json_utf8(const char *input, size_t length,
+                                            char *output,
+                                            bool ascii_only) noexcept {
+  return get_default_implementation()->escape_json_utf8(input, length, output,
+                                                        ascii_only);
+}
+simdutf_warn_unused result unescape_json_to_utf8(const char *input,
+                                                 size_t length,
+                                                 char *output) noexcept {
+  return get_default_implementation()->unescape_json_to_utf8(input, length,
+                                                             output);
+}
+
+namespace {
+template <typename offset_type>
+result validate_utf8_rows(const char *data, const offset_type *offsets,
+                          size_t row_count) noexcept {
+  if (row_count == 0) {
+    return result(error_code::SUCCESS, 0);
+  }
+  const implementation *impl = get_default_implementation();
+  const size_t begin = size_t(offsets[0]);
+  const size_t end = size_t(offsets[row_count]);
+  const result r = impl->validate_utf8_with_errors(data + begin, end - begin);
+  // The bytes before limit are valid as a whole, so a row before limit is
+  // only invalid when it ends in the middle of a character.
+  const size_t limit = r.is_ok() ? end : begin + r.count;
+  for (size_t row = 0; row < row_count; row++) {
+    const size_t row_begin = size_t(offsets[row]);
+    const size_t row_end = size_t(offsets[row + 1]);
+    if (row_end > limit ||
+        (row_end < limit && row_end > row_begin &&
+         (uint8_t(data[row_end]) & 0xc0) == 0x80)) {
+      return result(impl->validate_utf8_with_errors(data + row_begin,
+                                                    row_end - row_begin)
+                        .error,
+                    row);
+    }
+  }
+  return result(error_code::SUCCESS, row_count);
+}
+} // namespace
+
+simdutf_warn_unused result validate_utf8_offsets(const char *data,
+                                                 const int32_t *offsets,
+                                                 size_t row_count) noexcept {
+  return validate_utf8_rows(data, offsets, row_count);
+}
+simdutf_warn_unused result validate_utf8_offsets(const char *data,
+                                                 const int64_t *offsets,
+                                                 size_t row_count) noexcept {
+  return validate_utf8_rows(data, offsets, row_count);
+}
+
+simdutf_warn_unused result to_well_formed_utf8_length(const char *input,
+                                                      size_t length) noexcept {
+  const implementation *impl = get_default_implementation();
+  return scalar::utf8::length_with_replacement_via(
+      [impl](const char *b, size_t l) {
+        return impl->validate_utf8_with_errors(b, l);
+      },
+      [](const char *, size_t l) { return l; }, input, length, 3);
+}
+
+simdutf_warn_unused size_t to_well_formed_utf8(const char *input, size_t length,
+                                               char *output) noexcept {
+  const implementation *impl = get_default_implementation();
+  char *const start = output;
+  size_t pos = 0;
+  while (pos < length) {
+    // The validation finds the first error block, everything before it is
+    // copied as is.
+    const result r = impl->validate_utf8_with_errors(input + pos, length - pos);
+    const size_t valid = r.is_ok() ? length - pos : r.count;
+    std::memcpy(output, input + pos, valid);
+    output += valid;
+    if (r.is_ok()) {
+      break;
+    }
+    *output++ = char(0xef);
+    *output++ = char(0xbf);
+    *output++ = char(0xbd);
+    pos += r.count;
+    pos += scalar::utf8::maximal_subpart_length(input + pos, length - pos);
+  }
+  return size_t(output - start);
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
 #if SIMDUTF_FEATURE_ASCII
@@ -1661,6 +2151,12 @@ simdutf_warn_unused size_t convert_utf8_to_utf16(
   return convert_utf8_to_utf16le(input, length, utf16_output);
   #endif
 }
+simdutf_warn_unused result unescape_json_to_utf16(const char *input,
+                                                  size_t length,
+                                                  char16_t *output) noexcept {
+  return get_default_implementation()->unescape_json_to_utf16(input, length,
+                                                              output);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -2393,6 +2889,11 @@ simdutf_warn_unused size_t utf16_length_from_utf8(const char *input,
                                                   size_t length) noexcept {
   return get_default_implementation()->utf16_length_from_utf8(input, length);
 }
+simdutf_warn_unused result
+utf16_length_from_utf8_with_errors(const char *input, size_t length) noexcept {
+  return get_default_implementation()->utf16_length_from_utf8_with_errors(input,
+                                                                      length);
+}
 simdutf_warn_unused result utf8_length_from_utf16le_with_replacement(
     const char16_t *input, size_t length) noexcept {
   return get_default_implementation()
@@ -2426,10 +2927,37 @@ simdutf_warn_unused size_t convert_utf16be_to_utf8_with_replacement(
       input, length, utf8_buffer);
 }
 
-#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused size_t convert_utf8_to_utf16_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf8_to_utf16be_with_replacement(input, length, utf16_output);
+  #else
+  return convert_utf8_to_utf16le_with_replacement(input, length, utf16_output);
+  #endif
+}
 
-#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t utf8_length_from_utf32(const char32_t *input,
+simdutf_warn_unused size_t convert_utf8_to_utf16le_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_utf8_to_utf16le_with_replacement(
+      input, length, utf16_output);
+}
+
+simdutf_warn_unused size_t convert_utf8_to_utf16be_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_utf8_to_utf16be_with_replacement(
+      input, length, utf16_output);
+}
+
+simdutf_warn_unused result utf16_length_from_utf8_with_replacement(
+    const char *input, size_t length) noexcept {
+  return get_default_implementation()->utf16_length_from_utf8_with_replacement(
+      input, length);
+}
+
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused size_t utf8_length_from_utf32(const char32_t *input,
                                                   size_t length) noexcept {
   return get_default_implementation()->utf8_length_from_utf32(input, length);
 }
@@ -2447,6 +2975,21 @@ simdutf_warn_unused size_t utf32_length_from_utf8(const char *input,
                                                   size_t length) noexcept {
   return get_default_implementation()->utf32_length_from_utf8(input, length);
 }
+simdutf_warn_unused result
+utf32_length_from_utf8_with_errors(const char *input, size_t length) noexcept {
+  return get_default_implementation()->utf32_length_from_utf8_with_errors(input,
+                                                                      length);
+}
+simdutf_warn_unused size_t convert_utf8_to_utf32_with_replacement(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  return get_default_implementation()->convert_utf8_to_utf32_with_replacement(
+      input, length, utf32_output);
+}
+simdutf_warn_unused result utf32_length_from_utf8_with_replacement(
+    const char *input, size_t length) noexcept {
+  return get_default_implementation()->utf32_length_from_utf8_with_replacement(
+      input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_BASE64
@@ -2591,91 +3134,2785 @@ simdutf_warn_unused size_t convert_latin1_to_utf8_safe(
 }
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
-#if SIMDUTF_FEATURE_BASE64
-simdutf_warn_unused result
-base64_to_binary_safe(const char *input, size_t length, char *output,
-                      size_t &outlen, base64_options options,
-                      last_chunk_handling_options last_chunk_handling_options,
-                      bool decode_up_to_bad_char) noexcept {
-  return base64_to_binary_safe_impl<char>(input, length, output, outlen,
-                                          options, last_chunk_handling_options,
-                                          decode_up_to_bad_char);
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_UTF32 ||  \
+    SIMDUTF_FEATURE_LATIN1
+namespace {
+// Where an input chunk may end without splitting a character, and how many
+// code units the character at the start of the input spans.
+struct utf8_units {
+  static size_t chunk_end(const char *input, size_t end) noexcept {
+    // Move the end back to the last leading byte if its character is cut.
+    for (size_t i = 1; i <= 3; i++) {
+      if ((uint8_t(input[end - i]) & 0xc0) != 0x80) {
+        return char_length(input + end - i, 4) > i ? end - i : end;
+      }
+    }
+    return end;
+  }
+  static size_t char_length(const char *input, size_t length) noexcept {
+    const uint8_t lead = uint8_t(input[0]);
+    const size_t n = lead < 0xc0 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+    return detail::min(n, length);
+  }
+};
+
+struct utf16_units {
+  static size_t chunk_end(const char16_t *input, size_t end) noexcept {
+    return scalar::utf16::high_surrogate(input[end - 1]) ? end - 1 : end;
+  }
+  static size_t char_length(const char16_t *input, size_t length) noexcept {
+    return length > 1 && scalar::utf16::high_surrogate(input[0]) ? 2 : 1;
+  }
+};
+
+// UTF-32 and Latin1.
+struct single_units {
+  template <typename char_type>
+  static size_t chunk_end(const char_type *, size_t end) noexcept {
+    return end;
+  }
+  template <typename char_type>
+  static size_t char_length(const char_type *, size_t) noexcept {
+    return 1;
+  }
+};
+
+// Converts as much of the input as fits in output_length code units. The input
+// is converted in chunks whose worst-case output (max_expansion code units per
+// input code unit) fits in what is left of the output, and the last characters
+// are converted one at a time with the scalar code.
+template <typename units, typename in_type, typename out_type,
+          typename Convert, typename ScalarConvert>
+full_result convert_safe_with_errors_impl(
+    const in_type *input, size_t length, out_type *output,
+    size_t output_length, size_t max_expansion, Convert convert_with_errors,
+    ScalarConvert scalar_convert) noexcept {
+  size_t pos = 0;
+  size_t written = 0;
+  while (true) {
+    size_t read_len =
+        detail::min(length - pos, (output_length - written) / max_expansion);
+    if (read_len <= 16) {
+      break;
+    }
+    if (pos + read_len < length) {
+      read_len = units::chunk_end(input + pos, read_len);
+    }
+    const result r =
+        convert_with_errors(input + pos, read_len, output + written);
+    if (r.error != error_code::SUCCESS) {
+      // The backends need not write the valid prefix on error: convert it
+      // again.
+      written += scalar_convert(input + pos, r.count, output + written).count;
+      return full_result(r.error, pos + r.count, written);
+    }
+    pos += read_len;
+    written += r.count;
+  }
+  while (pos < length) {
+    const size_t char_length = units::char_length(input + pos, length - pos);
+    out_type buffer[4];
+    const result r = scalar_convert(input + pos, char_length, buffer);
+    if (r.error != error_code::SUCCESS) {
+      return full_result(r.error, pos + r.count, written);
+    }
+    if (r.count > output_length - written) {
+      return full_result(error_code::OUTPUT_BUFFER_TOO_SMALL, pos, written);
+    }
+    for (size_t i = 0; i < r.count; i++) {
+      output[written + i] = buffer[i];
+    }
+    pos += char_length;
+    written += r.count;
+  }
+  return full_result(error_code::SUCCESS, pos, written);
 }
-simdutf_warn_unused result
-base64_to_binary_safe(const char16_t *input, size_t length, char *output,
-                      size_t &outlen, base64_options options,
-                      last_chunk_handling_options last_chunk_handling_options,
-                      bool decode_up_to_bad_char) noexcept {
-  return base64_to_binary_safe_impl<char16_t>(
-      input, length, output, outlen, options, last_chunk_handling_options,
-      decode_up_to_bad_char);
+} // namespace
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16 ||
+       // SIMDUTF_FEATURE_UTF32 || SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused full_result convert_utf8_to_utf16_safe_with_errors(
+    const char *input, size_t length, char16_t *utf16_output,
+    size_t utf16_len) noexcept {
+  return convert_safe_with_errors_impl<utf8_units>(
+      input, length, utf16_output, utf16_len, 1,
+      [](const char *in, size_t len, char16_t *out) {
+        return convert_utf8_to_utf16_with_errors(in, len, out);
+      },
+      [](const char *in, size_t len, char16_t *out) {
+        return scalar::utf8_to_utf16::convert_with_errors<endianness::NATIVE>(
+            in, len, out);
+      });
 }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-size_t binary_to_base64(const char *input, size_t length, char *output,
-                        base64_options options) noexcept {
-  return get_default_implementation()->binary_to_base64(input, length, output,
-                                                        options);
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused full_result convert_utf8_to_utf32_safe_with_errors(
+    const char *input, size_t length, char32_t *utf32_output,
+    size_t utf32_len) noexcept {
+  return convert_safe_with_errors_impl<utf8_units>(
+      input, length, utf32_output, utf32_len, 1,
+      [](const char *in, size_t len, char32_t *out) {
+        return convert_utf8_to_utf32_with_errors(in, len, out);
+      },
+      [](const char *in, size_t len, char32_t *out) {
+        return scalar::utf8_to_utf32::convert_with_errors(in, len, out);
+      });
 }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
-size_t binary_to_base64_with_lines(const char *input, size_t length,
-                                   char *output, size_t line_length,
-                                   base64_options options) noexcept {
-  return get_default_implementation()->binary_to_base64_with_lines(
-      input, length, output, line_length, options);
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused full_result convert_utf8_to_latin1_safe_with_errors(
+    const char *input, size_t length, char *latin1_output,
+    size_t latin1_len) noexcept {
+  return convert_safe_with_errors_impl<utf8_units>(
+      input, length, latin1_output, latin1_len, 1,
+      [](const char *in, size_t len, char *out) {
+        return convert_utf8_to_latin1_with_errors(in, len, out);
+      },
+      [](const char *in, size_t len, char *out) {
+        return scalar::utf8_to_latin1::convert_with_errors(in, len, out);
+      });
 }
-#endif // SIMDUTF_FEATURE_BASE64
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
 
-#if SIMDUTF_FEATURE_DETECT_ENCODING
-simdutf_warn_unused simdutf::encoding_type
-autodetect_encoding(const char *buf, size_t length) noexcept {
-  return get_default_implementation()->autodetect_encoding(buf, length);
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused full_result convert_utf16_to_utf8_safe_with_errors(
+    const char16_t *input, size_t length, char *utf8_output,
+    size_t utf8_len) noexcept {
+  return convert_safe_with_errors_impl<utf16_units>(
+      input, length, utf8_output, utf8_len, 3,
+      [](const char16_t *in, size_t len, char *out) {
+        return convert_utf16_to_utf8_with_errors(in, len, out);
+      },
+      [](const char16_t *in, size_t len, char *out) {
+        return scalar::utf16_to_utf8::simple_convert_with_errors<
+            endianness::NATIVE>(in, len, out);
+      });
 }
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
-simdutf_warn_unused int detect_encodings(const char *buf,
-                                         size_t length) noexcept {
-  return get_default_implementation()->detect_encodings(buf, length);
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused full_result convert_utf16_to_utf32_safe_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    size_t utf32_len) noexcept {
+  return convert_safe_with_errors_impl<utf16_units>(
+      input, length, utf32_output, utf32_len, 1,
+      [](const char16_t *in, size_t len, char32_t *out) {
+        return convert_utf16_to_utf32_with_errors(in, len, out);
+      },
+      [](const char16_t *in, size_t len, char32_t *out) {
+        return scalar::utf16_to_utf32::convert_with_errors<endianness::NATIVE>(
+            in, len, out);
+      });
 }
-#endif // SIMDUTF_FEATURE_DETECT_ENCODING
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_USE_STATIC_INITIALIZATION
-static const implementation *const builtin_impl_instance =
-    get_available_implementations()[SIMDUTF_STRINGIFY(
-        SIMDUTF_BUILTIN_IMPLEMENTATION)];
-#endif
-const implementation *builtin_implementation() {
-#if !SIMDUTF_USE_STATIC_INITIALIZATION
-  static const implementation *const builtin_impl_instance =
-      get_available_implementations()[SIMDUTF_STRINGIFY(
-          SIMDUTF_BUILTIN_IMPLEMENTATION)];
-#endif
-  return builtin_impl_instance;
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused full_result convert_utf16_to_latin1_safe_with_errors(
+    const char16_t *input, size_t length, char *latin1_output,
+    size_t latin1_len) noexcept {
+  return convert_safe_with_errors_impl<utf16_units>(
+      input, length, latin1_output, latin1_len, 1,
+      [](const char16_t *in, size_t len, char *out) {
+        return convert_utf16_to_latin1_with_errors(in, len, out);
+      },
+      [](const char16_t *in, size_t len, char *out) {
+        return scalar::utf16_to_latin1::convert_with_errors<endianness::NATIVE>(
+            in, len, out);
+      });
 }
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
-#if SIMDUTF_FEATURE_UTF8
-simdutf_warn_unused size_t trim_partial_utf8(const char *input, size_t length) {
-  return scalar::utf8::trim_partial_utf8(input, length);
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused full_result convert_utf32_to_utf8_safe_with_errors(
+    const char32_t *input, size_t length, char *utf8_output,
+    size_t utf8_len) noexcept {
+  return convert_safe_with_errors_impl<single_units>(
+      input, length, utf8_output, utf8_len, 4,
+      [](const char32_t *in, size_t len, char *out) {
+        return convert_utf32_to_utf8_with_errors(in, len, out);
+      },
+      [](const char32_t *in, size_t len, char *out) {
+        return scalar::utf32_to_utf8::convert_with_errors(in, len, out);
+      });
 }
-#endif // SIMDUTF_FEATURE_UTF8
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
-#if SIMDUTF_FEATURE_UTF16
-simdutf_warn_unused size_t trim_partial_utf16be(const char16_t *input,
-                                                size_t length) {
-  return scalar::utf16::trim_partial_utf16<BIG>(input, length);
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused full_result convert_utf32_to_utf16_safe_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    size_t utf16_len) noexcept {
+  return convert_safe_with_errors_impl<single_units>(
+      input, length, utf16_output, utf16_len, 2,
+      [](const char32_t *in, size_t len, char16_t *out) {
+        return convert_utf32_to_utf16_with_errors(in, len, out);
+      },
+      [](const char32_t *in, size_t len, char16_t *out) {
+        return scalar::utf32_to_utf16::convert_with_errors<endianness::NATIVE>(
+            in, len, out);
+      });
 }
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
-simdutf_warn_unused size_t trim_partial_utf16le(const char16_t *input,
-                                                size_t length) {
-  return scalar::utf16::trim_partial_utf16<LITTLE>(input, length);
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused full_result convert_utf32_to_latin1_safe_with_errors(
+    const char32_t *input, size_t length, char *latin1_output,
+    size_t latin1_len) noexcept {
+  return convert_safe_with_errors_impl<single_units>(
+      input, length, latin1_output, latin1_len, 1,
+      [](const char32_t *in, size_t len, char *out) {
+        return convert_utf32_to_latin1_with_errors(in, len, out);
+      },
+      [](const char32_t *in, size_t len, char *out) {
+        return scalar::utf32_to_latin1::convert_with_errors(in, len, out);
+      });
 }
+#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 
-simdutf_warn_unused size_t trim_partial_utf16(const char16_t *input,
-                                              size_t length) {
-  #if SIMDUTF_IS_BIG_ENDIAN
-  return trim_partial_utf16be(input, length);
-  #else
-  return trim_partial_utf16le(input, length);
-  #endif
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused full_result convert_latin1_to_utf8_safe_with_errors(
+    const char *input, size_t length, char *utf8_output,
+    size_t utf8_len) noexcept {
+  return convert_safe_with_errors_impl<single_units>(
+      input, length, utf8_output, utf8_len, 2,
+      [](const char *in, size_t len, char *out) {
+        return result(error_code::SUCCESS,
+                      convert_latin1_to_utf8(in, len, out));
+      },
+      [](const char *in, size_t len, char *out) {
+        return result(error_code::SUCCESS,
+                      scalar::latin1_to_utf8::convert(in, len, out));
+      });
 }
-#endif // SIMDUTF_FEATURE_UTF16
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused full_result convert_latin1_to_utf16_safe_with_errors(
+    const char *input, size_t length, char16_t *utf16_output,
+    size_t utf16_len) noexcept {
+  return convert_safe_with_errors_impl<single_units>(
+      input, length, utf16_output, utf16_len, 1,
+      [](const char *in, size_t len, char16_t *out) {
+        return result(error_code::SUCCESS,
+                      convert_latin1_to_utf16(in, len, out));
+      },
+      [](const char *in, size_t len, char16_t *out) {
+        return result(
+            error_code::SUCCESS,
+            scalar::latin1_to_utf16::convert<endianness::NATIVE>(in, len, out));
+      });
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused full_result convert_latin1_to_utf32_safe_with_errors(
+    const char *input, size_t length, char32_t *utf32_output,
+    size_t utf32_len) noexcept {
+  return convert_safe_with_errors_impl<single_units>(
+      input, length, utf32_output, utf32_len, 1,
+      [](const char *in, size_t len, char32_t *out) {
+        return result(error_code::SUCCESS,
+                      convert_latin1_to_utf32(in, len, out));
+      },
+      [](const char *in, size_t len, char32_t *out) {
+        return result(error_code::SUCCESS,
+                      scalar::latin1_to_utf32::convert(in, len, out));
+      });
+}
+#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_LATIN1
+namespace {
+// Returns the position of the first byte in data[from, len) in the range
+// 0x80 to 0x9F, or len.
+size_t find_c1(const char *data, size_t from, size_t len) noexcept {
+  return size_t(get_default_implementation()->find_c1_control(data + from,
+                                                               data + len) -
+                data);
+}
+
+// windows-1252 differs from Latin1 only for the bytes 0x80 to 0x9F. It is
+// decoded by the single-byte encoding kernels with its row of the tables.
+const char16_t *windows1252_table() noexcept {
+  return tables::sbcs::high_halves[sbcs_windows_1252];
+}
+
+// Stores the windows-1252 byte of the code point and returns true, or
+// returns false if there is none.
+bool windows1252_from_unicode(uint32_t code_point, uint8_t &byte) noexcept {
+  if (code_point < 0x80 || (code_point >= 0xa0 && code_point <= 0xff)) {
+    byte = uint8_t(code_point);
+    return true;
+  }
+  const char16_t *table = windows1252_table();
+  for (uint8_t i = 0; i < 0x20; i++) {
+    if (table[i] == code_point) {
+      byte = uint8_t(0x80 + i);
+      return true;
+    }
+  }
+  return false;
+}
+
+// The Latin1 kernels stop at the first character above U+00FF, which is then
+// looked up in the table. Their output may also contain C1 controls that
+// windows-1252 has no byte for.
+template <typename units, typename char_type>
+result convert_to_windows1252_impl(const char_type *input, size_t length,
+                                   char *output) noexcept {
+  char *out = output;
+  size_t pos = 0;
+  while (true) {
+    const result r = units::to_latin1(input + pos, length - pos, out);
+    // On error, the kernels need not have written the valid prefix.
+    const size_t written =
+        r.error == error_code::SUCCESS
+            ? r.count
+            : units::valid_to_latin1(input + pos, r.count, out);
+    for (size_t k = find_c1(out, 0, written); k < written;
+         k = find_c1(out, k + 1, written)) {
+      uint8_t byte;
+      if (!windows1252_from_unicode(uint8_t(out[k]), byte)) {
+        return result(error_code::TOO_LARGE,
+                      pos + units::offset(input + pos, k));
+      }
+    }
+    out += written;
+    if (r.error == error_code::SUCCESS) {
+      return result(error_code::SUCCESS, out - output);
+    }
+    if (r.error != error_code::TOO_LARGE) {
+      return result(r.error, pos + r.count);
+    }
+    pos += r.count;
+    uint32_t code_point = 0;
+    size_t char_length = 0;
+    const result c =
+        units::decode(input + pos, length - pos, code_point, char_length);
+    if (c.error != error_code::SUCCESS) {
+      return result(c.error, pos + c.count);
+    }
+    uint8_t byte;
+    if (!windows1252_from_unicode(code_point, byte)) {
+      return result(error_code::TOO_LARGE, pos);
+    }
+    *out++ = char(byte);
+    pos += char_length;
+  }
+}
+
+// Characters are code units in the UTF-16 and UTF-32 Latin1 prefixes.
+struct one_unit_per_char {
+  template <typename char_type>
+  static size_t offset(const char_type *, size_t chars) noexcept {
+    return chars;
+  }
+};
+} // namespace
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+namespace {
+struct windows1252_from_utf8 {
+  static result to_latin1(const char *input, size_t length,
+                          char *output) noexcept {
+    return convert_utf8_to_latin1_with_errors(input, length, output);
+  }
+  static size_t valid_to_latin1(const char *input, size_t length,
+                                char *output) noexcept {
+    return convert_valid_utf8_to_latin1(input, length, output);
+  }
+  // Position of the character at index chars.
+  static size_t offset(const char *input, size_t chars) noexcept {
+    size_t i = 0;
+    for (;; i++) {
+      if ((uint8_t(input[i]) & 0xc0) != 0x80 && chars-- == 0) {
+        return i;
+      }
+    }
+  }
+  static result decode(const char *input, size_t length, uint32_t &code_point,
+                       size_t &char_length) noexcept {
+    const uint8_t lead = uint8_t(input[0]);
+    char_length = lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+    const result r =
+        validate_utf8_with_errors(input, detail::min(char_length, length));
+    if (r.error != error_code::SUCCESS) {
+      return r;
+    }
+    code_point = lead & (0x7f >> char_length);
+    for (size_t i = 1; i < char_length; i++) {
+      code_point = (code_point << 6) | (uint8_t(input[i]) & 0x3f);
+    }
+    return result(error_code::SUCCESS, char_length);
+  }
+};
+} // namespace
+
+simdutf_warn_unused size_t convert_utf8_to_windows1252(
+    const char *input, size_t length, char *windows1252_output) noexcept {
+  const result r = convert_utf8_to_windows1252_with_errors(
+      input, length, windows1252_output);
+  return r.error == error_code::SUCCESS ? r.count : 0;
+}
+simdutf_warn_unused result convert_utf8_to_windows1252_with_errors(
+    const char *input, size_t length, char *windows1252_output) noexcept {
+  return convert_to_windows1252_impl<windows1252_from_utf8>(
+      input, length, windows1252_output);
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+namespace {
+struct windows1252_from_utf16 : one_unit_per_char {
+  static result to_latin1(const char16_t *input, size_t length,
+                          char *output) noexcept {
+    return convert_utf16_to_latin1_with_errors(input, length, output);
+  }
+  static size_t valid_to_latin1(const char16_t *input, size_t length,
+                                char *output) noexcept {
+    return convert_valid_utf16_to_latin1(input, length, output);
+  }
+  static result decode(const char16_t *input, size_t length,
+                       uint32_t &code_point, size_t &char_length) noexcept {
+    if ((input[0] & 0xf800) != 0xd800) {
+      code_point = input[0];
+      char_length = 1;
+      return result(error_code::SUCCESS, 1);
+    }
+    // A surrogate pair is above U+FFFF, and so never in windows-1252.
+    const result r =
+        validate_utf16_with_errors(input, detail::min(size_t(2), length));
+    return r.error == error_code::SUCCESS ? result(error_code::TOO_LARGE, 0)
+                                          : r;
+  }
+};
+} // namespace
+
+// The table lookup kernel of the single-byte encodings also converts the
+// bytes 0x80 to 0x9F in registers.
+simdutf_warn_unused size_t convert_windows1252_to_utf16(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_sbcs_to_utf16(
+      input, length, windows1252_table(), utf16_output);
+}
+simdutf_warn_unused size_t convert_utf16_to_windows1252(
+    const char16_t *input, size_t length, char *windows1252_output) noexcept {
+  const result r = convert_utf16_to_windows1252_with_errors(
+      input, length, windows1252_output);
+  return r.error == error_code::SUCCESS ? r.count : 0;
+}
+simdutf_warn_unused result convert_utf16_to_windows1252_with_errors(
+    const char16_t *input, size_t length, char *windows1252_output) noexcept {
+  return convert_to_windows1252_impl<windows1252_from_utf16>(
+      input, length, windows1252_output);
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+namespace {
+struct windows1252_from_utf32 : one_unit_per_char {
+  static result to_latin1(const char32_t *input, size_t length,
+                          char *output) noexcept {
+    return convert_utf32_to_latin1_with_errors(input, length, output);
+  }
+  static size_t valid_to_latin1(const char32_t *input, size_t length,
+                                char *output) noexcept {
+    return convert_valid_utf32_to_latin1(input, length, output);
+  }
+  static result decode(const char32_t *input, size_t, uint32_t &code_point,
+                       size_t &char_length) noexcept {
+    code_point = uint32_t(input[0]);
+    char_length = 1;
+    if (code_point >= 0xd800 && code_point <= 0xdfff) {
+      return result(error_code::SURROGATE, 0);
+    }
+    return result(error_code::SUCCESS, 1);
+  }
+};
+} // namespace
+
+simdutf_warn_unused size_t convert_utf32_to_windows1252(
+    const char32_t *input, size_t length, char *windows1252_output) noexcept {
+  const result r = convert_utf32_to_windows1252_with_errors(
+      input, length, windows1252_output);
+  return r.error == error_code::SUCCESS ? r.count : 0;
+}
+simdutf_warn_unused result convert_utf32_to_windows1252_with_errors(
+    const char32_t *input, size_t length, char *windows1252_output) noexcept {
+  return convert_to_windows1252_impl<windows1252_from_utf32>(
+      input, length, windows1252_output);
+}
+#endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused const char16_t *
+sbcs_table(sbcs_encoding encoding) noexcept {
+  constexpr size_t count = sizeof(tables::sbcs::high_halves) /
+                           sizeof(tables::sbcs::high_halves[0]);
+  return size_t(encoding) < count ? tables::sbcs::high_halves[encoding]
+                                  : nullptr;
+}
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+namespace {
+// The backends decode a single-byte encoding by table lookups into UTF-16
+// blocks that stay in L1 cache, and the UTF-16 kernels take it from there.
+constexpr size_t sbcs_block = 2048;
+
+// A copy of a table in which the surrogates, which are not characters, mark
+// unassigned bytes like U+FFFD.
+struct sbcs_checked_table {
+  explicit sbcs_checked_table(const char16_t *table) noexcept {
+    for (size_t i = 0; i < 128; i++) {
+      units[i] = (table[i] & 0xf800) == 0xd800 ? char16_t(0xfffd) : table[i];
+    }
+  }
+  char16_t units[128];
+};
+
+// Maps the code units of a table back to bytes. The 128 entries are stored in
+// an open-addressing hash table of 256 slots, so that a lookup touches one
+// or two slots; zero is ASCII and marks an empty slot.
+struct sbcs_encoder {
+  explicit sbcs_encoder(const char16_t *table) noexcept {
+    std::memset(keys, 0, sizeof(keys));
+    for (size_t i = 0; i < 128; i++) {
+      const char16_t unit = table[i];
+      if (unit < 0x80 || unit == 0xfffd) {
+        continue;
+      }
+      uint8_t slot = hash(unit);
+      while (keys[slot] != 0 && keys[slot] != unit) {
+        slot++;
+      }
+      // The first byte of a code unit that appears twice wins.
+      if (keys[slot] == 0) {
+        keys[slot] = unit;
+        bytes[slot] = uint8_t(0x80 + i);
+      }
+    }
+  }
+  static uint8_t hash(char16_t unit) noexcept {
+    return uint8_t((uint32_t(unit) * 0x9e3779b1) >> 24);
+  }
+  bool encode(char16_t unit, uint8_t &byte) const noexcept {
+    if (unit < 0x80) {
+      byte = uint8_t(unit);
+      return true;
+    }
+    for (uint8_t slot = hash(unit); keys[slot] != 0; slot++) {
+      if (keys[slot] == unit) {
+        byte = bytes[slot];
+        return true;
+      }
+    }
+    return false;
+  }
+  // Returns the number of code units written before the first one that is
+  // not in the table. ASCII is copied four code units at a time.
+  size_t encode(const char16_t *input, size_t length,
+                char *output) const noexcept {
+    size_t i = 0;
+    while (i < length) {
+      if (length - i >= 4) {
+        uint64_t units;
+        std::memcpy(&units, input + i, sizeof(units));
+        if ((units & 0xff80ff80ff80ff80) == 0) {
+          for (size_t k = 0; k < 4; k++) {
+            output[i + k] = char(input[i + k]);
+          }
+          i += 4;
+          continue;
+        }
+      }
+      uint8_t byte;
+      if (!encode(input[i], byte)) {
+        break;
+      }
+      output[i++] = char(byte);
+    }
+    return i;
+  }
+  char16_t keys[256];
+  uint8_t bytes[256];
+};
+} // namespace
+
+simdutf_warn_unused size_t convert_sbcs_to_utf16(
+    const char *input, size_t length, const char16_t *table,
+    char16_t *utf16_output) noexcept {
+  const sbcs_checked_table checked(table);
+  return get_default_implementation()->convert_sbcs_to_utf16(
+      input, length, checked.units, utf16_output);
+}
+
+simdutf_warn_unused result convert_utf16_to_sbcs_with_errors(
+    const char16_t *input, size_t length, const char16_t *table,
+    char *sbcs_output) noexcept {
+  const sbcs_checked_table checked(table);
+  const sbcs_encoder encoder(checked.units);
+  const size_t count = encoder.encode(input, length, sbcs_output);
+  if (count == length) {
+    return result(error_code::SUCCESS, length);
+  }
+  if ((input[count] & 0xf800) == 0xd800) {
+    // Only a lone surrogate is an encoding error.
+    const result r = validate_utf16_with_errors(
+        input + count, detail::min(size_t(2), length - count));
+    if (r.error != error_code::SUCCESS) {
+      return result(r.error, count + r.count);
+    }
+  }
+  return result(error_code::TOO_LARGE, count);
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 &&                          \
+    SIMDUTF_FEATURE_LATIN1
+namespace {
+// Position in valid UTF-8 of the character that starts at UTF-16 code unit
+// index units.
+size_t utf8_offset_of_utf16_unit(const char *input, size_t units) noexcept {
+  size_t i = 0;
+  while (units > 0) {
+    const uint8_t lead = uint8_t(input[i]);
+    const size_t n = lead < 0x80 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+    units -= n == 4 ? 2 : 1;
+    i += n;
+  }
+  return i;
+}
+} // namespace
+
+simdutf_warn_unused size_t utf8_length_from_sbcs(
+    const char *input, size_t length, const char16_t *table) noexcept {
+  const sbcs_checked_table checked(table);
+  char16_t block[sbcs_block];
+  size_t count = 0;
+  for (size_t pos = 0; pos < length; pos += sbcs_block) {
+    const size_t units = get_default_implementation()->convert_sbcs_to_utf16(
+        input + pos, detail::min(sbcs_block, length - pos), checked.units,
+        block);
+    count += utf8_length_from_utf16(block, units);
+  }
+  return count;
+}
+
+simdutf_warn_unused size_t convert_sbcs_to_utf8(const char *input,
+                                                size_t length,
+                                                const char16_t *table,
+                                                char *utf8_output) noexcept {
+  const sbcs_checked_table checked(table);
+  char16_t block[sbcs_block];
+  char *start = utf8_output;
+  for (size_t pos = 0; pos < length; pos += sbcs_block) {
+    const size_t units = get_default_implementation()->convert_sbcs_to_utf16(
+        input + pos, detail::min(sbcs_block, length - pos), checked.units,
+        block);
+    utf8_output += convert_valid_utf16_to_utf8(block, units, utf8_output);
+  }
+  return utf8_output - start;
+}
+
+simdutf_warn_unused result convert_utf8_to_sbcs_with_errors(
+    const char *input, size_t length, const char16_t *table,
+    char *sbcs_output) noexcept {
+  const sbcs_checked_table checked(table);
+  const sbcs_encoder encoder(checked.units);
+  char16_t block[sbcs_block];
+  char *output = sbcs_output;
+  size_t pos = 0;
+  while (pos < length) {
+    // The UTF-8 kernels validate the input and decode it into UTF-16 blocks,
+    // which never end within a character.
+    size_t end = length;
+    if (length - pos > sbcs_block) {
+      end = pos + utf8_units::chunk_end(input + pos, sbcs_block);
+    }
+    const result r =
+        convert_utf8_to_utf16_with_errors(input + pos, end - pos, block);
+    const size_t units =
+        r.error == error_code::SUCCESS
+            ? r.count
+            : convert_valid_utf8_to_utf16(input + pos, r.count, block);
+    const size_t count = encoder.encode(block, units, output);
+    if (count < units) {
+      return result(error_code::TOO_LARGE,
+                    pos + utf8_offset_of_utf16_unit(input + pos, count));
+    }
+    output += units;
+    if (r.error != error_code::SUCCESS) {
+      return result(r.error, pos + r.count);
+    }
+    pos = end;
+  }
+  return result(error_code::SUCCESS, output - sbcs_output);
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 &&
+       // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused size_t utf8_length_from_windows1252(
+    const char *input, size_t length) noexcept {
+  return utf8_length_from_sbcs(input, length, windows1252_table());
+}
+simdutf_warn_unused size_t convert_windows1252_to_utf8(
+    const char *input, size_t length, char *utf8_output) noexcept {
+  return convert_sbcs_to_utf8(input, length, windows1252_table(), utf8_output);
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16 &&
+       // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
+// The windows-1252 table has no surrogates, so every UTF-16 code unit of a
+// block is one character.
+simdutf_warn_unused size_t convert_windows1252_to_utf32(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  char32_t *start = utf32_output;
+  char16_t block[sbcs_block];
+  for (size_t pos = 0; pos < length; pos += sbcs_block) {
+    const size_t units = get_default_implementation()->convert_sbcs_to_utf16(
+        input + pos, detail::min(sbcs_block, length - pos), windows1252_table(),
+        block);
+    utf32_output += convert_valid_utf16_to_utf32(block, units, utf32_output);
+  }
+  return utf32_output - start;
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32 &&
+       // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+namespace {
+// CESU-8 and modified UTF-8 agree with UTF-8 except on the characters above
+// U+FFFF and, for modified UTF-8, on the null character. Runs without them
+// are handed to the UTF-8 and UTF-16 kernels in blocks that stay in L1 cache;
+// the sequences in between are rare and converted here.
+constexpr size_t cesu8_block = 2048;
+
+// Returns the position of the first special byte or code unit in
+// data[from, len), or len.
+template <bool modified, typename char_type>
+size_t find_cesu8_special(const char_type *data, size_t from,
+                          size_t len) noexcept {
+  return size_t(get_default_implementation()->find_cesu8_special(
+                    data + from, data + len, modified) -
+                data);
+}
+
+// Decodes the three-byte sequence of a surrogate, ED A0-BF 80-BF, which
+// UTF-8 rejects.
+bool utf8_surrogate(const char *input, size_t length,
+                    char16_t &unit) noexcept {
+  if (length < 3) {
+    return false;
+  }
+  const uint8_t *b = reinterpret_cast<const uint8_t *>(input);
+  if (b[0] != 0xed || (b[1] & 0xe0) != 0xa0 || (b[2] & 0xc0) != 0x80) {
+    return false;
+  }
+  unit = char16_t(0xd000 | ((b[1] & 0x3f) << 6) | (b[2] & 0x3f));
+  return true;
+}
+
+bool cesu8_surrogate_pair(const char *input, size_t length, char16_t &high,
+                          char16_t &low) noexcept {
+  return utf8_surrogate(input, length, high) &&
+         scalar::utf16::high_surrogate(high) &&
+         utf8_surrogate(input + 3, length - 3, low) &&
+         !scalar::utf16::high_surrogate(low);
+}
+
+char *write_three_byte_unit(char *output, char16_t unit) noexcept {
+  *output++ = char((unit >> 12) | 0xe0);
+  *output++ = char(((unit >> 6) & 0x3f) | 0x80);
+  *output++ = char((unit & 0x3f) | 0x80);
+  return output;
+}
+
+// The output of decode_cesu8 and decode_wtf8. run() converts the longest
+// valid UTF-8 prefix of its input and returns the result of its validation.
+struct utf8_variant_validator {
+  result run(const char *input, size_t length) noexcept {
+    return validate_utf8_with_errors(input, length);
+  }
+  void null() noexcept {}
+  bool unit(char16_t) noexcept { return true; }
+  void pair(char16_t, char16_t) noexcept {}
+};
+
+struct utf8_variant_to_utf16 {
+  result run(const char *input, size_t length) noexcept {
+    const result r = convert_utf8_to_utf16_with_errors(input, length, output);
+    if (r.error == error_code::SUCCESS) {
+      output += r.count;
+      return result(error_code::SUCCESS, length);
+    }
+    output += convert_valid_utf8_to_utf16(input, r.count, output);
+    return r;
+  }
+  void null() noexcept { *output++ = 0; }
+  bool unit(char16_t u) noexcept {
+    *output++ = u;
+    return true;
+  }
+  void pair(char16_t high, char16_t low) noexcept {
+    *output++ = high;
+    *output++ = low;
+  }
+  char16_t *output;
+};
+
+struct utf8_variant_to_utf8 {
+  result run(const char *input, size_t length) noexcept {
+    const result r = validate_utf8_with_errors(input, length);
+    std::memcpy(output, input, r.count);
+    output += r.count;
+    return r;
+  }
+  void null() noexcept { *output++ = 0; }
+  // UTF-8 has no form for a surrogate that is not part of a pair.
+  bool unit(char16_t) noexcept { return false; }
+  void pair(char16_t high, char16_t low) noexcept {
+    const uint32_t code_point =
+        0x10000 + ((uint32_t(high - 0xd800) << 10) | uint32_t(low - 0xdc00));
+    *output++ = char((code_point >> 18) | 0xf0);
+    *output++ = char(((code_point >> 12) & 0x3f) | 0x80);
+    *output++ = char(((code_point >> 6) & 0x3f) | 0x80);
+    *output++ = char((code_point & 0x3f) | 0x80);
+  }
+  char *output;
+};
+
+template <bool modified, typename Output>
+result decode_cesu8(const char *input, size_t length, Output &out) noexcept {
+  size_t pos = 0;
+  while (pos < length) {
+    size_t block_end = length;
+    if (length - pos > cesu8_block) {
+      block_end = pos + utf8_units::chunk_end(input + pos, cesu8_block);
+    }
+    const size_t end = find_cesu8_special<modified>(input, pos, block_end);
+    const result r = out.run(input + pos, end - pos);
+    if (r.error == error_code::SUCCESS) {
+      if (end < block_end) {
+        // A zero byte or a four-byte sequence.
+        return result(error_code::HEADER_BITS, end);
+      }
+      pos = end;
+      continue;
+    }
+    // UTF-8 rejects C0 80 and the surrogates, and reports the error at the
+    // start of the sequence. Modified UTF-8 also has the lone surrogates of
+    // Java strings.
+    pos += r.count;
+    char16_t high, low;
+    if (modified && length - pos >= 2 && uint8_t(input[pos]) == 0xc0 &&
+        uint8_t(input[pos + 1]) == 0x80) {
+      out.null();
+      pos += 2;
+    } else if (cesu8_surrogate_pair(input + pos, length - pos, high, low)) {
+      out.pair(high, low);
+      pos += 6;
+    } else if (modified && utf8_surrogate(input + pos, length - pos, high)) {
+      if (!out.unit(high)) {
+        return result(error_code::SURROGATE, pos);
+      }
+      pos += 3;
+    } else {
+      return result(r.error, pos);
+    }
+  }
+  return result(error_code::SUCCESS, length);
+}
+
+// Modified UTF-8 writes every surrogate, so that Java strings with lone
+// surrogates survive the round trip; CESU-8 only writes the pairs.
+template <bool modified>
+result convert_utf16_to_cesu8_impl(const char16_t *input, size_t length,
+                                   char *output) noexcept {
+  char *start = output;
+  size_t pos = 0;
+  while (pos < length) {
+    const size_t block_end = pos + detail::min(cesu8_block, length - pos);
+    const size_t end = find_cesu8_special<modified>(input, pos, block_end);
+    output += convert_valid_utf16_to_utf8(input + pos, end - pos, output);
+    pos = end;
+    while (pos < length && scalar::cesu8::is_special<modified>(input[pos])) {
+      const char16_t unit = input[pos];
+      if (unit == 0) {
+        *output++ = char(0xc0);
+        *output++ = char(0x80);
+        pos++;
+      } else if (modified) {
+        output = write_three_byte_unit(output, unit);
+        pos++;
+      } else if (unit < 0xdc00 && length - pos >= 2 &&
+                 (input[pos + 1] & 0xfc00) == 0xdc00) {
+        output = write_three_byte_unit(output, unit);
+        output = write_three_byte_unit(output, input[pos + 1]);
+        pos += 2;
+      } else {
+        return result(error_code::SURROGATE, pos);
+      }
+    }
+  }
+  return result(error_code::SUCCESS, output - start);
+}
+
+template <bool modified>
+result convert_utf8_to_cesu8_impl(const char *input, size_t length,
+                                  char *cesu8_output) noexcept {
+  char *output = cesu8_output;
+  size_t pos = 0;
+  while (pos < length) {
+    size_t block_end = length;
+    if (length - pos > cesu8_block) {
+      block_end = pos + utf8_units::chunk_end(input + pos, cesu8_block);
+    }
+    const size_t end = find_cesu8_special<modified>(input, pos, block_end);
+    result r = validate_utf8_with_errors(input + pos, end - pos);
+    if (r.error != error_code::SUCCESS) {
+      return result(r.error, pos + r.count);
+    }
+    std::memcpy(output, input + pos, end - pos);
+    output += end - pos;
+    pos = end;
+    if (pos == block_end) {
+      continue;
+    }
+    if (input[pos] == 0) {
+      *output++ = char(0xc0);
+      *output++ = char(0x80);
+      pos++;
+      continue;
+    }
+    const size_t n = detail::min(size_t(4), length - pos);
+    r = validate_utf8_with_errors(input + pos, n);
+    if (r.error != error_code::SUCCESS) {
+      return result(r.error, pos + r.count);
+    }
+    const uint8_t *b = reinterpret_cast<const uint8_t *>(input + pos);
+    const uint32_t code_point = ((b[0] & 0x07u) << 18) |
+                                ((b[1] & 0x3fu) << 12) |
+                                ((b[2] & 0x3fu) << 6) | (b[3] & 0x3fu);
+    output = write_three_byte_unit(
+        output, char16_t(0xd800 + ((code_point - 0x10000) >> 10)));
+    output = write_three_byte_unit(
+        output, char16_t(0xdc00 + ((code_point - 0x10000) & 0x3ff)));
+    pos += 4;
+  }
+  return result(error_code::SUCCESS, output - cesu8_output);
+}
+
+template <bool modified>
+size_t cesu8_length_from_utf8_impl(const char *input, size_t length) noexcept {
+  size_t count = length;
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t byte = uint8_t(input[i]);
+    count += (byte >= 0xf0 ? 2 : 0) + (modified && byte == 0 ? 1 : 0);
+  }
+  return count;
+}
+
+template <bool modified>
+size_t cesu8_length_from_utf16_impl(const char16_t *input,
+                                    size_t length) noexcept {
+  size_t count = length;
+  for (size_t i = 0; i < length; i++) {
+    const char16_t unit = input[i];
+    count += (unit >= 0x80 ? 1 : 0) + (unit >= 0x800 ? 1 : 0) +
+             (modified && unit == 0 ? 1 : 0);
+  }
+  return count;
+}
+} // namespace
+
+simdutf_warn_unused bool validate_cesu8(const char *buf, size_t len) noexcept {
+  utf8_variant_validator out;
+  return decode_cesu8<false>(buf, len, out).error == error_code::SUCCESS;
+}
+
+simdutf_warn_unused result validate_cesu8_with_errors(const char *buf,
+                                                      size_t len) noexcept {
+  utf8_variant_validator out;
+  return decode_cesu8<false>(buf, len, out);
+}
+
+simdutf_warn_unused bool validate_mutf8(const char *buf, size_t len) noexcept {
+  utf8_variant_validator out;
+  return decode_cesu8<true>(buf, len, out).error == error_code::SUCCESS;
+}
+
+simdutf_warn_unused result validate_mutf8_with_errors(const char *buf,
+                                                      size_t len) noexcept {
+  utf8_variant_validator out;
+  return decode_cesu8<true>(buf, len, out);
+}
+
+simdutf_warn_unused size_t cesu8_length_from_utf16(const char16_t *input,
+                                                   size_t length) noexcept {
+  return cesu8_length_from_utf16_impl<false>(input, length);
+}
+
+simdutf_warn_unused size_t mutf8_length_from_utf16(const char16_t *input,
+                                                   size_t length) noexcept {
+  return cesu8_length_from_utf16_impl<true>(input, length);
+}
+
+simdutf_warn_unused size_t cesu8_length_from_utf8(const char *input,
+                                                  size_t length) noexcept {
+  return cesu8_length_from_utf8_impl<false>(input, length);
+}
+
+simdutf_warn_unused size_t mutf8_length_from_utf8(const char *input,
+                                                  size_t length) noexcept {
+  return cesu8_length_from_utf8_impl<true>(input, length);
+}
+
+simdutf_warn_unused result convert_cesu8_to_utf16_with_errors(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  utf8_variant_to_utf16 out{utf16_output};
+  const result r = decode_cesu8<false>(input, length, out);
+  return r.error == error_code::SUCCESS
+             ? result(error_code::SUCCESS, out.output - utf16_output)
+             : r;
+}
+
+simdutf_warn_unused result convert_mutf8_to_utf16_with_errors(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  utf8_variant_to_utf16 out{utf16_output};
+  const result r = decode_cesu8<true>(input, length, out);
+  return r.error == error_code::SUCCESS
+             ? result(error_code::SUCCESS, out.output - utf16_output)
+             : r;
+}
+
+simdutf_warn_unused result convert_cesu8_to_utf8_with_errors(
+    const char *input, size_t length, char *utf8_output) noexcept {
+  utf8_variant_to_utf8 out{utf8_output};
+  const result r = decode_cesu8<false>(input, length, out);
+  return r.error == error_code::SUCCESS
+             ? result(error_code::SUCCESS, out.output - utf8_output)
+             : r;
+}
+
+simdutf_warn_unused result convert_mutf8_to_utf8_with_errors(
+    const char *input, size_t length, char *utf8_output) noexcept {
+  utf8_variant_to_utf8 out{utf8_output};
+  const result r = decode_cesu8<true>(input, length, out);
+  return r.error == error_code::SUCCESS
+             ? result(error_code::SUCCESS, out.output - utf8_output)
+             : r;
+}
+
+simdutf_warn_unused size_t convert_utf16_to_cesu8(const char16_t *input,
+                                                  size_t length,
+                                                  char *cesu8_output) noexcept {
+  const result r =
+      convert_utf16_to_cesu8_impl<false>(input, length, cesu8_output);
+  return r.error ? 0 : r.count;
+}
+
+simdutf_warn_unused result convert_utf16_to_cesu8_with_errors(
+    const char16_t *input, size_t length, char *cesu8_output) noexcept {
+  return convert_utf16_to_cesu8_impl<false>(input, length, cesu8_output);
+}
+
+simdutf_warn_unused size_t convert_utf16_to_mutf8(const char16_t *input,
+                                                  size_t length,
+                                                  char *mutf8_output) noexcept {
+  return convert_utf16_to_cesu8_impl<true>(input, length, mutf8_output).count;
+}
+
+simdutf_warn_unused result convert_utf8_to_cesu8_with_errors(
+    const char *input, size_t length, char *cesu8_output) noexcept {
+  return convert_utf8_to_cesu8_impl<false>(input, length, cesu8_output);
+}
+
+simdutf_warn_unused result convert_utf8_to_mutf8_with_errors(
+    const char *input, size_t length, char *mutf8_output) noexcept {
+  return convert_utf8_to_cesu8_impl<true>(input, length, mutf8_output);
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+namespace {
+// WTF-8 is UTF-8 with unpaired surrogates. The UTF-8 kernels stop on each
+// surrogate sequence, which is decoded here.
+template <typename Output>
+result decode_wtf8(const char *input, size_t length, Output &out) noexcept {
+  size_t pos = 0;
+  while (pos < length) {
+    size_t end = length;
+    if (length - pos > cesu8_block) {
+      end = pos + utf8_units::chunk_end(input + pos, cesu8_block);
+    }
+    const result r = out.run(input + pos, end - pos);
+    if (r.error == error_code::SUCCESS) {
+      pos = end;
+      continue;
+    }
+    pos += r.count;
+    char16_t unit, next;
+    if (!utf8_surrogate(input + pos, length - pos, unit)) {
+      return result(r.error, pos);
+    }
+    // A surrogate pair must be a single four-byte sequence.
+    if (scalar::utf16::high_surrogate(unit) &&
+        utf8_surrogate(input + pos + 3, length - pos - 3, next) &&
+        !scalar::utf16::high_surrogate(next)) {
+      return result(error_code::SURROGATE, pos);
+    }
+    out.unit(unit);
+    pos += 3;
+  }
+  return result(error_code::SUCCESS, length);
+}
+} // namespace
+
+simdutf_warn_unused bool validate_wtf8(const char *buf, size_t len) noexcept {
+  utf8_variant_validator out;
+  return decode_wtf8(buf, len, out).error == error_code::SUCCESS;
+}
+
+simdutf_warn_unused result validate_wtf8_with_errors(const char *buf,
+                                                     size_t len) noexcept {
+  utf8_variant_validator out;
+  return decode_wtf8(buf, len, out);
+}
+
+simdutf_warn_unused size_t wtf8_length_from_utf16(const char16_t *input,
+                                                  size_t length) noexcept {
+  // An unpaired surrogate takes three bytes, as U+FFFD does.
+  return utf8_length_from_utf16_with_replacement(input, length).count;
+}
+
+simdutf_warn_unused size_t utf16_length_from_wtf8(const char *input,
+                                                  size_t length) noexcept {
+  // Surrogate sequences count as the three-byte characters they look like.
+  return utf16_length_from_utf8(input, length);
+}
+
+simdutf_warn_unused size_t convert_utf16_to_wtf8(const char16_t *input,
+                                                 size_t length,
+                                                 char *wtf8_output) noexcept {
+  char *output = wtf8_output;
+  size_t pos = 0;
+  while (pos < length) {
+    size_t end = length;
+    if (length - pos > cesu8_block) {
+      end = pos + utf16_units::chunk_end(input + pos, cesu8_block);
+    }
+    // The UTF-16 validation finds the unpaired surrogates.
+    while (pos < end) {
+      const result r = validate_utf16_with_errors(input + pos, end - pos);
+      output += convert_valid_utf16_to_utf8(input + pos, r.count, output);
+      pos += r.count;
+      if (r.error != error_code::SUCCESS) {
+        output = write_three_byte_unit(output, input[pos]);
+        pos++;
+      }
+    }
+  }
+  return output - wtf8_output;
+}
+
+simdutf_warn_unused result convert_wtf8_to_utf16_with_errors(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  utf8_variant_to_utf16 out{utf16_output};
+  const result r = decode_wtf8(input, length, out);
+  return r.error == error_code::SUCCESS
+             ? result(error_code::SUCCESS, out.output - utf16_output)
+             : r;
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF32
+namespace {
+// Brings native-endian UTF-32 output to the requested byte order in place.
+template <endianness e>
+void utf32_output_to(char32_t *output, size_t length) noexcept {
+  if (!match_system(e)) {
+    scalar::utf32::change_endianness_utf32(output, length, output);
+  }
+}
+} // namespace
+
+void change_endianness_utf32(const char32_t *input, size_t length,
+                             char32_t *output) noexcept {
+  scalar::utf32::change_endianness_utf32(input, length, output);
+}
+simdutf_warn_unused bool validate_utf32le(const char32_t *buf,
+                                          size_t len) noexcept {
+  if (match_system(endianness::LITTLE)) {
+    return validate_utf32(buf, len);
+  }
+  return validate_utf32le_with_errors(buf, len).error == error_code::SUCCESS;
+}
+simdutf_warn_unused result validate_utf32le_with_errors(const char32_t *buf,
+                                                        size_t len) noexcept {
+  return get_default_implementation()->validate_utf32le_with_errors(buf, len);
+}
+simdutf_warn_unused bool validate_utf32be(const char32_t *buf,
+                                          size_t len) noexcept {
+  if (match_system(endianness::BIG)) {
+    return validate_utf32(buf, len);
+  }
+  return validate_utf32be_with_errors(buf, len).error == error_code::SUCCESS;
+}
+simdutf_warn_unused result validate_utf32be_with_errors(const char32_t *buf,
+                                                        size_t len) noexcept {
+  return get_default_implementation()->validate_utf32be_with_errors(buf, len);
+}
+#endif // SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused size_t utf8_length_from_utf32le(const char32_t *input,
+                                                    size_t length) noexcept {
+  return get_default_implementation()->utf8_length_from_utf32le(input, length);
+}
+simdutf_warn_unused size_t convert_utf32le_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept {
+  return get_default_implementation()->convert_utf32le_to_utf8(input, length,
+                                                               utf8_output);
+}
+simdutf_warn_unused result convert_utf32le_to_utf8_with_errors(
+    const char32_t *input, size_t length, char *utf8_output) noexcept {
+  return get_default_implementation()->convert_utf32le_to_utf8_with_errors(
+      input, length, utf8_output);
+}
+simdutf_warn_unused size_t convert_valid_utf32le_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept {
+  return convert_utf32le_to_utf8(input, length, utf8_output);
+}
+simdutf_warn_unused size_t convert_utf8_to_utf32le(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written = convert_utf8_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::LITTLE>(utf32_output, written);
+  return written;
+}
+simdutf_warn_unused result convert_utf8_to_utf32le_with_errors(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  const result r =
+      convert_utf8_to_utf32_with_errors(input, length, utf32_output);
+  // On error, the code points of the valid prefix have been written.
+  utf32_output_to<endianness::LITTLE>(
+      utf32_output, r.error == error_code::SUCCESS
+                        ? r.count
+                        : utf32_length_from_utf8(input, r.count));
+  return r;
+}
+simdutf_warn_unused size_t convert_valid_utf8_to_utf32le(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written =
+      convert_valid_utf8_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::LITTLE>(utf32_output, written);
+  return written;
+}
+simdutf_warn_unused size_t utf8_length_from_utf32be(const char32_t *input,
+                                                    size_t length) noexcept {
+  return get_default_implementation()->utf8_length_from_utf32be(input, length);
+}
+simdutf_warn_unused size_t convert_utf32be_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept {
+  return get_default_implementation()->convert_utf32be_to_utf8(input, length,
+                                                               utf8_output);
+}
+simdutf_warn_unused result convert_utf32be_to_utf8_with_errors(
+    const char32_t *input, size_t length, char *utf8_output) noexcept {
+  return get_default_implementation()->convert_utf32be_to_utf8_with_errors(
+      input, length, utf8_output);
+}
+simdutf_warn_unused size_t convert_valid_utf32be_to_utf8(
+    const char32_t *input, size_t length, char *utf8_output) noexcept {
+  return convert_utf32be_to_utf8(input, length, utf8_output);
+}
+simdutf_warn_unused size_t convert_utf8_to_utf32be(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written = convert_utf8_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::BIG>(utf32_output, written);
+  return written;
+}
+simdutf_warn_unused result convert_utf8_to_utf32be_with_errors(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  const result r =
+      convert_utf8_to_utf32_with_errors(input, length, utf32_output);
+  // On error, the code points of the valid prefix have been written.
+  utf32_output_to<endianness::BIG>(
+      utf32_output, r.error == error_code::SUCCESS
+                        ? r.count
+                        : utf32_length_from_utf8(input, r.count));
+  return r;
+}
+simdutf_warn_unused size_t convert_valid_utf8_to_utf32be(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written =
+      convert_valid_utf8_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::BIG>(utf32_output, written);
+  return written;
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused size_t utf16_length_from_utf32le(const char32_t *input,
+                                                     size_t length) noexcept {
+  return get_default_implementation()->utf16_length_from_utf32le(input, length);
+}
+simdutf_warn_unused size_t convert_utf32le_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_utf32le_to_utf16(input, length,
+                                                                utf16_output);
+}
+simdutf_warn_unused result convert_utf32le_to_utf16_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_utf32le_to_utf16_with_errors(
+      input, length, utf16_output);
+}
+simdutf_warn_unused size_t convert_valid_utf32le_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept {
+  return convert_utf32le_to_utf16(input, length, utf16_output);
+}
+simdutf_warn_unused size_t convert_utf16_to_utf32le(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written = convert_utf16_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::LITTLE>(utf32_output, written);
+  return written;
+}
+simdutf_warn_unused result convert_utf16_to_utf32le_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept {
+  const result r =
+      convert_utf16_to_utf32_with_errors(input, length, utf32_output);
+  // On error, the code points of the valid prefix have been written.
+  utf32_output_to<endianness::LITTLE>(
+      utf32_output, r.error == error_code::SUCCESS
+                        ? r.count
+                        : utf32_length_from_utf16(input, r.count));
+  return r;
+}
+simdutf_warn_unused size_t convert_valid_utf16_to_utf32le(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written =
+      convert_valid_utf16_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::LITTLE>(utf32_output, written);
+  return written;
+}
+simdutf_warn_unused size_t utf16_length_from_utf32be(const char32_t *input,
+                                                     size_t length) noexcept {
+  return get_default_implementation()->utf16_length_from_utf32be(input, length);
+}
+simdutf_warn_unused size_t convert_utf32be_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_utf32be_to_utf16(input, length,
+                                                                utf16_output);
+}
+simdutf_warn_unused result convert_utf32be_to_utf16_with_errors(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept {
+  return get_default_implementation()->convert_utf32be_to_utf16_with_errors(
+      input, length, utf16_output);
+}
+simdutf_warn_unused size_t convert_valid_utf32be_to_utf16(
+    const char32_t *input, size_t length, char16_t *utf16_output) noexcept {
+  return convert_utf32be_to_utf16(input, length, utf16_output);
+}
+simdutf_warn_unused size_t convert_utf16_to_utf32be(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written = convert_utf16_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::BIG>(utf32_output, written);
+  return written;
+}
+simdutf_warn_unused result convert_utf16_to_utf32be_with_errors(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept {
+  const result r =
+      convert_utf16_to_utf32_with_errors(input, length, utf32_output);
+  // On error, the code points of the valid prefix have been written.
+  utf32_output_to<endianness::BIG>(
+      utf32_output, r.error == error_code::SUCCESS
+                        ? r.count
+                        : utf32_length_from_utf16(input, r.count));
+  return r;
+}
+simdutf_warn_unused size_t convert_valid_utf16_to_utf32be(
+    const char16_t *input, size_t length, char32_t *utf32_output) noexcept {
+  const size_t written =
+      convert_valid_utf16_to_utf32(input, length, utf32_output);
+  utf32_output_to<endianness::BIG>(utf32_output, written);
+  return written;
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_BASE64
+simdutf_warn_unused result
+base64_to_binary_safe(const char *input, size_t length, char *output,
+                      size_t &outlen, base64_options options,
+                      last_chunk_handling_options last_chunk_handling_options,
+                      bool decode_up_to_bad_char) noexcept {
+  return base64_to_binary_safe_impl<char>(input, length, output, outlen,
+                                          options, last_chunk_handling_options,
+                                          decode_up_to_bad_char);
+}
+simdutf_warn_unused result
+base64_to_binary_safe(const char16_t *input, size_t length, char *output,
+                      size_t &outlen, base64_options options,
+                      last_chunk_handling_options last_chunk_handling_options,
+                      bool decode_up_to_bad_char) noexcept {
+  return base64_to_binary_safe_impl<char16_t>(
+      input, length, output, outlen, options, last_chunk_handling_options,
+      decode_up_to_bad_char);
+}
+
+size_t binary_to_base64(const char *input, size_t length, char *output,
+                        base64_options options) noexcept {
+  return get_default_implementation()->binary_to_base64(input, length, output,
+                                                        options);
+}
+
+size_t binary_to_base64_with_lines(const char *input, size_t length,
+                                   char *output, size_t line_length,
+                                   base64_options options) noexcept {
+  return get_default_implementation()->binary_to_base64_with_lines(
+      input, length, output, line_length, options);
+}
+
+size_t binary_to_hex(const char *input, size_t length, char *output,
+                     hex_options options) noexcept {
+  return get_default_implementation()->binary_to_hex(input, length, output,
+                                                     options);
+}
+
+simdutf_warn_unused result hex_to_binary(const char *input, size_t length,
+                                         char *output) noexcept {
+  return get_default_implementation()->hex_to_binary(input, length, output);
+}
+
+simdutf_warn_unused result hex_to_binary(const char16_t *input, size_t length,
+                                         char *output) noexcept {
+  return get_default_implementation()->hex_to_binary(input, length, output);
+}
+
+namespace {
+template <typename char_type>
+result hex_to_binary_safe_impl(const char_type *input, size_t length,
+                               char *output, size_t &outlen) noexcept {
+  if (binary_length_from_hex(length) <= outlen) {
+    const result r = hex_to_binary(input, length, output);
+    // Only the digit pairs before an invalid digit are written.
+    outlen = r.error == error_code::INVALID_HEX_CHARACTER ? r.count / 2
+                                                           : r.count;
+    return r;
+  }
+  // Decode the digit pairs that fit.
+  const result r = hex_to_binary(input, 2 * outlen, output);
+  if (r.error != error_code::SUCCESS) {
+    outlen = r.count / 2;
+    return r;
+  }
+  return result(error_code::OUTPUT_BUFFER_TOO_SMALL, 2 * outlen);
+}
+} // namespace
+
+simdutf_warn_unused result hex_to_binary_safe(const char *input, size_t length,
+                                              char *output,
+                                              size_t &outlen) noexcept {
+  return hex_to_binary_safe_impl(input, length, output, outlen);
+}
+
+simdutf_warn_unused result hex_to_binary_safe(const char16_t *input,
+                                              size_t length, char *output,
+                                              size_t &outlen) noexcept {
+  return hex_to_binary_safe_impl(input, length, output, outlen);
+}
+
+simdutf_warn_unused size_t
+base64_encoder::encoded_length(size_t length) const noexcept {
+  const size_t characters = (carry_length + length) / 3 * 4;
+  const size_t room = line_length - column;
+  if (line_length == 0 || characters <= room) {
+    return characters;
+  }
+  return characters + (characters - room + line_length - 1) / line_length;
+}
+
+size_t base64_encoder::encode(const char *input, size_t length,
+                              char *output) noexcept {
+  char *const start = output;
+  if (carry_length > 0) {
+    while (carry_length < 3 && length > 0) {
+      carry[carry_length++] = *input++;
+      length--;
+    }
+    if (carry_length < 3) {
+      return 0;
+    }
+    output = write_base64(carry, 3, output);
+    carry_length = 0;
+  }
+  const size_t complete = length - length % 3;
+  output = write_base64(input, complete, output);
+  carry_length = uint8_t(length - complete);
+  std::memcpy(carry, input + complete, carry_length);
+  return size_t(output - start);
+}
+
+size_t base64_encoder::finish(char *output) noexcept {
+  char *const end = write_base64(carry, carry_length, output);
+  reset();
+  return size_t(end - output);
+}
+
+void base64_encoder::reset() noexcept {
+  column = 0;
+  carry_length = 0;
+}
+
+char *base64_encoder::write_base64(const char *input, size_t length,
+                                   char *output) noexcept {
+  const implementation *impl = get_default_implementation();
+  if (line_length == 0) {
+    return output + impl->binary_to_base64(input, length, output, options);
+  }
+  if (length == 0) {
+    return output;
+  }
+  if (line_length % 4 == 0) {
+    // Lines hold whole quanta: we fill the current line, and the kernel takes
+    // care of the lines that follow.
+    const size_t head = std::min(length, (line_length - column) / 4 * 3);
+    const size_t written = impl->binary_to_base64(input, head, output, options);
+    output += written;
+    column += written;
+    if (head == length) {
+      return output;
+    }
+    *output++ = '\n';
+    const size_t characters =
+        base64_length_from_binary(length - head, options);
+    column = (characters - 1) % line_length + 1;
+    return output + impl->binary_to_base64_with_lines(input + head,
+                                                      length - head, output,
+                                                      line_length, options);
+  }
+  // Otherwise, the quanta straddle the line breaks. We encode past the room
+  // needed for the line breaks, then move the lines into place.
+  const size_t characters = base64_length_from_binary(length, options);
+  const size_t room = line_length - column;
+  const size_t line_breaks =
+      characters <= room
+          ? 0
+          : (characters - room + line_length - 1) / line_length;
+  const char *encoded = output + line_breaks;
+  impl->binary_to_base64(input, length, output + line_breaks, options);
+  for (size_t left = characters; left > 0;) {
+    if (column == line_length) {
+      *output++ = '\n';
+      column = 0;
+    }
+    const size_t count = std::min(left, line_length - column);
+    std::memmove(output, encoded, count);
+    output += count;
+    encoded += count;
+    left -= count;
+    column += count;
+  }
+  return output;
+}
+
+namespace {
+bool base64_ignores_garbage(base64_options options) noexcept {
+  return (options == base64_options::base64_url_accept_garbage) ||
+         (options == base64_options::base64_default_accept_garbage) ||
+         (options == base64_options::base64_default_or_url_accept_garbage);
+}
+} // namespace
+
+simdutf_warn_unused size_t
+base64_decoder::maximal_binary_length(size_t length) const noexcept {
+  // The kept characters may complete a group at the start of the chunk.
+  return (significant + length) / 4 * 3;
+}
+
+simdutf_warn_unused full_result base64_decoder::decode(const char *input,
+                                                       size_t length,
+                                                       char *output) noexcept {
+  return decode_impl(input, length, output);
+}
+
+simdutf_warn_unused full_result base64_decoder::decode(const char16_t *input,
+                                                       size_t length,
+                                                       char *output) noexcept {
+  return decode_impl(input, length, output);
+}
+
+template <typename char_type>
+bool base64_decoder::keep_character(char_type c, size_t position,
+                                    char *&output) noexcept {
+  // With the garbage-accepting options, '=' is ignorable but it ends the
+  // input.
+  if (c != '=' && scalar::base64::is_ignorable(c, options)) {
+    if (kept_length == 0 || kept[kept_length - 1] == '=' ||
+        !scalar::base64::is_ignorable(kept[kept_length - 1], options)) {
+      kept[kept_length] = sizeof(char_type) == 1 ? char16_t(uint8_t(c)) : c;
+      kept_position[kept_length++] = position;
+    }
+    return true;
+  }
+  if (c == '=') {
+    if (padding++ == 0) {
+      padding_position = position;
+    }
+    ended = base64_ignores_garbage(options);
+  } else if (padding > 0 || !scalar::base64::is_base64(c, options)) {
+    // Nothing but ignorable characters and a second '=' may follow the
+    // padding, whatever comes next.
+    error = error_code::INVALID_BASE64_CHARACTER;
+    error_position = padding > 0 ? padding_position : position;
+    return false;
+  } else {
+    significant++;
+  }
+  if (padding > 2) {
+    error = error_code::INVALID_BASE64_CHARACTER;
+    error_position = padding_position;
+    return false;
+  }
+  kept[kept_length] = sizeof(char_type) == 1 ? char16_t(uint8_t(c)) : c;
+  kept_position[kept_length++] = position;
+  if (significant == 4) {
+    // The group is complete and not padded: it is not the last one.
+    output += scalar::base64::base64_to_binary_details_impl(
+                  kept, kept_length, output, options, loose)
+                  .output_count;
+    significant = 0;
+    kept_length = 0;
+  }
+  return true;
+}
+
+template <typename char_type>
+full_result base64_decoder::decode_impl(const char_type *input, size_t length,
+                                        char *output) noexcept {
+  if (error != error_code::SUCCESS) {
+    return full_result(error, error_position, 0);
+  }
+  const bool ignore_garbage = base64_ignores_garbage(options);
+  const size_t start = consumed;
+  consumed += length;
+  char *const output_start = output;
+  size_t pos = 0;
+  // Complete the group left over by the previous chunk.
+  for (; pos < length && (significant > 0 || padding > 0) && !ended; pos++) {
+    if (!keep_character(input[pos], start + pos, output)) {
+      return full_result(error, error_position, size_t(output - output_start));
+    }
+  }
+  if (pos < length && !ended) {
+    // The kernel takes the complete groups. It must not see the padding since
+    // what follows it, in the next chunks, decides whether it is valid.
+    size_t end = length;
+    if (ignore_garbage) {
+      end = size_t(detail::find(input + pos, input + length, char_type('=')) -
+                   input);
+    } else {
+      for (size_t i = length;
+           i > pos && (input[i - 1] == '=' ||
+                       scalar::base64::is_ignorable(input[i - 1], options));
+           i--) {
+        end = input[i - 1] == '=' ? i - 1 : end;
+      }
+    }
+    const full_result r =
+        get_default_implementation()->base64_to_binary_details(
+            input + pos, end - pos, output, options, only_full_chunks);
+    output += r.output_count;
+    if (r.error != error_code::SUCCESS) {
+      // Before the padding, an invalid character is an error whatever comes
+      // next. A '=' followed by other characters is an error as well.
+      error = r.error;
+      error_position = start + pos + r.input_count;
+      return full_result(error, error_position, size_t(output - output_start));
+    }
+    if (r.output_count > 0) {
+      // The characters we kept are ignorable, and the kernel went past them.
+      // We keep everything after the last character of the last group.
+      kept_length = 0;
+      pos += r.input_count;
+      while (scalar::base64::is_ignorable(input[pos - 1], options)) {
+        pos--;
+      }
+    }
+    for (; pos < length && !ended; pos++) {
+      if (!keep_character(input[pos], start + pos, output)) {
+        return full_result(error, error_position,
+                           size_t(output - output_start));
+      }
+    }
+  }
+  return full_result(error_code::SUCCESS, length,
+                     size_t(output - output_start));
+}
+
+simdutf_warn_unused full_result base64_decoder::finish(char *output) noexcept {
+  if (error != error_code::SUCCESS) {
+    return full_result(error, error_position, 0);
+  }
+  // The kept characters are decoded as the end of the stream, as
+  // base64_to_binary_safe would. Their positions in the stream are restored.
+  const full_result r = scalar::base64::base64_to_binary_details_impl(
+      kept, kept_length, output, options, last_chunk_options);
+  size_t position = consumed;
+  if (r.input_count < kept_length) {
+    position = kept_position[r.input_count];
+  } else if (ended) {
+    position = padding_position + 1;
+  }
+  if (r.error != error_code::SUCCESS) {
+    error = r.error;
+    error_position = position;
+  }
+  return full_result(r.error, position, r.output_count);
+}
+
+void base64_decoder::reset() noexcept {
+  *this = base64_decoder(options, last_chunk_options);
+}
+#endif // SIMDUTF_FEATURE_BASE64
+
+#if SIMDUTF_FEATURE_DETECT_ENCODING
+simdutf_warn_unused simdutf::encoding_type
+autodetect_encoding(const char *buf, size_t length) noexcept {
+  return get_default_implementation()->autodetect_encoding(buf, length);
+}
+
+simdutf_warn_unused int detect_encodings(const char *buf,
+                                         size_t length) noexcept {
+  return get_default_implementation()->detect_encodings(buf, length);
+}
+#endif // SIMDUTF_FEATURE_DETECT_ENCODING
+
+#if SIMDUTF_USE_STATIC_INITIALIZATION
+static const implementation *const builtin_impl_instance =
+    get_available_implementations()[SIMDUTF_STRINGIFY(
+        SIMDUTF_BUILTIN_IMPLEMENTATION)];
+#endif
+const implementation *builtin_implementation() {
+#if !SIMDUTF_USE_STATIC_INITIALIZATION
+  static const implementation *const builtin_impl_instance =
+      get_available_implementations()[SIMDUTF_STRINGIFY(
+          SIMDUTF_BUILTIN_IMPLEMENTATION)];
+#endif
+  return builtin_impl_instance;
+}
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused size_t trim_partial_utf8(const char *input, size_t length) {
+  return scalar::utf8::trim_partial_utf8(input, length);
+}
+
+namespace {
+// Moves the continuation bytes at the start of the input to the incomplete
+// character left over by the previous chunk. We only take continuation bytes:
+// anything else means that the character is truncated, which the scalar
+// routines report at the leading byte. Returns false if the input runs out
+// before the character is complete, in which case nothing else can be done
+// with this chunk.
+bool fill_pending_utf8(detail::utf8_stream_state &state, const char *&input,
+                       size_t &length) noexcept {
+  const uint8_t leading_byte = uint8_t(state.pending[0]);
+  const size_t needed = leading_byte < 0xe0 ? 2 : (leading_byte < 0xf0 ? 3 : 4);
+  while (state.pending_length < needed && length > 0 &&
+         (uint8_t(*input) & 0xc0) == 0x80) {
+    state.pending[state.pending_length++] = *input++;
+    length--;
+  }
+  return state.pending_length == needed || length > 0;
+}
+
+// Whatever follows the last complete character of the input is kept for the
+// next chunk: it is at most three bytes long.
+void keep_partial_utf8(detail::utf8_stream_state &state, const char *input,
+                       size_t length, size_t complete) noexcept {
+  state.validated += complete;
+  state.pending_length = uint8_t(length - complete);
+  std::memcpy(state.pending, input + complete, state.pending_length);
+}
+
+result set_utf8_stream_error(detail::utf8_stream_state &state,
+                             error_code error, size_t position) noexcept {
+  state.error = error;
+  state.error_position = position;
+  return result(error, position);
+}
+
+result finish_utf8_stream(detail::utf8_stream_state &state) noexcept {
+  if (state.error != error_code::SUCCESS) {
+    return result(state.error, state.error_position);
+  }
+  if (state.pending_length > 0) {
+    // The stream ends in the middle of a character.
+    const result r = scalar::utf8::validate_with_errors(
+        reinterpret_cast<const uint8_t *>(state.pending), state.pending_length);
+    return set_utf8_stream_error(state, r.error, state.validated + r.count);
+  }
+  return result(error_code::SUCCESS, state.validated);
+}
+} // namespace
+
+simdutf_warn_unused result utf8_stream_validator::feed(const char *input,
+                                                       size_t length) noexcept {
+  if (state.error != error_code::SUCCESS) {
+    return result(state.error, state.error_position);
+  }
+  if (state.pending_length > 0) {
+    if (!fill_pending_utf8(state, input, length)) {
+      return result(error_code::SUCCESS, state.validated);
+    }
+    const result r = scalar::utf8::validate_with_errors(
+        reinterpret_cast<const uint8_t *>(state.pending), state.pending_length);
+    if (r.error != error_code::SUCCESS) {
+      return set_utf8_stream_error(state, r.error, state.validated + r.count);
+    }
+    state.validated += state.pending_length;
+    state.pending_length = 0;
+  }
+  const size_t complete = scalar::utf8::trim_partial_utf8(input, length);
+  const result r =
+      get_default_implementation()->validate_utf8_with_errors(input, complete);
+  if (r.error != error_code::SUCCESS) {
+    return set_utf8_stream_error(state, r.error, state.validated + r.count);
+  }
+  keep_partial_utf8(state, input, length, complete);
+  return result(error_code::SUCCESS, state.validated);
+}
+
+simdutf_warn_unused result utf8_stream_validator::finish() noexcept {
+  return finish_utf8_stream(state);
+}
+
+void utf8_stream_validator::reset() noexcept {
+  state = detail::utf8_stream_state();
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused full_result utf8_to_utf16_stream::convert(
+    const char *input, size_t length, char16_t *utf16_output) noexcept {
+  if (state.error != error_code::SUCCESS) {
+    return full_result(state.error, state.error_position, 0);
+  }
+  const size_t chunk_length = length;
+  char16_t *const start = utf16_output;
+  if (state.pending_length > 0) {
+    if (!fill_pending_utf8(state, input, length)) {
+      return full_result(error_code::SUCCESS, chunk_length, 0);
+    }
+    const result r =
+        big_endian
+            ? scalar::utf8_to_utf16::convert_with_errors<endianness::BIG>(
+                  state.pending, state.pending_length, utf16_output)
+            : scalar::utf8_to_utf16::convert_with_errors<endianness::LITTLE>(
+                  state.pending, state.pending_length, utf16_output);
+    if (r.error != error_code::SUCCESS) {
+      set_utf8_stream_error(state, r.error, state.validated + r.count);
+      return full_result(state.error, state.error_position, 0);
+    }
+    utf16_output += r.count;
+    state.validated += state.pending_length;
+    state.pending_length = 0;
+  }
+  const size_t complete = scalar::utf8::trim_partial_utf8(input, length);
+  const implementation *impl = get_default_implementation();
+  const result r =
+      big_endian
+          ? impl->convert_utf8_to_utf16be_with_errors(input, complete,
+                                                      utf16_output)
+          : impl->convert_utf8_to_utf16le_with_errors(input, complete,
+                                                      utf16_output);
+  if (r.error != error_code::SUCCESS) {
+    // The output of the kernels is unspecified on error: write again the
+    // characters that precede the error so that output_count is meaningful.
+    utf16_output +=
+        big_endian
+            ? impl->convert_valid_utf8_to_utf16be(input, r.count, utf16_output)
+            : impl->convert_valid_utf8_to_utf16le(input, r.count, utf16_output);
+    set_utf8_stream_error(state, r.error, state.validated + r.count);
+    return full_result(state.error, state.error_position,
+                       size_t(utf16_output - start));
+  }
+  utf16_output += r.count;
+  keep_partial_utf8(state, input, length, complete);
+  return full_result(error_code::SUCCESS, chunk_length,
+                     size_t(utf16_output - start));
+}
+
+simdutf_warn_unused result utf8_to_utf16_stream::finish() noexcept {
+  return finish_utf8_stream(state);
+}
+
+void utf8_to_utf16_stream::reset() noexcept {
+  state = detail::utf8_stream_state();
+}
+
+namespace {
+char *write_utf8_replacement(char *utf8_output) noexcept {
+  *utf8_output++ = char(0xef);
+  *utf8_output++ = char(0xbf);
+  *utf8_output++ = char(0xbd);
+  return utf8_output;
+}
+} // namespace
+
+simdutf_warn_unused full_result utf16_to_utf8_stream::convert(
+    const char16_t *input, size_t length, char *utf8_output) noexcept {
+  if (error != error_code::SUCCESS) {
+    return full_result(error, error_position, 0);
+  }
+  const size_t chunk_length = length;
+  char *const start = utf8_output;
+  if (has_pending) {
+    if (length == 0) {
+      return full_result(error_code::SUCCESS, 0, 0);
+    }
+    const bool low_surrogate =
+        big_endian ? scalar::utf16::is_low_surrogate<endianness::BIG>(input[0])
+                   : scalar::utf16::is_low_surrogate<endianness::LITTLE>(
+                         input[0]);
+    if (low_surrogate) {
+      const char16_t pair[2] = {pending, input[0]};
+      utf8_output +=
+          big_endian
+              ? scalar::utf16_to_utf8::convert<endianness::BIG>(pair, 2,
+                                                                utf8_output)
+              : scalar::utf16_to_utf8::convert<endianness::LITTLE>(
+                    pair, 2, utf8_output);
+      converted += 2;
+      input++;
+      length--;
+    } else if (replace) {
+      utf8_output = write_utf8_replacement(utf8_output);
+      converted++;
+    } else {
+      error = error_code::SURROGATE;
+      error_position = converted;
+      return full_result(error, error_position, 0);
+    }
+    has_pending = false;
+  }
+  // A high surrogate at the end of the chunk is kept for the next chunk.
+  const size_t complete =
+      big_endian
+          ? scalar::utf16::trim_partial_utf16<endianness::BIG>(input, length)
+          : scalar::utf16::trim_partial_utf16<endianness::LITTLE>(input,
+                                                                  length);
+  const implementation *impl = get_default_implementation();
+  if (replace) {
+    utf8_output +=
+        big_endian ? impl->convert_utf16be_to_utf8_with_replacement(
+                         input, complete, utf8_output)
+                   : impl->convert_utf16le_to_utf8_with_replacement(
+                         input, complete, utf8_output);
+  } else {
+    const result r =
+        big_endian ? impl->convert_utf16be_to_utf8_with_errors(input, complete,
+                                                               utf8_output)
+                   : impl->convert_utf16le_to_utf8_with_errors(input, complete,
+                                                               utf8_output);
+    if (r.error != error_code::SUCCESS) {
+      // The output of the kernels is unspecified on error: write again the
+      // characters that precede the error so that output_count is meaningful.
+      utf8_output +=
+          big_endian
+              ? impl->convert_valid_utf16be_to_utf8(input, r.count, utf8_output)
+              : impl->convert_valid_utf16le_to_utf8(input, r.count,
+                                                    utf8_output);
+      error = r.error;
+      error_position = converted + r.count;
+      return full_result(error, error_position, size_t(utf8_output - start));
+    }
+    utf8_output += r.count;
+  }
+  converted += complete;
+  if (complete < length) {
+    pending = input[complete];
+    has_pending = true;
+  }
+  return full_result(error_code::SUCCESS, chunk_length,
+                     size_t(utf8_output - start));
+}
+
+simdutf_warn_unused full_result
+utf16_to_utf8_stream::finish(char *utf8_output) noexcept {
+  if (error != error_code::SUCCESS) {
+    return full_result(error, error_position, 0);
+  }
+  if (!has_pending) {
+    return full_result(error_code::SUCCESS, converted, 0);
+  }
+  // The stream ends with an unpaired high surrogate.
+  if (!replace) {
+    error = error_code::SURROGATE;
+    error_position = converted;
+    return full_result(error, error_position, 0);
+  }
+  write_utf8_replacement(utf8_output);
+  has_pending = false;
+  converted++;
+  return full_result(error_code::SUCCESS, converted, 3);
+}
+
+void utf16_to_utf8_stream::reset() noexcept {
+  *this = utf16_to_utf8_stream(
+      big_endian ? endianness::BIG : endianness::LITTLE, replace);
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused full_result utf8_to_utf32_stream::convert(
+    const char *input, size_t length, char32_t *utf32_output) noexcept {
+  if (state.error != error_code::SUCCESS) {
+    return full_result(state.error, state.error_position, 0);
+  }
+  const size_t chunk_length = length;
+  char32_t *const start = utf32_output;
+  if (state.pending_length > 0) {
+    if (!fill_pending_utf8(state, input, length)) {
+      return full_result(error_code::SUCCESS, chunk_length, 0);
+    }
+    const result r = scalar::utf8_to_utf32::convert_with_errors(
+        state.pending, state.pending_length, utf32_output);
+    if (r.error != error_code::SUCCESS) {
+      set_utf8_stream_error(state, r.error, state.validated + r.count);
+      return full_result(state.error, state.error_position, 0);
+    }
+    utf32_output += r.count;
+    state.validated += state.pending_length;
+    state.pending_length = 0;
+  }
+  const size_t complete = scalar::utf8::trim_partial_utf8(input, length);
+  const implementation *impl = get_default_implementation();
+  const result r =
+      impl->convert_utf8_to_utf32_with_errors(input, complete, utf32_output);
+  if (r.error != error_code::SUCCESS) {
+    // The output of the kernels is unspecified on error: write again the
+    // characters that precede the error so that output_count is meaningful.
+    utf32_output +=
+        impl->convert_valid_utf8_to_utf32(input, r.count, utf32_output);
+    set_utf8_stream_error(state, r.error, state.validated + r.count);
+    return full_result(state.error, state.error_position,
+                       size_t(utf32_output - start));
+  }
+  utf32_output += r.count;
+  keep_partial_utf8(state, input, length, complete);
+  return full_result(error_code::SUCCESS, chunk_length,
+                     size_t(utf32_output - start));
+}
+
+simdutf_warn_unused result utf8_to_utf32_stream::finish() noexcept {
+  return finish_utf8_stream(state);
+}
+
+void utf8_to_utf32_stream::reset() noexcept {
+  state = detail::utf8_stream_state();
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused size_t trim_partial_utf16be(const char16_t *input,
+                                                size_t length) {
+  return scalar::utf16::trim_partial_utf16<BIG>(input, length);
+}
+
+simdutf_warn_unused size_t trim_partial_utf16le(const char16_t *input,
+                                                size_t length) {
+  return scalar::utf16::trim_partial_utf16<LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t trim_partial_utf16(const char16_t *input,
+                                              size_t length) {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return trim_partial_utf16be(input, length);
+  #else
+  return trim_partial_utf16le(input, length);
+  #endif
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+namespace {
+  #if SIMDUTF_THREAD_POOL
+// A fixed set of worker threads that take the tasks of the batches in the
+// order the batches were submitted. The thread that submits a batch works on
+// it too, then waits for the tasks that the workers took. A task is a whole
+// segment of a parallel function (at least 64 KiB), so handing out the tasks
+// under a mutex costs little.
+class thread_pool final : public executor {
+public:
+  explicit thread_pool(size_t worker_count) noexcept
+      : mutex{}, work_available{}, batch_completed{}, queue{}, stopping{false},
+        workers{} {
+    // Thread creation may fail, e.g. under a limit on the number of threads:
+    // the pool then keeps the workers that started, possibly none.
+    try {
+      workers.reserve(worker_count);
+      for (size_t i = 0; i < worker_count; i++) {
+        workers.emplace_back([this] { work(); });
+      }
+    } catch (...) {
+    }
+  }
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    work_available.notify_all();
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  size_t concurrency() const noexcept override { return workers.size() + 1; }
+
+  void run(size_t task_count, task_function task,
+           void *context) noexcept override {
+    if (task_count == 0) {
+      return;
+    }
+    batch current{task, context, task_count, 0, task_count};
+    std::unique_lock<std::mutex> lock(mutex);
+    try {
+      queue.push_back(&current);
+    } catch (...) {
+      // Out of memory: the calling thread runs the batch alone.
+      lock.unlock();
+      for (size_t i = 0; i < task_count; i++) {
+        task(context, i);
+      }
+      return;
+    }
+    if (task_count > 1) {
+      work_available.notify_all();
+    }
+    while (current.next < current.task_count) {
+      run_one(current, lock);
+    }
+    batch_completed.wait(lock, [&current] { return current.pending == 0; });
+  }
+
+private:
+  struct batch {
+    task_function task;
+    void *context;
+    size_t task_count;
+    size_t next;    // the next task to hand out
+    size_t pending; // the tasks that have not completed
+  };
+
+  // Takes the next task of the batch and runs it with the mutex unlocked.
+  void run_one(batch &b, std::unique_lock<std::mutex> &lock) noexcept {
+    const size_t index = b.next++;
+    if (b.next == b.task_count) {
+      // Every task is handed out: the batch leaves the queue.
+      for (size_t i = 0; i < queue.size(); i++) {
+        if (queue[i] == &b) {
+          queue.erase(queue.begin() + ptrdiff_t(i));
+          break;
+        }
+      }
+    }
+    lock.unlock();
+    b.task(b.context, index);
+    lock.lock();
+    if (--b.pending == 0) {
+      batch_completed.notify_all();
+    }
+  }
+
+  void work() noexcept {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      work_available.wait(lock, [this] { return stopping || !queue.empty(); });
+      if (queue.empty()) {
+        return;
+      }
+      run_one(*queue.front(), lock);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable work_available;
+  std::condition_variable batch_completed;
+  std::vector<batch *> queue;
+  bool stopping;
+  std::vector<std::thread> workers;
+};
+  #endif // SIMDUTF_THREAD_POOL
+
+// Without threads, the tasks run on the calling thread.
+class sequential_executor final : public executor {
+public:
+  size_t concurrency() const noexcept override { return 1; }
+
+  void run(size_t task_count, task_function task,
+           void *context) noexcept override {
+    for (size_t i = 0; i < task_count; i++) {
+      task(context, i);
+    }
+  }
+};
+
+sequential_executor sequential_executor_instance;
+
+  #if SIMDUTF_THREAD_POOL
+executor *new_thread_pool() noexcept {
+  try {
+    return new thread_pool(std::thread::hardware_concurrency() > 1
+                               ? std::thread::hardware_concurrency() - 1
+                               : 0);
+  } catch (...) {
+    return &sequential_executor_instance;
+  }
+}
+  #endif // SIMDUTF_THREAD_POOL
+} // namespace
+
+simdutf_warn_unused executor &default_executor() noexcept {
+  #if SIMDUTF_THREAD_POOL
+  // The pool is never destroyed: its workers may still be needed while other
+  // static objects are destroyed at exit.
+  static executor *const pool = new_thread_pool();
+  return *pool;
+  #else
+  return sequential_executor_instance;
+  #endif // SIMDUTF_THREAD_POOL
+}
+
+namespace {
+// Cutting the input in segments shorter than this is not worth it: handing a
+// task to the executor costs more than converting a few kilobytes.
+constexpr size_t parallel_segment_bytes = 65536;
+// The bookkeeping of a parallel function lives on the stack.
+constexpr size_t parallel_max_segments = 256;
+
+// The input of a parallel function and where it is cut into segments.
+template <typename char_type> struct parallel_segments {
+  using split_function = size_t (*)(const char_type *input, size_t position);
+
+  parallel_segments(const char_type *in, split_function split_at) noexcept
+      : impl{get_default_implementation()}, input{in}, split{split_at} {}
+
+  // Returns the number of segments, 0 or 1 if the input should not be cut.
+  size_t cut(size_t length, const executor &exec) noexcept {
+    size_t segments = std::min(exec.concurrency(), parallel_max_segments);
+    segments =
+        std::min(segments, length * sizeof(char_type) / parallel_segment_bytes);
+    if (segments <= 1) {
+      return segments;
+    }
+    // The segments are at least parallel_segment_bytes long, moving a split
+    // point back by a few code units keeps the offsets increasing.
+    input_offsets[0] = 0;
+    for (size_t i = 1; i < segments; i++) {
+      input_offsets[i] = split(input, length / segments * i);
+    }
+    input_offsets[segments] = length;
+    return segments;
+  }
+
+  size_t segment_length(size_t index) const noexcept {
+    return input_offsets[index + 1] - input_offsets[index];
+  }
+
+  const implementation *impl;
+  const char_type *input;
+  split_function split;
+  size_t input_offsets[parallel_max_segments + 1];
+  result results[parallel_max_segments];
+};
+
+// A conversion in two rounds over the executor: the tasks of the first round
+// compute the output length of their segment, and once the prefix sum of
+// these lengths gives the position of each segment in the output, the tasks of
+// the second round convert their segment.
+template <typename from, typename to>
+struct parallel_conversion : parallel_segments<from> {
+  using measure_function = size_t (*)(const implementation *impl,
+                                      const from *input, size_t length);
+  using convert_function = result (*)(const implementation *impl,
+                                      const from *input, size_t length,
+                                      to *output);
+
+  parallel_conversion(const from *in, to *out,
+                      typename parallel_segments<from>::split_function split_at,
+                      measure_function measure_segment,
+                      convert_function convert_segment) noexcept
+      : parallel_segments<from>(in, split_at), output{out},
+        measure{measure_segment}, convert{convert_segment} {}
+
+  to *output;
+  measure_function measure;
+  convert_function convert;
+  size_t output_offsets[parallel_max_segments + 1];
+
+  static void measure_task(void *context, size_t index) {
+    parallel_conversion &job = *static_cast<parallel_conversion *>(context);
+    job.output_offsets[index + 1] =
+        job.measure(job.impl, job.input + job.input_offsets[index],
+                    job.segment_length(index));
+  }
+
+  static void convert_task(void *context, size_t index) {
+    parallel_conversion &job = *static_cast<parallel_conversion *>(context);
+    job.results[index] = job.convert(
+        job.impl, job.input + job.input_offsets[index],
+        job.segment_length(index), job.output + job.output_offsets[index]);
+  }
+
+  result run(size_t length, executor &exec) noexcept {
+    const size_t segments = this->cut(length, exec);
+    if (segments <= 1) {
+      return convert(this->impl, this->input, length, output);
+    }
+    output_offsets[0] = 0;
+    exec.run(segments, measure_task, this);
+    for (size_t i = 0; i < segments; i++) {
+      output_offsets[i + 1] += output_offsets[i];
+    }
+    exec.run(segments, convert_task, this);
+    for (size_t i = 0; i < segments; i++) {
+      if (this->results[i].error != error_code::SUCCESS) {
+        // The split points only fall between characters when the input is
+        // valid. Around an error, a segment may report a character truncated
+        // by its end: convert again from the start of the segment to find
+        // the error that a single pass reports.
+        const size_t start = this->input_offsets[i];
+        result r = convert(this->impl, this->input + start, length - start,
+                           output + output_offsets[i]);
+        r.count += r.error == error_code::SUCCESS ? output_offsets[i] : start;
+        return r;
+      }
+    }
+    return result(error_code::SUCCESS, output_offsets[segments]);
+  }
+};
+
+// A validation in one round over the executor, with the same split points as
+// the conversions.
+template <typename char_type>
+struct parallel_validation : parallel_segments<char_type> {
+  using validate_function = result (*)(const implementation *impl,
+                                       const char_type *input, size_t length);
+
+  parallel_validation(
+      const char_type *in,
+      typename parallel_segments<char_type>::split_function split_at,
+      validate_function validate_segment) noexcept
+      : parallel_segments<char_type>(in, split_at),
+        validate{validate_segment} {}
+
+  validate_function validate;
+
+  static void validate_task(void *context, size_t index) {
+    parallel_validation &job = *static_cast<parallel_validation *>(context);
+    job.results[index] =
+        job.validate(job.impl, job.input + job.input_offsets[index],
+                     job.segment_length(index));
+  }
+
+  result run(size_t length, executor &exec) noexcept {
+    const size_t segments = this->cut(length, exec);
+    if (segments <= 1) {
+      return validate(this->impl, this->input, length);
+    }
+    exec.run(segments, validate_task, this);
+    for (size_t i = 0; i < segments; i++) {
+      if (this->results[i].error != error_code::SUCCESS) {
+        // As for the conversions, the first error of the segment may be an
+        // artifact of the next split point.
+        const size_t start = this->input_offsets[i];
+        result r = validate(this->impl, this->input + start, length - start);
+        r.count += start;
+        return r;
+      }
+    }
+    return result(error_code::SUCCESS, length);
+  }
+};
+} // namespace
+#endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8
+namespace {
+// Moves the split point back to the leading byte of the character it falls
+// in. Four continuation bytes in a row are an error anyway.
+size_t utf8_split_point(const char *input, size_t position) noexcept {
+  for (size_t i = 0; i < 3 && (uint8_t(input[position]) & 0xc0) == 0x80; i++) {
+    position--;
+  }
+  return position;
+}
+} // namespace
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+namespace {
+// Keeps surrogate pairs in one piece.
+template <endianness big_endian>
+size_t utf16_split_point(const char16_t *input, size_t position) noexcept {
+  const char16_t previous =
+      scalar::utf16::swap_if_needed<big_endian>(input[position - 1]);
+  return (previous & 0xfc00) == 0xd800 ? position - 1 : position;
+}
+} // namespace
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF32 &&                                                   \
+    (SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF16)
+namespace {
+size_t utf32_split_point(const char32_t *, size_t position) noexcept {
+  return position;
+}
+} // namespace
+#endif // SIMDUTF_FEATURE_UTF32 && (SIMDUTF_FEATURE_UTF8 ||
+       // SIMDUTF_FEATURE_UTF16)
+
+#if SIMDUTF_FEATURE_UTF8
+simdutf_warn_unused result validate_utf8_parallel(const char *buf, size_t len,
+                                                  executor &exec) noexcept {
+  parallel_validation<char> job(
+      buf, utf8_split_point,
+      [](const implementation *impl, const char *in, size_t length) {
+        return impl->validate_utf8_with_errors(in, length);
+      });
+  return job.run(len, exec);
+}
+#endif // SIMDUTF_FEATURE_UTF8
+
+#if SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused result validate_utf16le_parallel(const char16_t *buf,
+                                                     size_t len,
+                                                     executor &exec) noexcept {
+  parallel_validation<char16_t> job(
+      buf, utf16_split_point<LITTLE>,
+      [](const implementation *impl, const char16_t *in, size_t length) {
+        return impl->validate_utf16le_with_errors(in, length);
+      });
+  return job.run(len, exec);
+}
+
+simdutf_warn_unused result validate_utf16be_parallel(const char16_t *buf,
+                                                     size_t len,
+                                                     executor &exec) noexcept {
+  parallel_validation<char16_t> job(
+      buf, utf16_split_point<BIG>,
+      [](const implementation *impl, const char16_t *in, size_t length) {
+        return impl->validate_utf16be_with_errors(in, length);
+      });
+  return job.run(len, exec);
+}
+
+simdutf_warn_unused result validate_utf16_parallel(const char16_t *buf,
+                                                   size_t len,
+                                                   executor &exec) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return validate_utf16be_parallel(buf, len, exec);
+  #else
+  return validate_utf16le_parallel(buf, len, exec);
+  #endif
+}
+#endif // SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused result convert_utf8_to_utf16le_parallel(
+    const char *input, size_t length, char16_t *utf16_output,
+    executor &exec) noexcept {
+  parallel_conversion<char, char16_t> job(
+      input, utf16_output, utf8_split_point,
+      [](const implementation *impl, const char *in, size_t len) {
+        return impl->utf16_length_from_utf8(in, len);
+      },
+      [](const implementation *impl, const char *in, size_t len,
+         char16_t *out) {
+        return impl->convert_utf8_to_utf16le_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf8_to_utf16be_parallel(
+    const char *input, size_t length, char16_t *utf16_output,
+    executor &exec) noexcept {
+  parallel_conversion<char, char16_t> job(
+      input, utf16_output, utf8_split_point,
+      [](const implementation *impl, const char *in, size_t len) {
+        return impl->utf16_length_from_utf8(in, len);
+      },
+      [](const implementation *impl, const char *in, size_t len,
+         char16_t *out) {
+        return impl->convert_utf8_to_utf16be_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf8_to_utf16_parallel(
+    const char *input, size_t length, char16_t *utf16_output,
+    executor &exec) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf8_to_utf16be_parallel(input, length, utf16_output, exec);
+  #else
+  return convert_utf8_to_utf16le_parallel(input, length, utf16_output, exec);
+  #endif
+}
+
+simdutf_warn_unused result convert_utf16le_to_utf8_parallel(
+    const char16_t *input, size_t length, char *utf8_output,
+    executor &exec) noexcept {
+  parallel_conversion<char16_t, char> job(
+      input, utf8_output, utf16_split_point<LITTLE>,
+      [](const implementation *impl, const char16_t *in, size_t len) {
+        return impl->utf8_length_from_utf16le(in, len);
+      },
+      [](const implementation *impl, const char16_t *in, size_t len,
+         char *out) {
+        return impl->convert_utf16le_to_utf8_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf16be_to_utf8_parallel(
+    const char16_t *input, size_t length, char *utf8_output,
+    executor &exec) noexcept {
+  parallel_conversion<char16_t, char> job(
+      input, utf8_output, utf16_split_point<BIG>,
+      [](const implementation *impl, const char16_t *in, size_t len) {
+        return impl->utf8_length_from_utf16be(in, len);
+      },
+      [](const implementation *impl, const char16_t *in, size_t len,
+         char *out) {
+        return impl->convert_utf16be_to_utf8_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf16_to_utf8_parallel(
+    const char16_t *input, size_t length, char *utf8_output,
+    executor &exec) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf16be_to_utf8_parallel(input, length, utf8_output, exec);
+  #else
+  return convert_utf16le_to_utf8_parallel(input, length, utf8_output, exec);
+  #endif
+}
+
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused result convert_utf8_to_utf32_parallel(
+    const char *input, size_t length, char32_t *utf32_output,
+    executor &exec) noexcept {
+  parallel_conversion<char, char32_t> job(
+      input, utf32_output, utf8_split_point,
+      [](const implementation *impl, const char *in, size_t len) {
+        return impl->utf32_length_from_utf8(in, len);
+      },
+      [](const implementation *impl, const char *in, size_t len,
+         char32_t *out) {
+        return impl->convert_utf8_to_utf32_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf32_to_utf8_parallel(
+    const char32_t *input, size_t length, char *utf8_output,
+    executor &exec) noexcept {
+  parallel_conversion<char32_t, char> job(
+      input, utf8_output, utf32_split_point,
+      [](const implementation *impl, const char32_t *in, size_t len) {
+        return impl->utf8_length_from_utf32(in, len);
+      },
+      [](const implementation *impl, const char32_t *in, size_t len,
+         char *out) {
+        return impl->convert_utf32_to_utf8_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused result convert_utf16le_to_utf32_parallel(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    executor &exec) noexcept {
+  parallel_conversion<char16_t, char32_t> job(
+      input, utf32_output, utf16_split_point<LITTLE>,
+      [](const implementation *impl, const char16_t *in, size_t len) {
+        return impl->utf32_length_from_utf16le(in, len);
+      },
+      [](const implementation *impl, const char16_t *in, size_t len,
+         char32_t *out) {
+        return impl->convert_utf16le_to_utf32_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf16be_to_utf32_parallel(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    executor &exec) noexcept {
+  parallel_conversion<char16_t, char32_t> job(
+      input, utf32_output, utf16_split_point<BIG>,
+      [](const implementation *impl, const char16_t *in, size_t len) {
+        return impl->utf32_length_from_utf16be(in, len);
+      },
+      [](const implementation *impl, const char16_t *in, size_t len,
+         char32_t *out) {
+        return impl->convert_utf16be_to_utf32_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf16_to_utf32_parallel(
+    const char16_t *input, size_t length, char32_t *utf32_output,
+    executor &exec) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf16be_to_utf32_parallel(input, length, utf32_output, exec);
+  #else
+  return convert_utf16le_to_utf32_parallel(input, length, utf32_output, exec);
+  #endif
+}
+
+simdutf_warn_unused result convert_utf32_to_utf16le_parallel(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    executor &exec) noexcept {
+  parallel_conversion<char32_t, char16_t> job(
+      input, utf16_output, utf32_split_point,
+      [](const implementation *impl, const char32_t *in, size_t len) {
+        return impl->utf16_length_from_utf32(in, len);
+      },
+      [](const implementation *impl, const char32_t *in, size_t len,
+         char16_t *out) {
+        return impl->convert_utf32_to_utf16le_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf32_to_utf16be_parallel(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    executor &exec) noexcept {
+  parallel_conversion<char32_t, char16_t> job(
+      input, utf16_output, utf32_split_point,
+      [](const implementation *impl, const char32_t *in, size_t len) {
+        return impl->utf16_length_from_utf32(in, len);
+      },
+      [](const implementation *impl, const char32_t *in, size_t len,
+         char16_t *out) {
+        return impl->convert_utf32_to_utf16be_with_errors(in, len, out);
+      });
+  return job.run(length, exec);
+}
+
+simdutf_warn_unused result convert_utf32_to_utf16_parallel(
+    const char32_t *input, size_t length, char16_t *utf16_output,
+    executor &exec) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf32_to_utf16be_parallel(input, length, utf16_output, exec);
+  #else
+  return convert_utf32_to_utf16le_parallel(input, length, utf16_output, exec);
+  #endif
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+namespace {
+// Converts the strings one after the other, one virtual call each, and records
+// the output offsets: a convenience over a loop, not a faster path. The
+// strings are not concatenated: a truncated character at the end of one string
+// would be completed by the next one.
+template <typename from, typename to>
+size_t convert_batch(const from *const *inputs, const size_t *lengths,
+                     size_t count, to *output, size_t *output_offsets,
+                     result *results,
+                     result (implementation::*convert)(const from *, size_t,
+                                                       to *) const noexcept) {
+  const implementation *impl = get_default_implementation();
+  size_t errors = 0;
+  size_t offset = 0;
+  for (size_t i = 0; i < count; i++) {
+    output_offsets[i] = offset;
+    const result r = (impl->*convert)(inputs[i], lengths[i], output + offset);
+    if (r.error == error_code::SUCCESS) {
+      offset += r.count;
+    } else {
+      errors++;
+    }
+    if (results != nullptr) {
+      results[i] = r;
+    }
+  }
+  output_offsets[count] = offset;
+  return errors;
+}
+} // namespace
+
+simdutf_warn_unused size_t convert_utf8_to_utf16le_batch(
+    const char *const *inputs, const size_t *lengths, size_t count,
+    char16_t *utf16_output, size_t *output_offsets, result *results) noexcept {
+  return convert_batch(inputs, lengths, count, utf16_output, output_offsets,
+                       results,
+                       &implementation::convert_utf8_to_utf16le_with_errors);
+}
+
+simdutf_warn_unused size_t convert_utf8_to_utf16be_batch(
+    const char *const *inputs, const size_t *lengths, size_t count,
+    char16_t *utf16_output, size_t *output_offsets, result *results) noexcept {
+  return convert_batch(inputs, lengths, count, utf16_output, output_offsets,
+                       results,
+                       &implementation::convert_utf8_to_utf16be_with_errors);
+}
+
+simdutf_warn_unused size_t convert_utf8_to_utf16_batch(
+    const char *const *inputs, const size_t *lengths, size_t count,
+    char16_t *utf16_output, size_t *output_offsets, result *results) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf8_to_utf16be_batch(inputs, lengths, count, utf16_output,
+                                       output_offsets, results);
+  #else
+  return convert_utf8_to_utf16le_batch(inputs, lengths, count, utf16_output,
+                                       output_offsets, results);
+  #endif
+}
+
+simdutf_warn_unused size_t convert_utf16le_to_utf8_batch(
+    const char16_t *const *inputs, const size_t *lengths, size_t count,
+    char *utf8_output, size_t *output_offsets, result *results) noexcept {
+  return convert_batch(inputs, lengths, count, utf8_output, output_offsets,
+                       results,
+                       &implementation::convert_utf16le_to_utf8_with_errors);
+}
+
+simdutf_warn_unused size_t convert_utf16be_to_utf8_batch(
+    const char16_t *const *inputs, const size_t *lengths, size_t count,
+    char *utf8_output, size_t *output_offsets, result *results) noexcept {
+  return convert_batch(inputs, lengths, count, utf8_output, output_offsets,
+                       results,
+                       &implementation::convert_utf16be_to_utf8_with_errors);
+}
+
+simdutf_warn_unused size_t convert_utf16_to_utf8_batch(
+    const char16_t *const *inputs, const size_t *lengths, size_t count,
+    char *utf8_output, size_t *output_offsets, result *results) noexcept {
+  #if SIMDUTF_IS_BIG_ENDIAN
+  return convert_utf16be_to_utf8_batch(inputs, lengths, count, utf8_output,
+                                       output_offsets, results);
+  #else
+  return convert_utf16le_to_utf8_batch(inputs, lengths, count, utf8_output,
+                                       output_offsets, results);
+  #endif
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 } // namespace simdutf
@@ -1,4 +1,4 @@
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char16_t *>
 lasx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                             char16_t *utf16_out) {
@@ -7,7 +7,7 @@ lasx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
 
   // Performance degradation when memory address is not 32-byte aligned
   while (((uint64_t)utf16_output & 0x1F) && buf < end) {
-    uint32_t word = *buf++;
+    uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(*buf++);
     if ((word & 0xFFFF0000) == 0) {
       // will not generate a surrogate pair
       if (word >= 0xD800 && word <= 0xDFFF) {
@@ -41,8 +41,10 @@ lasx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   __m256i v_d800 = lasx_splat_u16(0xd800);
   __m256i v_dfff = lasx_splat_u16(0xdfff);
   while (end - buf >= 16) {
-    __m256i in0 = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m256i in1 = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32);
+    __m256i in0 = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m256i in1 = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32));
 
     // Check if no bits set above 16th
     if (__lasx_xbz_v(__lasx_xvpickod_h(in1, in0))) {
@@ -67,7 +69,7 @@ lasx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
@@ -106,7 +108,7 @@ lasx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   return std::make_pair(buf, reinterpret_cast<char16_t *>(utf16_output));
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char16_t *>
 lasx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
                                         char16_t *utf16_out) {
@@ -116,7 +118,7 @@ lasx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
 
   // Performance degradation when memory address is not 32-byte aligned
   while (((uint64_t)utf16_output & 0x1F) && buf < end) {
-    uint32_t word = *buf++;
+    uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(*buf++);
     if ((word & 0xFFFF0000) == 0) {
       // will not generate a surrogate pair
       if (word >= 0xD800 && word <= 0xDFFF) {
@@ -148,8 +150,10 @@ lasx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
   __m256i v_d800 = lasx_splat_u16(0xd800);
   __m256i v_dfff = lasx_splat_u16(0xdfff);
   while (end - buf >= 16) {
-    __m256i in0 = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m256i in1 = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32);
+    __m256i in0 = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m256i in1 = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32));
 
     // Check if no bits set above 16th
     if (__lasx_xbz_v(__lasx_xvpickod_h(in1, in0))) {
@@ -179,7 +183,7 @@ lasx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
@@ -1,3 +1,4 @@
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char *>
 lasx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   uint8_t *utf8_output = reinterpret_cast<uint8_t *>(utf8_out);
@@ -5,7 +6,7 @@ lasx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
 
   // load addr align 32
   while (((uint64_t)buf & 0x1F) && buf < end) {
-    uint32_t word = *buf;
+    uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(*buf);
     if ((word & 0xFFFFFF80) == 0) {
       *utf8_output++ = char(word);
     } else if ((word & 0xFFFFF800) == 0) {
@@ -43,8 +44,10 @@ lasx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
           // https://github.com/simdutf/simdutf/issues/92
 
   while (end - buf > std::ptrdiff_t(16 + safety_margin)) {
-    __m256i in = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m256i nextin = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32);
+    __m256i in = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m256i nextin = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32));
 
     // Check if no bits set above 16th
     if (__lasx_xbz_v(__lasx_xvpickod_h(in, nextin))) {
@@ -254,7 +257,7 @@ lasx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -290,6 +293,7 @@ lasx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   return std::make_pair(buf, reinterpret_cast<char *>(utf8_output));
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char *>
 lasx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
                                        char *utf8_out) {
@@ -299,7 +303,7 @@ lasx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
 
   // load addr align 32
   while (((uint64_t)buf & 0x1F) && buf < end) {
-    uint32_t word = *buf;
+    uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(*buf);
     if ((word & 0xFFFFFF80) == 0) {
       *utf8_output++ = char(word);
     } else if ((word & 0xFFFFF800) == 0) {
@@ -338,8 +342,10 @@ lasx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
           // https://github.com/simdutf/simdutf/issues/92
 
   while (end - buf > std::ptrdiff_t(16 + safety_margin)) {
-    __m256i in = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m256i nextin = __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32);
+    __m256i in = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m256i nextin = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(buf), 32));
 
     // Check if no bits set above 16th
     if (__lasx_xbz_v(__lasx_xvpickod_h(in, nextin))) {
@@ -553,7 +559,7 @@ lasx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
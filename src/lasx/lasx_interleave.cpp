@@ -0,0 +1,27 @@
+// Stores the bytes of the two vectors alternately: first[0], second[0],
+// first[1], second[1]...
+simdutf_really_inline void store_interleaved(const simd8<uint8_t> first,
+                                             const simd8<uint8_t> second,
+                                             uint8_t *output) {
+  // The interleaving instructions work within 128-bit lanes, so the 64-bit
+  // quarters are reordered first: the low halves of the lanes then hold the
+  // bytes 0-15 and the high halves the bytes 16-31.
+  const __m256i first_quarters = __lasx_xvpermi_d(first, 0b11011000);
+  const __m256i second_quarters = __lasx_xvpermi_d(second, 0b11011000);
+  __lasx_xvst(__lasx_xvilvl_b(second_quarters, first_quarters), output, 0);
+  __lasx_xvst(__lasx_xvilvh_b(second_quarters, first_quarters), output, 32);
+}
+
+// Splits the bytes of two consecutive vectors into those at even and those at
+// odd positions, the inverse of store_interleaved.
+simdutf_really_inline void deinterleave(const simd8<uint8_t> first,
+                                        const simd8<uint8_t> second,
+                                        simd8<uint8_t> &even,
+                                        simd8<uint8_t> &odd) {
+  // The picking instructions also work within 128-bit lanes, and leave the
+  // bytes of first and second alternating by 64-bit quarters.
+  even = simd8<uint8_t>(
+      __lasx_xvpermi_d(__lasx_xvpickev_b(second, first), 0b11011000));
+  odd = simd8<uint8_t>(
+      __lasx_xvpermi_d(__lasx_xvpickod_b(second, first), 0b11011000));
+}
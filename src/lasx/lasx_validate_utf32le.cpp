@@ -37,6 +37,7 @@ const char32_t *lasx_validate_utf32le(const char32_t *input, size_t size) {
   return input;
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 const result lasx_validate_utf32le_with_errors(const char32_t *input,
                                                size_t size) {
   const char32_t *start = input;
@@ -44,7 +45,7 @@ const result lasx_validate_utf32le_with_errors(const char32_t *input,
 
   // Performance degradation when memory address is not 32-byte aligned
   while (((uint64_t)input & 0x1F) && input < end) {
-    uint32_t word = *input;
+    uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(*input);
     if (word > 0x10FFFF) {
       return result(error_code::TOO_LARGE, input - start);
     }
@@ -61,7 +62,8 @@ const result lasx_validate_utf32le_with_errors(const char32_t *input,
   __m256i currentoffsetmax = __lasx_xvldi(0x0);
 
   while (input + 8 < end) {
-    __m256i in = __lasx_xvld(reinterpret_cast<const uint32_t *>(input), 0);
+    __m256i in = lasx_swap_utf32_if_needed<utf32_endian>(
+        __lasx_xvld(reinterpret_cast<const uint32_t *>(input), 0));
     currentmax = __lasx_xvmax_wu(in, currentmax);
     currentoffsetmax =
         __lasx_xvmax_wu(__lasx_xvadd_w(in, offset), currentoffsetmax);
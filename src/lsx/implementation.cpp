@@ -37,6 +37,16 @@ simdutf_really_inline __m128i lsx_swap_bytes(__m128i vec) {
 }
 #endif // SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_UTF32
+template <endianness utf32_endian>
+simdutf_really_inline __m128i lsx_swap_utf32_if_needed(__m128i vec) {
+  if constexpr (!match_system(utf32_endian)) {
+    vec = __lsx_vshuf4i_b(vec, 0b00011011);
+  }
+  return vec;
+}
+#endif // SIMDUTF_FEATURE_UTF32
+
 #if SIMDUTF_FEATURE_ASCII || SIMDUTF_FEATURE_DETECT_ENCODING ||                \
     SIMDUTF_FEATURE_UTF8
 simdutf_really_inline bool is_ascii(const simd8x64<uint8_t> &input) {
@@ -129,6 +139,12 @@ convert_utf8_1_to_2_byte_to_utf16(__m128i in, size_t shufutf8_idx) {
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
   #include "lsx/lsx_convert_latin1_to_utf16.cpp"
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_BASE64 ||                                                  \
+    (SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1)
+  #include "lsx/lsx_interleave.cpp"
+#endif // SIMDUTF_FEATURE_BASE64 ||
+       // (SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1)
 #if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
   #include "lsx/lsx_convert_latin1_to_utf32.cpp"
 #endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
@@ -176,6 +192,21 @@ convert_utf8_1_to_2_byte_to_utf16(__m128i in, size_t shufutf8_idx) {
   #include "generic/utf8_validation/utf8_lookup4_algorithm.h"
   #include "generic/utf8_validation/utf8_validator.h"
 #endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_DETECT_ENCODING
+#if SIMDUTF_FEATURE_UTF8
+  #include "generic/json.h"
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_BASE64
+  #include "generic/hex.h"
+#endif // SIMDUTF_FEATURE_BASE64
+#if SIMDUTF_FEATURE_LATIN1
+  #include "generic/windows1252.h"
+#endif // SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+  #include "generic/sbcs.h"
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  #include "generic/cesu8.h"
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 #if SIMDUTF_FEATURE_ASCII
   #include "generic/ascii_validation.h"
 #endif // SIMDUTF_FEATURE_ASCII
@@ -271,8 +302,63 @@ simdutf_warn_unused result implementation::validate_utf8_with_errors(
     const char *buf, size_t len) const noexcept {
   return lsx::utf8_validation::generic_validate_utf8_with_errors(buf, len);
 }
+
+simdutf_warn_unused result implementation::validate_utf8_and_index_lines(
+    const char *input, size_t length, size_t *line_positions,
+    size_t &line_count) const noexcept {
+  return lsx::utf8_validation::generic_validate_utf8_and_index_lines(
+      input, length, line_positions, line_count);
+}
+
+simdutf_warn_unused result implementation::validate_utf8_and_find_json_escape(
+    const char *input, size_t length) const noexcept {
+  return lsx::utf8_validation::generic_validate_utf8_and_find_json_escape(
+      input, length);
+}
+simdutf_warn_unused result implementation::escape_json_utf8(
+    const char *input, size_t length, char *output,
+    bool ascii_only) const noexcept {
+  return scalar::json::escape(
+      input, length, output,
+      [ascii_only](const char *in, size_t len, char *out) {
+        return json::validate_and_copy_until_escape(in, len, out,
+                                                    ascii_only);
+      });
+}
+
+simdutf_warn_unused result implementation::unescape_json_to_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::json::unescape(
+      input, length, output,
+      [](const char *in, size_t len, char *out, size_t &units) {
+        const result run =
+            json::validate_and_copy_until_escape(in, len, out, false);
+        units = run.count;
+        return run;
+      });
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused result implementation::unescape_json_to_utf16(
+    const char *input, size_t length, char16_t *output) const noexcept {
+  // The runs between the escapes are validated by the transcoding kernel.
+  return scalar::json::unescape(
+      input, length, output,
+      [this](const char *in, size_t len, char16_t *out, size_t &units) {
+        const size_t run = json::find_escape(in, len);
+  #if SIMDUTF_IS_BIG_ENDIAN
+        const result r = convert_utf8_to_utf16be_with_errors(in, run, out);
+  #else
+        const result r = convert_utf8_to_utf16le_with_errors(in, run, out);
+  #endif
+        units = r.count;
+        return r.error == error_code::SUCCESS ? result(error_code::SUCCESS, run)
+                                              : r;
+      });
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_ASCII
 simdutf_warn_unused bool
 implementation::validate_ascii(const char *buf, size_t len) const noexcept {
@@ -410,20 +496,36 @@ implementation::validate_utf32(const char32_t *buf, size_t len) const noexcept {
 #endif // SIMDUTF_FEATURE_UTF32 || SIMDUTF_FEATURE_DETECT_ENCODING
 
 #if SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused result implementation::validate_utf32_with_errors(
-    const char32_t *buf, size_t len) const noexcept {
+template <endianness utf32_endian>
+simdutf_really_inline result
+validate_utf32_with_errors_impl(const char32_t *buf, size_t len) {
   if (simdutf_unlikely(len == 0)) {
     return result(error_code::SUCCESS, 0);
   }
-  result res = lsx_validate_utf32le_with_errors(buf, len);
+  result res = lsx_validate_utf32le_with_errors<utf32_endian>(buf, len);
   if (res.count != len) {
-    result scalar_res =
-        scalar::utf32::validate_with_errors(buf + res.count, len - res.count);
+    result scalar_res = scalar::utf32::validate_with_errors<utf32_endian>(
+        buf + res.count, len - res.count);
     return result(scalar_res.error, res.count + scalar_res.count);
   } else {
     return res;
   }
 }
+
+simdutf_warn_unused result implementation::validate_utf32_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return validate_utf32_with_errors_impl<endianness::NATIVE>(buf, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32le_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return validate_utf32_with_errors_impl<endianness::LITTLE>(buf, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32be_with_errors(
+    const char32_t *buf, size_t len) const noexcept {
+  return validate_utf32_with_errors_impl<endianness::BIG>(buf, len);
+}
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -558,6 +660,30 @@ simdutf_warn_unused result implementation::convert_utf8_to_utf32_with_errors(
   return converter.convert_with_errors(buf, len, utf32_output);
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf32_with_replacement(
+    const char *input, size_t length, char32_t *utf32_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char32_t *o) {
+        return convert_utf8_to_utf32_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char32_t *o) {
+        return convert_valid_utf8_to_utf32(b, l, o);
+      },
+      input, length, utf32_output, char32_t(0xfffd));
+}
+
+simdutf_warn_unused result
+implementation::utf32_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::length_with_replacement_via(
+      [this](const char *b, size_t l) {
+        return validate_utf8_with_errors(b, l);
+      },
+      [this](const char *b, size_t l) { return utf32_length_from_utf8(b, l); },
+      input, length);
+}
+
 simdutf_warn_unused size_t implementation::convert_valid_utf8_to_utf32(
     const char *input, size_t size, char32_t *utf32_output) const noexcept {
   return utf8_to_utf32::convert_valid(input, size, utf32_output);
@@ -759,20 +885,22 @@ simdutf_warn_unused size_t implementation::convert_valid_utf16be_to_utf8(
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::convert_utf32_to_utf8(
-    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+template <endianness utf32_endian>
+simdutf_really_inline size_t
+convert_utf32_to_utf8_impl(const char32_t *buf, size_t len, char *utf8_output) {
   if (simdutf_unlikely(len == 0)) {
     return 0;
   }
   std::pair<const char32_t *, char *> ret =
-      lsx_convert_utf32_to_utf8(buf, len, utf8_output);
+      lsx_convert_utf32_to_utf8<utf32_endian>(buf, len, utf8_output);
   if (ret.first == nullptr) {
     return 0;
   }
   size_t saved_bytes = ret.second - utf8_output;
   if (ret.first != buf + len) {
-    const size_t scalar_saved_bytes = scalar::utf32_to_utf8::convert(
-        ret.first, len - (ret.first - buf), ret.second);
+    const size_t scalar_saved_bytes =
+        scalar::utf32_to_utf8::convert<utf32_endian>(
+            ret.first, len - (ret.first - buf), ret.second);
     if (scalar_saved_bytes == 0) {
       return 0;
     }
@@ -781,18 +909,36 @@ simdutf_warn_unused size_t implementation::convert_utf32_to_utf8(
   return saved_bytes;
 }
 
-simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
+simdutf_warn_unused size_t implementation::convert_utf32_to_utf8(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_impl<endianness::NATIVE>(buf, len, utf8_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf8(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_impl<endianness::LITTLE>(buf, len, utf8_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf8(
     const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_impl<endianness::BIG>(buf, len, utf8_output);
+}
+
+template <endianness utf32_endian>
+simdutf_really_inline result convert_utf32_to_utf8_with_errors_impl(
+    const char32_t *buf, size_t len, char *utf8_output) {
   if (simdutf_unlikely(len == 0)) {
     return result(error_code::SUCCESS, 0);
   }
   // ret.first.count is always the position in the buffer, not the number of
   // code units written even if finished
   std::pair<result, char *> ret =
-      lsx_convert_utf32_to_utf8_with_errors(buf, len, utf8_output);
+      lsx_convert_utf32_to_utf8_with_errors<utf32_endian>(buf, len,
+                                                          utf8_output);
   if (ret.first.count != len) {
-    result scalar_res = scalar::utf32_to_utf8::convert_with_errors(
-        buf + ret.first.count, len - ret.first.count, ret.second);
+    result scalar_res =
+        scalar::utf32_to_utf8::convert_with_errors<utf32_endian>(
+            buf + ret.first.count, len - ret.first.count, ret.second);
     if (scalar_res.error) {
       scalar_res.count += ret.first.count;
       return scalar_res;
@@ -805,6 +951,24 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
       utf8_output; // Set count to the number of 8-bit code units written
   return ret.first;
 }
+
+simdutf_warn_unused result implementation::convert_utf32_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_with_errors_impl<endianness::NATIVE>(
+      buf, len, utf8_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_with_errors_impl<endianness::LITTLE>(
+      buf, len, utf8_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf8_with_errors(
+    const char32_t *buf, size_t len, char *utf8_output) const noexcept {
+  return convert_utf32_to_utf8_with_errors_impl<endianness::BIG>(
+      buf, len, utf8_output);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -977,17 +1141,19 @@ simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf8(
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::convert_utf32_to_utf16le(
-    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+template <endianness big_endian, endianness utf32_endian>
+simdutf_really_inline size_t convert_utf32_to_utf16_impl(
+    const char32_t *buf, size_t len, char16_t *utf16_output) {
   std::pair<const char32_t *, char16_t *> ret =
-      lsx_convert_utf32_to_utf16<endianness::LITTLE>(buf, len, utf16_output);
+      lsx_convert_utf32_to_utf16<big_endian, utf32_endian>(buf, len,
+                                                           utf16_output);
   if (ret.first == nullptr) {
     return 0;
   }
   size_t saved_bytes = ret.second - utf16_output;
   if (ret.first != buf + len) {
     const size_t scalar_saved_bytes =
-        scalar::utf32_to_utf16::convert<endianness::LITTLE>(
+        scalar::utf32_to_utf16::convert<big_endian, utf32_endian>(
             ret.first, len - (ret.first - buf), ret.second);
     if (scalar_saved_bytes == 0) {
       return 0;
@@ -998,36 +1164,41 @@ simdutf_warn_unused size_t implementation::convert_utf32_to_utf16le(
   return saved_bytes;
 }
 
+simdutf_warn_unused size_t implementation::convert_utf32_to_utf16le(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::LITTLE, endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
 simdutf_warn_unused size_t implementation::convert_utf32_to_utf16be(
     const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
-  std::pair<const char32_t *, char16_t *> ret =
-      lsx_convert_utf32_to_utf16<endianness::BIG>(buf, len, utf16_output);
-  if (ret.first == nullptr) {
-    return 0;
-  }
-  size_t saved_bytes = ret.second - utf16_output;
-  if (ret.first != buf + len) {
-    const size_t scalar_saved_bytes =
-        scalar::utf32_to_utf16::convert<endianness::BIG>(
-            ret.first, len - (ret.first - buf), ret.second);
-    if (scalar_saved_bytes == 0) {
-      return 0;
-    }
-    saved_bytes += scalar_saved_bytes;
-  }
-  return saved_bytes;
+  return convert_utf32_to_utf16_impl<endianness::BIG, endianness::NATIVE>(
+      buf, len, utf16_output);
 }
 
-simdutf_warn_unused result implementation::convert_utf32_to_utf16le_with_errors(
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf16(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::NATIVE, endianness::LITTLE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf16(
     const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_impl<endianness::NATIVE, endianness::BIG>(
+      buf, len, utf16_output);
+}
+
+template <endianness big_endian, endianness utf32_endian>
+simdutf_really_inline result convert_utf32_to_utf16_with_errors_impl(
+    const char32_t *buf, size_t len, char16_t *utf16_output) {
   // ret.first.count is always the position in the buffer, not the number of
   // code units written even if finished
   std::pair<result, char16_t *> ret =
-      lsx_convert_utf32_to_utf16_with_errors<endianness::LITTLE>(buf, len,
-                                                                 utf16_output);
+      lsx_convert_utf32_to_utf16_with_errors<big_endian, utf32_endian>(
+          buf, len, utf16_output);
   if (ret.first.count != len) {
     result scalar_res =
-        scalar::utf32_to_utf16::convert_with_errors<endianness::LITTLE>(
+        scalar::utf32_to_utf16::convert_with_errors<big_endian, utf32_endian>(
             buf + ret.first.count, len - ret.first.count, ret.second);
     if (scalar_res.error) {
       scalar_res.count += ret.first.count;
@@ -1042,28 +1213,32 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf16le_with_errors(
   return ret.first;
 }
 
+simdutf_warn_unused result implementation::convert_utf32_to_utf16le_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_with_errors_impl<endianness::LITTLE,
+                                                 endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
 simdutf_warn_unused result implementation::convert_utf32_to_utf16be_with_errors(
     const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
-  // ret.first.count is always the position in the buffer, not the number of
-  // code units written even if finished
-  std::pair<result, char16_t *> ret =
-      lsx_convert_utf32_to_utf16_with_errors<endianness::BIG>(buf, len,
-                                                              utf16_output);
-  if (ret.first.count != len) {
-    result scalar_res =
-        scalar::utf32_to_utf16::convert_with_errors<endianness::BIG>(
-            buf + ret.first.count, len - ret.first.count, ret.second);
-    if (scalar_res.error) {
-      scalar_res.count += ret.first.count;
-      return scalar_res;
-    } else {
-      ret.second += scalar_res.count;
-    }
-  }
-  ret.first.count =
-      ret.second -
-      utf16_output; // Set count to the number of 8-bit code units written
-  return ret.first;
+  return convert_utf32_to_utf16_with_errors_impl<endianness::BIG,
+                                                 endianness::NATIVE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf16_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_with_errors_impl<endianness::NATIVE,
+                                                 endianness::LITTLE>(
+      buf, len, utf16_output);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf16_with_errors(
+    const char32_t *buf, size_t len, char16_t *utf16_output) const noexcept {
+  return convert_utf32_to_utf16_with_errors_impl<endianness::NATIVE,
+                                                 endianness::BIG>(
+      buf, len, utf16_output);
 }
 
 simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf16le(
@@ -1169,6 +1344,12 @@ simdutf_warn_unused size_t implementation::utf16_length_from_utf8(
   return utf8::utf16_length_from_utf8_bytemask(input, length);
 }
 simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_errors(
+    const char *input, size_t length) const noexcept {
+  return lsx::utf8_validation::generic_utf16_length_from_utf8_with_errors(
+      input, length);
+}
+simdutf_warn_unused result
 implementation::utf8_length_from_utf16le_with_replacement(
     const char16_t *input, size_t length) const noexcept {
   return scalar::utf16::utf8_length_from_utf16_with_replacement<
@@ -1202,6 +1383,45 @@ implementation::convert_utf16be_to_utf8_with_replacement(
       input, length, utf8_buffer);
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16le_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_utf8_to_utf16le_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_valid_utf8_to_utf16le(b, l, o);
+      },
+      input, length, utf16_output,
+      char16_t(scalar::utf16::swap_if_needed<endianness::LITTLE>(0xfffd)));
+}
+
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16be_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_utf8_to_utf16be_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_valid_utf8_to_utf16be(b, l, o);
+      },
+      input, length, utf16_output,
+      char16_t(scalar::utf16::swap_if_needed<endianness::BIG>(0xfffd)));
+}
+
+simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::length_with_replacement_via(
+      [this](const char *b, size_t l) {
+        return validate_utf8_with_errors(b, l);
+      },
+      [this](const char *b, size_t l) { return utf16_length_from_utf8(b, l); },
+      input, length);
+}
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -1209,23 +1429,50 @@ simdutf_warn_unused size_t implementation::utf8_length_from_utf32(
     const char32_t *input, size_t length) const noexcept {
   return utf32::utf8_length_from_utf32(input, length);
 }
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32le(
+    const char32_t *input, size_t length) const noexcept {
+  return utf32::utf8_length_from_utf32<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32be(
+    const char32_t *input, size_t length) const noexcept {
+  return utf32::utf8_length_from_utf32<endianness::BIG>(input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
-    const char32_t *input, size_t length) const noexcept {
+template <endianness utf32_endian>
+simdutf_really_inline size_t
+utf16_length_from_utf32_impl(const char32_t *input, size_t length) {
   const __m128i v_ffff = lsx_splat_u32(0x0000ffff);
   size_t pos = 0;
   size_t count = 0;
   for (; pos + 4 <= length; pos += 4) {
-    __m128i in = __lsx_vld(reinterpret_cast<const uint32_t *>(input + pos), 0);
+    __m128i in = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(input + pos), 0));
     const __m128i surrogate_bytemask = __lsx_vslt_wu(v_ffff, in);
     size_t surrogate_count = __lsx_vpickve2gr_bu(
         __lsx_vpcnt_b(__lsx_vmskltz_w(surrogate_bytemask)), 0);
     count += 4 + surrogate_count;
   }
-  return count +
-         scalar::utf32::utf16_length_from_utf32(input + pos, length - pos);
+  return count + scalar::utf32::utf16_length_from_utf32<utf32_endian>(
+                     input + pos, length - pos);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
+    const char32_t *input, size_t length) const noexcept {
+  return utf16_length_from_utf32_impl<endianness::NATIVE>(input, length);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32le(
+    const char32_t *input, size_t length) const noexcept {
+  return utf16_length_from_utf32_impl<endianness::LITTLE>(input, length);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32be(
+    const char32_t *input, size_t length) const noexcept {
+  return utf16_length_from_utf32_impl<endianness::BIG>(input, length);
 }
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
@@ -1234,8 +1481,46 @@ simdutf_warn_unused size_t implementation::utf32_length_from_utf8(
     const char *input, size_t length) const noexcept {
   return utf8::count_code_points(input, length);
 }
+simdutf_warn_unused result
+implementation::utf32_length_from_utf8_with_errors(
+    const char *input, size_t length) const noexcept {
+  return lsx::utf8_validation::generic_utf32_length_from_utf8_with_errors(
+      input, length);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused const char *
+implementation::find_c1_control(const char *start,
+                                const char *end) const noexcept {
+  return windows1252::find_c1(start, end);
+}
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused const char *
+implementation::find_cesu8_special(const char *start, const char *end,
+                                   bool modified) const noexcept {
+  return modified ? cesu8::find_special<true>(start, end)
+                  : cesu8::find_special<false>(start, end);
+}
+
+simdutf_warn_unused const char16_t *
+implementation::find_cesu8_special(const char16_t *start, const char16_t *end,
+                                   bool modified) const noexcept {
+  return modified ? cesu8::find_special<true>(start, end)
+                  : cesu8::find_special<false>(start, end);
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused size_t implementation::convert_sbcs_to_utf16(
+    const char *input, size_t length, const char16_t *table,
+    char16_t *utf16_output) const noexcept {
+  return sbcs::convert(input, length, table, utf16_output);
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_BASE64
 simdutf_warn_unused result implementation::base64_to_binary(
     const char *input, size_t length, char *output, base64_options options,
@@ -1384,6 +1669,22 @@ const char16_t *implementation::find(const char16_t *start, const char16_t *end,
   return util_find(start, end, character);
 }
 
+size_t implementation::binary_to_hex(const char *input, size_t length,
+                                     char *output,
+                                     hex_options options) const noexcept {
+  return hex::encode(input, length, output, options);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char *input, size_t length, char *output) const noexcept {
+  return hex::decode(input, length, output);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char16_t *input, size_t length, char *output) const noexcept {
+  return hex::decode(input, length, output);
+}
+
 simdutf_warn_unused size_t implementation::binary_length_from_base64(
     const char *input, size_t length) const noexcept {
   return base64_lengths::binary_length_from_base64(input, length);
@@ -1,4 +1,4 @@
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char16_t *>
 lsx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                            char16_t *utf16_out) {
@@ -9,8 +9,10 @@ lsx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   __m128i v_d800 = lsx_splat_u16(0xd800);
   __m128i v_dfff = lsx_splat_u16(0xdfff);
   while (end - buf >= 8) {
-    __m128i in0 = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m128i in1 = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16);
+    __m128i in0 = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m128i in1 = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16));
 
     // Check if no bits set above 16th
     if (__lsx_bz_v(__lsx_vpickod_h(in1, in0))) {
@@ -34,7 +36,7 @@ lsx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
@@ -73,7 +75,7 @@ lsx_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   return std::make_pair(buf, reinterpret_cast<char16_t *>(utf16_output));
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char16_t *>
 lsx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
                                        char16_t *utf16_out) {
@@ -86,8 +88,10 @@ lsx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
   __m128i v_dfff = lsx_splat_u16(0xdfff);
 
   while (end - buf >= 8) {
-    __m128i in0 = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m128i in1 = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16);
+    __m128i in0 = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m128i in1 = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16));
     // Check if no bits set above 16th
     if (__lsx_bz_v(__lsx_vpickod_h(in1, in0))) {
       __m128i utf16_packed = __lsx_vpickev_h(in1, in0);
@@ -116,7 +120,7 @@ lsx_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
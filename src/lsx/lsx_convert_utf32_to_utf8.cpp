@@ -1,3 +1,4 @@
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char *>
 lsx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   uint8_t *utf8_output = reinterpret_cast<uint8_t *>(utf8_out);
@@ -14,8 +15,10 @@ lsx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
           // https://github.com/simdutf/simdutf/issues/92
 
   while (end - buf > std::ptrdiff_t(16 + safety_margin)) {
-    __m128i in = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m128i nextin = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16);
+    __m128i in = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m128i nextin = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16));
 
     // Check if no bits set above 16th
     if (__lsx_bz_v(__lsx_vpickod_h(in, nextin))) {
@@ -189,7 +192,7 @@ lsx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -226,6 +229,7 @@ lsx_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_out) {
   return std::make_pair(buf, reinterpret_cast<char *>(utf8_output));
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char *>
 lsx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
                                       char *utf8_out) {
@@ -243,8 +247,10 @@ lsx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
           // https://github.com/simdutf/simdutf/issues/92
 
   while (end - buf > std::ptrdiff_t(16 + safety_margin)) {
-    __m128i in = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0);
-    __m128i nextin = __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16);
+    __m128i in = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 0));
+    __m128i nextin = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(buf), 16));
 
     // Check if no bits set above 16th
     if (__lsx_bz_v(__lsx_vpickod_h(in, nextin))) {
@@ -423,7 +429,7 @@ lsx_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -0,0 +1,18 @@
+// Stores the bytes of the two vectors alternately: first[0], second[0],
+// first[1], second[1]...
+simdutf_really_inline void store_interleaved(const simd8<uint8_t> first,
+                                             const simd8<uint8_t> second,
+                                             uint8_t *output) {
+  __lsx_vst(__lsx_vilvl_b(second, first), output, 0);
+  __lsx_vst(__lsx_vilvh_b(second, first), output, 16);
+}
+
+// Splits the bytes of two consecutive vectors into those at even and those at
+// odd positions, the inverse of store_interleaved.
+simdutf_really_inline void deinterleave(const simd8<uint8_t> first,
+                                        const simd8<uint8_t> second,
+                                        simd8<uint8_t> &even,
+                                        simd8<uint8_t> &odd) {
+  even = simd8<uint8_t>(__lsx_vpickev_b(second, first));
+  odd = simd8<uint8_t>(__lsx_vpickod_b(second, first));
+}
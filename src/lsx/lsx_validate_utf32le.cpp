@@ -32,6 +32,7 @@ const char32_t *lsx_validate_utf32le(const char32_t *input, size_t size) {
   return input;
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 const result lsx_validate_utf32le_with_errors(const char32_t *input,
                                               size_t size) {
   const char32_t *start = input;
@@ -44,7 +45,8 @@ const result lsx_validate_utf32le_with_errors(const char32_t *input,
   __m128i currentoffsetmax = lsx_splat_u32(0);
 
   while (input + 4 < end) {
-    __m128i in = __lsx_vld(reinterpret_cast<const uint32_t *>(input), 0);
+    __m128i in = lsx_swap_utf32_if_needed<utf32_endian>(
+        __lsx_vld(reinterpret_cast<const uint32_t *>(input), 0));
     currentmax = __lsx_vmax_wu(in, currentmax);
     currentoffsetmax =
         __lsx_vmax_wu(__lsx_vadd_w(in, offset), currentoffsetmax);
@@ -4,7 +4,8 @@ struct utf32_to_utf16_t {
   char16_t *output;
 };
 
-template <endianness big_endian, ErrorReporting er>
+template <endianness big_endian, ErrorReporting er,
+          endianness utf32_endian = endianness::NATIVE>
 utf32_to_utf16_t ppc64_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                                               char16_t *utf16_output) {
 
@@ -16,8 +17,12 @@ utf32_to_utf16_t ppc64_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   auto forbidden_global = simd16<bool>();
 
   while (end - buf >= 8) {
-    const auto in0 = vector_u32::load(buf);
-    const auto in1 = vector_u32::load(buf + vector_u32::ELEMENTS);
+    auto in0 = vector_u32::load(buf);
+    auto in1 = vector_u32::load(buf + vector_u32::ELEMENTS);
+    if constexpr (!match_system(utf32_endian)) {
+      in0 = in0.swap_bytes();
+      in1 = in1.swap_bytes();
+    }
 
     const auto any_surrogate = ((in0 | in1) & v_ffff0000) != zero;
 
@@ -76,7 +81,7 @@ utf32_to_utf16_t ppc64_convert_utf32_to_utf16(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
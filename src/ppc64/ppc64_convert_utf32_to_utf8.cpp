@@ -4,7 +4,7 @@ struct utf32_to_utf8_t {
   char *output;
 };
 
-template <ErrorReporting er>
+template <ErrorReporting er, endianness utf32_endian = endianness::NATIVE>
 utf32_to_utf8_t ppc64_convert_utf32_to_utf8(const char32_t *buf, size_t len,
                                             char *utf8_output) {
   const char32_t *end = buf + len;
@@ -28,6 +28,10 @@ utf32_to_utf8_t ppc64_convert_utf32_to_utf8(const char32_t *buf, size_t len,
     // These two values can hold only 8 UTF32 chars
     auto in0 = vector_u32::load(buf);
     auto in1 = vector_u32::load(buf + vector_u32::ELEMENTS);
+    if constexpr (!match_system(utf32_endian)) {
+      in0 = in0.swap_bytes();
+      in1 = in1.swap_bytes();
+    }
 
     // Pack 32-bit UTF-32 code units to 16-bit UTF-16 code units with unsigned
     // saturation
@@ -43,8 +47,12 @@ utf32_to_utf8_t ppc64_convert_utf32_to_utf8(const char32_t *buf, size_t len,
     // requires a total of 64 bytes of input. If we fail, we just pass thirdin
     // and fourthin as our new inputs.
     if (in.is_ascii()) { // if the first two blocks are ASCII
-      const auto in2 = vector_u32::load(buf + 2 * vector_u32::ELEMENTS);
-      const auto in3 = vector_u32::load(buf + 3 * vector_u32::ELEMENTS);
+      auto in2 = vector_u32::load(buf + 2 * vector_u32::ELEMENTS);
+      auto in3 = vector_u32::load(buf + 3 * vector_u32::ELEMENTS);
+      if constexpr (!match_system(utf32_endian)) {
+        in2 = in2.swap_bytes();
+        in3 = in3.swap_bytes();
+      }
 
       const auto next = vector_u32::pack(in2, in3);
       if (next.is_ascii()) {
@@ -124,7 +132,7 @@ utf32_to_utf8_t ppc64_convert_utf32_to_utf8(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -0,0 +1,27 @@
+// Stores the bytes of the two vectors alternately: first[0], second[0],
+// first[1], second[1]...
+simdutf_really_inline void store_interleaved(const simd8<uint8_t> first,
+                                             const simd8<uint8_t> second,
+                                             uint8_t *output) {
+  const vec_u8_t perm_lo = {0, 16, 1, 17, 2, 18, 3, 19,
+                            4, 20, 5, 21, 6, 22, 7, 23};
+  const vec_u8_t perm_hi = {8,  24, 9,  25, 10, 26, 11, 27,
+                            12, 28, 13, 29, 14, 30, 15, 31};
+  simd8<uint8_t>(vec_perm(first.value, second.value, perm_lo)).store(output);
+  simd8<uint8_t>(vec_perm(first.value, second.value, perm_hi))
+      .store(output + 16);
+}
+
+// Splits the bytes of two consecutive vectors into those at even and those at
+// odd positions, the inverse of store_interleaved.
+simdutf_really_inline void deinterleave(const simd8<uint8_t> first,
+                                        const simd8<uint8_t> second,
+                                        simd8<uint8_t> &even,
+                                        simd8<uint8_t> &odd) {
+  const vec_u8_t perm_even = {0,  2,  4,  6,  8,  10, 12, 14,
+                              16, 18, 20, 22, 24, 26, 28, 30};
+  const vec_u8_t perm_odd = {1,  3,  5,  7,  9,  11, 13, 15,
+                             17, 19, 21, 23, 25, 27, 29, 31};
+  even = simd8<uint8_t>(vec_perm(first.value, second.value, perm_even));
+  odd = simd8<uint8_t>(vec_perm(first.value, second.value, perm_odd));
+}
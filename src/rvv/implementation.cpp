@@ -35,6 +35,7 @@ namespace SIMDUTF_IMPLEMENTATION {
 #if SIMDUTF_FEATURE_BASE64
   #include "rvv/rvv_base64.cpp"
   #include "rvv/rvv_find.cpp"
+  #include "rvv/rvv_hex.cpp"
 #endif // SIMDUTF_FEATURE_BASE64
 
 #if SIMDUTF_FEATURE_UTF16
@@ -66,6 +67,88 @@ implementation::detect_encodings(const char *input,
 }
 #endif // SIMDUTF_FEATURE_DETECT_ENCODING
 
+#if SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused const char *
+implementation::find_c1_control(const char *start,
+                                const char *end) const noexcept {
+  const char *src = start;
+  for (size_t len = end - start, vl; len > 0; len -= vl, src += vl) {
+    vl = __riscv_vsetvl_e8m8(len);
+    vuint8m8_t v = __riscv_vle8_v_u8m8((uint8_t *)src, vl);
+    v = __riscv_vsub_vx_u8m8(v, 0x80, vl);
+    long idx =
+        __riscv_vfirst_m_b1(__riscv_vmsltu_vx_u8m8_b1(v, 0x20, vl), vl);
+    if (idx >= 0)
+      return src + idx;
+  }
+  return end;
+}
+#endif // SIMDUTF_FEATURE_LATIN1
+
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused const char *
+implementation::find_cesu8_special(const char *start, const char *end,
+                                   bool modified) const noexcept {
+  const char *src = start;
+  for (size_t len = end - start, vl; len > 0; len -= vl, src += vl) {
+    vl = __riscv_vsetvl_e8m8(len);
+    vuint8m8_t v = __riscv_vle8_v_u8m8((uint8_t *)src, vl);
+    vbool1_t special = __riscv_vmsgeu_vx_u8m8_b1(v, 0xf0, vl);
+    if (modified) {
+      special = __riscv_vmor_mm_b1(
+          special, __riscv_vmseq_vx_u8m8_b1(v, 0, vl), vl);
+    }
+    long idx = __riscv_vfirst_m_b1(special, vl);
+    if (idx >= 0)
+      return src + idx;
+  }
+  return end;
+}
+
+simdutf_warn_unused const char16_t *
+implementation::find_cesu8_special(const char16_t *start, const char16_t *end,
+                                   bool modified) const noexcept {
+  const char16_t *src = start;
+  for (size_t len = end - start, vl; len > 0; len -= vl, src += vl) {
+    vl = __riscv_vsetvl_e16m8(len);
+    vuint16m8_t v = __riscv_vle16_v_u16m8((const uint16_t *)src, vl);
+    vbool2_t special = __riscv_vmsltu_vx_u16m8_b2(
+        __riscv_vsub_vx_u16m8(v, 0xd800, vl), 0x800, vl);
+    if (modified) {
+      special = __riscv_vmor_mm_b2(
+          special, __riscv_vmseq_vx_u16m8_b2(v, 0, vl), vl);
+    }
+    long idx = __riscv_vfirst_m_b2(special, vl);
+    if (idx >= 0)
+      return src + idx;
+  }
+  return end;
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+simdutf_warn_unused size_t implementation::convert_sbcs_to_utf16(
+    const char *input, size_t length, const char16_t *table,
+    char16_t *utf16_output) const noexcept {
+  const char *src = input;
+  char16_t *dst = utf16_output;
+  for (size_t len = length, vl; len > 0; len -= vl, src += vl, dst += vl) {
+    vl = __riscv_vsetvl_e8m4(len);
+    vuint8m4_t v = __riscv_vle8_v_u8m4((uint8_t *)src, vl);
+    vuint16m8_t units = __riscv_vzext_vf2_u16m8(v, vl);
+    // The bytes 0x80 to 0xFF are replaced by the code units at their offsets
+    // in the table.
+    vbool2_t high = __riscv_vmsgeu_vx_u8m4_b2(v, 0x80, vl);
+    vuint16m8_t offsets = __riscv_vsll_vx_u16m8(
+        __riscv_vand_vx_u16m8(units, 0x7f, vl), 1, vl);
+    units = __riscv_vluxei16_v_u16m8_mu(high, units, (const uint16_t *)table,
+                                        offsets, vl);
+    __riscv_vse16_v_u16m8((uint16_t *)dst, units, vl);
+  }
+  return length;
+}
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+
 #if SIMDUTF_FEATURE_BASE64
 simdutf_warn_unused result implementation::base64_to_binary(
     const char *input, size_t length, char *output, base64_options options,
@@ -146,6 +229,45 @@ implementation::convert_utf16be_to_utf8_with_replacement(
       input, length, utf8_buffer);
 }
 
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16le_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_utf8_to_utf16le_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_valid_utf8_to_utf16le(b, l, o);
+      },
+      input, length, utf16_output,
+      char16_t(scalar::utf16::swap_if_needed<endianness::LITTLE>(0xfffd)));
+}
+
+simdutf_warn_unused size_t
+implementation::convert_utf8_to_utf16be_with_replacement(
+    const char *input, size_t length, char16_t *utf16_output) const noexcept {
+  return scalar::utf8::convert_with_replacement_via(
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_utf8_to_utf16be_with_errors(b, l, o);
+      },
+      [this](const char *b, size_t l, char16_t *o) {
+        return convert_valid_utf8_to_utf16be(b, l, o);
+      },
+      input, length, utf16_output,
+      char16_t(scalar::utf16::swap_if_needed<endianness::BIG>(0xfffd)));
+}
+
+simdutf_warn_unused result
+implementation::utf16_length_from_utf8_with_replacement(
+    const char *input, size_t length) const noexcept {
+  return scalar::utf8::length_with_replacement_via(
+      [this](const char *b, size_t l) {
+        return validate_utf8_with_errors(b, l);
+      },
+      [this](const char *b, size_t l) { return utf16_length_from_utf8(b, l); },
+      input, length);
+}
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 } // namespace SIMDUTF_IMPLEMENTATION
@@ -0,0 +1,100 @@
+size_t encode_hex(const char *input, size_t length, char *output,
+                  hex_options options) {
+  const uint8_t *table = reinterpret_cast<const uint8_t *>(
+      options == hex_options::hex_uppercase ? scalar::hex::upper_digits
+                                            : scalar::hex::lower_digits);
+  const uint8_t *src = reinterpret_cast<const uint8_t *>(input);
+  uint8_t *dst = reinterpret_cast<uint8_t *>(output);
+  for (size_t pos = 0, vl; pos < length; pos += vl) {
+    vl = __riscv_vsetvl_e8m4(length - pos);
+    const vuint8m4_t bytes = __riscv_vle8_v_u8m4(src + pos, vl);
+    const vuint8m4_t high =
+        __riscv_vluxei8_v_u8m4(table, __riscv_vsrl_vx_u8m4(bytes, 4, vl), vl);
+    const vuint8m4_t low = __riscv_vluxei8_v_u8m4(
+        table, __riscv_vand_vx_u8m4(bytes, 0x0f, vl), vl);
+    // 2-way interleaved store
+    __riscv_vsse8_v_u8m4(dst + 2 * pos, 2, high, vl);
+    __riscv_vsse8_v_u8m4(dst + 2 * pos + 1, 2, low, vl);
+  }
+  return 2 * length;
+}
+
+// Replaces the digits by their values and adds the other bytes to invalid.
+simdutf_really_inline vuint8m4_t hex_digit_values(const vuint8m4_t digits,
+                                                  vbool2_t &invalid,
+                                                  size_t vl) {
+  const vuint8m4_t decimal = __riscv_vsub_vx_u8m4(digits, '0', vl);
+  const vuint8m4_t lower =
+      __riscv_vsub_vx_u8m4(__riscv_vor_vx_u8m4(digits, 0x20, vl), 'a', vl);
+  const vbool2_t is_decimal = __riscv_vmsltu_vx_u8m4_b2(decimal, 10, vl);
+  const vbool2_t is_letter = __riscv_vmsltu_vx_u8m4_b2(lower, 6, vl);
+  invalid = __riscv_vmor_mm_b2(
+      invalid, __riscv_vmnor_mm_b2(is_decimal, is_letter, vl), vl);
+  return __riscv_vmerge_vvm_u8m4(
+      decimal, __riscv_vadd_vx_u8m4(lower, 10, vl), is_letter, vl);
+}
+
+// 2-way deinterleaved loads of the digits of the high and of the low nibbles.
+simdutf_really_inline void load_hex_digits(const char *input, vuint8m4_t &high,
+                                           vuint8m4_t &low, vbool2_t &invalid,
+                                           size_t vl) {
+  const uint8_t *src = reinterpret_cast<const uint8_t *>(input);
+  high = __riscv_vlse8_v_u8m4(src, 2, vl);
+  low = __riscv_vlse8_v_u8m4(src + 1, 2, vl);
+  invalid = __riscv_vmclr_m_b2(vl);
+}
+
+// Code units above 0xff are not narrowed, so they are marked as invalid here.
+simdutf_really_inline void load_hex_digits(const char16_t *input,
+                                           vuint8m4_t &high, vuint8m4_t &low,
+                                           vbool2_t &invalid, size_t vl) {
+  const uint16_t *src = reinterpret_cast<const uint16_t *>(input);
+  const vuint16m8_t high_units = __riscv_vlse16_v_u16m8(src, 4, vl);
+  const vuint16m8_t low_units = __riscv_vlse16_v_u16m8(src + 1, 4, vl);
+  invalid = __riscv_vmor_mm_b2(__riscv_vmsgtu_vx_u16m8_b2(high_units, 0xff, vl),
+                               __riscv_vmsgtu_vx_u16m8_b2(low_units, 0xff, vl),
+                               vl);
+  high = __riscv_vncvt_x_x_w_u8m4(high_units, vl);
+  low = __riscv_vncvt_x_x_w_u8m4(low_units, vl);
+}
+
+template <typename char_type>
+result decode_hex(const char_type *input, size_t length, char *output) {
+  const size_t pairs = length / 2;
+  size_t pos = 0;
+  for (size_t vl; pos < pairs; pos += vl) {
+    vl = __riscv_vsetvl_e8m4(pairs - pos);
+    vuint8m4_t high, low;
+    vbool2_t invalid;
+    load_hex_digits(input + 2 * pos, high, low, invalid, vl);
+    high = hex_digit_values(high, invalid, vl);
+    low = hex_digit_values(low, invalid, vl);
+    if (__riscv_vfirst_m_b2(invalid, vl) >= 0) {
+      break;
+    }
+    __riscv_vse8_v_u8m4(
+        reinterpret_cast<uint8_t *>(output + pos),
+        __riscv_vor_vv_u8m4(__riscv_vsll_vx_u8m4(high, 4, vl), low, vl), vl);
+  }
+  // The scalar code finds the error and writes the pairs before it.
+  result r =
+      scalar::hex::decode(input + 2 * pos, length - 2 * pos, output + pos);
+  r.count += r.error == error_code::INVALID_HEX_CHARACTER ? 2 * pos : pos;
+  return r;
+}
+
+size_t implementation::binary_to_hex(const char *input, size_t length,
+                                     char *output,
+                                     hex_options options) const noexcept {
+  return encode_hex(input, length, output, options);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char *input, size_t length, char *output) const noexcept {
+  return decode_hex(input, length, output);
+}
+
+simdutf_warn_unused result implementation::hex_to_binary(
+    const char16_t *input, size_t length, char *output) const noexcept {
+  return decode_hex(input, length, output);
+}
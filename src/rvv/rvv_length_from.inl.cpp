@@ -38,6 +38,17 @@ simdutf_warn_unused size_t implementation::utf32_length_from_utf8(
 }
 #endif // SIMDUTF_FEATURE_UTF8 || SIMDUTF_FEATURE_UTF32
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+simdutf_warn_unused result implementation::utf32_length_from_utf8_with_errors(
+    const char *src, size_t len) const noexcept {
+  const result r = validate_utf8_with_errors(src, len);
+  if (r.error != error_code::SUCCESS) {
+    return r;
+  }
+  return result(error_code::SUCCESS, utf32_length_from_utf8(src, len));
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
+
 #if SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_UTF32
 template <simdutf_ByteFlip bflip>
 simdutf_really_inline static size_t
@@ -117,12 +128,14 @@ simdutf_warn_unused size_t implementation::utf8_length_from_utf16be(
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::utf8_length_from_utf32(
-    const char32_t *src, size_t len) const noexcept {
+template <simdutf_ByteFlip bflip>
+simdutf_really_inline static size_t
+rvv_utf8_length_from_utf32(const char32_t *src, size_t len) {
   size_t count = 0;
   for (size_t vl; len > 0; len -= vl, src += vl) {
     vl = __riscv_vsetvl_e32m8(len);
     vuint32m8_t v = __riscv_vle32_v_u32m8((uint32_t *)src, vl);
+    v = simdutf_byteflip<bflip>(v, vl);
     vbool4_t m234 = __riscv_vmsgtu_vx_u32m8_b4(v, 0x7F, vl);
     vbool4_t m34 = __riscv_vmsgtu_vx_u32m8_b4(v, 0x7FF, vl);
     vbool4_t m4 = __riscv_vmsgtu_vx_u32m8_b4(v, 0xFFFF, vl);
@@ -131,6 +144,24 @@ simdutf_warn_unused size_t implementation::utf8_length_from_utf32(
   }
   return count;
 }
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32(
+    const char32_t *src, size_t len) const noexcept {
+  return rvv_utf8_length_from_utf32<simdutf_ByteFlip::NONE>(src, len);
+}
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32le(
+    const char32_t *src, size_t len) const noexcept {
+  return rvv_utf8_length_from_utf32<simdutf_ByteFlip::NONE>(src, len);
+}
+
+simdutf_warn_unused size_t implementation::utf8_length_from_utf32be(
+    const char32_t *src, size_t len) const noexcept {
+  if (supports_zvbb())
+    return rvv_utf8_length_from_utf32<simdutf_ByteFlip::ZVBB>(src, len);
+  else
+    return rvv_utf8_length_from_utf32<simdutf_ByteFlip::V>(src, len);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
@@ -147,18 +178,47 @@ simdutf_warn_unused size_t implementation::utf16_length_from_utf8(
   }
   return count;
 }
+
+simdutf_warn_unused result implementation::utf16_length_from_utf8_with_errors(
+    const char *src, size_t len) const noexcept {
+  const result r = validate_utf8_with_errors(src, len);
+  if (r.error != error_code::SUCCESS) {
+    return r;
+  }
+  return result(error_code::SUCCESS, utf16_length_from_utf8(src, len));
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
-    const char32_t *src, size_t len) const noexcept {
+template <simdutf_ByteFlip bflip>
+simdutf_really_inline static size_t
+rvv_utf16_length_from_utf32(const char32_t *src, size_t len) {
   size_t count = 0;
   for (size_t vl; len > 0; len -= vl, src += vl) {
     vl = __riscv_vsetvl_e32m8(len);
     vuint32m8_t v = __riscv_vle32_v_u32m8((uint32_t *)src, vl);
+    v = simdutf_byteflip<bflip>(v, vl);
     vbool4_t m4 = __riscv_vmsgtu_vx_u32m8_b4(v, 0xFFFF, vl);
     count += vl + __riscv_vcpop_m_b4(m4, vl);
   }
   return count;
 }
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32(
+    const char32_t *src, size_t len) const noexcept {
+  return rvv_utf16_length_from_utf32<simdutf_ByteFlip::NONE>(src, len);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32le(
+    const char32_t *src, size_t len) const noexcept {
+  return rvv_utf16_length_from_utf32<simdutf_ByteFlip::NONE>(src, len);
+}
+
+simdutf_warn_unused size_t implementation::utf16_length_from_utf32be(
+    const char32_t *src, size_t len) const noexcept {
+  if (supports_zvbb())
+    return rvv_utf16_length_from_utf32<simdutf_ByteFlip::ZVBB>(src, len);
+  else
+    return rvv_utf16_length_from_utf32<simdutf_ByteFlip::V>(src, len);
+}
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
@@ -57,8 +57,11 @@ void rvv_to_well_formed_utf16(const char16_t *in, size_t n, char16_t *out) {
   if (n == 0)
     return;
 
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
   n -= 1;
   in += 1;
   out += 1;
@@ -76,9 +79,9 @@ void rvv_to_well_formed_utf16(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_block_rvv<big_endian, false, false>(out, in, n);
   }
 
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
 
 void implementation::to_well_formed_utf16le(const char16_t *input, size_t len,
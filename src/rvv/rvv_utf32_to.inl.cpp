@@ -31,7 +31,8 @@ simdutf_warn_unused size_t implementation::convert_valid_utf32_to_latin1(
 #endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
-template <bool with_validation>
+template <bool with_validation,
+          simdutf_ByteFlip bflip = simdutf_ByteFlip::NONE>
 simdutf_warn_unused result convert_utf32_to_utf8_aux(const char32_t *src,
                                                      size_t len,
                                                      char *dst) noexcept {
@@ -46,6 +47,7 @@ simdutf_warn_unused result convert_utf32_to_utf8_aux(const char32_t *src,
     vl = __riscv_vsetvl_e32m4(n);
 
     vuint32m4_t v = __riscv_vle32_v_u32m4((uint32_t const *)src, vl);
+    v = simdutf_byteflip<bflip>(v, vl);
     vbool8_t m234 = __riscv_vmsgtu_vx_u32m4_b8(v, 0x80 - 1, vl);
     vuint16m2_t vn = __riscv_vncvt_x_x_w_u16m2(v, vl);
 
@@ -155,7 +157,7 @@ simdutf_warn_unused result convert_utf32_to_utf8_aux(const char32_t *src,
 
     if (tail)
       while (n) {
-        uint32_t word = src[0];
+        uint32_t word = simdutf_byteflip<bflip>(uint32_t(src[0]));
         if (word < 0x10000)
           break;
         if (word > 0x10FFFF)
@@ -190,10 +192,40 @@ simdutf_warn_unused size_t implementation::convert_valid_utf32_to_utf8(
   const auto res = convert_utf32_to_utf8_aux<with_validation>(src, len, dst);
   return res.count;
 }
+
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf8(
+    const char32_t *src, size_t len, char *dst) const noexcept {
+  result res = convert_utf32le_to_utf8_with_errors(src, len, dst);
+  return res.error == error_code::SUCCESS ? res.count : 0;
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf8(
+    const char32_t *src, size_t len, char *dst) const noexcept {
+  result res = convert_utf32be_to_utf8_with_errors(src, len, dst);
+  return res.error == error_code::SUCCESS ? res.count : 0;
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf8_with_errors(
+    const char32_t *src, size_t len, char *dst) const noexcept {
+  constexpr bool with_validation = true;
+  return convert_utf32_to_utf8_aux<with_validation>(src, len, dst);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf8_with_errors(
+    const char32_t *src, size_t len, char *dst) const noexcept {
+  constexpr bool with_validation = true;
+  if (supports_zvbb())
+    return convert_utf32_to_utf8_aux<with_validation, simdutf_ByteFlip::ZVBB>(
+        src, len, dst);
+  else
+    return convert_utf32_to_utf8_aux<with_validation, simdutf_ByteFlip::V>(
+        src, len, dst);
+}
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
-template <simdutf_ByteFlip bflip>
+template <simdutf_ByteFlip bflip,
+          simdutf_ByteFlip utf32_bflip = simdutf_ByteFlip::NONE>
 simdutf_really_inline static result
 rvv_convert_utf32_to_utf16_with_errors(const char32_t *src, size_t len,
                                        char16_t *dst) {
@@ -205,6 +237,7 @@ rvv_convert_utf32_to_utf16_with_errors(const char32_t *src, size_t len,
   for (size_t vl, vlOut; len > 0; len -= vl, src += vl, dst += vlOut) {
     vl = __riscv_vsetvl_e32m4(len);
     vuint32m4_t v = __riscv_vle32_v_u32m4((uint32_t *)src, vl);
+    v = simdutf_byteflip<utf32_bflip>(v, vl);
     vuint32m4_t off = __riscv_vadd_vx_u32m4(v, 0xFFFF2000, vl);
     const long err_surrogate_idx = __riscv_vfirst_m_b8(
         __riscv_vmsgtu_vx_u32m4_b8(off, 0xFFFFF7FF, vl), vl);
@@ -266,6 +299,36 @@ simdutf_warn_unused result implementation::convert_utf32_to_utf16be_with_errors(
                                                                        dst);
 }
 
+simdutf_warn_unused size_t implementation::convert_utf32le_to_utf16(
+    const char32_t *src, size_t len, char16_t *dst) const noexcept {
+  result res = convert_utf32le_to_utf16_with_errors(src, len, dst);
+  return res.error == error_code::SUCCESS ? res.count : 0;
+}
+
+simdutf_warn_unused size_t implementation::convert_utf32be_to_utf16(
+    const char32_t *src, size_t len, char16_t *dst) const noexcept {
+  result res = convert_utf32be_to_utf16_with_errors(src, len, dst);
+  return res.error == error_code::SUCCESS ? res.count : 0;
+}
+
+simdutf_warn_unused result implementation::convert_utf32le_to_utf16_with_errors(
+    const char32_t *src, size_t len, char16_t *dst) const noexcept {
+  return rvv_convert_utf32_to_utf16_with_errors<simdutf_ByteFlip::NONE>(
+      src, len, dst);
+}
+
+simdutf_warn_unused result implementation::convert_utf32be_to_utf16_with_errors(
+    const char32_t *src, size_t len, char16_t *dst) const noexcept {
+  if (supports_zvbb())
+    return rvv_convert_utf32_to_utf16_with_errors<simdutf_ByteFlip::NONE,
+                                                  simdutf_ByteFlip::ZVBB>(
+        src, len, dst);
+  else
+    return rvv_convert_utf32_to_utf16_with_errors<simdutf_ByteFlip::NONE,
+                                                  simdutf_ByteFlip::V>(src, len,
+                                                                       dst);
+}
+
 template <simdutf_ByteFlip bflip>
 simdutf_really_inline static size_t
 rvv_convert_valid_utf32_to_utf16(const char32_t *src, size_t len,
@@ -151,8 +151,74 @@ simdutf_warn_unused result implementation::validate_utf8_with_errors(
   result res = scalar::utf8::validate_with_errors(src + count, len - count);
   return result(res.error, count + res.count);
 }
+
+simdutf_warn_unused result implementation::validate_utf8_and_index_lines(
+    const char *src, size_t len, size_t *line_positions,
+    size_t &line_count) const noexcept {
+  const size_t capacity = line_count;
+  line_count = 0;
+  const result r = validate_utf8_with_errors(src, len);
+  const size_t end = r.error == error_code::SUCCESS ? len : r.count;
+  const size_t stop = scalar::utf8::index_lines(src, 0, end, line_positions,
+                                                capacity, line_count);
+  if (stop != end) {
+    return result(error_code::OUTPUT_BUFFER_TOO_SMALL, stop);
+  }
+  return r;
+}
+
+simdutf_warn_unused result implementation::validate_utf8_and_find_json_escape(
+    const char *src, size_t len) const noexcept {
+  const result r = validate_utf8_with_errors(src, len);
+  if (r.error != error_code::SUCCESS) {
+    return r;
+  }
+  return result(error_code::SUCCESS, scalar::json::find_escape(src, 0, len));
+}
+simdutf_warn_unused result implementation::escape_json_utf8(
+    const char *input, size_t length, char *output,
+    bool ascii_only) const noexcept {
+  return scalar::json::escape(
+      input, length, output,
+      [ascii_only](const char *in, size_t len, char *out) {
+        return scalar::json::validate_and_copy_until_escape(in, len, out,
+                                                            ascii_only);
+      });
+}
+
+simdutf_warn_unused result implementation::unescape_json_to_utf8(
+    const char *input, size_t length, char *output) const noexcept {
+  return scalar::json::unescape(
+      input, length, output,
+      [](const char *in, size_t len, char *out, size_t &units) {
+        const result run =
+            scalar::json::validate_and_copy_until_escape(in, len, out, false);
+        units = run.count;
+        return run;
+      });
+}
 #endif // SIMDUTF_FEATURE_UTF8
 
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+simdutf_warn_unused result implementation::unescape_json_to_utf16(
+    const char *input, size_t length, char16_t *output) const noexcept {
+  // The runs between the escapes are validated by the transcoding kernel.
+  return scalar::json::unescape(
+      input, length, output,
+      [this](const char *in, size_t len, char16_t *out, size_t &units) {
+        const size_t run = scalar::json::find_escape(in, 0, len);
+  #if SIMDUTF_IS_BIG_ENDIAN
+        const result r = convert_utf8_to_utf16be_with_errors(in, run, out);
+  #else
+        const result r = convert_utf8_to_utf16le_with_errors(in, run, out);
+  #endif
+        units = r.count;
+        return r.error == error_code::SUCCESS ? result(error_code::SUCCESS, run)
+                                              : r;
+      });
+}
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #if SIMDUTF_FEATURE_UTF16 || SIMDUTF_FEATURE_DETECT_ENCODING
 template <simdutf_ByteFlip bflip>
 simdutf_really_inline static result
@@ -245,12 +311,14 @@ implementation::validate_utf32(const char32_t *src, size_t len) const noexcept {
 #endif // SIMDUTF_FEATURE_UTF32 || SIMDUTF_FEATURE_DETECT_ENCODING
 
 #if SIMDUTF_FEATURE_UTF32
-simdutf_warn_unused result implementation::validate_utf32_with_errors(
-    const char32_t *src, size_t len) const noexcept {
+template <simdutf_ByteFlip bflip>
+simdutf_really_inline static result
+rvv_validate_utf32_with_errors(const char32_t *src, size_t len) {
   const char32_t *beg = src;
   for (size_t vl; len > 0; len -= vl, src += vl) {
     vl = __riscv_vsetvl_e32m8(len);
     vuint32m8_t v = __riscv_vle32_v_u32m8((uint32_t *)src, vl);
+    v = simdutf_byteflip<bflip>(v, vl);
     vuint32m8_t off = __riscv_vadd_vx_u32m8(v, 0xFFFF2000, vl);
     long idx1 =
         __riscv_vfirst_m_b4(__riscv_vmsgtu_vx_u32m8_b4(v, 0x10FFFF, vl), vl);
@@ -272,4 +340,22 @@ simdutf_warn_unused result implementation::validate_utf32_with_errors(
   }
   return result(error_code::SUCCESS, src - beg);
 }
+
+simdutf_warn_unused result implementation::validate_utf32_with_errors(
+    const char32_t *src, size_t len) const noexcept {
+  return rvv_validate_utf32_with_errors<simdutf_ByteFlip::NONE>(src, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32le_with_errors(
+    const char32_t *src, size_t len) const noexcept {
+  return rvv_validate_utf32_with_errors<simdutf_ByteFlip::NONE>(src, len);
+}
+
+simdutf_warn_unused result implementation::validate_utf32be_with_errors(
+    const char32_t *src, size_t len) const noexcept {
+  if (supports_zvbb())
+    return rvv_validate_utf32_with_errors<simdutf_ByteFlip::ZVBB>(src, len);
+  else
+    return rvv_validate_utf32_with_errors<simdutf_ByteFlip::V>(src, len);
+}
 #endif // SIMDUTF_FEATURE_UTF32
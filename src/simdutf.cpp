@@ -7,6 +7,7 @@
 #include "tables/utf8_to_utf16_tables.h"
 #include "tables/utf16_to_utf8_tables.h"
 #include "tables/utf32_to_utf16_tables.h"
+#include "tables/sbcs_tables.h"
 // End of tables.
 
 // Implementations: they need to be setup before including
@@ -48,9 +49,12 @@ SIMDUTF_POP_DISABLE_WARNINGS
 #endif // SIMDUTF_FEATURE_UTF32 || SIMDUTF_FEATURE_DETECT_ENCODING
 #if SIMDUTF_FEATURE_LATIN1
   #include "simdutf/scalar/latin1.h"
+  #include "simdutf/scalar/windows1252.h"
+  #include "simdutf/scalar/sbcs.h"
 #endif // SIMDUTF_FEATURE_LATIN1
 #if SIMDUTF_FEATURE_BASE64
   #include "simdutf/scalar/base64.h"
+  #include "simdutf/scalar/hex.h"
 #endif // SIMDUTF_FEATURE_BASE64
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -115,6 +119,13 @@ SIMDUTF_POP_DISABLE_WARNINGS
   #include "simdutf/scalar/utf32_to_latin1/valid_utf32_to_latin1.h"
 #endif // SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
 
+#if SIMDUTF_FEATURE_UTF8
+  #include "simdutf/scalar/json.h"
+#endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  #include "simdutf/scalar/cesu8.h"
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+
 #include "implementation.cpp"
 
 SIMDUTF_PUSH_DISABLE_WARNINGS
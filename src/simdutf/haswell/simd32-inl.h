@@ -26,8 +26,8 @@ template <> struct simd32<uint32_t> {
 
   simdutf_really_inline simd32<uint32_t> swap_bytes() const {
     const __m256i shuffle =
-        _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 8, 9, 10, 11, 15, 14, 13, 12,
-                         3, 2, 1, 0, 7, 6, 5, 4, 8, 9, 10, 11, 15, 14, 13, 12);
+        _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                         3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
 
     return _mm256_shuffle_epi8(value, shuffle);
   }
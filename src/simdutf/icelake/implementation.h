@@ -38,7 +38,21 @@ public:
 #if SIMDUTF_FEATURE_UTF8
   simdutf_warn_unused result
   validate_utf8_with_errors(const char *buf, size_t len) const noexcept final;
+  simdutf_warn_unused result validate_utf8_and_index_lines(
+      const char *input, size_t length, size_t *line_positions,
+      size_t &line_count) const noexcept final;
+  simdutf_warn_unused result validate_utf8_and_find_json_escape(
+      const char *input, size_t length) const noexcept final;
+  simdutf_warn_unused result
+  escape_json_utf8(const char *input, size_t length, char *output,
+                   bool ascii_only) const noexcept final;
+  simdutf_warn_unused result unescape_json_to_utf8(
+      const char *input, size_t length, char *output) const noexcept final;
 #endif // SIMDUTF_FEATURE_UTF8
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused result unescape_json_to_utf16(
+      const char *input, size_t length, char16_t *output) const noexcept final;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_ASCII
   simdutf_warn_unused bool validate_ascii(const char *buf,
@@ -83,6 +97,10 @@ public:
 #if SIMDUTF_FEATURE_UTF32
   simdutf_warn_unused result validate_utf32_with_errors(
       const char32_t *buf, size_t len) const noexcept final;
+  simdutf_warn_unused result validate_utf32le_with_errors(
+      const char32_t *buf, size_t len) const noexcept final;
+  simdutf_warn_unused result validate_utf32be_with_errors(
+      const char32_t *buf, size_t len) const noexcept final;
 #endif // SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -131,6 +149,10 @@ public:
       const char *buf, size_t len, char32_t *utf32_output) const noexcept final;
   simdutf_warn_unused result convert_utf8_to_utf32_with_errors(
       const char *buf, size_t len, char32_t *utf32_output) const noexcept final;
+  simdutf_warn_unused size_t convert_utf8_to_utf32_with_replacement(
+      const char *buf, size_t len, char32_t *utf32_output) const noexcept final;
+  simdutf_warn_unused result utf32_length_from_utf8_with_replacement(
+      const char *buf, size_t len) const noexcept final;
   simdutf_warn_unused size_t convert_valid_utf8_to_utf32(
       const char *buf, size_t len, char32_t *utf32_buffer) const noexcept final;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
@@ -178,6 +200,14 @@ public:
       const char32_t *buf, size_t len, char *utf8_buffer) const noexcept final;
   simdutf_warn_unused size_t convert_valid_utf32_to_utf8(
       const char32_t *buf, size_t len, char *utf8_buffer) const noexcept final;
+  simdutf_warn_unused size_t convert_utf32le_to_utf8(
+      const char32_t *buf, size_t len, char *utf8_buffer) const noexcept final;
+  simdutf_warn_unused size_t convert_utf32be_to_utf8(
+      const char32_t *buf, size_t len, char *utf8_buffer) const noexcept final;
+  simdutf_warn_unused result convert_utf32le_to_utf8_with_errors(
+      const char32_t *buf, size_t len, char *utf8_buffer) const noexcept final;
+  simdutf_warn_unused result convert_utf32be_to_utf8_with_errors(
+      const char32_t *buf, size_t len, char *utf8_buffer) const noexcept final;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF32 && SIMDUTF_FEATURE_LATIN1
@@ -212,6 +242,18 @@ public:
   convert_valid_utf32_to_utf16be(const char32_t *buf, size_t len,
                                  char16_t *utf16_buffer) const noexcept final;
   simdutf_warn_unused size_t
+  convert_utf32le_to_utf16(const char32_t *buf, size_t len,
+                           char16_t *utf16_buffer) const noexcept final;
+  simdutf_warn_unused size_t
+  convert_utf32be_to_utf16(const char32_t *buf, size_t len,
+                           char16_t *utf16_buffer) const noexcept final;
+  simdutf_warn_unused result convert_utf32le_to_utf16_with_errors(
+      const char32_t *buf, size_t len,
+      char16_t *utf16_buffer) const noexcept final;
+  simdutf_warn_unused result convert_utf32be_to_utf16_with_errors(
+      const char32_t *buf, size_t len,
+      char16_t *utf16_buffer) const noexcept final;
+  simdutf_warn_unused size_t
   convert_utf16le_to_utf32(const char16_t *buf, size_t len,
                            char32_t *utf32_buffer) const noexcept final;
   simdutf_warn_unused size_t
@@ -262,6 +304,8 @@ public:
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
   simdutf_warn_unused size_t utf16_length_from_utf8(
       const char *input, size_t length) const noexcept override;
+  simdutf_warn_unused result utf16_length_from_utf8_with_errors(
+      const char *input, size_t length) const noexcept override;
   simdutf_warn_unused result utf8_length_from_utf16le_with_replacement(
       const char16_t *input, size_t length) const noexcept override;
   ;
@@ -277,21 +321,42 @@ public:
       const char16_t *input, size_t length,
       char *utf8_buffer) const noexcept override;
 
+  simdutf_warn_unused size_t convert_utf8_to_utf16le_with_replacement(
+      const char *input, size_t length,
+      char16_t *utf16_output) const noexcept override;
+
+  simdutf_warn_unused size_t convert_utf8_to_utf16be_with_replacement(
+      const char *input, size_t length,
+      char16_t *utf16_output) const noexcept override;
+
+  simdutf_warn_unused result utf16_length_from_utf8_with_replacement(
+      const char *input, size_t length) const noexcept override;
+
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
   simdutf_warn_unused size_t utf8_length_from_utf32(
       const char32_t *input, size_t length) const noexcept override;
+  simdutf_warn_unused size_t utf8_length_from_utf32le(
+      const char32_t *input, size_t length) const noexcept override;
+  simdutf_warn_unused size_t utf8_length_from_utf32be(
+      const char32_t *input, size_t length) const noexcept override;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
   simdutf_warn_unused size_t utf16_length_from_utf32(
       const char32_t *input, size_t length) const noexcept override;
+  simdutf_warn_unused size_t utf16_length_from_utf32le(
+      const char32_t *input, size_t length) const noexcept override;
+  simdutf_warn_unused size_t utf16_length_from_utf32be(
+      const char32_t *input, size_t length) const noexcept override;
 #endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
   simdutf_warn_unused size_t utf32_length_from_utf8(
       const char *input, size_t length) const noexcept override;
+  simdutf_warn_unused result utf32_length_from_utf8_with_errors(
+      const char *input, size_t length) const noexcept override;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF32
 
 #if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
@@ -303,6 +368,23 @@ public:
   simdutf_warn_unused size_t utf8_length_from_latin1(
       const char *input, size_t length) const noexcept override;
 #endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_LATIN1
+  simdutf_warn_unused const char *
+  find_c1_control(const char *start, const char *end) const noexcept override;
+#endif // SIMDUTF_FEATURE_LATIN1
+#if SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+  simdutf_warn_unused const char *
+  find_cesu8_special(const char *start, const char *end,
+                     bool modified) const noexcept override;
+  simdutf_warn_unused const char16_t *
+  find_cesu8_special(const char16_t *start, const char16_t *end,
+                     bool modified) const noexcept override;
+#endif // SIMDUTF_FEATURE_UTF8 && SIMDUTF_FEATURE_UTF16
+#if SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
+  simdutf_warn_unused size_t
+  convert_sbcs_to_utf16(const char *input, size_t length, const char16_t *table,
+                        char16_t *utf16_output) const noexcept override;
+#endif // SIMDUTF_FEATURE_UTF16 && SIMDUTF_FEATURE_LATIN1
 
 #if SIMDUTF_FEATURE_BASE64
   simdutf_warn_unused result base64_to_binary(
@@ -333,6 +415,14 @@ public:
                    char character) const noexcept override;
   const char16_t *find(const char16_t *start, const char16_t *end,
                        char16_t character) const noexcept override;
+  size_t binary_to_hex(const char *input, size_t length, char *output,
+                       hex_options options) const noexcept override;
+  simdutf_warn_unused result
+  hex_to_binary(const char *input, size_t length,
+                char *output) const noexcept override;
+  simdutf_warn_unused result
+  hex_to_binary(const char16_t *input, size_t length,
+                char *output) const noexcept override;
   simdutf_warn_unused size_t binary_length_from_base64(
       const char *input, size_t length) const noexcept override;
   simdutf_warn_unused size_t binary_length_from_base64(
@@ -12,6 +12,12 @@ template <> struct simd32<uint32_t> {
   simdutf_really_inline simd32(const Pointer *ptr)
       : value(_mm512_loadu_si512(reinterpret_cast<const __m512i *>(ptr))) {}
 
+  simdutf_really_inline simd32<uint32_t> swap_bytes() const {
+    const __m512i shuffle = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    return _mm512_shuffle_epi8(value, shuffle);
+  }
+
   uint64_t sum() const {
     const __m512i mask = _mm512_set1_epi64(0xffffffff);
     const __m512i t0 = _mm512_and_si512(value, mask);
@@ -18,6 +18,10 @@ template <> struct simd32<uint32_t> {
   }
 
   // members
+  simdutf_really_inline simd32<uint32_t> swap_bytes() const {
+    return __lasx_xvshuf4i_b(value, 0b00011011);
+  }
+
   simdutf_really_inline uint64_t sum() const {
     const auto odd = __lasx_xvsrli_d(value, 32);
     const auto even = __lasx_xvand_v(value, __lasx_xvreplgr2vr_d(0xffffffff));
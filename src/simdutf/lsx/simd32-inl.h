@@ -18,6 +18,10 @@ template <> struct simd32<uint32_t> {
   }
 
   // members
+  simdutf_really_inline simd32<uint32_t> swap_bytes() const {
+    return __lsx_vshuf4i_b(value, 0b00011011);
+  }
+
   simdutf_really_inline uint64_t sum() const {
     return uint64_t(__lsx_vpickve2gr_wu(value, 0)) +
            uint64_t(__lsx_vpickve2gr_wu(value, 1)) +
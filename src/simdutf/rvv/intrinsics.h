@@ -66,6 +66,13 @@ simdutf_really_inline static uint16_t simdutf_byteflip(uint16_t v) {
   return v;
 }
 
+template <simdutf_ByteFlip method>
+simdutf_really_inline static uint32_t simdutf_byteflip(uint32_t v) {
+  if (method != simdutf_ByteFlip::NONE)
+    return v << 24 | (v & 0xFF00) << 8 | (v >> 8 & 0xFF00) | v >> 24;
+  return v;
+}
+
 #ifdef SIMDUTF_TARGET_ZVBB
 SIMDUTF_UNTARGET_REGION
 SIMDUTF_TARGET_ZVBB
@@ -123,6 +130,40 @@ simdutf_really_inline static vuint16m8_t simdutf_byteflip(vuint16m8_t v,
   return v;
 }
 
+/* Without Zvbb, swap the bytes of each 16-bit half and then the halves. */
+template <simdutf_ByteFlip method>
+simdutf_really_inline static vuint32m4_t simdutf_byteflip(vuint32m4_t v,
+                                                          size_t vl) {
+#if SIMDUTF_HAS_ZVBB_INTRINSICS
+  if (method == simdutf_ByteFlip::ZVBB)
+    return __riscv_vrev8_v_u32m4(v, vl);
+#endif
+  if (method == simdutf_ByteFlip::V) {
+    v = __riscv_vreinterpret_v_u16m4_u32m4(simdutf_byteflip<method>(
+        __riscv_vreinterpret_v_u32m4_u16m4(v), vl * 2));
+    return __riscv_vor_vv_u32m4(__riscv_vsrl_vx_u32m4(v, 16, vl),
+                                __riscv_vsll_vx_u32m4(v, 16, vl), vl);
+  }
+  return v;
+}
+
+/* Without Zvbb, swap the bytes of each 16-bit half and then the halves. */
+template <simdutf_ByteFlip method>
+simdutf_really_inline static vuint32m8_t simdutf_byteflip(vuint32m8_t v,
+                                                          size_t vl) {
+#if SIMDUTF_HAS_ZVBB_INTRINSICS
+  if (method == simdutf_ByteFlip::ZVBB)
+    return __riscv_vrev8_v_u32m8(v, vl);
+#endif
+  if (method == simdutf_ByteFlip::V) {
+    v = __riscv_vreinterpret_v_u16m8_u32m8(simdutf_byteflip<method>(
+        __riscv_vreinterpret_v_u32m8_u16m8(v), vl * 2));
+    return __riscv_vor_vv_u32m8(__riscv_vsrl_vx_u32m8(v, 16, vl),
+                                __riscv_vsll_vx_u32m8(v, 16, vl), vl);
+  }
+  return v;
+}
+
 #ifdef SIMDUTF_TARGET_ZVBB
 SIMDUTF_UNTARGET_REGION
 SIMDUTF_TARGET_RVV
@@ -1,6 +1,9 @@
 #include "simdutf_c.h"
 #include "simdutf/implementation.h"
 
+#include <cstring>
+#include <type_traits>
+
 static simdutf_result to_c_result(const simdutf::result &r) {
   simdutf_result out;
   out.error = static_cast<simdutf_error_code>(r.error);
@@ -82,6 +85,37 @@ simdutf_result simdutf_validate_utf32_with_errors(const char32_t *buf,
   return to_c_result(simdutf::validate_utf32_with_errors(buf, len));
 }
 
+// The C state is a copy of the C++ object: it is trivially copyable, so we
+// move it in and out of the opaque storage with memcpy.
+static_assert(sizeof(simdutf::utf8_stream_validator) <=
+                  sizeof(simdutf_utf8_stream_validator),
+              "simdutf_utf8_stream_validator is too small");
+static_assert(
+    std::is_trivially_copyable<simdutf::utf8_stream_validator>::value,
+    "simdutf::utf8_stream_validator must be trivially copyable");
+
+void simdutf_utf8_stream_validator_init(simdutf_utf8_stream_validator *state) {
+  const simdutf::utf8_stream_validator validator;
+  std::memcpy(state->opaque, &validator, sizeof(validator));
+}
+simdutf_result
+simdutf_utf8_stream_validator_feed(simdutf_utf8_stream_validator *state,
+                                   const char *input, size_t length) {
+  simdutf::utf8_stream_validator validator;
+  std::memcpy(&validator, state->opaque, sizeof(validator));
+  const simdutf::result r = validator.feed(input, length);
+  std::memcpy(state->opaque, &validator, sizeof(validator));
+  return to_c_result(r);
+}
+simdutf_result
+simdutf_utf8_stream_validator_finish(simdutf_utf8_stream_validator *state) {
+  simdutf::utf8_stream_validator validator;
+  std::memcpy(&validator, state->opaque, sizeof(validator));
+  const simdutf::result r = validator.finish();
+  std::memcpy(state->opaque, &validator, sizeof(validator));
+  return to_c_result(r);
+}
+
 void simdutf_to_well_formed_utf16le(const char16_t *input, size_t len,
                                     char16_t *output) {
   simdutf::to_well_formed_utf16le(input, len, output);
@@ -52,7 +52,7 @@ simdutf_really_inline bool validate_utf32(const __m128i a, const __m128i b) {
   return !combined.any();
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char16_t *>
 sse_convert_utf32_to_utf16(const char32_t *buf, size_t len,
                            char16_t *utf16_output) {
@@ -64,10 +64,18 @@ sse_convert_utf32_to_utf16(const char32_t *buf, size_t len,
 
   while (end - buf >= 16 + 8) {
     const __m128i *ptr = reinterpret_cast<const __m128i *>(buf);
-    const __m128i in0 = _mm_loadu_si128(ptr + 0);
-    const __m128i in1 = _mm_loadu_si128(ptr + 1);
-    const __m128i in2 = _mm_loadu_si128(ptr + 2);
-    const __m128i in3 = _mm_loadu_si128(ptr + 3);
+    __m128i in0 = _mm_loadu_si128(ptr + 0);
+    __m128i in1 = _mm_loadu_si128(ptr + 1);
+    __m128i in2 = _mm_loadu_si128(ptr + 2);
+    __m128i in3 = _mm_loadu_si128(ptr + 3);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m128i swap =
+          _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in0 = _mm_shuffle_epi8(in0, swap);
+      in1 = _mm_shuffle_epi8(in1, swap);
+      in2 = _mm_shuffle_epi8(in2, swap);
+      in3 = _mm_shuffle_epi8(in3, swap);
+    }
 
     const __m128i combined =
         _mm_or_si128(_mm_or_si128(in2, in3), _mm_or_si128(in0, in1));
@@ -128,7 +136,7 @@ sse_convert_utf32_to_utf16(const char32_t *buf, size_t len,
   return std::make_pair(buf, utf16_output);
 }
 
-template <endianness big_endian>
+template <endianness big_endian, endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char16_t *>
 sse_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
                                        char16_t *utf16_output) {
@@ -138,8 +146,14 @@ sse_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
   const __m128i v_ffff0000 = _mm_set1_epi32((int32_t)0xffff0000);
 
   while (end - buf >= 8) {
-    const __m128i in = _mm_loadu_si128((__m128i *)buf);
-    const __m128i nextin = _mm_loadu_si128((__m128i *)buf + 1);
+    __m128i in = _mm_loadu_si128((__m128i *)buf);
+    __m128i nextin = _mm_loadu_si128((__m128i *)buf + 1);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m128i swap =
+          _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm_shuffle_epi8(in, swap);
+      nextin = _mm_shuffle_epi8(nextin, swap);
+    }
 
     const __m128i combined = _mm_or_si128(in, nextin);
     if (simdutf_likely(_mm_testz_si128(combined, v_ffff0000))) {
@@ -171,7 +185,7 @@ sse_convert_utf32_to_utf16_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFF0000) == 0) {
           // will not generate a surrogate pair
           if (word >= 0xD800 && word <= 0xDFFF) {
@@ -1,3 +1,4 @@
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<const char32_t *, char *>
 sse_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_output) {
   const char32_t *end = buf + len;
@@ -28,6 +29,12 @@ sse_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_output) {
     __m128i in = _mm_loadu_si128((__m128i *)buf);
     __m128i nextin = _mm_loadu_si128(
         (__m128i *)buf + 1); // These two values can hold only 8 UTF32 chars
+    if constexpr (!match_system(utf32_endian)) {
+      const __m128i swap =
+          _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm_shuffle_epi8(in, swap);
+      nextin = _mm_shuffle_epi8(nextin, swap);
+    }
     running_max = _mm_max_epu32(
         _mm_max_epu32(in, running_max), // take element-wise max char32_t from
                                         // in and running_max vector
@@ -60,6 +67,12 @@ sse_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_output) {
     if (_mm_testz_si128(in_16, v_ff80)) { // if the first two blocks are ASCII
       __m128i thirdin = _mm_loadu_si128((__m128i *)buf + 2);
       __m128i fourthin = _mm_loadu_si128((__m128i *)buf + 3);
+      if constexpr (!match_system(utf32_endian)) {
+        const __m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9,
+                                           8, 15, 14, 13, 12);
+        thirdin = _mm_shuffle_epi8(thirdin, swap);
+        fourthin = _mm_shuffle_epi8(fourthin, swap);
+      }
       running_max = _mm_max_epu32(
           _mm_max_epu32(thirdin, running_max),
           fourthin); // take the running max of all 4 vectors thus far
@@ -287,7 +300,7 @@ sse_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_output) {
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
@@ -328,6 +341,7 @@ sse_convert_utf32_to_utf8(const char32_t *buf, size_t len, char *utf8_output) {
   return std::make_pair(buf, utf8_output);
 }
 
+template <endianness utf32_endian = endianness::NATIVE>
 std::pair<result, char *>
 sse_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
                                       char *utf8_output) {
@@ -350,6 +364,12 @@ sse_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
     // We load two 16 bytes registers for a total of 32 bytes or 8 characters.
     __m128i in = _mm_loadu_si128((__m128i *)buf);
     __m128i nextin = _mm_loadu_si128((__m128i *)buf + 1);
+    if constexpr (!match_system(utf32_endian)) {
+      const __m128i swap =
+          _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      in = _mm_shuffle_epi8(in, swap);
+      nextin = _mm_shuffle_epi8(nextin, swap);
+    }
     // Check for too large input
     __m128i max_input = _mm_max_epu32(_mm_max_epu32(in, nextin), v_10ffff);
     if (static_cast<uint16_t>(_mm_movemask_epi8(
@@ -557,7 +577,7 @@ sse_convert_utf32_to_utf8_with_errors(const char32_t *buf, size_t len,
         forward = size_t(end - buf - 1);
       }
       for (; k < forward; k++) {
-        uint32_t word = buf[k];
+        uint32_t word = scalar::utf32::swap_if_needed<utf32_endian>(buf[k]);
         if ((word & 0xFFFFFF80) == 0) {
           *utf8_output++ = char(word);
         } else if ((word & 0xFFFFF800) == 0) {
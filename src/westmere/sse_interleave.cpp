@@ -0,0 +1,24 @@
+// Stores the bytes of the two vectors alternately: first[0], second[0],
+// first[1], second[1]...
+simdutf_really_inline void store_interleaved(const simd8<uint8_t> first,
+                                             const simd8<uint8_t> second,
+                                             uint8_t *output) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                   _mm_unpacklo_epi8(first, second));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 16),
+                   _mm_unpackhi_epi8(first, second));
+}
+
+// Splits the bytes of two consecutive vectors into those at even and those at
+// odd positions, the inverse of store_interleaved.
+simdutf_really_inline void deinterleave(const simd8<uint8_t> first,
+                                        const simd8<uint8_t> second,
+                                        simd8<uint8_t> &even,
+                                        simd8<uint8_t> &odd) {
+  const __m128i split =
+      _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+  const __m128i first_split = _mm_shuffle_epi8(first, split);
+  const __m128i second_split = _mm_shuffle_epi8(second, split);
+  even = simd8<uint8_t>(_mm_unpacklo_epi64(first_split, second_split));
+  odd = simd8<uint8_t>(_mm_unpackhi_epi64(first_split, second_split));
+}
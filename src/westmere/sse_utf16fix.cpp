@@ -58,8 +58,11 @@ void utf16fix_sse(const char16_t *in, size_t n, char16_t *out) {
     return;
   }
 
-  out[0] =
-      scalar::utf16::is_low_surrogate<big_endian>(in[0]) ? replacement : in[0];
+  if (scalar::utf16::is_low_surrogate<big_endian>(in[0])) {
+    out[0] = replacement;
+  } else if (in != out) {
+    out[0] = in[0];
+  }
 
   /* duplicate code to have the compiler specialise utf16fix_block() */
   if (in == out) {
@@ -76,7 +79,7 @@ void utf16fix_sse(const char16_t *in, size_t n, char16_t *out) {
     utf16fix_block_sse<big_endian, false>(out + n - 8, in + n - 8);
   }
 
-  out[n - 1] = scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])
-                   ? replacement
-                   : out[n - 1];
+  if (scalar::utf16::is_high_surrogate<big_endian>(out[n - 1])) {
+    out[n - 1] = replacement;
+  }
 }
@@ -0,0 +1,277 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+struct stream_output {
+  simdutf::full_result status;
+  std::string binary;
+};
+
+// Feeds the input to a decoder in chunks of random sizes (up to max_chunk
+// characters) and returns everything it wrote along with the result of
+// finish(), or the first error.
+template <typename char_type>
+stream_output decode_in_chunks(simdutf::base64_decoder &decoder,
+                               const std::basic_string<char_type> &input,
+                               size_t max_chunk, uint32_t seed) {
+  simdutf::tests::helpers::RandomInt chunk_size(0, max_chunk, seed);
+  stream_output out;
+  size_t pos = 0;
+  while (pos < input.size()) {
+    const size_t len = std::min<size_t>(chunk_size(), input.size() - pos);
+    std::vector<char> buffer(decoder.maximal_binary_length(len));
+    const simdutf::full_result r =
+        decoder.decode(input.data() + pos, len, buffer.data());
+    out.binary.append(buffer.data(), r.output_count);
+    if (r.error != simdutf::error_code::SUCCESS) {
+      out.status = r;
+      return out;
+    }
+    ASSERT_EQUAL(r.input_count, len);
+    pos += len;
+  }
+  char tail[2];
+  out.status = decoder.finish(tail);
+  out.binary.append(tail, out.status.output_count);
+  return out;
+}
+
+// Decodes the input in three chunks, for every split, and compares the result
+// with base64_to_binary_safe on the whole input: the error, the position of the
+// error or the number of characters consumed, and the output.
+std::string decode_all_splits_check(const std::string &input,
+                                    simdutf::base64_options options,
+                                    simdutf::last_chunk_handling_options lc) {
+  // The output buffer is large enough for the whole input to be decoded in
+  // one pass.
+  std::vector<char> expected(input.size() + 3);
+  size_t expected_length = expected.size();
+  const simdutf::result one_shot = simdutf::base64_to_binary_safe(
+      input.data(), input.size(), expected.data(), expected_length, options,
+      lc);
+  for (size_t split = 0; split <= input.size(); split++) {
+    for (size_t split2 = split; split2 <= input.size(); split2++) {
+      simdutf::base64_decoder decoder(options, lc);
+      std::string binary;
+      char buffer[64];
+      simdutf::full_result r = decoder.decode(input.data(), split, buffer);
+      binary.append(buffer, r.output_count);
+      if ((r.error == simdutf::error_code::SUCCESS)) {
+        r = decoder.decode(input.data() + split, split2 - split, buffer);
+        binary.append(buffer, r.output_count);
+      }
+      if ((r.error == simdutf::error_code::SUCCESS)) {
+        r = decoder.decode(input.data() + split2, input.size() - split2,
+                           buffer);
+        binary.append(buffer, r.output_count);
+      }
+      if ((r.error == simdutf::error_code::SUCCESS)) {
+        r = decoder.finish(buffer);
+        binary.append(buffer, r.output_count);
+      }
+      const std::string where =
+          " at split " + std::to_string(split) + "/" + std::to_string(split2);
+      if (r.error != one_shot.error) {
+        return "error mismatch" + where;
+      }
+      if (r.input_count != one_shot.count) {
+        return "position mismatch" + where + ": " +
+               std::to_string(r.input_count) + " instead of " +
+               std::to_string(one_shot.count);
+      }
+      if ((r.error == simdutf::error_code::SUCCESS) &&
+          binary != std::string(expected.data(), expected_length)) {
+        return "output mismatch" + where;
+      }
+    }
+  }
+  return "";
+}
+
+void check_all_splits(const std::vector<std::string> &inputs,
+                      simdutf::base64_options options,
+                      simdutf::last_chunk_handling_options lc) {
+  for (const std::string &input : inputs) {
+    const std::string message = decode_all_splits_check(input, options, lc);
+    if (!message.empty()) {
+      printf("input '%s' with %s: %s\n", input.c_str(),
+             std::string(simdutf::to_string(lc)).c_str(), message.c_str());
+    }
+    ASSERT_TRUE(message.empty());
+  }
+}
+} // namespace
+
+TEST(padded_group_across_chunks) {
+  // "Hello" is SGVsbG8=
+  for (size_t split = 0; split <= 8; split++) {
+    simdutf::base64_decoder decoder;
+    const std::string input = "SGVsbG8=";
+    std::string binary;
+    char buffer[16];
+    simdutf::full_result r = decoder.decode(input.data(), split, buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    binary.append(buffer, r.output_count);
+    r = decoder.decode(input.data() + split, 8 - split, buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    binary.append(buffer, r.output_count);
+    r = decoder.finish(buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    ASSERT_EQUAL(r.input_count, size_t(8));
+    binary.append(buffer, r.output_count);
+    ASSERT_TRUE(binary == "Hello");
+  }
+}
+
+TEST(data_after_padding) {
+  simdutf::base64_decoder decoder;
+  char buffer[16];
+  // The padded group waits for the end of the stream.
+  simdutf::full_result r = decoder.decode("QQ==", 4, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(0));
+  ASSERT_EQUAL(decoder.decode(" \n", 2, buffer).error,
+               simdutf::error_code::SUCCESS);
+  r = decoder.decode("QUJD", 4, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::INVALID_BASE64_CHARACTER);
+  ASSERT_EQUAL(r.input_count, size_t(2));
+  // The error is sticky until reset().
+  ASSERT_EQUAL(decoder.finish(buffer).error,
+               simdutf::error_code::INVALID_BASE64_CHARACTER);
+  decoder.reset();
+  r = decoder.decode("QUJD", 4, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(3));
+}
+
+TEST(last_chunk_options) {
+  char buffer[16];
+  simdutf::base64_decoder loose;
+  ASSERT_EQUAL(loose.decode("QUJDQQ", 6, buffer).output_count, size_t(3));
+  simdutf::full_result r = loose.finish(buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.input_count, size_t(6));
+  ASSERT_EQUAL(r.output_count, size_t(1));
+
+  simdutf::base64_decoder strict(simdutf::base64_default, simdutf::strict);
+  ASSERT_EQUAL(strict.decode("QUJDQQ", 6, buffer).output_count, size_t(3));
+  ASSERT_EQUAL(strict.finish(buffer).error,
+               simdutf::error_code::BASE64_INPUT_REMAINDER);
+
+  simdutf::base64_decoder partial(simdutf::base64_default,
+                                  simdutf::stop_before_partial);
+  ASSERT_EQUAL(partial.decode("QUJD", 4, buffer).output_count, size_t(3));
+  ASSERT_EQUAL(partial.decode(" QQ", 3, buffer).output_count, size_t(0));
+  r = partial.finish(buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.input_count, size_t(4));
+  ASSERT_EQUAL(r.output_count, size_t(0));
+}
+
+TEST(all_splits_match_one_shot) {
+  const std::vector<std::string> inputs = {
+      "",         "QQ==",       "QUI=",          "QUJD",         "QUJDQQ",
+      " Q U J D", "QUJD\nQQ==", "QUJD QUJ= ",    "QQ=",          "QQ===",
+      "Q",        "QUJD=",      "QUJD!QUJD",     "QQ==QUJD",     "QR==",
+      "QUJDQR",   "=QUJ",       "QUJDQUJDQUJDQ", "QUJD QQ = = ", "QU JD QU J"};
+  for (simdutf::last_chunk_handling_options lc :
+       {simdutf::loose, simdutf::strict, simdutf::stop_before_partial,
+        simdutf::only_full_chunks}) {
+    check_all_splits(inputs, simdutf::base64_default, lc);
+  }
+}
+
+TEST(garbage_stops_at_padding) {
+  check_all_splits({"QU!JD", "Q*UJDQQ=QUJD", "QUJD=", "QU==", "Q=", "=QUJD",
+                    "QUJD QUI"},
+                   simdutf::base64_default_accept_garbage, simdutf::loose);
+}
+
+TEST(padding_followed_by_garbage) {
+  // What follows a padded group decides how it is decoded, wherever the
+  // input is split.
+  const std::vector<std::string> inputs = {
+      "aba=Q",   "/=\na_",  "b  =a",   "QQ==Q",  "QQ= =",    "QQ= = =",
+      "QUI= !",  "QQ==\n\n", "Q=Q=",    "QUJD=",  "QUJD = A", "QQ==  =",
+      "QR== \t", "QUJD Q=", "QUJDQ==", "QUI = "};
+  for (simdutf::last_chunk_handling_options lc :
+       {simdutf::loose, simdutf::strict, simdutf::stop_before_partial,
+        simdutf::only_full_chunks}) {
+    check_all_splits(inputs, simdutf::base64_default, lc);
+    check_all_splits({"h1-=4Hg", "h1-=", "h1-", "_-_=  "}, simdutf::base64_url,
+                     lc);
+  }
+}
+
+TEST(positions_match_safe_decoding) {
+  for (simdutf::last_chunk_handling_options lc :
+       {simdutf::loose, simdutf::strict, simdutf::stop_before_partial,
+        simdutf::only_full_chunks}) {
+    check_all_splits({"3OM ", "g ", "pAOU +", "  QUJD  Q  ", "QUJD  ", " "},
+                     simdutf::base64_default, lc);
+    check_all_splits({"\t_fR  _   ", "_fR_ _"}, simdutf::base64_url, lc);
+  }
+}
+
+TEST_LOOP(random_inputs_match_safe_decoding) {
+  // Short inputs made of a few base64 characters, padding, spaces and invalid
+  // characters, so that the interesting cases come up often.
+  const char alphabet[] = {'Q', 'U', 'J', 'g', '/', '_', '=', ' ', '\n', '!'};
+  simdutf::tests::helpers::RandomInt random_size(0, 9, seed);
+  simdutf::tests::helpers::RandomInt random_char(0, sizeof(alphabet) - 1,
+                                                 seed);
+  for (size_t trial = 0; trial < 20; trial++) {
+    std::string input(random_size(), '\0');
+    for (char &c : input) {
+      c = alphabet[random_char()];
+    }
+    for (simdutf::last_chunk_handling_options lc :
+         {simdutf::loose, simdutf::strict, simdutf::stop_before_partial,
+          simdutf::only_full_chunks}) {
+      for (simdutf::base64_options options :
+           {simdutf::base64_default, simdutf::base64_url,
+            simdutf::base64_default_accept_garbage}) {
+        check_all_splits({input}, options, lc);
+      }
+    }
+  }
+}
+
+TEST_LOOP(random_chunks_round_trip) {
+  simdutf::tests::helpers::RandomInt random_byte(0, 0xff, seed);
+  for (size_t size : {0, 1, 2, 3, 100, 1000}) {
+    std::string binary(size, '\0');
+    for (char &c : binary) {
+      c = char(random_byte());
+    }
+    for (simdutf::base64_options options :
+         {simdutf::base64_default, simdutf::base64_url}) {
+      std::string base64(simdutf::base64_length_from_binary_with_lines(
+                             size, options, 20),
+                         '\0');
+      base64.resize(simdutf::binary_to_base64_with_lines(
+          binary.data(), size, base64.data(), 20, options));
+      std::u16string base64_16(base64.begin(), base64.end());
+      for (size_t max_chunk : {1, 2, 3, 7, 64, 500}) {
+        simdutf::base64_decoder decoder(options);
+        const stream_output out =
+            decode_in_chunks(decoder, base64, max_chunk, seed);
+        ASSERT_EQUAL(out.status.error, simdutf::error_code::SUCCESS);
+        ASSERT_EQUAL(out.status.input_count, base64.size());
+        ASSERT_TRUE(out.binary == binary);
+        decoder.reset();
+        const stream_output out16 =
+            decode_in_chunks(decoder, base64_16, max_chunk, seed);
+        ASSERT_EQUAL(out16.status.error, simdutf::error_code::SUCCESS);
+        ASSERT_TRUE(out16.binary == binary);
+      }
+    }
+  }
+}
+
+TEST_MAIN
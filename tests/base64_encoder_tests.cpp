@@ -0,0 +1,106 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+std::string one_shot(const std::vector<char> &input,
+                     simdutf::base64_options options, size_t line_length) {
+  std::string base64;
+  if (line_length == 0) {
+    base64.resize(simdutf::base64_length_from_binary(input.size(), options));
+    base64.resize(simdutf::binary_to_base64(input.data(), input.size(),
+                                            base64.data(), options));
+  } else {
+    base64.resize(simdutf::base64_length_from_binary_with_lines(
+        input.size(), options, line_length));
+    base64.resize(simdutf::binary_to_base64_with_lines(
+        input.data(), input.size(), base64.data(), line_length, options));
+  }
+  return base64;
+}
+
+// Feeds the input to an encoder in chunks of random sizes (up to max_chunk
+// bytes) and returns the concatenated output.
+std::string encode_in_chunks(simdutf::base64_encoder &encoder,
+                             const std::vector<char> &input, size_t max_chunk,
+                             uint32_t seed) {
+  simdutf::tests::helpers::RandomInt chunk_size(0, max_chunk, seed);
+  std::string base64;
+  size_t pos = 0;
+  while (pos < input.size()) {
+    const size_t len = std::min<size_t>(chunk_size(), input.size() - pos);
+    const size_t expected = encoder.encoded_length(len);
+    std::vector<char> out(expected + 1);
+    const size_t written = encoder.encode(input.data() + pos, len, out.data());
+    ASSERT_EQUAL(written, expected);
+    base64.append(out.data(), written);
+    pos += len;
+  }
+  char tail[5];
+  base64.append(tail, encoder.finish(tail));
+  return base64;
+}
+} // namespace
+
+TEST(one_byte_at_a_time) {
+  const std::string input = "Hello, World!";
+  simdutf::base64_encoder encoder;
+  std::string base64;
+  char out[8];
+  for (char c : input) {
+    base64.append(out, encoder.encode(&c, 1, out));
+  }
+  base64.append(out, encoder.finish(out));
+  ASSERT_TRUE(base64 == "SGVsbG8sIFdvcmxkIQ==");
+  // The encoder can be used again after finish().
+  base64.assign(out, encoder.encode("ab", 2, out));
+  base64.append(out, encoder.finish(out));
+  ASSERT_TRUE(base64 == "YWI=");
+}
+
+TEST(empty_input) {
+  simdutf::base64_encoder encoder(simdutf::base64_default, 76);
+  char out[5];
+  ASSERT_EQUAL(encoder.encoded_length(0), size_t(0));
+  ASSERT_EQUAL(encoder.encode("", 0, out), size_t(0));
+  ASSERT_EQUAL(encoder.finish(out), size_t(0));
+}
+
+TEST(reset_drops_carry) {
+  simdutf::base64_encoder encoder(simdutf::base64_url);
+  char out[8];
+  ASSERT_EQUAL(encoder.encode("ab", 2, out), size_t(0));
+  encoder.reset();
+  std::string base64(out, encoder.encode("\xfb\xff", 2, out));
+  base64.append(out, encoder.finish(out));
+  ASSERT_TRUE(base64 == "-_8");
+}
+
+TEST_LOOP(random_chunks_match_one_shot) {
+  simdutf::tests::helpers::RandomInt random_byte(0, 0xff, seed);
+  for (size_t size : {0, 1, 2, 3, 4, 5, 47, 48, 49, 100, 1000}) {
+    std::vector<char> input(size);
+    for (char &c : input) {
+      c = char(random_byte());
+    }
+    for (simdutf::base64_options options :
+         {simdutf::base64_default, simdutf::base64_url,
+          simdutf::base64_default_no_padding,
+          simdutf::base64_url_with_padding}) {
+      for (size_t line_length : {0, 4, 5, 7, 8, 64, 76}) {
+        const std::string expected = one_shot(input, options, line_length);
+        for (size_t max_chunk : {1, 2, 3, 10, 64, 300}) {
+          simdutf::base64_encoder encoder(options, line_length);
+          ASSERT_TRUE(encode_in_chunks(encoder, input, max_chunk, seed) ==
+                      expected);
+        }
+      }
+    }
+  }
+}
+
+TEST_MAIN
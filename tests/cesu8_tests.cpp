@@ -0,0 +1,281 @@
+#include "simdutf.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::error_code;
+
+// Valid UTF-16 where about one character in special_rate is a null character
+// or above U+FFFF.
+std::u16string random_utf16(uint32_t seed, size_t size, size_t special_rate) {
+  simdutf::tests::helpers::RandomInt random_kind(0, special_rate, seed);
+  simdutf::tests::helpers::RandomInt random_unit(0, 0xffff, seed);
+  simdutf::tests::helpers::RandomInt random_low(0xdc00, 0xdfff, seed);
+  std::u16string output;
+  while (output.size() < size) {
+    const uint32_t kind = random_kind();
+    const uint32_t unit = random_unit();
+    if (kind == 0) {
+      output.push_back(0);
+    } else if (kind == 1) {
+      output.push_back(char16_t(0xd800 | (unit & 0x3ff)));
+      output.push_back(char16_t(random_low()));
+    } else if (kind < special_rate / 2) {
+      output.push_back(char16_t(unit & 0x7f));
+    } else if ((unit & 0xf800) != 0xd800 && unit != 0) {
+      output.push_back(char16_t(unit));
+    }
+  }
+  return output;
+}
+
+// Each code unit on its own, as three bytes for surrogates.
+std::string reference_cesu8(const std::u16string &input, bool modified) {
+  std::string output;
+  for (char16_t unit : input) {
+    if (unit == 0 && modified) {
+      output += "\xc0\x80";
+    } else if (unit < 0x80) {
+      output.push_back(char(unit));
+    } else if (unit < 0x800) {
+      output.push_back(char(0xc0 | (unit >> 6)));
+      output.push_back(char(0x80 | (unit & 0x3f)));
+    } else {
+      output.push_back(char(0xe0 | (unit >> 12)));
+      output.push_back(char(0x80 | ((unit >> 6) & 0x3f)));
+      output.push_back(char(0x80 | (unit & 0x3f)));
+    }
+  }
+  return output;
+}
+
+void check_round_trip(const std::u16string &utf16) {
+  std::string utf8(simdutf::utf8_length_from_utf16(utf16.data(), utf16.size()),
+                   '\0');
+  utf8.resize(
+      simdutf::convert_utf16_to_utf8(utf16.data(), utf16.size(), &utf8[0]));
+
+  for (bool modified : {false, true}) {
+    const std::string expected = reference_cesu8(utf16, modified);
+    const size_t from_utf16 =
+        modified ? simdutf::mutf8_length_from_utf16(utf16.data(), utf16.size())
+                 : simdutf::cesu8_length_from_utf16(utf16.data(), utf16.size());
+    const size_t from_utf8 =
+        modified ? simdutf::mutf8_length_from_utf8(utf8.data(), utf8.size())
+                 : simdutf::cesu8_length_from_utf8(utf8.data(), utf8.size());
+    ASSERT_EQUAL(from_utf16, expected.size());
+    ASSERT_EQUAL(from_utf8, expected.size());
+
+    std::string encoded(expected.size(), '\0');
+    const size_t written =
+        modified
+            ? simdutf::convert_utf16_to_mutf8(utf16.data(), utf16.size(),
+                                              &encoded[0])
+            : simdutf::convert_utf16_to_cesu8(utf16.data(), utf16.size(),
+                                              &encoded[0]);
+    ASSERT_EQUAL(written, expected.size());
+    ASSERT_TRUE(encoded == expected);
+
+    encoded.assign(expected.size(), '\0');
+    simdutf::result r;
+    if (!modified) {
+      r = simdutf::convert_utf16_to_cesu8_with_errors(
+          utf16.data(), utf16.size(), &encoded[0]);
+      ASSERT_EQUAL(r.error, error_code::SUCCESS);
+      ASSERT_EQUAL(r.count, expected.size());
+      ASSERT_TRUE(encoded == expected);
+      encoded.assign(expected.size(), '\0');
+    }
+
+    r = modified ? simdutf::convert_utf8_to_mutf8_with_errors(
+                       utf8.data(), utf8.size(), &encoded[0])
+                 : simdutf::convert_utf8_to_cesu8_with_errors(
+                       utf8.data(), utf8.size(), &encoded[0]);
+    ASSERT_EQUAL(r.error, error_code::SUCCESS);
+    ASSERT_EQUAL(r.count, expected.size());
+    ASSERT_TRUE(encoded == expected);
+
+    ASSERT_TRUE(modified ? simdutf::validate_mutf8(expected.data(),
+                                                   expected.size())
+                         : simdutf::validate_cesu8(expected.data(),
+                                                   expected.size()));
+    std::u16string decoded(expected.size(), u'\0');
+    r = modified ? simdutf::convert_mutf8_to_utf16_with_errors(
+                       expected.data(), expected.size(), &decoded[0])
+                 : simdutf::convert_cesu8_to_utf16_with_errors(
+                       expected.data(), expected.size(), &decoded[0]);
+    ASSERT_EQUAL(r.error, error_code::SUCCESS);
+    ASSERT_EQUAL(r.count, utf16.size());
+    decoded.resize(r.count);
+    ASSERT_TRUE(decoded == utf16);
+
+    std::string back(expected.size(), '\0');
+    r = modified ? simdutf::convert_mutf8_to_utf8_with_errors(
+                       expected.data(), expected.size(), &back[0])
+                 : simdutf::convert_cesu8_to_utf8_with_errors(
+                       expected.data(), expected.size(), &back[0]);
+    ASSERT_EQUAL(r.error, error_code::SUCCESS);
+    ASSERT_EQUAL(r.count, utf8.size());
+    back.resize(r.count);
+    ASSERT_TRUE(back == utf8);
+  }
+}
+
+void check_error(const std::string &input, bool modified, error_code error,
+                 size_t position) {
+  const simdutf::result r =
+      modified ? simdutf::validate_mutf8_with_errors(input.data(), input.size())
+               : simdutf::validate_cesu8_with_errors(input.data(),
+                                                     input.size());
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+  ASSERT_FALSE(modified ? simdutf::validate_mutf8(input.data(), input.size())
+                        : simdutf::validate_cesu8(input.data(), input.size()));
+
+  std::u16string utf16(input.size(), u'\0');
+  const simdutf::result r16 =
+      modified ? simdutf::convert_mutf8_to_utf16_with_errors(
+                     input.data(), input.size(), &utf16[0])
+               : simdutf::convert_cesu8_to_utf16_with_errors(
+                     input.data(), input.size(), &utf16[0]);
+  ASSERT_EQUAL(r16.error, error);
+  ASSERT_EQUAL(r16.count, position);
+
+  std::string utf8(input.size(), '\0');
+  const simdutf::result r8 =
+      modified ? simdutf::convert_mutf8_to_utf8_with_errors(
+                     input.data(), input.size(), &utf8[0])
+               : simdutf::convert_cesu8_to_utf8_with_errors(
+                     input.data(), input.size(), &utf8[0]);
+  ASSERT_EQUAL(r8.error, error);
+  ASSERT_EQUAL(r8.count, position);
+}
+} // namespace
+
+TEST(examples) {
+  // U+1F600 is the surrogate pair D83D DE00.
+  const std::u16string utf16 = {u'a', 0, 0xd83d, 0xde00, 0x00e9};
+  ASSERT_TRUE(reference_cesu8(utf16, true) ==
+              "a\xc0\x80\xed\xa0\xbd\xed\xb8\x80\xc3\xa9");
+  check_round_trip(utf16);
+}
+
+TEST(random_strings) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size = 0; size < 100; size++) {
+      check_round_trip(random_utf16(seed, size, 8));
+    }
+    for (size_t special_rate : {2, 50, 100000}) {
+      check_round_trip(random_utf16(seed, 5000, special_rate));
+    }
+  }
+}
+
+TEST(lone_surrogates) {
+  // Java strings may contain them: they survive a round trip through modified
+  // UTF-8, but they are not valid CESU-8 and UTF-8 has no form for them.
+  const char16_t utf16[] = {u'a', 0xdc00, 0xd800, u'b', 0xd800};
+  std::string encoded(15, '\0');
+  const size_t written = simdutf::convert_utf16_to_mutf8(utf16, 5, &encoded[0]);
+  ASSERT_EQUAL(written, size_t(11));
+  encoded.resize(written);
+  ASSERT_TRUE(encoded == "a\xed\xb0\x80\xed\xa0\x80" "b\xed\xa0\x80");
+  check_error(encoded, false, error_code::SURROGATE, 1);
+
+  ASSERT_TRUE(simdutf::validate_mutf8(encoded.data(), encoded.size()));
+  std::u16string decoded(encoded.size(), u'\0');
+  const simdutf::result r = simdutf::convert_mutf8_to_utf16_with_errors(
+      encoded.data(), encoded.size(), &decoded[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(5));
+  decoded.resize(r.count);
+  ASSERT_TRUE(decoded == std::u16string(utf16, 5));
+
+  std::string utf8(encoded.size(), '\0');
+  const simdutf::result r8 = simdutf::convert_mutf8_to_utf8_with_errors(
+      encoded.data(), encoded.size(), &utf8[0]);
+  ASSERT_EQUAL(r8.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r8.count, size_t(1));
+
+  check_error("a\xed\xa0\x80", false, error_code::SURROGATE, 1);
+  check_error("a\xed\xa0\x80\xed\xa0\x80", false, error_code::SURROGATE, 1);
+  // A truncated surrogate sequence is still invalid.
+  check_error("a\xed\xa0", true, error_code::TOO_SHORT, 1);
+}
+
+TEST(lone_surrogates_to_cesu8) {
+  // The lone surrogate is first alone, then followed by a character which is
+  // not a low surrogate, then at the end of the input, then after the first
+  // block.
+  std::u16string prefix;
+  for (size_t i = 0; i < 1500; i++) {
+    prefix += {u'a', 0xd83d, 0xde00};
+  }
+  const std::vector<std::pair<std::u16string, size_t>> inputs = {
+      {{u'a', 0xdc00, u'b'}, 1},
+      {{u'a', 0xd83d, 0xde00, 0xd800, u'b'}, 3},
+      {{u'a', 0xd800, 0xd800, 0xdc00}, 1},
+      {{u'a', u'b', 0xd800}, 2},
+      {prefix + char16_t(0xdfff), prefix.size()},
+  };
+  for (const auto &input : inputs) {
+    const std::u16string &utf16 = input.first;
+    std::string encoded(3 * utf16.size(), '\0');
+    ASSERT_EQUAL(simdutf::convert_utf16_to_cesu8(utf16.data(), utf16.size(),
+                                                 &encoded[0]),
+                 size_t(0));
+    const simdutf::result r = simdutf::convert_utf16_to_cesu8_with_errors(
+        utf16.data(), utf16.size(), &encoded[0]);
+    ASSERT_EQUAL(r.error, error_code::SURROGATE);
+    ASSERT_EQUAL(r.count, input.second);
+
+    // Modified UTF-8 writes them.
+    ASSERT_EQUAL(simdutf::convert_utf16_to_mutf8(utf16.data(), utf16.size(),
+                                                 &encoded[0]),
+                 simdutf::mutf8_length_from_utf16(utf16.data(), utf16.size()));
+  }
+}
+
+TEST(invalid_sequences) {
+  // UTF-8 sequences of four bytes.
+  check_error("ab\xf0\x9f\x98\x80", false, error_code::HEADER_BITS, 2);
+  check_error("ab\xf0\x9f\x98\x80", true, error_code::HEADER_BITS, 2);
+  // Zero bytes are not allowed in modified UTF-8, and C0 80 only there.
+  check_error(std::string("ab\0c", 4), true, error_code::HEADER_BITS, 2);
+  check_error("ab\xc0\x80", false, error_code::OVERLONG, 2);
+  check_error("\xc3\xa9\xc3", true, error_code::TOO_SHORT, 2);
+  check_error("\xc3\xa9\xff", false, error_code::HEADER_BITS, 2);
+  check_error("\xc3\xa9\x80", true, error_code::TOO_LONG, 2);
+
+  // Errors after the first block.
+  std::string long_input;
+  for (size_t i = 0; i < 1000; i++) {
+    long_input += "\xed\xa0\xbd\xed\xb8\x80\xc0\x80\xc3\xa9";
+  }
+  ASSERT_TRUE(simdutf::validate_mutf8(long_input.data(), long_input.size()));
+  check_error(long_input + "\xed\xb8", true, error_code::TOO_SHORT,
+              long_input.size());
+  check_error(long_input + '\0', true, error_code::HEADER_BITS,
+              long_input.size());
+  check_error(long_input, false, error_code::OVERLONG, 6);
+
+  std::string output(16, '\0');
+  simdutf::result r = simdutf::convert_utf8_to_mutf8_with_errors(
+      "a\xf0\x9f\x98", 4, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(1));
+  r = simdutf::convert_utf8_to_cesu8_with_errors("a\xf8\x80", 3, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::HEADER_BITS);
+  ASSERT_EQUAL(r.count, size_t(1));
+  r = simdutf::convert_utf8_to_cesu8_with_errors("ab\xed\xa0\x80", 5,
+                                                 &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, size_t(2));
+}
+
+TEST_MAIN
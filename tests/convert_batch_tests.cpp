@@ -0,0 +1,192 @@
+#include "simdutf.h"
+
+#include <utility>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf16.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// Many short strings, as an RPC layer would see them.
+template <typename char_type> struct batch {
+  std::vector<std::vector<char_type>> strings;
+  std::vector<const char_type *> inputs;
+  std::vector<size_t> lengths;
+
+  void add(std::vector<char_type> string) {
+    strings.push_back(std::move(string));
+  }
+
+  // Call once all strings are added: the vector may move them before.
+  void finish() {
+    for (const std::vector<char_type> &string : strings) {
+      inputs.push_back(string.data());
+      lengths.push_back(string.size());
+    }
+  }
+
+  size_t total_length() const {
+    size_t total = 0;
+    for (size_t length : lengths) {
+      total += length;
+    }
+    return total;
+  }
+};
+
+batch<char> random_utf8_batch(uint32_t seed, size_t count, size_t max_length) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  simdutf::tests::helpers::RandomInt random_length(0, max_length, seed);
+  batch<char> b;
+  for (size_t i = 0; i < count; i++) {
+    const std::vector<uint8_t> utf8 = generator.generate(random_length());
+    b.add(std::vector<char>(utf8.begin(), utf8.end()));
+  }
+  return b;
+}
+
+batch<char16_t> random_utf16le_batch(uint32_t seed, size_t count,
+                                     size_t max_length) {
+  simdutf::tests::helpers::random_utf16 generator{seed, 1, 1};
+  simdutf::tests::helpers::RandomInt random_length(0, max_length, seed);
+  batch<char16_t> b;
+  for (size_t i = 0; i < count; i++) {
+    b.add(generator.generate_le(random_length()));
+  }
+  return b;
+}
+
+// Checks a batch conversion against the single-string function, string by
+// string.
+template <typename from, typename to>
+void check_batch(const batch<from> &b, size_t output_length,
+                 size_t (*batched)(const from *const *, const size_t *, size_t,
+                                   to *, size_t *, simdutf::result *) noexcept,
+                 simdutf::result (*single)(const from *, size_t,
+                                           to *) noexcept) {
+  const size_t count = b.inputs.size();
+  std::vector<to> output(output_length);
+  std::vector<simdutf::result> results(count);
+  std::vector<size_t> offsets(count + 1);
+  const size_t errors =
+      batched(b.inputs.data(), b.lengths.data(), count, output.data(),
+              offsets.data(), results.data());
+  size_t expected_errors = 0;
+  ASSERT_EQUAL(offsets[0], size_t(0));
+  for (size_t i = 0; i < count; i++) {
+    std::vector<to> expected(3 * b.lengths[i]);
+    const simdutf::result e =
+        single(b.inputs[i], b.lengths[i], expected.data());
+    ASSERT_EQUAL(results[i].error, e.error);
+    ASSERT_EQUAL(results[i].count, e.count);
+    if (e.error == simdutf::error_code::SUCCESS) {
+      ASSERT_EQUAL(offsets[i + 1] - offsets[i], e.count);
+      for (size_t j = 0; j < e.count; j++) {
+        ASSERT_EQUAL(output[offsets[i] + j], expected[j]);
+      }
+    } else {
+      ASSERT_EQUAL(offsets[i + 1], offsets[i]);
+      expected_errors++;
+    }
+  }
+  ASSERT_EQUAL(errors, expected_errors);
+  // The results are optional.
+  std::vector<size_t> offsets_only(count + 1);
+  ASSERT_EQUAL(batched(b.inputs.data(), b.lengths.data(), count, output.data(),
+                       offsets_only.data(), nullptr),
+               expected_errors);
+  ASSERT_TRUE(offsets_only == offsets);
+}
+} // namespace
+
+TEST(empty_batch) {
+  size_t offset = 42;
+  char16_t utf16[1];
+  ASSERT_EQUAL(simdutf::convert_utf8_to_utf16le_batch(nullptr, nullptr, 0,
+                                                      utf16, &offset, nullptr),
+               size_t(0));
+  ASSERT_EQUAL(offset, size_t(0));
+  char utf8[1];
+  offset = 42;
+  ASSERT_EQUAL(simdutf::convert_utf16le_to_utf8_batch(nullptr, nullptr, 0, utf8,
+                                                      &offset, nullptr),
+               size_t(0));
+  ASSERT_EQUAL(offset, size_t(0));
+}
+
+TEST(utf8_to_utf16_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    for (size_t max_length : {4, 16, 64, 300}) {
+      batch<char> b = random_utf8_batch(seed, 200, max_length);
+      b.finish();
+      const size_t output_length = b.total_length();
+      check_batch(b, output_length, simdutf::convert_utf8_to_utf16le_batch,
+                  simdutf::convert_utf8_to_utf16le_with_errors);
+      check_batch(b, output_length, simdutf::convert_utf8_to_utf16be_batch,
+                  simdutf::convert_utf8_to_utf16be_with_errors);
+      check_batch(b, output_length, simdutf::convert_utf8_to_utf16_batch,
+                  simdutf::convert_utf8_to_utf16_with_errors);
+    }
+  }
+}
+
+TEST(utf8_to_utf16_with_errors) {
+  for (uint32_t seed : {1, 2, 3}) {
+    batch<char> b = random_utf8_batch(seed, 200, 64);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    for (size_t i = 0; i < b.strings.size(); i += 3) {
+      std::vector<char> &string = b.strings[i];
+      if (!string.empty()) {
+        string[string.size() / 2] = char(random_byte());
+      }
+    }
+    // A string ending with a truncated character followed by a string
+    // starting with a continuation byte.
+    b.add({'a', char(0xe2), char(0x82)});
+    b.add({char(0xac), 'b'});
+    b.finish();
+    check_batch(b, b.total_length(), simdutf::convert_utf8_to_utf16le_batch,
+                simdutf::convert_utf8_to_utf16le_with_errors);
+    check_batch(b, b.total_length(), simdutf::convert_utf8_to_utf16be_batch,
+                simdutf::convert_utf8_to_utf16be_with_errors);
+  }
+}
+
+TEST(utf16_to_utf8_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    for (size_t max_length : {4, 16, 64, 300}) {
+      batch<char16_t> b = random_utf16le_batch(seed, 200, max_length);
+      b.finish();
+      check_batch(b, 3 * b.total_length(),
+                  simdutf::convert_utf16le_to_utf8_batch,
+                  simdutf::convert_utf16le_to_utf8_with_errors);
+    }
+  }
+}
+
+TEST(utf16_to_utf8_with_errors) {
+  for (uint32_t seed : {1, 2, 3}) {
+    batch<char16_t> b = random_utf16le_batch(seed, 200, 64);
+    const bool little = simdutf::match_system(simdutf::endianness::LITTLE);
+    for (size_t i = 0; i < b.strings.size(); i += 4) {
+      std::vector<char16_t> &string = b.strings[i];
+      if (!string.empty()) {
+        string[string.size() / 2] = little ? char16_t(0xdc00) : char16_t(0xdc);
+      }
+    }
+    b.finish();
+    check_batch(b, 3 * b.total_length(),
+                simdutf::convert_utf16le_to_utf8_batch,
+                simdutf::convert_utf16le_to_utf8_with_errors);
+    // Read as big endian, the same strings are mostly garbage.
+    check_batch(b, 3 * b.total_length(),
+                simdutf::convert_utf16be_to_utf8_batch,
+                simdutf::convert_utf16be_to_utf8_with_errors);
+    check_batch(b, 3 * b.total_length(), simdutf::convert_utf16_to_utf8_batch,
+                simdutf::convert_utf16_to_utf8_with_errors);
+  }
+}
+
+TEST_MAIN
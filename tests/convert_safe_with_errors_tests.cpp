@@ -0,0 +1,333 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::error_code;
+using simdutf::full_result;
+using simdutf::result;
+
+constexpr size_t input_sizes[] = {0, 1, 15, 16, 17, 64, 100, 1000, 5000};
+constexpr size_t capacities[] = {4, 5, 7, 16, 17, 33, 64, 100, 1000, 100000};
+
+// Each encoding can encode a list of code points and corrupt the result.
+struct utf8 {
+  using type = char;
+  static std::vector<char> encode(const std::vector<char32_t> &code_points) {
+    std::vector<char> output(4 * code_points.size());
+    output.resize(simdutf::convert_valid_utf32_to_utf8(
+        code_points.data(), code_points.size(), output.data()));
+    return output;
+  }
+  static void corrupt(std::vector<char> &input, size_t position) {
+    input[position] = char(0x80 + (position & 0x7f));
+  }
+};
+
+struct utf16 {
+  using type = char16_t;
+  static std::vector<char16_t>
+  encode(const std::vector<char32_t> &code_points) {
+    std::vector<char16_t> output(2 * code_points.size());
+    output.resize(simdutf::convert_valid_utf32_to_utf16(
+        code_points.data(), code_points.size(), output.data()));
+    return output;
+  }
+  static void corrupt(std::vector<char16_t> &input, size_t position) {
+    input[position] = char16_t(0xd800 + (position & 0x7ff));
+  }
+};
+
+struct utf32 {
+  using type = char32_t;
+  static std::vector<char32_t>
+  encode(const std::vector<char32_t> &code_points) {
+    return code_points;
+  }
+  static void corrupt(std::vector<char32_t> &input, size_t position) {
+    input[position] = position % 2 == 0 ? 0xdfff : 0x110000;
+  }
+};
+
+struct latin1 {
+  using type = char;
+  static std::vector<char> encode(const std::vector<char32_t> &code_points) {
+    std::vector<char> output(code_points.size());
+    output.resize(simdutf::convert_utf32_to_latin1(
+        code_points.data(), code_points.size(), output.data()));
+    return output;
+  }
+  static void corrupt(std::vector<char> &, size_t) {}
+};
+
+std::vector<char32_t> random_code_points(uint32_t seed, size_t size,
+                                         bool latin1_only) {
+  simdutf::tests::helpers::RandomIntRanges random(
+      {{0x0000, 0x007f},
+       {0x0080, 0x00ff},
+       {0x0100, 0x07ff},
+       {0x0800, 0xd7ff},
+       {0xe000, 0xffff},
+       {0x10000, 0x10ffff}},
+      seed);
+  std::vector<char32_t> code_points(size);
+  for (char32_t &c : code_points) {
+    c = char32_t(random());
+    if (latin1_only) {
+      c &= 0xff;
+    }
+  }
+  return code_points;
+}
+
+// Converts the whole input through a buffer of the given capacity, resuming
+// after each OUTPUT_BUFFER_TOO_SMALL, and compares with the reference
+// conversion.
+template <typename From, typename To, typename Safe, typename Reference>
+void check(const std::vector<typename From::type> &input, size_t capacity,
+           Safe safe, Reference reference) {
+  using out_type = typename To::type;
+  std::vector<out_type> expected(4 * input.size() + 4);
+  const result whole = reference(input.data(), input.size(), expected.data());
+  const size_t valid_end =
+      whole.error == error_code::SUCCESS ? input.size() : whole.count;
+  const result prefix = reference(input.data(), valid_end, expected.data());
+  ASSERT_EQUAL(prefix.error, error_code::SUCCESS);
+  expected.resize(prefix.count);
+
+  const out_type sentinel = out_type(0x2a);
+  std::vector<out_type> output;
+  std::vector<out_type> buffer(capacity + 1);
+  std::vector<out_type> scratch(capacity + 1);
+  size_t position = 0;
+  while (true) {
+    std::fill(buffer.begin(), buffer.end(), sentinel);
+    const full_result r = safe(input.data() + position, input.size() - position,
+                               buffer.data(), capacity);
+    ASSERT_TRUE(r.output_count <= capacity);
+    ASSERT_EQUAL(buffer[capacity], sentinel);
+    output.insert(output.end(), buffer.begin(),
+                  buffer.begin() + r.output_count);
+    if (r.error != error_code::OUTPUT_BUFFER_TOO_SMALL) {
+      ASSERT_EQUAL(r.error, whole.error);
+      ASSERT_EQUAL(position + r.input_count, valid_end);
+      break;
+    }
+    // Any character fits in four code units, so there is progress, and the
+    // next character does not fit in what is left.
+    ASSERT_TRUE(r.input_count > 0);
+    ASSERT_TRUE(position + r.input_count < valid_end);
+    const full_result next = safe(
+        input.data() + position + r.input_count,
+        input.size() - position - r.input_count, scratch.data(),
+        capacity - r.output_count);
+    ASSERT_EQUAL(next.error, error_code::OUTPUT_BUFFER_TOO_SMALL);
+    ASSERT_EQUAL(next.input_count, size_t(0));
+    position += r.input_count;
+  }
+  ASSERT_TRUE(output == expected);
+}
+
+template <typename From, typename To, typename Safe, typename Reference>
+void check_pair(Safe safe, Reference reference) {
+  const bool latin1_only = std::is_same<From, latin1>::value;
+  const bool to_latin1 = std::is_same<To, latin1>::value;
+  for (uint32_t seed = 0; seed < 4; seed++) {
+    for (size_t size : input_sizes) {
+      std::vector<char32_t> code_points =
+          random_code_points(seed, size, latin1_only || to_latin1);
+      const std::vector<typename From::type> input = From::encode(code_points);
+      for (size_t capacity : capacities) {
+        check<From, To>(input, capacity, safe, reference);
+      }
+      if (input.empty()) {
+        continue;
+      }
+      simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                         seed);
+      std::vector<typename From::type> corrupted = input;
+      From::corrupt(corrupted, random_position());
+      if (to_latin1) {
+        // A character that Latin1 cannot represent.
+        code_points[random_position() % code_points.size()] = 0x20ac;
+        corrupted = From::encode(code_points);
+      }
+      for (size_t capacity : capacities) {
+        check<From, To>(corrupted, capacity, safe, reference);
+      }
+    }
+  }
+}
+} // namespace
+
+TEST(utf8_to_utf16) {
+  check_pair<utf8, utf16>(
+      [](const char *in, size_t len, char16_t *out, size_t cap) {
+        return simdutf::convert_utf8_to_utf16_safe_with_errors(in, len, out,
+                                                               cap);
+      },
+      [](const char *in, size_t len, char16_t *out) {
+        return simdutf::convert_utf8_to_utf16_with_errors(in, len, out);
+      });
+}
+
+TEST(utf8_to_utf32) {
+  check_pair<utf8, utf32>(
+      [](const char *in, size_t len, char32_t *out, size_t cap) {
+        return simdutf::convert_utf8_to_utf32_safe_with_errors(in, len, out,
+                                                               cap);
+      },
+      [](const char *in, size_t len, char32_t *out) {
+        return simdutf::convert_utf8_to_utf32_with_errors(in, len, out);
+      });
+}
+
+TEST(utf8_to_latin1) {
+  check_pair<utf8, latin1>(
+      [](const char *in, size_t len, char *out, size_t cap) {
+        return simdutf::convert_utf8_to_latin1_safe_with_errors(in, len, out,
+                                                                cap);
+      },
+      [](const char *in, size_t len, char *out) {
+        return simdutf::convert_utf8_to_latin1_with_errors(in, len, out);
+      });
+}
+
+TEST(utf16_to_utf8) {
+  check_pair<utf16, utf8>(
+      [](const char16_t *in, size_t len, char *out, size_t cap) {
+        return simdutf::convert_utf16_to_utf8_safe_with_errors(in, len, out,
+                                                               cap);
+      },
+      [](const char16_t *in, size_t len, char *out) {
+        return simdutf::convert_utf16_to_utf8_with_errors(in, len, out);
+      });
+}
+
+TEST(utf16_to_utf32) {
+  check_pair<utf16, utf32>(
+      [](const char16_t *in, size_t len, char32_t *out, size_t cap) {
+        return simdutf::convert_utf16_to_utf32_safe_with_errors(in, len, out,
+                                                                cap);
+      },
+      [](const char16_t *in, size_t len, char32_t *out) {
+        return simdutf::convert_utf16_to_utf32_with_errors(in, len, out);
+      });
+}
+
+TEST(utf16_to_latin1) {
+  check_pair<utf16, latin1>(
+      [](const char16_t *in, size_t len, char *out, size_t cap) {
+        return simdutf::convert_utf16_to_latin1_safe_with_errors(in, len, out,
+                                                                 cap);
+      },
+      [](const char16_t *in, size_t len, char *out) {
+        return simdutf::convert_utf16_to_latin1_with_errors(in, len, out);
+      });
+}
+
+TEST(utf32_to_utf8) {
+  check_pair<utf32, utf8>(
+      [](const char32_t *in, size_t len, char *out, size_t cap) {
+        return simdutf::convert_utf32_to_utf8_safe_with_errors(in, len, out,
+                                                               cap);
+      },
+      [](const char32_t *in, size_t len, char *out) {
+        return simdutf::convert_utf32_to_utf8_with_errors(in, len, out);
+      });
+}
+
+TEST(utf32_to_utf16) {
+  check_pair<utf32, utf16>(
+      [](const char32_t *in, size_t len, char16_t *out, size_t cap) {
+        return simdutf::convert_utf32_to_utf16_safe_with_errors(in, len, out,
+                                                                cap);
+      },
+      [](const char32_t *in, size_t len, char16_t *out) {
+        return simdutf::convert_utf32_to_utf16_with_errors(in, len, out);
+      });
+}
+
+TEST(utf32_to_latin1) {
+  check_pair<utf32, latin1>(
+      [](const char32_t *in, size_t len, char *out, size_t cap) {
+        return simdutf::convert_utf32_to_latin1_safe_with_errors(in, len, out,
+                                                                 cap);
+      },
+      [](const char32_t *in, size_t len, char *out) {
+        return simdutf::convert_utf32_to_latin1_with_errors(in, len, out);
+      });
+}
+
+TEST(latin1_to_utf8) {
+  check_pair<latin1, utf8>(
+      [](const char *in, size_t len, char *out, size_t cap) {
+        return simdutf::convert_latin1_to_utf8_safe_with_errors(in, len, out,
+                                                                cap);
+      },
+      [](const char *in, size_t len, char *out) {
+        return result(error_code::SUCCESS,
+                      simdutf::convert_latin1_to_utf8(in, len, out));
+      });
+}
+
+TEST(latin1_to_utf16) {
+  check_pair<latin1, utf16>(
+      [](const char *in, size_t len, char16_t *out, size_t cap) {
+        return simdutf::convert_latin1_to_utf16_safe_with_errors(in, len, out,
+                                                                 cap);
+      },
+      [](const char *in, size_t len, char16_t *out) {
+        return result(error_code::SUCCESS,
+                      simdutf::convert_latin1_to_utf16(in, len, out));
+      });
+}
+
+TEST(latin1_to_utf32) {
+  check_pair<latin1, utf32>(
+      [](const char *in, size_t len, char32_t *out, size_t cap) {
+        return simdutf::convert_latin1_to_utf32_safe_with_errors(in, len, out,
+                                                                 cap);
+      },
+      [](const char *in, size_t len, char32_t *out) {
+        return result(error_code::SUCCESS,
+                      simdutf::convert_latin1_to_utf32(in, len, out));
+      });
+}
+
+TEST(examples) {
+  // U+00E9 U+20AC U+1F600: the surrogate pair does not fit.
+  const char input[] = "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+  char16_t utf16[3];
+  full_result r =
+      simdutf::convert_utf8_to_utf16_safe_with_errors(input, 9, utf16, 3);
+  ASSERT_EQUAL(r.error, error_code::OUTPUT_BUFFER_TOO_SMALL);
+  ASSERT_EQUAL(r.input_count, size_t(5));
+  ASSERT_EQUAL(r.output_count, size_t(2));
+  // Resume where the conversion stopped.
+  r = simdutf::convert_utf8_to_utf16_safe_with_errors(input + 5, 4, utf16, 3);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.input_count, size_t(4));
+  ASSERT_EQUAL(r.output_count, size_t(2));
+
+  char utf8[6];
+  const char32_t code_points[] = {0xe9, 0x20ac, 0x1f600};
+  r = simdutf::convert_utf32_to_utf8_safe_with_errors(code_points, 3, utf8, 6);
+  ASSERT_EQUAL(r.error, error_code::OUTPUT_BUFFER_TOO_SMALL);
+  ASSERT_EQUAL(r.input_count, size_t(2));
+  ASSERT_EQUAL(r.output_count, size_t(5));
+
+  // Errors are reported with the position of the input.
+  const char32_t invalid[] = {'a', 0x110000};
+  r = simdutf::convert_utf32_to_utf8_safe_with_errors(invalid, 2, utf8, 6);
+  ASSERT_EQUAL(r.error, error_code::TOO_LARGE);
+  ASSERT_EQUAL(r.input_count, size_t(1));
+  ASSERT_EQUAL(r.output_count, size_t(1));
+}
+
+TEST_MAIN
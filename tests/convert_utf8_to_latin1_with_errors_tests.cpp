@@ -1,6 +1,7 @@
 #include "simdutf.h"
 
 #include <array>
+#include <string>
 
 #include <tests/helpers/fixed_string.h>
 #include <tests/helpers/random_int.h>
@@ -544,6 +545,22 @@ TEST(issue_446) {
   ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
 }
 
+// The output before the error must be written, also after the first block.
+TEST(output_before_error) {
+  for (size_t position : {10, 64, 100, 200}) {
+    std::string input(position, 'a');
+    input += "\xc4\x80";
+    std::vector<char> output(input.size(), 'x');
+    const auto r = implementation.convert_utf8_to_latin1_with_errors(
+        input.data(), input.size(), output.data());
+    ASSERT_EQUAL(r.error, simdutf::error_code::TOO_LARGE);
+    ASSERT_EQUAL(r.count, position);
+    for (size_t i = 0; i < position; i++) {
+      ASSERT_EQUAL(output[i], 'a');
+    }
+  }
+}
+
 #if SIMDUTF_CPLUSPLUS23
 
 namespace {
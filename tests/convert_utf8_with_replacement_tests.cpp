@@ -0,0 +1,239 @@
+#include "simdutf.h"
+
+#include <array>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// The UTF-8 decoder of the WHATWG Encoding Standard, one byte at a time.
+std::vector<char32_t> whatwg_decode(const std::vector<char> &input) {
+  std::vector<char32_t> output;
+  char32_t code_point = 0;
+  size_t bytes_needed = 0;
+  size_t bytes_seen = 0;
+  uint8_t lower = 0x80;
+  uint8_t upper = 0xbf;
+  for (size_t i = 0; i < input.size(); i++) {
+    const uint8_t byte = uint8_t(input[i]);
+    if (bytes_needed == 0) {
+      if (byte < 0x80) {
+        output.push_back(byte);
+      } else if (byte >= 0xc2 && byte <= 0xdf) {
+        bytes_needed = 1;
+        code_point = byte & 0x1f;
+      } else if (byte >= 0xe0 && byte <= 0xef) {
+        lower = byte == 0xe0 ? 0xa0 : 0x80;
+        upper = byte == 0xed ? 0x9f : 0xbf;
+        bytes_needed = 2;
+        code_point = byte & 0xf;
+      } else if (byte >= 0xf0 && byte <= 0xf4) {
+        lower = byte == 0xf0 ? 0x90 : 0x80;
+        upper = byte == 0xf4 ? 0x8f : 0xbf;
+        bytes_needed = 3;
+        code_point = byte & 0x7;
+      } else {
+        output.push_back(0xfffd);
+      }
+      continue;
+    }
+    if (byte < lower || byte > upper) {
+      code_point = 0;
+      bytes_needed = 0;
+      bytes_seen = 0;
+      lower = 0x80;
+      upper = 0xbf;
+      output.push_back(0xfffd);
+      i--; // The byte is processed again.
+      continue;
+    }
+    lower = 0x80;
+    upper = 0xbf;
+    code_point = (code_point << 6) | (byte & 0x3f);
+    if (++bytes_seen == bytes_needed) {
+      output.push_back(code_point);
+      code_point = 0;
+      bytes_needed = 0;
+      bytes_seen = 0;
+    }
+  }
+  if (bytes_needed != 0) {
+    output.push_back(0xfffd);
+  }
+  return output;
+}
+
+std::vector<char16_t> to_utf16(const std::vector<char32_t> &code_points,
+                               bool big_endian) {
+  std::vector<char16_t> output;
+  for (char32_t c : code_points) {
+    if (c < 0x10000) {
+      output.push_back(char16_t(c));
+    } else {
+      output.push_back(char16_t(0xd800 + ((c - 0x10000) >> 10)));
+      output.push_back(char16_t(0xdc00 + ((c - 0x10000) & 0x3ff)));
+    }
+  }
+  if (big_endian != !simdutf::match_system(simdutf::endianness::LITTLE)) {
+    for (char16_t &unit : output) {
+      unit = char16_t((unit >> 8) | (unit << 8));
+    }
+  }
+  return output;
+}
+
+std::vector<char> to_chars(const std::vector<uint8_t> &utf8) {
+  return std::vector<char>(utf8.begin(), utf8.end());
+}
+
+// Converts with every function of the implementation, into buffers of the
+// exact size given by the length functions, and compares with the decoder.
+void check(const simdutf::implementation &implementation,
+           const std::vector<char> &input) {
+  const std::vector<char32_t> expected32 = whatwg_decode(input);
+  const simdutf::result valid =
+      implementation.validate_utf8_with_errors(input.data(), input.size());
+
+  const simdutf::result length32 =
+      implementation.utf32_length_from_utf8_with_replacement(input.data(),
+                                                             input.size());
+  ASSERT_EQUAL(length32.count, expected32.size());
+  ASSERT_EQUAL(length32.error, valid.error);
+  std::vector<char32_t> utf32(length32.count);
+  ASSERT_EQUAL(implementation.convert_utf8_to_utf32_with_replacement(
+                   input.data(), input.size(), utf32.data()),
+               expected32.size());
+  ASSERT_TRUE(utf32 == expected32);
+
+  for (bool big_endian : {false, true}) {
+    const std::vector<char16_t> expected16 = to_utf16(expected32, big_endian);
+    const simdutf::result length16 =
+        implementation.utf16_length_from_utf8_with_replacement(input.data(),
+                                                               input.size());
+    ASSERT_EQUAL(length16.count, expected16.size());
+    ASSERT_EQUAL(length16.error, valid.error);
+    std::vector<char16_t> utf16(length16.count);
+    const size_t written =
+        big_endian ? implementation.convert_utf8_to_utf16be_with_replacement(
+                         input.data(), input.size(), utf16.data())
+                   : implementation.convert_utf8_to_utf16le_with_replacement(
+                         input.data(), input.size(), utf16.data());
+    ASSERT_EQUAL(written, expected16.size());
+    ASSERT_TRUE(utf16 == expected16);
+  }
+}
+} // namespace
+
+TEST(whatwg_examples) {
+  // Examples of the Unicode Standard, section 3.9, table 3-8 and following.
+  const std::vector<std::vector<char>> inputs = {
+      {},
+      {char(0xf0), char(0x80), char(0x80)},
+      {char(0xe2), char(0x82)},
+      {char(0xe2), char(0x82), 'a'},
+      {char(0xc0), char(0xaf), char(0xe0), char(0x80), char(0xbf), char(0xf0),
+       char(0x81), char(0x82), 'A'},
+      {char(0xed), char(0xa0), char(0x80), char(0xed), char(0xbf), char(0xbf),
+       char(0xed), char(0xaf), 'A'},
+      {char(0xf4), char(0x91), char(0x92), char(0x93), char(0xff), 'A',
+       char(0x80), char(0xbf), 'B'},
+      {char(0xe1), char(0x80), char(0xe2), char(0xf0), char(0x91), char(0x92),
+       char(0xf1), char(0xbf), 'A'},
+      {char(0xf0), char(0x9f), char(0x98)},
+      {char(0xf0), char(0x9f), char(0x98), char(0x80)}};
+  for (const std::vector<char> &input : inputs) {
+    check(implementation, input);
+  }
+  // Three U+FFFD for the overlong encoding, as the standard mandates.
+  const char overlong[] = {char(0xf0), char(0x80), char(0x80)};
+  char32_t utf32[3];
+  ASSERT_EQUAL(
+      implementation.convert_utf8_to_utf32_with_replacement(overlong, 3, utf32),
+      size_t(3));
+  ASSERT_EQUAL(utf32[0], char32_t(0xfffd));
+  ASSERT_EQUAL(utf32[2], char32_t(0xfffd));
+}
+
+TEST(valid_input) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    for (size_t size : {1, 15, 64, 65, 1000, 5000}) {
+      const std::vector<char> input = to_chars(generator.generate(size));
+      check(implementation, input);
+    }
+  }
+}
+
+TEST(corrupted_input) {
+  for (uint32_t seed = 0; seed < 100; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    simdutf::tests::helpers::RandomInt random_size(1, 2000, seed);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    simdutf::tests::helpers::RandomInt random_count(1, 20, seed);
+    std::vector<char> input = to_chars(generator.generate(random_size()));
+    simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                       seed);
+    for (size_t i = random_count(); i > 0; i--) {
+      input[random_position()] = char(random_byte());
+    }
+    check(implementation, input);
+  }
+}
+
+TEST(only_errors) {
+  // Inputs where the output is much shorter than utf16_length_from_utf8
+  // suggests, or much longer, so that the exact-size buffers are tight.
+  for (size_t size : {1, 63, 64, 200, 1000}) {
+    std::vector<char> truncated;
+    std::vector<char> continuations(size, char(0x80));
+    while (truncated.size() < size) {
+      truncated.insert(truncated.end(), {char(0xf0), char(0x9f), char(0x98)});
+    }
+    check(implementation, truncated);
+    check(implementation, continuations);
+  }
+}
+
+#if SIMDUTF_CPLUSPLUS23
+
+namespace {
+constexpr std::array<char, 6> invalid_input = {
+    char(0xf0), char(0x80), char(0x80), 'a', char(0xe2), char(0x82)};
+
+constexpr auto convert_to_utf16() {
+  std::array<char16_t,
+             simdutf::utf16_length_from_utf8_with_replacement(invalid_input)
+                 .count>
+      output{};
+  if (simdutf::convert_utf8_to_utf16_with_replacement(invalid_input, output) !=
+      output.size()) {
+    throw "oops";
+  }
+  return output;
+}
+
+constexpr auto convert_to_utf32() {
+  std::array<char32_t,
+             simdutf::utf32_length_from_utf8_with_replacement(invalid_input)
+                 .count>
+      output{};
+  if (simdutf::convert_utf8_to_utf32_with_replacement(invalid_input, output) !=
+      output.size()) {
+    throw "oops";
+  }
+  return output;
+}
+} // namespace
+
+TEST(compile_time_convert_with_replacement) {
+  static_assert(convert_to_utf16() == std::array<char16_t, 5>{
+                                          0xfffd, 0xfffd, 0xfffd, u'a', 0xfffd});
+  static_assert(convert_to_utf32() == std::array<char32_t, 5>{
+                                          0xfffd, 0xfffd, 0xfffd, U'a', 0xfffd});
+}
+
+#endif
+
+TEST_MAIN
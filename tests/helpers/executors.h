@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "simdutf.h"
+
+namespace simdutf {
+namespace tests {
+namespace helpers {
+
+// Runs each task of a batch on its own thread.
+class thread_executor : public simdutf::executor {
+public:
+  explicit thread_executor(size_t workers) : worker_count{workers} {}
+
+  size_t concurrency() const noexcept override { return worker_count; }
+
+  void run(size_t task_count, task_function task,
+           void *context) noexcept override {
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < task_count; i++) {
+      threads.emplace_back(task, context, i);
+    }
+    task(context, 0);
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    batches++;
+  }
+
+  size_t batches{0};
+
+private:
+  size_t worker_count;
+};
+
+// Runs the tasks one after the other, last one first.
+class reverse_executor : public simdutf::executor {
+public:
+  explicit reverse_executor(size_t workers) : worker_count{workers} {}
+
+  size_t concurrency() const noexcept override { return worker_count; }
+
+  void run(size_t task_count, task_function task,
+           void *context) noexcept override {
+    for (size_t i = task_count; i > 0; i--) {
+      task(context, i - 1);
+    }
+    batches++;
+  }
+
+  size_t batches{0};
+
+private:
+  size_t worker_count;
+};
+
+} // namespace helpers
+} // namespace tests
+} // namespace simdutf
@@ -0,0 +1,199 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::error_code;
+
+std::string random_bytes(uint32_t seed, size_t size) {
+  simdutf::tests::helpers::RandomInt random_byte(0, 255, seed);
+  std::string output(size, '\0');
+  for (char &c : output) {
+    c = char(random_byte());
+  }
+  return output;
+}
+
+std::string reference_hex(const std::string &input, bool uppercase) {
+  const char *digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+  std::string output;
+  for (char c : input) {
+    output.push_back(digits[uint8_t(c) >> 4]);
+    output.push_back(digits[uint8_t(c) & 0xf]);
+  }
+  return output;
+}
+
+void check_error(const std::string &input, error_code error, size_t count) {
+  std::string output(input.size() / 2, '\0');
+  simdutf::result r =
+      simdutf::hex_to_binary(input.data(), input.size(), &output[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, count);
+  const std::u16string utf16(input.begin(), input.end());
+  r = simdutf::hex_to_binary(utf16.data(), utf16.size(), &output[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, count);
+}
+} // namespace
+
+TEST(lengths) {
+  ASSERT_EQUAL(simdutf::hex_length_from_binary(0), size_t(0));
+  ASSERT_EQUAL(simdutf::hex_length_from_binary(7), size_t(14));
+  ASSERT_EQUAL(simdutf::binary_length_from_hex(14), size_t(7));
+  ASSERT_EQUAL(simdutf::binary_length_from_hex(15), size_t(7));
+}
+
+TEST(round_trip) {
+  std::vector<size_t> sizes;
+  for (size_t size = 0; size < 300; size++) {
+    sizes.push_back(size);
+  }
+  sizes.push_back(5000);
+  for (size_t size : sizes) {
+    const std::string bytes = random_bytes(uint32_t(size), size);
+    for (bool uppercase : {false, true}) {
+      const simdutf::hex_options options =
+          uppercase ? simdutf::hex_uppercase : simdutf::hex_lowercase;
+      const std::string expected = reference_hex(bytes, uppercase);
+      std::string hex(simdutf::hex_length_from_binary(size), '\0');
+      ASSERT_EQUAL(
+          implementation.binary_to_hex(bytes.data(), size, &hex[0], options),
+          expected.size());
+      ASSERT_TRUE(hex == expected);
+
+      std::string back(size, '\0');
+      simdutf::result r =
+          implementation.hex_to_binary(hex.data(), hex.size(), &back[0]);
+      ASSERT_EQUAL(r.error, error_code::SUCCESS);
+      ASSERT_EQUAL(r.count, size);
+      ASSERT_TRUE(back == bytes);
+
+      const std::u16string utf16(hex.begin(), hex.end());
+      back.assign(size, '\0');
+      r = implementation.hex_to_binary(utf16.data(), utf16.size(), &back[0]);
+      ASSERT_EQUAL(r.error, error_code::SUCCESS);
+      ASSERT_EQUAL(r.count, size);
+      ASSERT_TRUE(back == bytes);
+    }
+  }
+}
+
+TEST(mixed_case) {
+  const std::string hex = "00fF7a9B";
+  std::string output(4, '\0');
+  const simdutf::result r =
+      implementation.hex_to_binary(hex.data(), hex.size(), &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_TRUE(output == std::string("\x00\xff\x7a\x9b", 4));
+}
+
+TEST(invalid_characters) {
+  for (size_t size : {0, 10, 63, 64, 100, 1000}) {
+    const std::string hex = reference_hex(random_bytes(1234, size), false);
+    for (char invalid : {'g', 'G', '/', ':', '@', '`', ' ', '\0', '\xc0'}) {
+      for (size_t position : {size_t(0), hex.size() / 2, hex.size()}) {
+        std::string input = hex;
+        input.insert(position, 1, invalid);
+        input += "00";
+        check_error(input, error_code::INVALID_HEX_CHARACTER, position);
+      }
+    }
+  }
+  // The pairs before the error are written.
+  const std::string hex = reference_hex(std::string(100, '\x5a'), true) + "0x";
+  std::string output(101, '\0');
+  const simdutf::result r =
+      implementation.hex_to_binary(hex.data(), hex.size(), &output[0]);
+  ASSERT_EQUAL(r.error, error_code::INVALID_HEX_CHARACTER);
+  ASSERT_EQUAL(r.count, size_t(201));
+  ASSERT_TRUE(output.substr(0, 100) == std::string(100, '\x5a'));
+
+  // Units above 0xff are not narrowed.
+  for (size_t size : {1, 40, 100}) {
+    std::u16string utf16(2 * size, u'a');
+    utf16[size] = char16_t(0x130);
+    std::string bytes(size, '\0');
+    const simdutf::result r16 =
+        implementation.hex_to_binary(utf16.data(), utf16.size(), &bytes[0]);
+    ASSERT_EQUAL(r16.error, error_code::INVALID_HEX_CHARACTER);
+    ASSERT_EQUAL(r16.count, size);
+  }
+}
+
+TEST(invalid_at_each_position) {
+  const std::string hex = reference_hex(random_bytes(99, 100), true);
+  for (size_t position = 0; position < hex.size(); position++) {
+    std::string input = hex;
+    input[position] = 'g';
+    std::string output(100, '\0');
+    simdutf::result r =
+        implementation.hex_to_binary(input.data(), input.size(), &output[0]);
+    ASSERT_EQUAL(r.error, error_code::INVALID_HEX_CHARACTER);
+    ASSERT_EQUAL(r.count, position);
+    std::u16string utf16(hex.begin(), hex.end());
+    utf16[position] = char16_t(0x100 + uint8_t(hex[position]));
+    r = implementation.hex_to_binary(utf16.data(), utf16.size(), &output[0]);
+    ASSERT_EQUAL(r.error, error_code::INVALID_HEX_CHARACTER);
+    ASSERT_EQUAL(r.count, position);
+  }
+}
+
+TEST(odd_length) {
+  for (size_t size : {0, 31, 32, 100}) {
+    const std::string hex = reference_hex(random_bytes(42, size), false);
+    check_error(hex + "a", error_code::HEX_INPUT_REMAINDER, size);
+    check_error(hex + "z", error_code::INVALID_HEX_CHARACTER, 2 * size);
+  }
+}
+
+TEST(safe_decoding) {
+  const std::string bytes = random_bytes(7, 200);
+  const std::string hex = reference_hex(bytes, false);
+  const std::u16string utf16(hex.begin(), hex.end());
+  for (size_t outlen : {0, 1, 50, 199, 200, 300}) {
+    std::string output(outlen, '\0');
+    size_t written = outlen;
+    simdutf::result r =
+        simdutf::hex_to_binary_safe(hex.data(), hex.size(), &output[0],
+                                    written);
+    if (outlen < 200) {
+      ASSERT_EQUAL(r.error, error_code::OUTPUT_BUFFER_TOO_SMALL);
+      ASSERT_EQUAL(r.count, 2 * outlen);
+      ASSERT_EQUAL(written, outlen);
+    } else {
+      ASSERT_EQUAL(r.error, error_code::SUCCESS);
+      ASSERT_EQUAL(r.count, size_t(200));
+      ASSERT_EQUAL(written, size_t(200));
+    }
+    ASSERT_TRUE(output.substr(0, written) == bytes.substr(0, written));
+
+    written = outlen;
+    r = simdutf::hex_to_binary_safe(utf16.data(), utf16.size(), &output[0],
+                                    written);
+    ASSERT_EQUAL(written, std::min(outlen, size_t(200)));
+  }
+
+  std::string invalid = hex;
+  invalid[101] = 'x';
+  std::string output(200, '\0');
+  size_t written = 100;
+  simdutf::result r = simdutf::hex_to_binary_safe(
+      invalid.data(), invalid.size(), &output[0], written);
+  ASSERT_EQUAL(r.error, error_code::INVALID_HEX_CHARACTER);
+  ASSERT_EQUAL(r.count, size_t(101));
+  ASSERT_EQUAL(written, size_t(50));
+  // The invalid digit is beyond the digits that fit.
+  written = 20;
+  r = simdutf::hex_to_binary_safe(invalid.data(), invalid.size(), &output[0],
+                                  written);
+  ASSERT_EQUAL(r.error, error_code::OUTPUT_BUFFER_TOO_SMALL);
+  ASSERT_EQUAL(written, size_t(20));
+}
+
+TEST_MAIN
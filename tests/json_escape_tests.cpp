@@ -0,0 +1,250 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// Random UTF-8 text where about one character in escape_rate must be escaped.
+std::string random_text(uint32_t seed, size_t size, size_t escape_rate) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  const std::vector<uint8_t> utf8 = generator.generate(size);
+  std::string text(utf8.begin(), utf8.end());
+  simdutf::tests::helpers::RandomInt random_escape(0, escape_rate, seed);
+  simdutf::tests::helpers::RandomInt random_char(0, 5, seed);
+  const char escaped[] = {'"', '\\', '\n', '\t', '\0', '\x1f'};
+  for (char &c : text) {
+    if (uint8_t(c) < 0x80 && random_escape() == 0) {
+      c = escaped[random_char()];
+    }
+  }
+  return text;
+}
+
+std::string escape(const simdutf::implementation &implementation,
+                   const std::string &input, bool ascii_only) {
+  std::string output(6 * input.size(), '\0');
+  const simdutf::result r = implementation.escape_json_utf8(
+      input.data(), input.size(), &output[0], ascii_only);
+  if (r.error != simdutf::error_code::SUCCESS) {
+    return "error";
+  }
+  output.resize(r.count);
+  return output;
+}
+
+simdutf::result unescape(const simdutf::implementation &implementation,
+                         const std::string &input, std::string &output) {
+  output.assign(input.size(), '\0');
+  const simdutf::result r =
+      implementation.unescape_json_to_utf8(input.data(), input.size(),
+                                           &output[0]);
+  if (r.error == simdutf::error_code::SUCCESS) {
+    output.resize(r.count);
+  }
+  return r;
+}
+
+std::u16string to_utf16(const std::string &input) {
+  std::u16string output(input.size(), u'\0');
+  output.resize(simdutf::convert_utf8_to_utf16(input.data(), input.size(),
+                                               &output[0]));
+  return output;
+}
+
+// Escapes the input, checks the output and unescapes it back.
+void check_round_trip(const simdutf::implementation &implementation,
+                      const std::string &input, bool ascii_only) {
+  const std::string escaped = escape(implementation, input, ascii_only);
+  if (ascii_only) {
+    ASSERT_TRUE(simdutf::validate_ascii(escaped.data(), escaped.size()));
+  }
+  std::string unescaped;
+  const simdutf::result r = unescape(implementation, escaped, unescaped);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_TRUE(unescaped == input);
+
+  std::u16string utf16(escaped.size(), u'\0');
+  const simdutf::result r16 = implementation.unescape_json_to_utf16(
+      escaped.data(), escaped.size(), &utf16[0]);
+  ASSERT_EQUAL(r16.error, simdutf::error_code::SUCCESS);
+  utf16.resize(r16.count);
+  ASSERT_TRUE(utf16 == to_utf16(input));
+}
+
+// The input has no JSON error, so the error of escaping and unescaping it is
+// its first UTF-8 error.
+void check_utf8_error(const simdutf::implementation &implementation,
+                      const std::string &input) {
+  const simdutf::result expected =
+      simdutf::validate_utf8_with_errors(input.data(), input.size());
+  ASSERT_TRUE(expected.error != simdutf::error_code::SUCCESS);
+  std::string output(6 * input.size(), '\0');
+  for (bool ascii_only : {false, true}) {
+    const simdutf::result r = implementation.escape_json_utf8(
+        input.data(), input.size(), &output[0], ascii_only);
+    ASSERT_EQUAL(r.error, expected.error);
+    ASSERT_EQUAL(r.count, expected.count);
+  }
+  const simdutf::result r =
+      implementation.unescape_json_to_utf8(input.data(), input.size(),
+                                           &output[0]);
+  ASSERT_EQUAL(r.error, expected.error);
+  ASSERT_EQUAL(r.count, expected.count);
+  std::u16string utf16(input.size(), u'\0');
+  const simdutf::result r16 = implementation.unescape_json_to_utf16(
+      input.data(), input.size(), &utf16[0]);
+  ASSERT_EQUAL(r16.error, expected.error);
+  ASSERT_EQUAL(r16.count, expected.count);
+}
+
+void check_unescape_error(const simdutf::implementation &implementation,
+                          const std::string &input, simdutf::error_code error,
+                          size_t position) {
+  std::string output;
+  const simdutf::result r = unescape(implementation, input, output);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+  std::u16string utf16(input.size(), u'\0');
+  const simdutf::result r16 = implementation.unescape_json_to_utf16(
+      input.data(), input.size(), &utf16[0]);
+  ASSERT_EQUAL(r16.error, error);
+  ASSERT_EQUAL(r16.count, position);
+}
+} // namespace
+
+TEST(escape_examples) {
+  ASSERT_TRUE(escape(implementation, "say \"hi\"\\", false) ==
+              "say \\\"hi\\\"\\\\");
+  ASSERT_TRUE(escape(implementation, "\b\f\n\r\t/", false) ==
+              "\\b\\f\\n\\r\\t/");
+  ASSERT_TRUE(escape(implementation, std::string("\0\x01\x1f\x7f", 4),
+                     false) == "\\u0000\\u0001\\u001f\x7f");
+  const std::string text = "caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80";
+  ASSERT_TRUE(escape(implementation, text, false) == text);
+  ASSERT_TRUE(escape(implementation, text, true) ==
+              "caf\\u00e9 \\u20ac \\ud83d\\ude00");
+  ASSERT_TRUE(escape(implementation, "", false).empty());
+
+  // The input is validated.
+  std::string output(30, '\0');
+  const simdutf::result r =
+      implementation.escape_json_utf8("a\"b\xff", 4, &output[0], false);
+  ASSERT_EQUAL(r.error, simdutf::error_code::HEADER_BITS);
+  ASSERT_EQUAL(r.count, size_t(3));
+}
+
+TEST(unescape_examples) {
+  std::string output;
+  simdutf::result r = unescape(
+      implementation, "\\\"\\\\\\/\\b\\f\\n\\r\\t \\u00e9\\u20AC\\ud83d\\ude00",
+      output);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_TRUE(output ==
+              "\"\\/\b\f\n\r\t \xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+
+  std::u16string utf16(10, u'\0');
+  r = implementation.unescape_json_to_utf16("a\\u00e9\\ud83d\\ude00", 19,
+                                            &utf16[0]);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  utf16.resize(r.count);
+  ASSERT_TRUE(utf16 == u"a\u00e9\U0001F600");
+}
+
+TEST(unescape_errors) {
+  using simdutf::error_code;
+  check_unescape_error(implementation, "ab\\x", error_code::INVALID_JSON_ESCAPE,
+                       2);
+  check_unescape_error(implementation, "ab\\", error_code::INVALID_JSON_ESCAPE,
+                       2);
+  check_unescape_error(implementation, "\\u12", error_code::INVALID_JSON_ESCAPE,
+                       0);
+  check_unescape_error(implementation, "\\u12g4",
+                       error_code::INVALID_JSON_ESCAPE, 0);
+  check_unescape_error(implementation, "a\"b", error_code::INVALID_JSON_ESCAPE,
+                       1);
+  check_unescape_error(implementation, "a\nb", error_code::INVALID_JSON_ESCAPE,
+                       1);
+  check_unescape_error(implementation, "a\\ud83d", error_code::SURROGATE, 1);
+  check_unescape_error(implementation, "a\\ud83dxxxxxx", error_code::SURROGATE,
+                       1);
+  check_unescape_error(implementation, "a\\ude00\\ud83d", error_code::SURROGATE,
+                       1);
+  check_unescape_error(implementation, "a\\ud83d\\u0041", error_code::SURROGATE,
+                       1);
+  // The input is read once: the first error is reported, whatever its kind.
+  check_unescape_error(implementation, "\\x\xff",
+                       error_code::INVALID_JSON_ESCAPE, 0);
+  check_unescape_error(implementation, "\xff\\x", error_code::HEADER_BITS, 0);
+}
+
+TEST(round_trip) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size = 0; size < 200; size++) {
+      const std::string input = random_text(seed, size, 10);
+      check_round_trip(implementation, input, false);
+      check_round_trip(implementation, input, true);
+    }
+    for (size_t size : {1000, 4096, 65536}) {
+      for (size_t escape_rate : {1, 100, 100000}) {
+        const std::string input = random_text(seed, size, escape_rate);
+        check_round_trip(implementation, input, false);
+        check_round_trip(implementation, input, true);
+      }
+    }
+  }
+}
+
+TEST(escape_at_every_position) {
+  for (size_t size : {63, 64, 65, 130}) {
+    const std::string input(size, 'a');
+    for (size_t i = 0; i < size; i++) {
+      for (char c : {'"', '\\', '\0', '\x1f'}) {
+        std::string escaped = input;
+        escaped[i] = c;
+        check_round_trip(implementation, escaped, false);
+      }
+      std::string invalid = escape(implementation, input, false);
+      invalid[i] = '\\';
+      std::string output;
+      const simdutf::result r = unescape(implementation, invalid, output);
+      ASSERT_EQUAL(r.error, simdutf::error_code::INVALID_JSON_ESCAPE);
+      ASSERT_EQUAL(r.count, i);
+    }
+  }
+}
+
+TEST(utf8_error_at_every_position) {
+  // The UTF-8 errors are found by the scan for escapes, so that the runs
+  // between escapes end before, at and after them.
+  const std::vector<std::string> errors = {
+      "\xff", "\x80", "\xc3", "\xe2\x82", "\xed\xa0\x80", "\xf4\x90\x80\x80"};
+  for (size_t size : {63, 64, 65, 130}) {
+    for (size_t i = 0; i < size; i++) {
+      for (const std::string &error : errors) {
+        const std::string input =
+            std::string(i, 'a') + error + std::string(size - i, 'a');
+        check_utf8_error(implementation, input);
+        check_utf8_error(implementation,
+                         input.substr(0, i + error.size()) + "\\n" +
+                             input.substr(i + error.size()));
+        check_utf8_error(implementation, "\\t" + input);
+        check_utf8_error(implementation, input.substr(0, i + error.size()));
+      }
+    }
+  }
+}
+
+TEST(worst_case_size) {
+  for (size_t size : {1, 64, 1000}) {
+    const std::string input(size, '\x01');
+    const std::string escaped = escape(implementation, input, false);
+    ASSERT_EQUAL(escaped.size(), 6 * size);
+    check_round_trip(implementation, input, true);
+  }
+}
+
+TEST_MAIN
@@ -0,0 +1,119 @@
+#include "simdutf.h"
+
+#include <array>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+std::vector<char> to_chars(const std::vector<uint8_t> &utf8) {
+  return std::vector<char>(utf8.begin(), utf8.end());
+}
+
+// The fused functions must agree with validating and then measuring.
+void check(const simdutf::implementation &implementation,
+           const std::vector<char> &input) {
+  const simdutf::result valid =
+      implementation.validate_utf8_with_errors(input.data(), input.size());
+  const simdutf::result utf16 =
+      implementation.utf16_length_from_utf8_with_errors(input.data(),
+                                                        input.size());
+  const simdutf::result utf32 =
+      implementation.utf32_length_from_utf8_with_errors(input.data(),
+                                                        input.size());
+  ASSERT_EQUAL(utf16.error, valid.error);
+  ASSERT_EQUAL(utf32.error, valid.error);
+  if (valid.error != simdutf::error_code::SUCCESS) {
+    ASSERT_EQUAL(utf16.count, valid.count);
+    ASSERT_EQUAL(utf32.count, valid.count);
+    return;
+  }
+  ASSERT_EQUAL(utf16.count, implementation.utf16_length_from_utf8(
+                                input.data(), input.size()));
+  ASSERT_EQUAL(utf32.count, implementation.utf32_length_from_utf8(
+                                input.data(), input.size()));
+}
+} // namespace
+
+TEST(examples) {
+  const std::vector<std::vector<char>> inputs = {
+      {},
+      {'a'},
+      {'a', char(0xc3), char(0xa9)},
+      {char(0xf0), char(0x9f), char(0x98), char(0x80)},
+      {char(0xf0), char(0x9f), char(0x98)},
+      {'a', char(0xff)},
+      {char(0xed), char(0xa0), char(0x80)}};
+  for (const std::vector<char> &input : inputs) {
+    check(implementation, input);
+  }
+  // One character in UTF-32, a surrogate pair in UTF-16.
+  const char emoji[] = {char(0xf0), char(0x9f), char(0x98), char(0x80)};
+  ASSERT_EQUAL(
+      implementation.utf16_length_from_utf8_with_errors(emoji, 4).count,
+      size_t(2));
+  ASSERT_EQUAL(
+      implementation.utf32_length_from_utf8_with_errors(emoji, 4).count,
+      size_t(1));
+  const char invalid[] = {'a', 'b', char(0xc3), 'c'};
+  const simdutf::result r =
+      implementation.utf16_length_from_utf8_with_errors(invalid, 4);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(2));
+}
+
+TEST(valid_input) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    for (size_t size = 0; size < 300; size++) {
+      check(implementation, to_chars(generator.generate(size)));
+    }
+    for (size_t size : {1000, 4096, 10000, 65536}) {
+      check(implementation, to_chars(generator.generate(size)));
+    }
+  }
+  for (size_t size : {63, 64, 65, 1000, 5000}) {
+    check(implementation, std::vector<char>(size, 'a'));
+  }
+}
+
+TEST(corrupted_input) {
+  for (uint32_t seed = 0; seed < 100; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    simdutf::tests::helpers::RandomInt random_size(1, 5000, seed);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    std::vector<char> input = to_chars(generator.generate(random_size()));
+    simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                       seed);
+    for (size_t trial = 0; trial < 10; trial++) {
+      const size_t position = random_position();
+      const char original = input[position];
+      input[position] = char(random_byte());
+      check(implementation, input);
+      input[position] = original;
+    }
+  }
+}
+
+#if SIMDUTF_CPLUSPLUS23
+
+namespace {
+constexpr std::array<char, 5> emoji_input = {'a', char(0xf0), char(0x9f),
+                                             char(0x98), char(0x80)};
+constexpr std::array<char, 3> invalid_input = {'a', char(0xc3), 'c'};
+} // namespace
+
+TEST(compile_time_length_from_utf8_with_errors) {
+  static_assert(
+      simdutf::utf16_length_from_utf8_with_errors(emoji_input).count == 3);
+  static_assert(
+      simdutf::utf32_length_from_utf8_with_errors(emoji_input).count == 2);
+  static_assert(simdutf::utf16_length_from_utf8_with_errors(invalid_input)
+                    .error == simdutf::error_code::TOO_SHORT);
+}
+
+#endif
+
+TEST_MAIN
@@ -0,0 +1,318 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <tests/helpers/executors.h>
+#include <tests/helpers/random_utf16.h>
+#include <tests/helpers/random_utf32.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::tests::helpers::reverse_executor;
+using simdutf::tests::helpers::thread_executor;
+
+std::vector<char> to_chars(const std::vector<uint8_t> &utf8) {
+  return std::vector<char>(utf8.begin(), utf8.end());
+}
+
+// Compares a parallel conversion with the matching single-threaded function
+// for various numbers of workers.
+template <typename to, typename from>
+void check_conversion(const std::vector<from> &input, size_t output_length,
+                      simdutf::result (*parallel)(const from *, size_t, to *,
+                                                  simdutf::executor &) noexcept,
+                      simdutf::result (*single)(const from *, size_t,
+                                                to *) noexcept,
+                      std::vector<size_t> worker_counts = {0, 1, 2, 3, 7,
+                                                           16}) {
+  std::vector<to> expected(output_length);
+  const simdutf::result e =
+      single(input.data(), input.size(), expected.data());
+  for (size_t workers : worker_counts) {
+    std::vector<to> output(output_length);
+    thread_executor threads(workers);
+    simdutf::result r =
+        parallel(input.data(), input.size(), output.data(), threads);
+    ASSERT_EQUAL(r.error, e.error);
+    ASSERT_EQUAL(r.count, e.count);
+    if (e.error == simdutf::error_code::SUCCESS) {
+      ASSERT_TRUE(output == expected);
+    }
+    reverse_executor reverse(workers);
+    r = parallel(input.data(), input.size(), output.data(), reverse);
+    ASSERT_EQUAL(r.error, e.error);
+    ASSERT_EQUAL(r.count, e.count);
+    if (e.error == simdutf::error_code::SUCCESS) {
+      ASSERT_TRUE(output == expected);
+    }
+  }
+}
+
+// The error tests run with 3 and 7 workers.
+const std::vector<size_t> error_worker_counts = {3, 7};
+
+// The positions where the inputs of the error tests are split, give or take a
+// few code units.
+std::vector<size_t> split_points(size_t length, size_t unit_size) {
+  std::vector<size_t> points;
+  for (size_t workers : error_worker_counts) {
+    const size_t segments =
+        std::min(workers, length * unit_size / size_t(65536));
+    for (size_t i = 1; i < segments; i++) {
+      points.push_back(length / segments * i);
+    }
+  }
+  return points;
+}
+
+constexpr size_t large_size = 300000;
+constexpr size_t error_test_size = 100000;
+} // namespace
+
+TEST(utf8_to_utf16_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    const std::vector<char> utf8 = to_chars(generator.generate(large_size));
+    const size_t utf16_length =
+        simdutf::utf16_length_from_utf8(utf8.data(), utf8.size());
+    check_conversion<char16_t>(utf8, utf16_length,
+                               simdutf::convert_utf8_to_utf16le_parallel,
+                               simdutf::convert_utf8_to_utf16le_with_errors);
+    check_conversion<char16_t>(utf8, utf16_length,
+                               simdutf::convert_utf8_to_utf16be_parallel,
+                               simdutf::convert_utf8_to_utf16be_with_errors);
+    check_conversion<char16_t>(utf8, utf16_length,
+                               simdutf::convert_utf8_to_utf16_parallel,
+                               simdutf::convert_utf8_to_utf16_with_errors);
+  }
+}
+
+TEST(utf8_to_utf32_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    const std::vector<char> utf8 = to_chars(generator.generate(large_size));
+    check_conversion<char32_t>(
+        utf8, simdutf::utf32_length_from_utf8(utf8.data(), utf8.size()),
+        simdutf::convert_utf8_to_utf32_parallel,
+        simdutf::convert_utf8_to_utf32_with_errors);
+  }
+}
+
+TEST(utf16_to_utf8_and_utf32_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    simdutf::tests::helpers::random_utf16 generator{seed, 1, 1};
+    const std::vector<char16_t> utf16le = generator.generate_le(large_size);
+    const std::vector<char16_t> utf16be = generator.generate_be(large_size);
+    check_conversion<char>(
+        utf16le,
+        simdutf::utf8_length_from_utf16le(utf16le.data(), utf16le.size()),
+        simdutf::convert_utf16le_to_utf8_parallel,
+        simdutf::convert_utf16le_to_utf8_with_errors);
+    check_conversion<char>(
+        utf16be,
+        simdutf::utf8_length_from_utf16be(utf16be.data(), utf16be.size()),
+        simdutf::convert_utf16be_to_utf8_parallel,
+        simdutf::convert_utf16be_to_utf8_with_errors);
+    check_conversion<char32_t>(
+        utf16le,
+        simdutf::utf32_length_from_utf16le(utf16le.data(), utf16le.size()),
+        simdutf::convert_utf16le_to_utf32_parallel,
+        simdutf::convert_utf16le_to_utf32_with_errors);
+    check_conversion<char32_t>(
+        utf16be,
+        simdutf::utf32_length_from_utf16be(utf16be.data(), utf16be.size()),
+        simdutf::convert_utf16be_to_utf32_parallel,
+        simdutf::convert_utf16be_to_utf32_with_errors);
+  }
+}
+
+TEST(utf32_to_utf8_and_utf16_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    simdutf::tests::helpers::random_utf32 generator{seed};
+    const std::vector<char32_t> utf32 = generator.generate(large_size);
+    check_conversion<char>(
+        utf32, simdutf::utf8_length_from_utf32(utf32.data(), utf32.size()),
+        simdutf::convert_utf32_to_utf8_parallel,
+        simdutf::convert_utf32_to_utf8_with_errors);
+    const size_t utf16_length =
+        simdutf::utf16_length_from_utf32(utf32.data(), utf32.size());
+    check_conversion<char16_t>(utf32, utf16_length,
+                               simdutf::convert_utf32_to_utf16le_parallel,
+                               simdutf::convert_utf32_to_utf16le_with_errors);
+    check_conversion<char16_t>(utf32, utf16_length,
+                               simdutf::convert_utf32_to_utf16be_parallel,
+                               simdutf::convert_utf32_to_utf16be_with_errors);
+  }
+}
+
+TEST(utf8_errors_near_split_points) {
+  simdutf::tests::helpers::random_utf8 generator{1234, 1, 1, 1, 1};
+  std::vector<char> utf8 = to_chars(generator.generate(error_test_size));
+  const std::vector<std::vector<char>> corruptions = {
+      {char(0x80)},
+      {char(0xf0)},
+      {char(0xff)},
+      {char(0xe2), char(0x82)},
+      {char(0x80), char(0x80), char(0x80), char(0x80)},
+      {char(0xf0), char(0x9f), char(0x98), char(0x80), char(0x80)}};
+  for (size_t point : split_points(utf8.size(), 1)) {
+    for (size_t position = point - 4; position <= point + 4; position++) {
+      for (const std::vector<char> &corruption : corruptions) {
+        const std::vector<char> original(
+            utf8.begin() + position,
+            utf8.begin() + position + corruption.size());
+        std::copy(corruption.begin(), corruption.end(),
+                  utf8.begin() + position);
+        check_conversion<char16_t>(
+            utf8, simdutf::utf16_length_from_utf8(utf8.data(), utf8.size()),
+            simdutf::convert_utf8_to_utf16le_parallel,
+            simdutf::convert_utf8_to_utf16le_with_errors, error_worker_counts);
+        std::copy(original.begin(), original.end(), utf8.begin() + position);
+      }
+    }
+  }
+}
+
+TEST(utf16_errors_near_split_points) {
+  simdutf::tests::helpers::random_utf16 generator{1234, 1, 1};
+  std::vector<char16_t> utf16 = generator.generate_le(error_test_size);
+  for (size_t point : split_points(utf16.size(), 2)) {
+    for (size_t position = point - 3; position <= point + 3; position++) {
+      for (char16_t surrogate : {0xd800, 0xdbff, 0xdc00, 0xdfff}) {
+        const char16_t original = utf16[position];
+        utf16[position] = simdutf::match_system(simdutf::endianness::LITTLE)
+                              ? surrogate
+                              : char16_t((surrogate >> 8) | (surrogate << 8));
+        check_conversion<char>(
+            utf16,
+            simdutf::utf8_length_from_utf16le(utf16.data(), utf16.size()),
+            simdutf::convert_utf16le_to_utf8_parallel,
+            simdutf::convert_utf16le_to_utf8_with_errors, error_worker_counts);
+        utf16[position] = original;
+      }
+    }
+  }
+}
+
+TEST(utf32_errors_near_split_points) {
+  simdutf::tests::helpers::random_utf32 generator{1234};
+  std::vector<char32_t> utf32 = generator.generate(error_test_size);
+  for (size_t point : split_points(utf32.size(), 4)) {
+    for (size_t position = point - 2; position <= point + 2; position++) {
+      for (char32_t invalid : {0xd800u, 0xdfffu, 0x110000u, 0xffffffffu}) {
+        const char32_t original = utf32[position];
+        utf32[position] = invalid;
+        check_conversion<char>(
+            utf32, simdutf::utf8_length_from_utf32(utf32.data(), utf32.size()),
+            simdutf::convert_utf32_to_utf8_parallel,
+            simdutf::convert_utf32_to_utf8_with_errors, error_worker_counts);
+        utf32[position] = original;
+      }
+    }
+  }
+}
+
+TEST(earliest_error_is_reported) {
+  simdutf::tests::helpers::random_utf8 generator{1234, 1, 0, 0, 0};
+  std::vector<char> utf8 = to_chars(generator.generate(large_size));
+  // Errors in the last segments must not hide the one in the second segment.
+  utf8[utf8.size() - 10] = char(0xff);
+  utf8[utf8.size() / 2 + 1] = char(0x80);
+  utf8[utf8.size() / 3 + 100] = char(0xc0);
+  thread_executor threads(7);
+  std::vector<char16_t> utf16(utf8.size());
+  const simdutf::result r = simdutf::convert_utf8_to_utf16le_parallel(
+      utf8.data(), utf8.size(), utf16.data(), threads);
+  ASSERT_EQUAL(threads.batches, size_t(2));
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, utf8.size() / 3 + 100);
+  const simdutf::result e = simdutf::convert_utf8_to_utf16le_with_errors(
+      utf8.data(), utf8.size(), utf16.data());
+  ASSERT_EQUAL(r.error, e.error);
+  ASSERT_EQUAL(r.count, e.count);
+}
+
+TEST(short_inputs_stay_on_the_calling_thread) {
+  const char utf8[] = "short input \xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+  reverse_executor exec(16);
+  std::vector<char16_t> utf16(sizeof(utf8));
+  const simdutf::result r = simdutf::convert_utf8_to_utf16le_parallel(
+      utf8, sizeof(utf8) - 1, utf16.data(), exec);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(16));
+  ASSERT_EQUAL(exec.batches, size_t(0));
+}
+
+TEST(default_executor) {
+  simdutf::executor &exec = simdutf::default_executor();
+  ASSERT_TRUE(exec.concurrency() >= 1);
+  ASSERT_TRUE(&exec == &simdutf::default_executor());
+  simdutf::tests::helpers::random_utf8 generator{1234, 1, 1, 1, 1};
+  const std::vector<char> utf8 = to_chars(generator.generate(large_size));
+  const size_t utf16_length =
+      simdutf::utf16_length_from_utf8(utf8.data(), utf8.size());
+  std::vector<char16_t> expected(utf16_length);
+  ASSERT_EQUAL(simdutf::convert_utf8_to_utf16le(utf8.data(), utf8.size(),
+                                                expected.data()),
+               utf16_length);
+  std::vector<char16_t> utf16(utf16_length);
+  const simdutf::result r = simdutf::convert_utf8_to_utf16le_parallel(
+      utf8.data(), utf8.size(), utf16.data());
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, utf16_length);
+  ASSERT_TRUE(utf16 == expected);
+}
+
+TEST(default_executor_from_several_threads) {
+  simdutf::tests::helpers::random_utf16 generator{1234, 1, 1};
+  const std::vector<char16_t> utf16 = generator.generate_le(large_size);
+  const size_t utf8_length =
+      simdutf::utf8_length_from_utf16le(utf16.data(), utf16.size());
+  std::vector<char> expected(utf8_length);
+  ASSERT_EQUAL(simdutf::convert_utf16le_to_utf8(utf16.data(), utf16.size(),
+                                                expected.data()),
+               utf8_length);
+  std::atomic<size_t> failures{0};
+  std::vector<std::thread> callers;
+  for (size_t i = 0; i < 4; i++) {
+    callers.emplace_back([&] {
+      for (size_t trial = 0; trial < 5; trial++) {
+        std::vector<char> utf8(utf8_length);
+        const simdutf::result r = simdutf::convert_utf16le_to_utf8_parallel(
+            utf16.data(), utf16.size(), utf8.data());
+        if (r.error != simdutf::error_code::SUCCESS ||
+            r.count != utf8_length || utf8 != expected) {
+          failures++;
+        }
+      }
+    });
+  }
+  for (std::thread &caller : callers) {
+    caller.join();
+  }
+  ASSERT_EQUAL(failures.load(), size_t(0));
+}
+
+TEST(default_executor_runs_every_task_once) {
+  std::vector<std::atomic<size_t>> counters(1000);
+  for (std::atomic<size_t> &counter : counters) {
+    counter = 0;
+  }
+  simdutf::default_executor().run(
+      counters.size(),
+      [](void *context, size_t index) {
+        (*static_cast<std::vector<std::atomic<size_t>> *>(context))[index]++;
+      },
+      &counters);
+  for (const std::atomic<size_t> &counter : counters) {
+    ASSERT_EQUAL(counter.load(), size_t(1));
+  }
+  // Nothing to do is not an error.
+  simdutf::default_executor().run(0, [](void *, size_t) {}, nullptr);
+}
+
+TEST_MAIN
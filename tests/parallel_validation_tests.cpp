@@ -0,0 +1,178 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <tests/helpers/executors.h>
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf16.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::tests::helpers::reverse_executor;
+using simdutf::tests::helpers::thread_executor;
+
+// Compares a parallel validation with the matching single-threaded function
+// for various numbers of workers.
+template <typename char_type>
+void check_validation(const std::vector<char_type> &input,
+                      simdutf::result (*parallel)(const char_type *, size_t,
+                                                  simdutf::executor &) noexcept,
+                      simdutf::result (*single)(const char_type *,
+                                                size_t) noexcept,
+                      std::vector<size_t> worker_counts = {0, 1, 2, 3, 7,
+                                                           16}) {
+  const simdutf::result e = single(input.data(), input.size());
+  for (size_t workers : worker_counts) {
+    thread_executor threads(workers);
+    simdutf::result r = parallel(input.data(), input.size(), threads);
+    ASSERT_EQUAL(r.error, e.error);
+    ASSERT_EQUAL(r.count, e.count);
+    reverse_executor reverse(workers);
+    r = parallel(input.data(), input.size(), reverse);
+    ASSERT_EQUAL(r.error, e.error);
+    ASSERT_EQUAL(r.count, e.count);
+  }
+}
+
+// The error tests run with 3 and 7 workers.
+const std::vector<size_t> error_worker_counts = {3, 7};
+
+// The positions where the inputs of the error tests are split, give or take a
+// few code units.
+std::vector<size_t> split_points(size_t length, size_t unit_size) {
+  std::vector<size_t> points;
+  for (size_t workers : error_worker_counts) {
+    const size_t segments =
+        std::min(workers, length * unit_size / size_t(65536));
+    for (size_t i = 1; i < segments; i++) {
+      points.push_back(length / segments * i);
+    }
+  }
+  return points;
+}
+
+std::vector<char> to_chars(const std::vector<uint8_t> &utf8) {
+  return std::vector<char>(utf8.begin(), utf8.end());
+}
+
+constexpr size_t large_size = 300000;
+constexpr size_t error_test_size = 100000;
+} // namespace
+
+TEST(utf8_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    const std::vector<char> utf8 = to_chars(generator.generate(large_size));
+    check_validation(utf8, simdutf::validate_utf8_parallel,
+                     simdutf::validate_utf8_with_errors);
+    thread_executor threads(7);
+    const simdutf::result r =
+        simdutf::validate_utf8_parallel(utf8.data(), utf8.size(), threads);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    ASSERT_EQUAL(r.count, utf8.size());
+    ASSERT_EQUAL(threads.batches, size_t(1));
+  }
+}
+
+TEST(utf16_valid) {
+  for (uint32_t seed : {1, 2, 3}) {
+    simdutf::tests::helpers::random_utf16 generator{seed, 1, 1};
+    check_validation(generator.generate_le(large_size),
+                     simdutf::validate_utf16le_parallel,
+                     simdutf::validate_utf16le_with_errors);
+    check_validation(generator.generate_be(large_size),
+                     simdutf::validate_utf16be_parallel,
+                     simdutf::validate_utf16be_with_errors);
+  }
+}
+
+TEST(utf8_errors_near_split_points) {
+  simdutf::tests::helpers::random_utf8 generator{1234, 1, 1, 1, 1};
+  std::vector<char> utf8 = to_chars(generator.generate(error_test_size));
+  const std::vector<std::vector<char>> corruptions = {
+      {char(0x80)},
+      {char(0xf0)},
+      {char(0xff)},
+      {char(0xe2), char(0x82)},
+      {char(0xed), char(0xa0), char(0x80)},
+      {char(0x80), char(0x80), char(0x80), char(0x80)},
+      {char(0xf0), char(0x9f), char(0x98), char(0x80), char(0x80)}};
+  for (size_t point : split_points(utf8.size(), 1)) {
+    for (size_t position = point - 4; position <= point + 4; position++) {
+      for (const std::vector<char> &corruption : corruptions) {
+        const std::vector<char> original(
+            utf8.begin() + position,
+            utf8.begin() + position + corruption.size());
+        std::copy(corruption.begin(), corruption.end(),
+                  utf8.begin() + position);
+        check_validation(utf8, simdutf::validate_utf8_parallel,
+                         simdutf::validate_utf8_with_errors,
+                         error_worker_counts);
+        std::copy(original.begin(), original.end(), utf8.begin() + position);
+      }
+    }
+  }
+}
+
+TEST(utf8_random_errors) {
+  simdutf::tests::helpers::random_utf8 generator{1234, 1, 1, 1, 1};
+  std::vector<char> utf8 = to_chars(generator.generate(error_test_size));
+  simdutf::tests::helpers::RandomInt random_position(0, utf8.size() - 1, 1234);
+  simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, 1234);
+  for (size_t trial = 0; trial < 100; trial++) {
+    const size_t position = random_position();
+    const char original = utf8[position];
+    utf8[position] = char(random_byte());
+    check_validation(utf8, simdutf::validate_utf8_parallel,
+                     simdutf::validate_utf8_with_errors, error_worker_counts);
+    utf8[position] = original;
+  }
+}
+
+TEST(utf16_errors_near_split_points) {
+  simdutf::tests::helpers::random_utf16 generator{1234, 1, 1};
+  std::vector<char16_t> utf16le = generator.generate_le(error_test_size);
+  std::vector<char16_t> utf16be = generator.generate_be(error_test_size);
+  for (size_t point : split_points(utf16le.size(), 2)) {
+    for (size_t position = point - 3; position <= point + 3; position++) {
+      for (char16_t surrogate : {0xd800, 0xdbff, 0xdc00, 0xdfff}) {
+        const char16_t swapped = char16_t((surrogate >> 8) | (surrogate << 8));
+        const bool little = simdutf::match_system(simdutf::endianness::LITTLE);
+        const char16_t original_le = utf16le[position];
+        utf16le[position] = little ? surrogate : swapped;
+        check_validation(utf16le, simdutf::validate_utf16le_parallel,
+                         simdutf::validate_utf16le_with_errors,
+                         error_worker_counts);
+        utf16le[position] = original_le;
+        if (position < utf16be.size()) {
+          const char16_t original_be = utf16be[position];
+          utf16be[position] = little ? swapped : surrogate;
+          check_validation(utf16be, simdutf::validate_utf16be_parallel,
+                           simdutf::validate_utf16be_with_errors,
+                           error_worker_counts);
+          utf16be[position] = original_be;
+        }
+      }
+    }
+  }
+}
+
+TEST(earliest_error_is_reported) {
+  std::vector<char16_t> utf16(400000, u'a');
+  utf16[utf16.size() - 1] = char16_t(0xd800);
+  utf16[utf16.size() / 2] = char16_t(0xdc00);
+  utf16[utf16.size() / 4 + 7] = char16_t(0xdfff);
+  if (!simdutf::match_system(simdutf::endianness::LITTLE)) {
+    simdutf::change_endianness_utf16(utf16.data(), utf16.size(), utf16.data());
+  }
+  thread_executor threads(16);
+  const simdutf::result r =
+      simdutf::validate_utf16le_parallel(utf16.data(), utf16.size(), threads);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, utf16.size() / 4 + 7);
+  ASSERT_EQUAL(threads.batches, size_t(1));
+}
+
+TEST_MAIN
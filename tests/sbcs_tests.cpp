@@ -0,0 +1,233 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::error_code;
+
+const simdutf::sbcs_encoding encodings[] = {
+    simdutf::sbcs_ibm866,       simdutf::sbcs_iso_8859_2,
+    simdutf::sbcs_iso_8859_3,   simdutf::sbcs_iso_8859_4,
+    simdutf::sbcs_iso_8859_5,   simdutf::sbcs_iso_8859_6,
+    simdutf::sbcs_iso_8859_7,   simdutf::sbcs_iso_8859_8,
+    simdutf::sbcs_iso_8859_10,  simdutf::sbcs_iso_8859_13,
+    simdutf::sbcs_iso_8859_14,  simdutf::sbcs_iso_8859_15,
+    simdutf::sbcs_iso_8859_16,  simdutf::sbcs_koi8_r,
+    simdutf::sbcs_koi8_u,       simdutf::sbcs_macintosh,
+    simdutf::sbcs_windows_874,  simdutf::sbcs_windows_1250,
+    simdutf::sbcs_windows_1251, simdutf::sbcs_windows_1252,
+    simdutf::sbcs_windows_1253, simdutf::sbcs_windows_1254,
+    simdutf::sbcs_windows_1255, simdutf::sbcs_windows_1256,
+    simdutf::sbcs_windows_1257, simdutf::sbcs_windows_1258,
+    simdutf::sbcs_x_mac_cyrillic};
+
+// Random assigned bytes, of which about one in ascii_rate is ASCII.
+std::string random_sbcs(const char16_t *table, uint32_t seed, size_t size,
+                        size_t ascii_rate) {
+  simdutf::tests::helpers::RandomInt random_byte(0, 127, seed);
+  simdutf::tests::helpers::RandomInt random_ascii(0, ascii_rate, seed);
+  std::string output;
+  while (output.size() < size) {
+    const uint32_t byte = random_byte();
+    if (random_ascii() == 0) {
+      output.push_back(char(byte));
+    } else if (table[byte] != 0xfffd) {
+      output.push_back(char(0x80 + byte));
+    }
+  }
+  return output;
+}
+
+void check_round_trip(const char16_t *table, const std::string &input) {
+  std::u16string utf16(input.size(), u'\0');
+  ASSERT_EQUAL(simdutf::convert_sbcs_to_utf16(input.data(), input.size(),
+                                              table, &utf16[0]),
+               input.size());
+  for (size_t i = 0; i < input.size(); i++) {
+    const uint8_t byte = uint8_t(input[i]);
+    ASSERT_EQUAL(uint32_t(utf16[i]),
+                 uint32_t(byte < 0x80 ? byte : table[byte - 0x80]));
+  }
+
+  std::string utf8(3 * input.size(), '\0');
+  utf8.resize(simdutf::convert_sbcs_to_utf8(input.data(), input.size(), table,
+                                            &utf8[0]));
+  ASSERT_EQUAL(
+      simdutf::utf8_length_from_sbcs(input.data(), input.size(), table),
+      utf8.size());
+  std::string from_utf16(3 * input.size(), '\0');
+  from_utf16.resize(simdutf::convert_utf16_to_utf8(utf16.data(), utf16.size(),
+                                                   &from_utf16[0]));
+  ASSERT_TRUE(utf8 == from_utf16);
+
+  std::string back(input.size(), '\0');
+  simdutf::result r = simdutf::convert_utf8_to_sbcs_with_errors(
+      utf8.data(), utf8.size(), table, &back[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, input.size());
+  ASSERT_TRUE(back == input);
+  back.assign(input.size(), '\0');
+  r = simdutf::convert_utf16_to_sbcs_with_errors(utf16.data(), utf16.size(),
+                                                 table, &back[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, input.size());
+  ASSERT_TRUE(back == input);
+}
+
+void check_utf8_error(const char16_t *table, const std::string &utf8,
+                      error_code error, size_t position) {
+  std::string output(utf8.size(), '\0');
+  const simdutf::result r = simdutf::convert_utf8_to_sbcs_with_errors(
+      utf8.data(), utf8.size(), table, &output[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+}
+} // namespace
+
+TEST(builtin_tables) {
+  for (simdutf::sbcs_encoding encoding : encodings) {
+    ASSERT_TRUE(simdutf::sbcs_table(encoding) != nullptr);
+  }
+  ASSERT_TRUE(simdutf::sbcs_table(simdutf::sbcs_encoding(1000)) == nullptr);
+
+  ASSERT_EQUAL(simdutf::sbcs_table(simdutf::sbcs_koi8_r)[0xc1 - 0x80],
+               char16_t(0x0430));
+  ASSERT_EQUAL(simdutf::sbcs_table(simdutf::sbcs_koi8_u)[0xae - 0x80],
+               char16_t(0x045e));
+  ASSERT_EQUAL(simdutf::sbcs_table(simdutf::sbcs_iso_8859_2)[0xb1 - 0x80],
+               char16_t(0x0105));
+  ASSERT_EQUAL(simdutf::sbcs_table(simdutf::sbcs_iso_8859_3)[0xa5 - 0x80],
+               char16_t(0xfffd));
+  ASSERT_EQUAL(simdutf::sbcs_table(simdutf::sbcs_windows_1251)[0xc0 - 0x80],
+               char16_t(0x0410));
+  ASSERT_EQUAL(simdutf::sbcs_table(simdutf::sbcs_windows_1250)[0x81 - 0x80],
+               char16_t(0x0081));
+
+  // windows-1252 also has its own functions.
+  std::string bytes(128, '\0');
+  for (size_t i = 0; i < 128; i++) {
+    bytes[i] = char(0x80 + i);
+  }
+  std::u16string utf16(128, u'\0');
+  ASSERT_EQUAL(
+      simdutf::convert_windows1252_to_utf16(bytes.data(), 128, &utf16[0]),
+      size_t(128));
+  const char16_t *table = simdutf::sbcs_table(simdutf::sbcs_windows_1252);
+  for (size_t i = 0; i < 128; i++) {
+    ASSERT_EQUAL(uint32_t(table[i]), uint32_t(utf16[i]));
+  }
+}
+
+TEST(round_trip) {
+  for (simdutf::sbcs_encoding encoding : encodings) {
+    const char16_t *table = simdutf::sbcs_table(encoding);
+    for (size_t size = 0; size < 70; size++) {
+      check_round_trip(table, random_sbcs(table, uint32_t(size), size, 4));
+    }
+    for (size_t ascii_rate : {1, 10, 100000}) {
+      check_round_trip(table, random_sbcs(table, 1234, 5000, ascii_rate));
+    }
+  }
+}
+
+TEST(unassigned_bytes) {
+  const char16_t *table = simdutf::sbcs_table(simdutf::sbcs_iso_8859_3);
+  std::string utf8(3, '\0');
+  ASSERT_EQUAL(simdutf::convert_sbcs_to_utf8("\xa5", 1, table, &utf8[0]),
+               size_t(3));
+  ASSERT_TRUE(utf8 == "\xef\xbf\xbd");
+  // U+FFFD has no byte.
+  check_utf8_error(table, "ab\xef\xbf\xbd", error_code::TOO_LARGE, 2);
+}
+
+TEST(unmappable_characters) {
+  const char16_t *table = simdutf::sbcs_table(simdutf::sbcs_koi8_r);
+  check_utf8_error(table, "abc\xe2\x82\xac", error_code::TOO_LARGE, 3);
+  check_utf8_error(table, "\xd0\xb0\xf0\x9f\x98\x80", error_code::TOO_LARGE,
+                   2);
+  check_utf8_error(table, "\xd0\xb0\xff", error_code::HEADER_BITS, 2);
+  // Errors after the first block, and within a non-ASCII text.
+  std::string cyrillic;
+  for (size_t i = 0; i < 3000; i++) {
+    cyrillic += "\xd0\xb0";
+  }
+  check_utf8_error(table, cyrillic + "\xc3\xa9", error_code::TOO_LARGE, 6000);
+  check_utf8_error(table, cyrillic + "\xf0\x9f\x98\x80",
+                   error_code::TOO_LARGE, 6000);
+  check_utf8_error(table, cyrillic + "\xe2\x82", error_code::TOO_SHORT, 6000);
+
+  std::string output(4, '\0');
+  const char16_t lone[] = {0x0430, 0xd83d, u'a'};
+  simdutf::result r =
+      simdutf::convert_utf16_to_sbcs_with_errors(lone, 3, table, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, size_t(1));
+  const char16_t emoji[] = {0x0430, 0xd83d, 0xde00};
+  r = simdutf::convert_utf16_to_sbcs_with_errors(emoji, 3, table, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::TOO_LARGE);
+  ASSERT_EQUAL(r.count, size_t(1));
+}
+
+TEST(kernels) {
+  for (simdutf::sbcs_encoding encoding : encodings) {
+    const char16_t *table = simdutf::sbcs_table(encoding);
+    for (size_t size : {0, 1, 31, 32, 63, 64, 65, 127, 128, 200, 1000}) {
+      for (size_t ascii_rate : {1, 4, 100000}) {
+        const std::string input =
+            random_sbcs(table, uint32_t(size + ascii_rate), size, ascii_rate);
+        std::u16string utf16(size, u'\0');
+        ASSERT_EQUAL(implementation.convert_sbcs_to_utf16(input.data(), size,
+                                                          table, &utf16[0]),
+                     size);
+        for (size_t i = 0; i < size; i++) {
+          const uint8_t byte = uint8_t(input[i]);
+          ASSERT_EQUAL(uint32_t(utf16[i]),
+                       uint32_t(byte < 0x80 ? byte : table[byte - 0x80]));
+        }
+      }
+    }
+  }
+}
+
+TEST(surrogates_in_table) {
+  char16_t table[128];
+  for (size_t i = 0; i < 128; i++) {
+    table[i] = char16_t(0x0400 + i);
+  }
+  table[0x01] = char16_t(0xd800);
+  table[0x7f] = char16_t(0xdfff);
+  std::string input(100, 'a');
+  input[10] = '\x81';
+  input[90] = '\xff';
+  input[50] = '\x82';
+
+  std::u16string utf16(input.size(), u'\0');
+  ASSERT_EQUAL(simdutf::convert_sbcs_to_utf16(input.data(), input.size(),
+                                              table, &utf16[0]),
+               input.size());
+  ASSERT_EQUAL(uint32_t(utf16[10]), uint32_t(0xfffd));
+  ASSERT_EQUAL(uint32_t(utf16[90]), uint32_t(0xfffd));
+  ASSERT_EQUAL(uint32_t(utf16[50]), uint32_t(0x0402));
+
+  std::string utf8(3 * input.size(), '\0');
+  utf8.resize(simdutf::convert_sbcs_to_utf8(input.data(), input.size(), table,
+                                            &utf8[0]));
+  ASSERT_EQUAL(
+      simdutf::utf8_length_from_sbcs(input.data(), input.size(), table),
+      utf8.size());
+  ASSERT_TRUE(simdutf::validate_utf8(utf8.data(), utf8.size()));
+  check_utf8_error(table, "a\xed\xa0\x80", error_code::SURROGATE, 1);
+
+  std::string output(2, '\0');
+  const char16_t lone[] = {u'a', 0xd800};
+  const simdutf::result r =
+      simdutf::convert_utf16_to_sbcs_with_errors(lone, 2, table, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, size_t(1));
+}
+
+TEST_MAIN
@@ -14,6 +14,27 @@ TEST(validate_utf8_c) {
   ASSERT_EQUAL(r.count, hello_len);
 }
 
+TEST(utf8_stream_validator_c) {
+  simdutf_utf8_stream_validator state;
+  simdutf_utf8_stream_validator_init(&state);
+  // U+20AC split across two chunks
+  simdutf_result r = simdutf_utf8_stream_validator_feed(&state, "a\xe2\x82", 3);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(1));
+  r = simdutf_utf8_stream_validator_feed(&state, "\xac", 1);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_SUCCESS);
+  r = simdutf_utf8_stream_validator_finish(&state);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(4));
+
+  simdutf_utf8_stream_validator_init(&state);
+  r = simdutf_utf8_stream_validator_feed(&state, "ab\xf0\x9f", 4);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_SUCCESS);
+  r = simdutf_utf8_stream_validator_finish(&state);
+  ASSERT_EQUAL(r.error, SIMDUTF_ERROR_TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(2));
+}
+
 TEST(convert_utf8_to_utf16_c) {
   char16_t out[16];
   size_t n = simdutf_convert_utf8_to_utf16(hello, hello_len, out);
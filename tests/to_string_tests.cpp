@@ -0,0 +1,135 @@
+#include "simdutf.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// Short and long inputs take different paths.
+const std::vector<size_t> sizes = {0, 1, 15, 64, 1000, 4096, 4097, 20000};
+
+std::string random_string(uint32_t seed, size_t size) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  const std::vector<uint8_t> utf8 = generator.generate(size);
+  return std::string(utf8.begin(), utf8.end());
+}
+
+std::string corrupt(std::string input, uint32_t seed) {
+  if (input.empty()) {
+    return input;
+  }
+  simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                     seed);
+  simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+  for (size_t i = 0; i < 5; i++) {
+    input[random_position()] = char(random_byte());
+  }
+  return input;
+}
+
+std::u16string expected_utf16(const std::string &input) {
+  std::u16string output(input.size(), u'\0');
+  output.resize(simdutf::convert_utf8_to_utf16_with_replacement(
+      input.data(), input.size(), &output[0]));
+  return output;
+}
+
+std::u32string expected_utf32(const std::string &input) {
+  std::u32string output(input.size(), U'\0');
+  output.resize(simdutf::convert_utf8_to_utf32_with_replacement(
+      input.data(), input.size(), &output[0]));
+  return output;
+}
+
+std::string expected_utf8(const std::u16string &input) {
+  std::string output(3 * input.size(), '\0');
+  output.resize(simdutf::convert_utf16_to_utf8_with_replacement(
+      input.data(), input.size(), &output[0]));
+  return output;
+}
+
+// Counts the bytes it allocates.
+template <typename T> struct counting_allocator {
+  using value_type = T;
+  size_t *allocated;
+
+  explicit counting_allocator(size_t *counter) : allocated(counter) {}
+  template <typename U>
+  counting_allocator(const counting_allocator<U> &other)
+      : allocated(other.allocated) {}
+
+  T *allocate(size_t n) {
+    *allocated += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <typename U> bool operator==(const counting_allocator<U> &) const {
+    return true;
+  }
+  template <typename U> bool operator!=(const counting_allocator<U> &) const {
+    return false;
+  }
+};
+} // namespace
+
+TEST(valid_utf8) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size : sizes) {
+      const std::string input = random_string(seed, size);
+      const std::u16string utf16 = simdutf::to_u16string(input);
+      ASSERT_TRUE(utf16 == expected_utf16(input));
+      ASSERT_TRUE(simdutf::to_u32string(input) == expected_utf32(input));
+      // The round trip gives the input back.
+      ASSERT_TRUE(simdutf::to_utf8_string(utf16) == input);
+    }
+  }
+}
+
+TEST(invalid_utf8) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size : sizes) {
+      const std::string input = corrupt(random_string(seed, size), seed);
+      const std::u16string utf16 = simdutf::to_u16string(input);
+      ASSERT_TRUE(utf16 == expected_utf16(input));
+      ASSERT_TRUE(simdutf::to_u32string(input) == expected_utf32(input));
+      ASSERT_TRUE(simdutf::validate_utf16(utf16.data(), utf16.size()));
+    }
+  }
+}
+
+TEST(unpaired_surrogates) {
+  for (size_t size : sizes) {
+    std::u16string input(size, u'a');
+    for (size_t i = 0; i < size; i += 100) {
+      input[i] = char16_t(0xd800);
+    }
+    const std::string utf8 = simdutf::to_utf8_string(input);
+    ASSERT_TRUE(utf8 == expected_utf8(input));
+    ASSERT_TRUE(simdutf::validate_utf8(utf8.data(), utf8.size()));
+  }
+}
+
+TEST(custom_allocator) {
+  const std::string input = random_string(1234, 20000);
+  size_t allocated = 0;
+  counting_allocator<char16_t> allocator(&allocated);
+  const auto utf16 = simdutf::to_u16string(input, allocator);
+  ASSERT_TRUE(std::u16string_view(utf16) == expected_utf16(input));
+  // Long inputs are converted into a buffer of the exact size.
+  ASSERT_TRUE(allocated >= utf16.size() * sizeof(char16_t));
+  ASSERT_TRUE(allocated <= (utf16.size() + 1) * sizeof(char16_t));
+
+  allocated = 0;
+  const auto utf8 = simdutf::to_utf8_string(
+      std::u16string_view(utf16), counting_allocator<char>(&allocated));
+  ASSERT_TRUE(std::string_view(utf8) == input);
+  ASSERT_TRUE(allocated > 0);
+}
+
+TEST_MAIN
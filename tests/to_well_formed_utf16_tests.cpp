@@ -1,8 +1,15 @@
 #include "simdutf.h"
 
+#include <algorithm>
+#include <cstring>
 #include <random>
 #include <vector>
 
+#ifdef __linux__
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
 #include <tests/helpers/compiletime_conversions.h>
 #include <tests/helpers/fixed_string.h>
 #include <tests/helpers/random_utf16.h>
@@ -307,6 +314,64 @@ TEST(to_well_formed_utf16be_bad_input_self) {
   }
 }
 
+#ifdef __linux__
+// A valid string fixed in place must only be read: we put it on read-only
+// pages, so that any store faults.
+TEST(to_well_formed_utf16_self_valid_input_is_not_written) {
+  const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  for (size_t len : {1, 2, 7, 8, 9, 16, 31, 32, 33, 64, 100, 1000, 5000}) {
+    simdutf::tests::helpers::random_utf16 generator{uint32_t(len), 1, 1};
+    for (bool big_endian : {false, true}) {
+      auto utf16 = big_endian ? generator.generate_be(len)
+                              : generator.generate_le(len);
+      const size_t bytes = utf16.size() * sizeof(char16_t);
+      const size_t total = (bytes + page - 1) / page * page;
+      void *base = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      ASSERT_TRUE(base != MAP_FAILED);
+      char16_t *buffer = static_cast<char16_t *>(base);
+      std::memcpy(buffer, utf16.data(), bytes);
+      ASSERT_EQUAL(mprotect(base, total, PROT_READ), 0);
+      if (big_endian) {
+        implementation.to_well_formed_utf16be(buffer, utf16.size(), buffer);
+      } else {
+        implementation.to_well_formed_utf16le(buffer, utf16.size(), buffer);
+      }
+      ASSERT_TRUE(std::equal(utf16.begin(), utf16.end(), buffer));
+      munmap(base, total);
+    }
+  }
+}
+#endif
+
+// Fixing in place a mostly valid string must give the same result as copying.
+TEST(to_well_formed_utf16_self_sparse_errors) {
+  std::mt19937 gen((std::mt19937::result_type)(1234));
+  const char16_t surrogates[] = {0xD800, 0xDBFF, 0xDC00, 0xDFFF,
+                                 0x00D8, 0xFFDB, 0x00DC, 0xFFDF};
+  for (size_t len : {1, 3, 15, 16, 17, 32, 33, 64, 65, 200, 4096}) {
+    std::uniform_int_distribution<size_t> position(0, len - 1);
+    std::uniform_int_distribution<size_t> surrogate(0, 7);
+    for (size_t trial = 0; trial < 50; trial++) {
+      std::vector<char16_t> utf16(len, u'a');
+      for (size_t i = 0; i < 1 + trial % 3; i++) {
+        utf16[position(gen)] = surrogates[surrogate(gen)];
+      }
+      std::vector<char16_t> copied(len);
+      std::vector<char16_t> fixed = utf16;
+      implementation.to_well_formed_utf16le(utf16.data(), len, copied.data());
+      implementation.to_well_formed_utf16le(fixed.data(), len, fixed.data());
+      ASSERT_TRUE(fixed == copied);
+      ASSERT_TRUE(implementation.validate_utf16le(fixed.data(), len));
+      fixed = utf16;
+      implementation.to_well_formed_utf16be(utf16.data(), len, copied.data());
+      implementation.to_well_formed_utf16be(fixed.data(), len, fixed.data());
+      ASSERT_TRUE(fixed == copied);
+      ASSERT_TRUE(implementation.validate_utf16be(fixed.data(), len));
+    }
+  }
+}
+
 #if SIMDUTF_CPLUSPLUS23
 
 namespace {
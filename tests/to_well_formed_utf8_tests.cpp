@@ -0,0 +1,131 @@
+#include "simdutf.h"
+
+#include <array>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+std::vector<char> to_chars(const std::vector<uint8_t> &utf8) {
+  return std::vector<char>(utf8.begin(), utf8.end());
+}
+
+// The corrected string is what decoding with replacement characters and
+// encoding back gives.
+std::vector<char> expected_output(const std::vector<char> &input) {
+  std::vector<char32_t> utf32(
+      simdutf::utf32_length_from_utf8_with_replacement(input.data(),
+                                                       input.size())
+          .count);
+  const size_t length = simdutf::convert_utf8_to_utf32_with_replacement(
+      input.data(), input.size(), utf32.data());
+  std::vector<char> utf8(4 * length);
+  utf8.resize(
+      simdutf::convert_utf32_to_utf8(utf32.data(), length, utf8.data()));
+  return utf8;
+}
+
+void check(const std::vector<char> &input) {
+  const std::vector<char> expected = expected_output(input);
+  const simdutf::result length =
+      simdutf::to_well_formed_utf8_length(input.data(), input.size());
+  ASSERT_EQUAL(length.count, expected.size());
+  ASSERT_EQUAL(length.error,
+               simdutf::validate_utf8_with_errors(input.data(), input.size())
+                   .error);
+  std::vector<char> output(length.count);
+  ASSERT_EQUAL(
+      simdutf::to_well_formed_utf8(input.data(), input.size(), output.data()),
+      expected.size());
+  ASSERT_TRUE(output == expected);
+  ASSERT_TRUE(simdutf::validate_utf8(output.data(), output.size()));
+}
+} // namespace
+
+TEST(examples) {
+  check({});
+  check({'a', char(0xc3), char(0xa9)});
+  // Three replacement characters: F0 cannot be followed by 80.
+  const std::vector<char> overlong = {char(0xf0), char(0x80), char(0x80)};
+  check(overlong);
+  ASSERT_EQUAL(simdutf::to_well_formed_utf8_length(overlong.data(), 3).count,
+               size_t(9));
+  // One replacement character for a truncated sequence.
+  const std::vector<char> truncated = {'a', char(0xe2), char(0x82), 'b'};
+  check(truncated);
+  char output[5];
+  ASSERT_EQUAL(simdutf::to_well_formed_utf8(truncated.data(), 4, output),
+               size_t(5));
+  ASSERT_EQUAL(output[0], 'a');
+  ASSERT_EQUAL(uint8_t(output[1]), 0xef);
+  ASSERT_EQUAL(uint8_t(output[2]), 0xbf);
+  ASSERT_EQUAL(uint8_t(output[3]), 0xbd);
+  ASSERT_EQUAL(output[4], 'b');
+  check({char(0xed), char(0xa0), char(0x80), char(0xff), char(0xf4),
+         char(0x90), char(0x80), char(0x80), char(0xc0), char(0xaf)});
+}
+
+TEST(valid_input) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    for (size_t size : {1, 63, 64, 65, 1000, 10000}) {
+      check(to_chars(generator.generate(size)));
+    }
+  }
+}
+
+TEST(corrupted_input) {
+  for (uint32_t seed = 0; seed < 100; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    simdutf::tests::helpers::RandomInt random_size(1, 3000, seed);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    simdutf::tests::helpers::RandomInt random_count(1, 20, seed);
+    std::vector<char> input = to_chars(generator.generate(random_size()));
+    simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                       seed);
+    for (size_t i = random_count(); i > 0; i--) {
+      input[random_position()] = char(random_byte());
+    }
+    check(input);
+  }
+}
+
+TEST(only_errors) {
+  // Every byte is replaced: the output is three times as long as the input.
+  for (size_t size : {1, 64, 1000}) {
+    const std::vector<char> input(size, char(0xff));
+    check(input);
+    ASSERT_EQUAL(
+        simdutf::to_well_formed_utf8_length(input.data(), input.size()).count,
+        3 * size);
+  }
+}
+
+#if SIMDUTF_CPLUSPLUS23
+
+namespace {
+constexpr std::array<char, 5> invalid_input = {'a', char(0xe2), char(0x82),
+                                               'b', char(0xff)};
+
+constexpr auto correct() {
+  std::array<char, simdutf::to_well_formed_utf8_length(invalid_input).count>
+      output{};
+  if (simdutf::to_well_formed_utf8(invalid_input, output) != output.size()) {
+    throw "oops";
+  }
+  return output;
+}
+} // namespace
+
+TEST(compile_time_to_well_formed_utf8) {
+  constexpr auto output = correct();
+  static_assert(output == std::array<char, 8>{'a', char(0xef), char(0xbf),
+                                              char(0xbd), 'b', char(0xef),
+                                              char(0xbf), char(0xbd)});
+}
+
+#endif
+
+TEST_MAIN
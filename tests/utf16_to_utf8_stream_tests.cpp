@@ -0,0 +1,195 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf16.h>
+#include <tests/helpers/test.h>
+
+namespace {
+struct stream_output {
+  simdutf::full_result status;
+  std::string utf8;
+};
+
+// Feeds the input to a stream transcoder in chunks of random sizes (up to
+// max_chunk code units) and returns everything it wrote along with the result
+// of finish(), or the first error.
+stream_output convert_in_chunks(const std::vector<char16_t> &input,
+                                simdutf::endianness e, bool replace,
+                                size_t max_chunk, uint32_t seed) {
+  simdutf::tests::helpers::RandomInt chunk_size(0, max_chunk, seed);
+  simdutf::utf16_to_utf8_stream stream(e, replace);
+  stream_output out;
+  std::vector<char> buffer(3 * (max_chunk + 1));
+  size_t pos = 0;
+  while (pos < input.size()) {
+    const size_t len = std::min<size_t>(chunk_size(), input.size() - pos);
+    const simdutf::full_result r =
+        stream.convert(input.data() + pos, len, buffer.data());
+    out.utf8.append(buffer.data(), r.output_count);
+    if (r.error != simdutf::error_code::SUCCESS) {
+      out.status = r;
+      return out;
+    }
+    ASSERT_EQUAL(r.input_count, len);
+    pos += len;
+  }
+  out.status = stream.finish(buffer.data());
+  out.utf8.append(buffer.data(), out.status.output_count);
+  return out;
+}
+
+std::string one_shot(const std::vector<char16_t> &input, simdutf::endianness e,
+                     bool replace, size_t length) {
+  std::string utf8(3 * length, '\0');
+  size_t written;
+  if (replace) {
+    written = e == simdutf::endianness::BIG
+                  ? simdutf::convert_utf16be_to_utf8_with_replacement(
+                        input.data(), length, utf8.data())
+                  : simdutf::convert_utf16le_to_utf8_with_replacement(
+                        input.data(), length, utf8.data());
+  } else {
+    written = e == simdutf::endianness::BIG
+                  ? simdutf::convert_valid_utf16be_to_utf8(input.data(), length,
+                                                           utf8.data())
+                  : simdutf::convert_valid_utf16le_to_utf8(input.data(), length,
+                                                           utf8.data());
+  }
+  utf8.resize(written);
+  return utf8;
+}
+
+std::vector<char16_t> to_le(std::vector<char16_t> utf16) {
+  if (!simdutf::match_system(simdutf::endianness::LITTLE)) {
+    simdutf::change_endianness_utf16(utf16.data(), utf16.size(), utf16.data());
+  }
+  return utf16;
+}
+} // namespace
+
+TEST(split_surrogate_pair) {
+  // "a", U+1F600, "b"
+  const auto input = to_le({'a', 0xd83d, 0xde00, 'b'});
+  for (size_t split = 0; split <= input.size(); split++) {
+    simdutf::utf16_to_utf8_stream stream(simdutf::endianness::LITTLE);
+    char buffer[16];
+    std::string utf8;
+    simdutf::full_result r = stream.convert(input.data(), split, buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    utf8.append(buffer, r.output_count);
+    r = stream.convert(input.data() + split, input.size() - split, buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    utf8.append(buffer, r.output_count);
+    r = stream.finish(buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    ASSERT_EQUAL(r.input_count, size_t(4));
+    ASSERT_EQUAL(r.output_count, size_t(0));
+    ASSERT_TRUE(utf8 == "a\xf0\x9f\x98\x80"
+                        "b");
+  }
+}
+
+TEST(dangling_high_surrogate) {
+  const auto input = to_le({'a', 'b', 0xd83d});
+  char buffer[16];
+  simdutf::utf16_to_utf8_stream strict(simdutf::endianness::LITTLE);
+  simdutf::full_result r = strict.convert(input.data(), input.size(), buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(2));
+  r = strict.finish(buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SURROGATE);
+  ASSERT_EQUAL(r.input_count, size_t(2));
+  // The error is sticky until reset().
+  ASSERT_EQUAL(strict.convert(input.data(), 1, buffer).error,
+               simdutf::error_code::SURROGATE);
+  strict.reset();
+  ASSERT_EQUAL(strict.convert(input.data(), 2, buffer).error,
+               simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(strict.finish(buffer).error, simdutf::error_code::SUCCESS);
+
+  simdutf::utf16_to_utf8_stream lenient(simdutf::endianness::LITTLE, true);
+  r = lenient.convert(input.data(), input.size(), buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(2));
+  r = lenient.finish(buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.input_count, size_t(3));
+  ASSERT_EQUAL(r.output_count, size_t(3));
+  ASSERT_TRUE(std::string(buffer, 3) == "\xef\xbf\xbd");
+}
+
+TEST(high_surrogate_followed_by_non_surrogate) {
+  const auto first = to_le({'a', 0xd83d});
+  const auto second = to_le({'b'});
+  char buffer[16];
+  simdutf::utf16_to_utf8_stream strict(simdutf::endianness::LITTLE);
+  ASSERT_EQUAL(strict.convert(first.data(), first.size(), buffer).error,
+               simdutf::error_code::SUCCESS);
+  simdutf::full_result r = strict.convert(second.data(), 1, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SURROGATE);
+  ASSERT_EQUAL(r.input_count, size_t(1));
+  ASSERT_EQUAL(r.output_count, size_t(0));
+
+  simdutf::utf16_to_utf8_stream lenient(simdutf::endianness::LITTLE, true);
+  ASSERT_EQUAL(lenient.convert(first.data(), first.size(), buffer).error,
+               simdutf::error_code::SUCCESS);
+  r = lenient.convert(second.data(), 1, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(4));
+  ASSERT_TRUE(std::string(buffer, 4) == "\xef\xbf\xbd"
+                                        "b");
+}
+
+TEST_LOOP(random_chunks_valid) {
+  simdutf::tests::helpers::random_utf16 generator{seed, 1, 1};
+  for (size_t size : {0, 1, 7, 31, 32, 33, 300, 1024}) {
+    for (simdutf::endianness e :
+         {simdutf::endianness::LITTLE, simdutf::endianness::BIG}) {
+      const auto utf16 = e == simdutf::endianness::BIG
+                             ? generator.generate_be(size, seed)
+                             : generator.generate_le(size, seed);
+      const std::string expected = one_shot(utf16, e, false, utf16.size());
+      for (size_t max_chunk : {1, 2, 5, 17, 64, 200}) {
+        const stream_output out =
+            convert_in_chunks(utf16, e, false, max_chunk, seed);
+        ASSERT_EQUAL(out.status.error, simdutf::error_code::SUCCESS);
+        ASSERT_EQUAL(out.status.input_count, utf16.size());
+        ASSERT_TRUE(out.utf8 == expected);
+      }
+    }
+  }
+}
+
+TEST_LOOP(random_chunks_match_one_shot) {
+  simdutf::tests::helpers::random_utf16 generator{seed, 1, 1};
+  simdutf::tests::helpers::RandomInt random_surrogate(0xd800, 0xdfff, seed);
+  auto utf16 = generator.generate_le(256, seed);
+  for (size_t i = 0; i < utf16.size(); i += 7) {
+    const char16_t old = utf16[i];
+    utf16[i] = to_le({char16_t(random_surrogate())})[0];
+    const simdutf::result expected =
+        simdutf::validate_utf16le_with_errors(utf16.data(), utf16.size());
+    const std::string expected_utf8 =
+        one_shot(utf16, simdutf::endianness::LITTLE, false, expected.count);
+    const std::string replaced =
+        one_shot(utf16, simdutf::endianness::LITTLE, true, utf16.size());
+    for (size_t max_chunk : {1, 3, 16, 100}) {
+      const stream_output strict = convert_in_chunks(
+          utf16, simdutf::endianness::LITTLE, false, max_chunk, seed);
+      ASSERT_EQUAL(strict.status.error, expected.error);
+      ASSERT_EQUAL(strict.status.input_count, expected.count);
+      ASSERT_TRUE(strict.utf8 == expected_utf8);
+      const stream_output lenient = convert_in_chunks(
+          utf16, simdutf::endianness::LITTLE, true, max_chunk, seed);
+      ASSERT_EQUAL(lenient.status.error, simdutf::error_code::SUCCESS);
+      ASSERT_EQUAL(lenient.status.input_count, utf16.size());
+      ASSERT_TRUE(lenient.utf8 == replaced);
+    }
+    utf16[i] = old;
+  }
+}
+
+TEST_MAIN
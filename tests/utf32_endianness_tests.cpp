@@ -0,0 +1,269 @@
+#include "simdutf.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_utf32.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::endianness;
+using simdutf::error_code;
+
+// Sizes around the vector widths and the scalar tails of the kernels.
+const size_t sizes[] = {0, 1, 7, 15, 16, 17, 31, 32, 33, 64, 1000, 5000};
+
+std::vector<char32_t> swapped(const std::vector<char32_t> &input) {
+  std::vector<char32_t> output(input.size());
+  simdutf::change_endianness_utf32(input.data(), input.size(), output.data());
+  return output;
+}
+
+// The string in the requested byte order, given in the native byte order.
+std::vector<char32_t> in_order(const std::vector<char32_t> &native,
+                               endianness e) {
+  return simdutf::match_system(e) ? native : swapped(native);
+}
+
+template <endianness e> struct utf32_functions;
+
+template <> struct utf32_functions<endianness::LITTLE> {
+  static constexpr auto validate = simdutf::validate_utf32le;
+  static constexpr auto validate_with_errors =
+      simdutf::validate_utf32le_with_errors;
+  static constexpr auto utf8_length = simdutf::utf8_length_from_utf32le;
+  static constexpr auto utf16_length = simdutf::utf16_length_from_utf32le;
+  static constexpr auto to_utf8 = simdutf::convert_utf32le_to_utf8;
+  static constexpr auto to_utf8_with_errors =
+      simdutf::convert_utf32le_to_utf8_with_errors;
+  static constexpr auto valid_to_utf8 = simdutf::convert_valid_utf32le_to_utf8;
+  static constexpr auto to_utf16 = simdutf::convert_utf32le_to_utf16;
+  static constexpr auto to_utf16_with_errors =
+      simdutf::convert_utf32le_to_utf16_with_errors;
+  static constexpr auto valid_to_utf16 =
+      simdutf::convert_valid_utf32le_to_utf16;
+  static constexpr auto from_utf8 = simdutf::convert_utf8_to_utf32le;
+  static constexpr auto from_utf8_with_errors =
+      simdutf::convert_utf8_to_utf32le_with_errors;
+  static constexpr auto valid_from_utf8 =
+      simdutf::convert_valid_utf8_to_utf32le;
+  static constexpr auto from_utf16 = simdutf::convert_utf16_to_utf32le;
+  static constexpr auto from_utf16_with_errors =
+      simdutf::convert_utf16_to_utf32le_with_errors;
+  static constexpr auto valid_from_utf16 =
+      simdutf::convert_valid_utf16_to_utf32le;
+};
+
+template <> struct utf32_functions<endianness::BIG> {
+  static constexpr auto validate = simdutf::validate_utf32be;
+  static constexpr auto validate_with_errors =
+      simdutf::validate_utf32be_with_errors;
+  static constexpr auto utf8_length = simdutf::utf8_length_from_utf32be;
+  static constexpr auto utf16_length = simdutf::utf16_length_from_utf32be;
+  static constexpr auto to_utf8 = simdutf::convert_utf32be_to_utf8;
+  static constexpr auto to_utf8_with_errors =
+      simdutf::convert_utf32be_to_utf8_with_errors;
+  static constexpr auto valid_to_utf8 = simdutf::convert_valid_utf32be_to_utf8;
+  static constexpr auto to_utf16 = simdutf::convert_utf32be_to_utf16;
+  static constexpr auto to_utf16_with_errors =
+      simdutf::convert_utf32be_to_utf16_with_errors;
+  static constexpr auto valid_to_utf16 =
+      simdutf::convert_valid_utf32be_to_utf16;
+  static constexpr auto from_utf8 = simdutf::convert_utf8_to_utf32be;
+  static constexpr auto from_utf8_with_errors =
+      simdutf::convert_utf8_to_utf32be_with_errors;
+  static constexpr auto valid_from_utf8 =
+      simdutf::convert_valid_utf8_to_utf32be;
+  static constexpr auto from_utf16 = simdutf::convert_utf16_to_utf32be;
+  static constexpr auto from_utf16_with_errors =
+      simdutf::convert_utf16_to_utf32be_with_errors;
+  static constexpr auto valid_from_utf16 =
+      simdutf::convert_valid_utf16_to_utf32be;
+};
+
+// Checks every function against the native-endian one on a valid string.
+template <endianness e> void check_valid(const std::vector<char32_t> &native) {
+  using f = utf32_functions<e>;
+  const std::vector<char32_t> input = in_order(native, e);
+  const size_t n = input.size();
+  ASSERT_TRUE(f::validate(input.data(), n));
+  simdutf::result r = f::validate_with_errors(input.data(), n);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, n);
+
+  std::string utf8(4 * n, '\0');
+  utf8.resize(simdutf::convert_utf32_to_utf8(native.data(), n, &utf8[0]));
+  ASSERT_EQUAL(f::utf8_length(input.data(), n), utf8.size());
+  std::string output(utf8.size(), '\0');
+  ASSERT_EQUAL(f::to_utf8(input.data(), n, &output[0]), utf8.size());
+  ASSERT_TRUE(output == utf8);
+  output.assign(utf8.size(), '\0');
+  r = f::to_utf8_with_errors(input.data(), n, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, utf8.size());
+  ASSERT_TRUE(output == utf8);
+  output.assign(utf8.size(), '\0');
+  ASSERT_EQUAL(f::valid_to_utf8(input.data(), n, &output[0]), utf8.size());
+  ASSERT_TRUE(output == utf8);
+
+  std::u16string utf16(2 * n, u'\0');
+  utf16.resize(simdutf::convert_utf32_to_utf16(native.data(), n, &utf16[0]));
+  ASSERT_EQUAL(f::utf16_length(input.data(), n), utf16.size());
+  std::u16string output16(utf16.size(), u'\0');
+  ASSERT_EQUAL(f::to_utf16(input.data(), n, &output16[0]), utf16.size());
+  ASSERT_TRUE(output16 == utf16);
+  output16.assign(utf16.size(), u'\0');
+  r = f::to_utf16_with_errors(input.data(), n, &output16[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, utf16.size());
+  ASSERT_TRUE(output16 == utf16);
+  output16.assign(utf16.size(), u'\0');
+  ASSERT_EQUAL(f::valid_to_utf16(input.data(), n, &output16[0]),
+               utf16.size());
+  ASSERT_TRUE(output16 == utf16);
+
+  std::vector<char32_t> utf32(n);
+  ASSERT_EQUAL(f::from_utf8(utf8.data(), utf8.size(), utf32.data()), n);
+  ASSERT_TRUE(utf32 == input);
+  utf32.assign(n, 0);
+  r = f::from_utf8_with_errors(utf8.data(), utf8.size(), utf32.data());
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, n);
+  ASSERT_TRUE(utf32 == input);
+  utf32.assign(n, 0);
+  ASSERT_EQUAL(f::valid_from_utf8(utf8.data(), utf8.size(), utf32.data()), n);
+  ASSERT_TRUE(utf32 == input);
+
+  utf32.assign(n, 0);
+  ASSERT_EQUAL(f::from_utf16(utf16.data(), utf16.size(), utf32.data()), n);
+  ASSERT_TRUE(utf32 == input);
+  utf32.assign(n, 0);
+  r = f::from_utf16_with_errors(utf16.data(), utf16.size(), utf32.data());
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, n);
+  ASSERT_TRUE(utf32 == input);
+  utf32.assign(n, 0);
+  ASSERT_EQUAL(f::valid_from_utf16(utf16.data(), utf16.size(), utf32.data()),
+               n);
+  ASSERT_TRUE(utf32 == input);
+}
+
+// Checks that an invalid code unit is reported at its position.
+template <endianness e>
+void check_invalid(const std::vector<char32_t> &native, size_t position,
+                   char32_t bad, error_code error) {
+  using f = utf32_functions<e>;
+  std::vector<char32_t> broken = native;
+  broken[position] = bad;
+  const std::vector<char32_t> input = in_order(broken, e);
+  const size_t n = input.size();
+  ASSERT_FALSE(f::validate(input.data(), n));
+  simdutf::result r = f::validate_with_errors(input.data(), n);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+
+  std::string utf8(4 * n, '\0');
+  ASSERT_EQUAL(f::to_utf8(input.data(), n, &utf8[0]), size_t(0));
+  r = f::to_utf8_with_errors(input.data(), n, &utf8[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+  std::u16string utf16(2 * n, u'\0');
+  ASSERT_EQUAL(f::to_utf16(input.data(), n, &utf16[0]), size_t(0));
+  r = f::to_utf16_with_errors(input.data(), n, &utf16[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+}
+
+// Checks that the code points decoded before an error are written in the
+// requested byte order.
+template <endianness e>
+void check_prefix_on_error(const std::vector<char32_t> &native, size_t k) {
+  using f = utf32_functions<e>;
+  const std::vector<char32_t> prefix(native.begin(), native.begin() + k);
+  const std::vector<char32_t> expected = in_order(prefix, e);
+
+  std::string utf8(4 * k, '\0');
+  utf8.resize(simdutf::convert_utf32_to_utf8(prefix.data(), k, &utf8[0]));
+  const size_t utf8_error = utf8.size();
+  utf8 += '\xff';
+  utf8 += "some more text after the error";
+  std::vector<char32_t> utf32(utf8.size());
+  simdutf::result r =
+      f::from_utf8_with_errors(utf8.data(), utf8.size(), utf32.data());
+  ASSERT_EQUAL(r.error, error_code::HEADER_BITS);
+  ASSERT_EQUAL(r.count, utf8_error);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), utf32.begin()));
+
+  std::u16string utf16(2 * k, u'\0');
+  utf16.resize(simdutf::convert_utf32_to_utf16(prefix.data(), k, &utf16[0]));
+  const size_t utf16_error = utf16.size();
+  utf16 += char16_t(0xdc00);
+  utf16 += u"some more text after the error";
+  utf32.assign(utf16.size(), 0);
+  r = f::from_utf16_with_errors(utf16.data(), utf16.size(), utf32.data());
+  ASSERT_EQUAL(r.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, utf16_error);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), utf32.begin()));
+}
+} // namespace
+
+TEST(change_endianness_round_trip) {
+  simdutf::tests::helpers::random_utf32 generator{1234};
+  for (size_t size : sizes) {
+    const std::vector<char32_t> input = generator.generate(size);
+    const std::vector<char32_t> once = swapped(input);
+    for (size_t i = 0; i < size; i++) {
+      ASSERT_EQUAL(uint32_t(once[i]),
+                   simdutf::scalar::u32_swap_bytes(uint32_t(input[i])));
+    }
+    ASSERT_TRUE(swapped(once) == input);
+  }
+}
+
+TEST(valid_strings) {
+  simdutf::tests::helpers::random_utf32 generator{1234};
+  for (size_t trial = 0; trial < 10; trial++) {
+    for (size_t size : sizes) {
+      const std::vector<char32_t> input = generator.generate(size);
+      check_valid<endianness::LITTLE>(input);
+      check_valid<endianness::BIG>(input);
+    }
+  }
+}
+
+TEST(invalid_strings) {
+  simdutf::tests::helpers::random_utf32 generator{1234};
+  const std::vector<char32_t> input = generator.generate(5000);
+  for (size_t position : {0, 1, 2047, 2048, 4100, 4999}) {
+    check_invalid<endianness::LITTLE>(input, position, 0x110000,
+                                      error_code::TOO_LARGE);
+    check_invalid<endianness::BIG>(input, position, 0x110000,
+                                   error_code::TOO_LARGE);
+    check_invalid<endianness::LITTLE>(input, position, 0xd800,
+                                      error_code::SURROGATE);
+    check_invalid<endianness::BIG>(input, position, 0xdfff,
+                                   error_code::SURROGATE);
+  }
+}
+
+TEST(error_keeps_valid_prefix) {
+  simdutf::tests::helpers::random_utf32 generator{1234};
+  const std::vector<char32_t> input = generator.generate(1000);
+  for (size_t k : {0, 1, 15, 16, 17, 100, 999, 1000}) {
+    check_prefix_on_error<endianness::LITTLE>(input, k);
+    check_prefix_on_error<endianness::BIG>(input, k);
+  }
+}
+
+TEST(invalid_utf8_input) {
+  std::vector<char32_t> output(8);
+  ASSERT_EQUAL(simdutf::convert_utf8_to_utf32le("ab\xff", 3, output.data()),
+               size_t(0));
+  const simdutf::result r =
+      simdutf::convert_utf8_to_utf32be_with_errors("ab\xff", 3, output.data());
+  ASSERT_EQUAL(r.error, error_code::HEADER_BITS);
+  ASSERT_EQUAL(r.count, size_t(2));
+}
+
+TEST_MAIN
@@ -0,0 +1,148 @@
+#include "simdutf.h"
+
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// Feeds the input to a stream validator in chunks of random sizes (up to
+// max_chunk bytes) and returns the result of finish(), or the first error.
+simdutf::result validate_in_chunks(const std::vector<uint8_t> &input,
+                                   size_t max_chunk, uint32_t seed) {
+  simdutf::tests::helpers::RandomInt chunk_size(0, max_chunk, seed);
+  simdutf::utf8_stream_validator validator;
+  const char *data = reinterpret_cast<const char *>(input.data());
+  size_t pos = 0;
+  while (pos < input.size()) {
+    const size_t len = std::min<size_t>(chunk_size(), input.size() - pos);
+    const simdutf::result r = validator.feed(data + pos, len);
+    if (r.error != simdutf::error_code::SUCCESS) {
+      return r;
+    }
+    ASSERT_TRUE(r.count <= pos + len);
+    ASSERT_TRUE(r.count + 3 >= pos + len);
+    pos += len;
+  }
+  return validator.finish();
+}
+} // namespace
+
+TEST(empty_stream) {
+  simdutf::utf8_stream_validator validator;
+  ASSERT_EQUAL(validator.feed("", 0).error, simdutf::error_code::SUCCESS);
+  const simdutf::result r = validator.finish();
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(0));
+}
+
+TEST(split_every_byte) {
+  // "école d'été" followed by U+1F600
+  const char input[] = "\xc3\xa9\x63ole d'\xc3\xa9t\xc3\xa9\xf0\x9f\x98\x80";
+  const size_t length = sizeof(input) - 1;
+  simdutf::utf8_stream_validator validator;
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_EQUAL(validator.feed(input + i, 1).error,
+                 simdutf::error_code::SUCCESS);
+  }
+  const simdutf::result r = validator.finish();
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, length);
+}
+
+TEST(truncated_stream) {
+  const char input[] = "abc\xf0\x9f\x98";
+  simdutf::utf8_stream_validator validator;
+  const simdutf::result fed = validator.feed(input, 6);
+  ASSERT_EQUAL(fed.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(fed.count, size_t(3));
+  const simdutf::result r = validator.finish();
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(3));
+}
+
+TEST(error_across_chunks) {
+  // The leading byte of a three-byte character ends the first chunk and the
+  // second chunk starts with ASCII.
+  simdutf::utf8_stream_validator validator;
+  ASSERT_EQUAL(validator.feed("0123456789\xe2", 11).error,
+               simdutf::error_code::SUCCESS);
+  simdutf::result r = validator.feed("\x82xyz", 4);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(10));
+  // The error is sticky.
+  r = validator.feed("abc", 3);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(10));
+  r = validator.finish();
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(10));
+  // Until the validator is reset.
+  validator.reset();
+  ASSERT_EQUAL(validator.feed("abc", 3).error, simdutf::error_code::SUCCESS);
+  r = validator.finish();
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(3));
+}
+
+TEST_LOOP(random_chunks_valid) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  for (size_t size : {0, 1, 7, 63, 64, 65, 300, 1024}) {
+    const auto utf8{generator.generate(size, seed)};
+    for (size_t max_chunk : {1, 2, 5, 17, 64, 200}) {
+      const simdutf::result r = validate_in_chunks(utf8, max_chunk, seed);
+      ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+      ASSERT_EQUAL(r.count, utf8.size());
+    }
+  }
+}
+
+TEST_LOOP(random_chunks_match_one_shot) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  simdutf::tests::helpers::RandomInt random_byte(0, 0xff, seed);
+  auto utf8{generator.generate(256, seed)};
+  for (size_t i = 0; i < utf8.size(); i += 3) {
+    const uint8_t old = utf8[i];
+    utf8[i] = uint8_t(random_byte());
+    const simdutf::result expected = simdutf::validate_utf8_with_errors(
+        reinterpret_cast<const char *>(utf8.data()), utf8.size());
+    for (size_t max_chunk : {1, 3, 16, 100}) {
+      const simdutf::result r = validate_in_chunks(utf8, max_chunk, seed);
+      ASSERT_EQUAL(r.error, expected.error);
+      ASSERT_EQUAL(r.count, expected.count);
+    }
+    utf8[i] = old;
+  }
+}
+
+TEST(all_split_points) {
+  // Every way of cutting a short string with errors in two pieces must report
+  // the same error as the one-shot validation.
+  const std::vector<std::vector<uint8_t>> inputs = {
+      {0x61, 0xe2, 0x82, 0xac, 0x62},       {0x61, 0xe2, 0x82, 0x62},
+      {0xf0, 0x9f, 0x98, 0x80, 0xf0, 0x9f}, {0xe0, 0x80, 0x80, 0x61},
+      {0xed, 0xa0, 0x80, 0x61},             {0xf4, 0x90, 0x80, 0x80},
+      {0x61, 0x80, 0x80, 0x61},             {0xc3, 0xa9, 0xa9},
+      {0xff, 0x80, 0x80, 0x80},             {0xe0, 0x41, 0x80, 0x80},
+      {0xc0, 0x80},                         {0xf8, 0x88, 0x80, 0x80, 0x80}};
+  for (const auto &input : inputs) {
+    const char *data = reinterpret_cast<const char *>(input.data());
+    const simdutf::result expected =
+        simdutf::validate_utf8_with_errors(data, input.size());
+    for (size_t split = 0; split <= input.size(); split++) {
+      simdutf::utf8_stream_validator validator;
+      simdutf::result r = validator.feed(data, split);
+      if (r.is_ok()) {
+        r = validator.feed(data + split, input.size() - split);
+      }
+      if (r.is_ok()) {
+        r = validator.finish();
+      }
+      ASSERT_EQUAL(r.error, expected.error);
+      ASSERT_EQUAL(r.count, expected.count);
+    }
+  }
+}
+
+TEST_MAIN
@@ -0,0 +1,155 @@
+#include "simdutf.h"
+
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+struct stream_output {
+  simdutf::result status;
+  std::vector<char16_t> utf16;
+};
+
+// Feeds the input to a stream transcoder in chunks of random sizes (up to
+// max_chunk bytes) and returns everything it wrote along with the result of
+// finish(), or the first error.
+stream_output convert_in_chunks(const std::vector<uint8_t> &input,
+                                simdutf::endianness e, size_t max_chunk,
+                                uint32_t seed) {
+  simdutf::tests::helpers::RandomInt chunk_size(0, max_chunk, seed);
+  simdutf::utf8_to_utf16_stream stream(e);
+  const char *data = reinterpret_cast<const char *>(input.data());
+  stream_output out;
+  std::vector<char16_t> buffer(max_chunk + 1);
+  size_t pos = 0;
+  while (pos < input.size()) {
+    const size_t len = std::min<size_t>(chunk_size(), input.size() - pos);
+    const simdutf::full_result r =
+        stream.convert(data + pos, len, buffer.data());
+    out.utf16.insert(out.utf16.end(), buffer.begin(),
+                     buffer.begin() + r.output_count);
+    if (r.error != simdutf::error_code::SUCCESS) {
+      out.status = simdutf::result(r.error, r.input_count);
+      return out;
+    }
+    ASSERT_EQUAL(r.input_count, len);
+    pos += len;
+  }
+  out.status = stream.finish();
+  return out;
+}
+
+std::vector<char16_t> one_shot(const std::vector<uint8_t> &input,
+                               simdutf::endianness e, size_t length) {
+  const char *data = reinterpret_cast<const char *>(input.data());
+  std::vector<char16_t> utf16(length + 1);
+  const size_t written =
+      e == simdutf::endianness::BIG
+          ? simdutf::convert_valid_utf8_to_utf16be(data, length, utf16.data())
+          : simdutf::convert_valid_utf8_to_utf16le(data, length, utf16.data());
+  utf16.resize(written);
+  return utf16;
+}
+} // namespace
+
+TEST(split_every_byte) {
+  // "école" followed by U+1F600
+  const char input[] = "\xc3\xa9\x63ole\xf0\x9f\x98\x80";
+  const size_t length = sizeof(input) - 1;
+  simdutf::utf8_to_utf16_stream stream(simdutf::endianness::LITTLE);
+  std::vector<char16_t> utf16;
+  char16_t buffer[2];
+  for (size_t i = 0; i < length; i++) {
+    const simdutf::full_result r = stream.convert(input + i, 1, buffer);
+    ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+    ASSERT_EQUAL(r.input_count, size_t(1));
+    utf16.insert(utf16.end(), buffer, buffer + r.output_count);
+  }
+  const simdutf::result r = stream.finish();
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, length);
+  std::vector<char16_t> expected = {0xe9, 'c', 'o', 'l', 'e', 0xd83d, 0xde00};
+  if (!simdutf::match_system(simdutf::endianness::LITTLE)) {
+    simdutf::change_endianness_utf16(expected.data(), expected.size(),
+                                     expected.data());
+  }
+  ASSERT_TRUE(utf16 == expected);
+}
+
+TEST(truncated_stream) {
+  simdutf::utf8_to_utf16_stream stream;
+  char16_t buffer[8];
+  const simdutf::full_result r = stream.convert("abc\xe2\x82", 5, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.input_count, size_t(5));
+  ASSERT_EQUAL(r.output_count, size_t(3));
+  const simdutf::result end = stream.finish();
+  ASSERT_EQUAL(end.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(end.count, size_t(3));
+}
+
+TEST(error_is_sticky) {
+  simdutf::utf8_to_utf16_stream stream;
+  char16_t buffer[16];
+  simdutf::full_result r = stream.convert("0123\xf0\x9f", 6, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(4));
+  // The four-byte character is interrupted by ASCII.
+  r = stream.convert("\x98xyz", 4, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.input_count, size_t(4));
+  ASSERT_EQUAL(r.output_count, size_t(0));
+  r = stream.convert("abc", 3, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.input_count, size_t(4));
+  ASSERT_EQUAL(stream.finish().error, simdutf::error_code::TOO_SHORT);
+  stream.reset();
+  r = stream.convert("abc", 3, buffer);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.output_count, size_t(3));
+  ASSERT_EQUAL(stream.finish().count, size_t(3));
+}
+
+TEST_LOOP(random_chunks_valid) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  for (size_t size : {0, 1, 7, 63, 64, 65, 300, 1024}) {
+    const auto utf8{generator.generate(size, seed)};
+    for (simdutf::endianness e :
+         {simdutf::endianness::LITTLE, simdutf::endianness::BIG}) {
+      const auto expected = one_shot(utf8, e, utf8.size());
+      for (size_t max_chunk : {1, 2, 5, 17, 64, 200}) {
+        const stream_output out = convert_in_chunks(utf8, e, max_chunk, seed);
+        ASSERT_EQUAL(out.status.error, simdutf::error_code::SUCCESS);
+        ASSERT_EQUAL(out.status.count, utf8.size());
+        ASSERT_TRUE(out.utf16 == expected);
+      }
+    }
+  }
+}
+
+TEST_LOOP(random_chunks_match_one_shot) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  simdutf::tests::helpers::RandomInt random_byte(0, 0xff, seed);
+  auto utf8{generator.generate(256, seed)};
+  for (size_t i = 0; i < utf8.size(); i += 5) {
+    const uint8_t old = utf8[i];
+    utf8[i] = uint8_t(random_byte());
+    const simdutf::result expected = simdutf::validate_utf8_with_errors(
+        reinterpret_cast<const char *>(utf8.data()), utf8.size());
+    // Everything that precedes the error must have been written.
+    const auto expected_utf16 =
+        one_shot(utf8, simdutf::endianness::LITTLE, expected.count);
+    for (size_t max_chunk : {1, 3, 16, 100}) {
+      const stream_output out = convert_in_chunks(
+          utf8, simdutf::endianness::LITTLE, max_chunk, seed);
+      ASSERT_EQUAL(out.status.error, expected.error);
+      ASSERT_EQUAL(out.status.count, expected.count);
+      ASSERT_TRUE(out.utf16 == expected_utf16);
+    }
+    utf8[i] = old;
+  }
+}
+
+TEST_MAIN
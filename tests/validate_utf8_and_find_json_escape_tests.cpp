@@ -0,0 +1,131 @@
+#include "simdutf.h"
+
+#include <array>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// Random UTF-8 text without any character to escape.
+std::vector<char> random_text(uint32_t seed, size_t size) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  const std::vector<uint8_t> utf8 = generator.generate(size);
+  std::vector<char> text(utf8.begin(), utf8.end());
+  for (char &c : text) {
+    if (uint8_t(c) < 0x20 || c == '"' || c == '\\') {
+      c = 'a';
+    }
+  }
+  return text;
+}
+
+void check(const simdutf::implementation &implementation,
+           const std::vector<char> &input) {
+  const simdutf::result valid =
+      implementation.validate_utf8_with_errors(input.data(), input.size());
+  const simdutf::result r = implementation.validate_utf8_and_find_json_escape(
+      input.data(), input.size());
+  ASSERT_EQUAL(r.error, valid.error);
+  if (valid.error != simdutf::error_code::SUCCESS) {
+    ASSERT_EQUAL(r.count, valid.count);
+    return;
+  }
+  size_t expected = 0;
+  while (expected < input.size() && uint8_t(input[expected]) >= 0x20 &&
+         input[expected] != '"' && input[expected] != '\\') {
+    expected++;
+  }
+  ASSERT_EQUAL(r.count, expected);
+}
+} // namespace
+
+TEST(examples) {
+  const char clean[] = "caf\xc3\xa9 au lait";
+  simdutf::result r =
+      implementation.validate_utf8_and_find_json_escape(clean, 13);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(13));
+
+  const char quoted[] = "say \"hi\"";
+  r = implementation.validate_utf8_and_find_json_escape(quoted, 8);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(4));
+
+  // The string is validated past the first byte to escape.
+  const char invalid[] = "a\tb\xff";
+  r = implementation.validate_utf8_and_find_json_escape(invalid, 4);
+  ASSERT_EQUAL(r.error, simdutf::error_code::HEADER_BITS);
+  ASSERT_EQUAL(r.count, size_t(3));
+
+  // DEL and non-ASCII characters need no escaping.
+  const char del[] = "\x7f\xc2\x80";
+  r = implementation.validate_utf8_and_find_json_escape(del, 3);
+  ASSERT_EQUAL(r.count, size_t(3));
+
+  r = implementation.validate_utf8_and_find_json_escape(nullptr, 0);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(0));
+}
+
+TEST(every_position) {
+  for (size_t size : {1, 15, 63, 64, 65, 130, 700}) {
+    const std::vector<char> input = random_text(uint32_t(size), size);
+    check(implementation, input);
+    for (char c : {'"', '\\', '\0', '\n', '\x1f'}) {
+      for (size_t i = 0; i < size; i++) {
+        if (uint8_t(input[i]) >= 0x80) {
+          continue; // Keep the input valid.
+        }
+        std::vector<char> escaped = input;
+        escaped[i] = c;
+        check(implementation, escaped);
+      }
+    }
+  }
+}
+
+TEST(valid_input) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+    for (size_t size : {1, 64, 1000, 10000, 65536}) {
+      const std::vector<uint8_t> utf8 = generator.generate(size);
+      check(implementation, std::vector<char>(utf8.begin(), utf8.end()));
+      check(implementation, random_text(seed, size));
+    }
+  }
+}
+
+TEST(corrupted_input) {
+  for (uint32_t seed = 0; seed < 100; seed++) {
+    simdutf::tests::helpers::RandomInt random_size(1, 5000, seed);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    std::vector<char> input = random_text(seed, random_size());
+    simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                       seed);
+    input[random_position()] = '"';
+    for (size_t trial = 0; trial < 10; trial++) {
+      const size_t position = random_position();
+      const char original = input[position];
+      input[position] = char(random_byte());
+      check(implementation, input);
+      input[position] = original;
+    }
+  }
+}
+
+#if SIMDUTF_CPLUSPLUS23
+
+namespace {
+constexpr std::array<char, 4> escaped_input = {'a', 'b', '\\', 'n'};
+} // namespace
+
+TEST(compile_time_find_json_escape) {
+  static_assert(
+      simdutf::validate_utf8_and_find_json_escape(escaped_input).count == 2);
+}
+
+#endif
+
+TEST_MAIN
@@ -0,0 +1,156 @@
+#include "simdutf.h"
+
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// Random UTF-8 text where about one character in line_length is a newline.
+std::vector<char> random_text(uint32_t seed, size_t size, size_t line_length) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  const std::vector<uint8_t> utf8 = generator.generate(size);
+  std::vector<char> text(utf8.begin(), utf8.end());
+  simdutf::tests::helpers::RandomInt random_newline(0, line_length, seed);
+  for (char &c : text) {
+    if (uint8_t(c) < 0x80 && random_newline() == 0) {
+      c = '\n';
+    }
+  }
+  return text;
+}
+
+// The positions of the newlines in input[0, end).
+std::vector<size_t> newlines_before(const std::vector<char> &input,
+                                    size_t end) {
+  std::vector<size_t> positions;
+  for (size_t i = 0; i < end; i++) {
+    if (input[i] == '\n') {
+      positions.push_back(i);
+    }
+  }
+  return positions;
+}
+
+// Indexes the whole input with an array of the given capacity, resuming after
+// each OUTPUT_BUFFER_TOO_SMALL, and compares with a plain search.
+void check(const simdutf::implementation &implementation,
+           const std::vector<char> &input, size_t capacity) {
+  const simdutf::result valid =
+      implementation.validate_utf8_with_errors(input.data(), input.size());
+  const size_t valid_end =
+      valid.error == simdutf::error_code::SUCCESS ? input.size() : valid.count;
+  const std::vector<size_t> expected = newlines_before(input, valid_end);
+
+  std::vector<size_t> found;
+  std::vector<size_t> line_positions(capacity + 1, size_t(-1));
+  size_t start = 0;
+  while (true) {
+    size_t line_count = capacity;
+    const simdutf::result r = implementation.validate_utf8_and_index_lines(
+        input.data() + start, input.size() - start, line_positions.data(),
+        line_count);
+    ASSERT_TRUE(line_count <= capacity);
+    // Nothing is written past the capacity.
+    ASSERT_EQUAL(line_positions[capacity], size_t(-1));
+    for (size_t i = 0; i < line_count; i++) {
+      found.push_back(start + line_positions[i]);
+    }
+    if (r.error != simdutf::error_code::OUTPUT_BUFFER_TOO_SMALL) {
+      ASSERT_EQUAL(r.error, valid.error);
+      ASSERT_EQUAL(start + r.count, valid.count);
+      break;
+    }
+    // The array is full and the input before the newline is valid.
+    ASSERT_EQUAL(line_count, capacity);
+    ASSERT_EQUAL(input[start + r.count], '\n');
+    ASSERT_TRUE(start + r.count < valid_end);
+    start += r.count;
+  }
+  ASSERT_TRUE(found == expected);
+}
+} // namespace
+
+TEST(examples) {
+  const std::vector<char> input = {'a', '\n', char(0xc3), char(0xa9), '\n',
+                                   '\n', 'b'};
+  size_t line_positions[4];
+  size_t line_count = 4;
+  simdutf::result r = implementation.validate_utf8_and_index_lines(
+      input.data(), input.size(), line_positions, line_count);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, input.size());
+  ASSERT_EQUAL(line_count, size_t(3));
+  ASSERT_EQUAL(line_positions[0], size_t(1));
+  ASSERT_EQUAL(line_positions[1], size_t(4));
+  ASSERT_EQUAL(line_positions[2], size_t(5));
+
+  line_count = 2;
+  r = implementation.validate_utf8_and_index_lines(input.data(), input.size(),
+                                                   line_positions, line_count);
+  ASSERT_EQUAL(r.error, simdutf::error_code::OUTPUT_BUFFER_TOO_SMALL);
+  ASSERT_EQUAL(r.count, size_t(5));
+  ASSERT_EQUAL(line_count, size_t(2));
+
+  // Only the newlines before the error are recorded.
+  const std::vector<char> invalid = {'a', '\n', char(0xc3), '\n', '\n'};
+  line_count = 4;
+  r = implementation.validate_utf8_and_index_lines(
+      invalid.data(), invalid.size(), line_positions, line_count);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(2));
+  ASSERT_EQUAL(line_count, size_t(1));
+
+  // An empty array is enough for a string without newlines.
+  line_count = 0;
+  r = implementation.validate_utf8_and_index_lines("abc", 3, nullptr,
+                                                   line_count);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(line_count, size_t(0));
+}
+
+TEST(valid_input) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size = 0; size < 200; size++) {
+      check(implementation, random_text(seed, size, 10), 1000);
+    }
+    for (size_t size : {1000, 4096, 10000, 65536}) {
+      for (size_t line_length : {1, 80, 1000}) {
+        check(implementation, random_text(seed, size, line_length), 100000);
+      }
+    }
+  }
+  for (size_t size : {63, 64, 65, 1000}) {
+    check(implementation, std::vector<char>(size, '\n'), size);
+  }
+}
+
+TEST(small_capacity) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t capacity : {1, 2, 7, 64, 100}) {
+      check(implementation, random_text(seed, 5000, 20), capacity);
+      check(implementation, std::vector<char>(1000, '\n'), capacity);
+    }
+  }
+}
+
+TEST(corrupted_input) {
+  for (uint32_t seed = 0; seed < 100; seed++) {
+    simdutf::tests::helpers::RandomInt random_size(1, 5000, seed);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    std::vector<char> input = random_text(seed, random_size(), 30);
+    simdutf::tests::helpers::RandomInt random_position(0, input.size() - 1,
+                                                       seed);
+    for (size_t trial = 0; trial < 10; trial++) {
+      const size_t position = random_position();
+      const char original = input[position];
+      input[position] = char(random_byte());
+      check(implementation, input, 100000);
+      check(implementation, input, 3);
+      input[position] = original;
+    }
+  }
+}
+
+TEST_MAIN
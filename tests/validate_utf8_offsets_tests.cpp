@@ -0,0 +1,141 @@
+#include "simdutf.h"
+
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/random_utf8.h>
+#include <tests/helpers/test.h>
+
+namespace {
+// A string column stored as one data buffer and row_count + 1 offsets.
+template <typename offset_type> struct column {
+  std::vector<char> data;
+  std::vector<offset_type> offsets{0};
+
+  void add(const std::vector<uint8_t> &row) {
+    data.insert(data.end(), row.begin(), row.end());
+    offsets.push_back(offset_type(data.size()));
+  }
+
+  size_t row_count() const { return offsets.size() - 1; }
+};
+
+template <typename offset_type>
+column<offset_type> random_column(uint32_t seed, size_t row_count,
+                                  size_t max_length) {
+  simdutf::tests::helpers::random_utf8 generator{seed, 1, 1, 1, 1};
+  simdutf::tests::helpers::RandomInt random_length(0, max_length, seed);
+  column<offset_type> c;
+  for (size_t i = 0; i < row_count; i++) {
+    c.add(generator.generate(random_length()));
+  }
+  return c;
+}
+
+// What validating each row on its own reports.
+template <typename offset_type>
+simdutf::result validate_rows(const column<offset_type> &c) {
+  for (size_t row = 0; row < c.row_count(); row++) {
+    const simdutf::result r = simdutf::validate_utf8_with_errors(
+        c.data.data() + c.offsets[row],
+        size_t(c.offsets[row + 1] - c.offsets[row]));
+    if (r.error != simdutf::error_code::SUCCESS) {
+      return simdutf::result(r.error, row);
+    }
+  }
+  return simdutf::result(simdutf::error_code::SUCCESS, c.row_count());
+}
+
+template <typename offset_type> void check(const column<offset_type> &c) {
+  const simdutf::result expected = validate_rows(c);
+  const simdutf::result r = simdutf::validate_utf8_offsets(
+      c.data.data(), c.offsets.data(), c.row_count());
+  ASSERT_EQUAL(r.error, expected.error);
+  ASSERT_EQUAL(r.count, expected.count);
+}
+} // namespace
+
+TEST(no_rows) {
+  const int32_t offsets[] = {0};
+  const simdutf::result r = simdutf::validate_utf8_offsets("", offsets, 0);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(0));
+}
+
+TEST(empty_rows) {
+  // "é" split between the two non-empty rows, with empty rows around.
+  const char data[] = "ab\xc3\xa9";
+  const int64_t offsets[] = {1, 1, 3, 3, 4, 4};
+  simdutf::result r = simdutf::validate_utf8_offsets(data, offsets, 5);
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, size_t(1));
+  const int64_t aligned[] = {1, 1, 2, 2, 4, 4};
+  r = simdutf::validate_utf8_offsets(data, aligned, 5);
+  ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, size_t(5));
+}
+
+TEST(valid_columns) {
+  for (uint32_t seed = 0; seed < 20; seed++) {
+    for (size_t max_length : {0, 1, 8, 40, 200}) {
+      const column<int32_t> c32 = random_column<int32_t>(seed, 500, max_length);
+      const simdutf::result r = simdutf::validate_utf8_offsets(
+          c32.data.data(), c32.offsets.data(), c32.row_count());
+      ASSERT_EQUAL(r.error, simdutf::error_code::SUCCESS);
+      ASSERT_EQUAL(r.count, c32.row_count());
+      check(random_column<int64_t>(seed, 500, max_length));
+    }
+  }
+}
+
+TEST(corrupted_bytes) {
+  for (uint32_t seed = 0; seed < 50; seed++) {
+    column<int32_t> c = random_column<int32_t>(seed, 200, 20);
+    simdutf::tests::helpers::RandomInt random_position(0, c.data.size() - 1,
+                                                       seed);
+    simdutf::tests::helpers::RandomInt random_byte(0x80, 0xff, seed);
+    for (size_t trial = 0; trial < 20; trial++) {
+      const size_t position = random_position();
+      const char original = c.data[position];
+      c.data[position] = char(random_byte());
+      check(c);
+      c.data[position] = original;
+    }
+  }
+}
+
+TEST(misaligned_offsets) {
+  for (uint32_t seed = 0; seed < 50; seed++) {
+    column<int64_t> c = random_column<int64_t>(seed, 200, 20);
+    simdutf::tests::helpers::RandomInt random_row(1, c.row_count() - 1, seed);
+    simdutf::tests::helpers::RandomInt random_shift(0, 6, seed);
+    for (size_t trial = 0; trial < 20; trial++) {
+      const size_t row = random_row();
+      const int64_t original = c.offsets[row];
+      // Move the boundary by up to three bytes either way, within the
+      // neighbouring rows.
+      const int64_t moved = original + int64_t(random_shift()) - 3;
+      if (moved < c.offsets[row - 1] || moved > c.offsets[row + 1]) {
+        continue;
+      }
+      c.offsets[row] = moved;
+      check(c);
+      c.offsets[row] = original;
+    }
+  }
+}
+
+TEST(error_and_misaligned_offset) {
+  column<int32_t> c = random_column<int32_t>(1234, 100, 30);
+  // A misaligned offset before a corrupted byte must be reported first.
+  c.add({'a', 0xe2, 0x82, 0xac, 'b'});
+  c.add({'c', 0xff, 'd'});
+  c.offsets[c.row_count() - 1] -= 2;
+  check(c);
+  const simdutf::result r = simdutf::validate_utf8_offsets(
+      c.data.data(), c.offsets.data(), c.row_count());
+  ASSERT_EQUAL(r.error, simdutf::error_code::TOO_SHORT);
+  ASSERT_EQUAL(r.count, c.row_count() - 2);
+}
+
+TEST_MAIN
@@ -0,0 +1,184 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::error_code;
+
+// WHATWG index-windows-1252 for the bytes 0x80 to 0x9F.
+const char16_t c1[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178};
+
+char16_t expected(uint8_t byte) {
+  return byte >= 0x80 && byte < 0xa0 ? c1[byte - 0x80] : char16_t(byte);
+}
+
+// Random bytes where about one byte in c1_rate is in the range 0x80-0x9F.
+std::string random_windows1252(uint32_t seed, size_t size, size_t c1_rate) {
+  simdutf::tests::helpers::RandomInt random_byte(0, 255, seed);
+  simdutf::tests::helpers::RandomInt random_c1(0, c1_rate, seed);
+  std::string output(size, '\0');
+  for (char &c : output) {
+    const uint8_t byte = uint8_t(random_byte());
+    const bool is_c1 = byte >= 0x80 && byte < 0xa0;
+    if (random_c1() == 0) {
+      c = char(0x80 | (byte & 0x1f));
+    } else {
+      c = char(is_c1 ? byte ^ 0x40 : byte);
+    }
+  }
+  return output;
+}
+
+void check_round_trip(const std::string &input) {
+  std::u16string utf16(input.size(), u'\0');
+  ASSERT_EQUAL(simdutf::convert_windows1252_to_utf16(input.data(), input.size(),
+                                                     &utf16[0]),
+               input.size());
+  for (size_t i = 0; i < input.size(); i++) {
+    ASSERT_EQUAL(uint32_t(utf16[i]), uint32_t(expected(uint8_t(input[i]))));
+  }
+
+  std::u32string utf32(input.size(), U'\0');
+  ASSERT_EQUAL(simdutf::convert_windows1252_to_utf32(input.data(), input.size(),
+                                                     &utf32[0]),
+               input.size());
+  for (size_t i = 0; i < input.size(); i++) {
+    ASSERT_EQUAL(uint32_t(utf32[i]), uint32_t(utf16[i]));
+  }
+
+  std::string utf8(3 * input.size(), '\0');
+  utf8.resize(simdutf::convert_windows1252_to_utf8(input.data(), input.size(),
+                                                   &utf8[0]));
+  ASSERT_EQUAL(
+      simdutf::utf8_length_from_windows1252(input.data(), input.size()),
+      utf8.size());
+  std::string from_utf16(3 * input.size(), '\0');
+  from_utf16.resize(simdutf::convert_utf16_to_utf8(utf16.data(), utf16.size(),
+                                                   &from_utf16[0]));
+  ASSERT_TRUE(utf8 == from_utf16);
+
+  std::string back(input.size(), '\0');
+  simdutf::result r = simdutf::convert_utf8_to_windows1252_with_errors(
+      utf8.data(), utf8.size(), &back[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, input.size());
+  ASSERT_TRUE(back == input);
+  back.assign(input.size(), '\0');
+  r = simdutf::convert_utf16_to_windows1252_with_errors(utf16.data(),
+                                                        utf16.size(), &back[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, input.size());
+  ASSERT_TRUE(back == input);
+  back.assign(input.size(), '\0');
+  ASSERT_EQUAL(simdutf::convert_utf32_to_windows1252(utf32.data(),
+                                                     utf32.size(), &back[0]),
+               input.size());
+  ASSERT_TRUE(back == input);
+}
+
+void check_utf8_error(const std::string &utf8, error_code error,
+                      size_t position) {
+  std::string output(utf8.size(), '\0');
+  const simdutf::result r = simdutf::convert_utf8_to_windows1252_with_errors(
+      utf8.data(), utf8.size(), &output[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+  ASSERT_EQUAL(
+      simdutf::convert_utf8_to_windows1252(utf8.data(), utf8.size(),
+                                           &output[0]),
+      size_t(0));
+}
+} // namespace
+
+TEST(every_byte) {
+  std::string input(256, '\0');
+  for (size_t i = 0; i < 256; i++) {
+    input[i] = char(i);
+  }
+  check_round_trip(input);
+  std::string utf8(3, '\0');
+  ASSERT_EQUAL(simdutf::convert_windows1252_to_utf8("\x80", 1, &utf8[0]),
+               size_t(3));
+  ASSERT_TRUE(utf8 == "\xe2\x82\xac");
+}
+
+TEST(find_c1_control) {
+  // Latin1 letters and no-break spaces around one C1 byte.
+  for (size_t size : {0, 1, 63, 64, 65, 200}) {
+    std::string input(size, '\xa0');
+    for (size_t i = 0; i < size; i += 3) {
+      input[i] = i % 2 ? 'a' : '\xff';
+    }
+    ASSERT_TRUE(implementation.find_c1_control(input.data(),
+                                               input.data() + size) ==
+                input.data() + size);
+    for (size_t position = 0; position < size; position++) {
+      for (char c1 : {'\x80', '\x9f'}) {
+        std::string with_c1 = input;
+        with_c1[position] = c1;
+        ASSERT_TRUE(implementation.find_c1_control(with_c1.data(),
+                                                   with_c1.data() + size) ==
+                    with_c1.data() + position);
+      }
+    }
+  }
+}
+
+TEST(random_strings) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size = 0; size < 100; size++) {
+      check_round_trip(random_windows1252(seed, size, 8));
+    }
+    for (size_t c1_rate : {1, 50, 100000}) {
+      check_round_trip(random_windows1252(seed, 5000, c1_rate));
+    }
+  }
+}
+
+TEST(unmappable_characters) {
+  // U+0080 is a Latin1 character but not a windows-1252 one.
+  check_utf8_error("ab\xc2\x80", error_code::TOO_LARGE, 2);
+  check_utf8_error("\xc3\xa9\xe2\x82\xac\xc2\x80", error_code::TOO_LARGE, 5);
+  check_utf8_error(std::string(100, 'a') + "\xc2\x9f", error_code::TOO_LARGE,
+                   100);
+  check_utf8_error("a\xc4\x80", error_code::TOO_LARGE, 1);
+  check_utf8_error("a\xe2\x82\xacz\xf0\x9f\x98\x80", error_code::TOO_LARGE, 5);
+  check_utf8_error("a\xe2\x82", error_code::TOO_SHORT, 1);
+  check_utf8_error("a\xe2\x82\xac\xff", error_code::HEADER_BITS, 4);
+
+  // The unassigned bytes come back from their C1 control.
+  std::string output(2, '\0');
+  ASSERT_EQUAL(simdutf::convert_utf8_to_windows1252("\xc2\x81\xc2\x9d", 4,
+                                                    &output[0]),
+               size_t(2));
+  ASSERT_TRUE(output == "\x81\x9d");
+
+  const char16_t utf16[] = {u'a', 0xd83d, u'b'};
+  simdutf::result r =
+      simdutf::convert_utf16_to_windows1252_with_errors(utf16, 3, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, size_t(1));
+  const char16_t emoji[] = {u'a', 0xd83d, 0xde00};
+  r = simdutf::convert_utf16_to_windows1252_with_errors(emoji, 3, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::TOO_LARGE);
+  ASSERT_EQUAL(r.count, size_t(1));
+  const char32_t utf32[] = {U'a', 0x85, 0x2026};
+  r = simdutf::convert_utf32_to_windows1252_with_errors(utf32, 3, &output[0]);
+  ASSERT_EQUAL(r.error, error_code::TOO_LARGE);
+  ASSERT_EQUAL(r.count, size_t(1));
+  const char32_t surrogate[] = {U'a', 0xdc00};
+  r = simdutf::convert_utf32_to_windows1252_with_errors(surrogate, 2,
+                                                        &output[0]);
+  ASSERT_EQUAL(r.error, error_code::SURROGATE);
+  ASSERT_EQUAL(r.count, size_t(1));
+}
+
+TEST_MAIN
@@ -0,0 +1,154 @@
+#include "simdutf.h"
+
+#include <string>
+#include <vector>
+
+#include <tests/helpers/random_int.h>
+#include <tests/helpers/test.h>
+
+namespace {
+using simdutf::error_code;
+
+// UTF-16 where about one code unit in surrogate_rate is a random surrogate,
+// so that most surrogates are unpaired, and as many again are pairs.
+std::u16string random_utf16(uint32_t seed, size_t size, size_t surrogate_rate) {
+  simdutf::tests::helpers::RandomInt random_kind(0, surrogate_rate, seed);
+  simdutf::tests::helpers::RandomInt random_unit(0, 0xffff, seed);
+  simdutf::tests::helpers::RandomInt random_surrogate(0xd800, 0xdfff, seed);
+  std::u16string output;
+  while (output.size() < size) {
+    const uint32_t kind = random_kind();
+    if (kind == 0) {
+      output.push_back(char16_t(random_surrogate()));
+    } else if (kind == 1) {
+      output.push_back(char16_t(0xd800 | (random_unit() & 0x3ff)));
+      output.push_back(char16_t(0xdc00 | (random_unit() & 0x3ff)));
+    } else {
+      const uint32_t unit = random_unit();
+      output.push_back(char16_t((unit & 0xf800) == 0xd800 ? unit & 0x7f
+                                                          : unit));
+    }
+  }
+  return output;
+}
+
+void append_utf8(std::string &output, uint32_t code_point) {
+  if (code_point < 0x80) {
+    output.push_back(char(code_point));
+  } else if (code_point < 0x800) {
+    output.push_back(char(0xc0 | (code_point >> 6)));
+    output.push_back(char(0x80 | (code_point & 0x3f)));
+  } else if (code_point < 0x10000) {
+    output.push_back(char(0xe0 | (code_point >> 12)));
+    output.push_back(char(0x80 | ((code_point >> 6) & 0x3f)));
+    output.push_back(char(0x80 | (code_point & 0x3f)));
+  } else {
+    output.push_back(char(0xf0 | (code_point >> 18)));
+    output.push_back(char(0x80 | ((code_point >> 12) & 0x3f)));
+    output.push_back(char(0x80 | ((code_point >> 6) & 0x3f)));
+    output.push_back(char(0x80 | (code_point & 0x3f)));
+  }
+}
+
+std::string reference_wtf8(const std::u16string &input) {
+  std::string output;
+  for (size_t i = 0; i < input.size(); i++) {
+    const char16_t unit = input[i];
+    if (unit >= 0xd800 && unit < 0xdc00 && i + 1 < input.size() &&
+        input[i + 1] >= 0xdc00 && input[i + 1] < 0xe000) {
+      append_utf8(output, 0x10000 + ((uint32_t(unit - 0xd800) << 10) |
+                                     uint32_t(input[i + 1] - 0xdc00)));
+      i++;
+    } else {
+      append_utf8(output, unit);
+    }
+  }
+  return output;
+}
+
+void check_round_trip(const std::u16string &utf16) {
+  const std::string expected = reference_wtf8(utf16);
+  ASSERT_EQUAL(simdutf::wtf8_length_from_utf16(utf16.data(), utf16.size()),
+               expected.size());
+  std::string wtf8(expected.size(), '\0');
+  ASSERT_EQUAL(
+      simdutf::convert_utf16_to_wtf8(utf16.data(), utf16.size(), &wtf8[0]),
+      expected.size());
+  ASSERT_TRUE(wtf8 == expected);
+
+  ASSERT_TRUE(simdutf::validate_wtf8(wtf8.data(), wtf8.size()));
+  ASSERT_EQUAL(simdutf::utf16_length_from_wtf8(wtf8.data(), wtf8.size()),
+               utf16.size());
+  std::u16string back(utf16.size(), u'\0');
+  const simdutf::result r = simdutf::convert_wtf8_to_utf16_with_errors(
+      wtf8.data(), wtf8.size(), &back[0]);
+  ASSERT_EQUAL(r.error, error_code::SUCCESS);
+  ASSERT_EQUAL(r.count, utf16.size());
+  ASSERT_TRUE(back == utf16);
+}
+
+void check_error(const std::string &input, error_code error, size_t position) {
+  simdutf::result r =
+      simdutf::validate_wtf8_with_errors(input.data(), input.size());
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+  ASSERT_FALSE(simdutf::validate_wtf8(input.data(), input.size()));
+  std::u16string utf16(input.size(), u'\0');
+  r = simdutf::convert_wtf8_to_utf16_with_errors(input.data(), input.size(),
+                                                 &utf16[0]);
+  ASSERT_EQUAL(r.error, error);
+  ASSERT_EQUAL(r.count, position);
+}
+} // namespace
+
+TEST(examples) {
+  const std::u16string utf16 = {u'a', 0xd83d, 0xde00, 0xdc00, 0xd800};
+  ASSERT_TRUE(reference_wtf8(utf16) ==
+              "a\xf0\x9f\x98\x80\xed\xb0\x80\xed\xa0\x80");
+  check_round_trip(utf16);
+  // A high surrogate just before the end of a block.
+  std::u16string long_utf16(2047, u'a');
+  long_utf16 += {0xd800, 0xdc00, 0xd800};
+  check_round_trip(long_utf16);
+  long_utf16[2047] = 0xdbff;
+  long_utf16[2048] = u'b';
+  check_round_trip(long_utf16);
+}
+
+TEST(random_strings) {
+  for (uint32_t seed = 0; seed < 10; seed++) {
+    for (size_t size = 0; size < 100; size++) {
+      check_round_trip(random_utf16(seed, size, 8));
+    }
+    for (size_t surrogate_rate : {2, 50, 100000}) {
+      check_round_trip(random_utf16(seed, 5000, surrogate_rate));
+    }
+  }
+}
+
+TEST(valid_utf8) {
+  const std::string utf8 = "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+  ASSERT_TRUE(simdutf::validate_wtf8(utf8.data(), utf8.size()));
+}
+
+TEST(invalid_sequences) {
+  // A surrogate pair written as two sequences, as in CESU-8.
+  check_error("a\xed\xa0\xbd\xed\xb8\x80", error_code::SURROGATE, 1);
+  check_error("a\xed\xa0", error_code::TOO_SHORT, 1);
+  check_error("a\xc0\x80", error_code::OVERLONG, 1);
+  check_error("a\xed\xb0\x80\xff", error_code::HEADER_BITS, 4);
+  check_error("a\xed\xb0\x80\x80", error_code::TOO_LONG, 4);
+
+  // Errors after the first block.
+  std::string long_input;
+  for (size_t i = 0; i < 1000; i++) {
+    long_input += "\xed\xa0\xbd\xf0\x9f\x98\x80\xed\xb8\x80";
+  }
+  ASSERT_TRUE(simdutf::validate_wtf8(long_input.data(), long_input.size()));
+  check_error(long_input + "\xed\xa0\xbd\xed\xb8\x80", error_code::SURROGATE,
+              long_input.size());
+  check_error(long_input + "\xed\xb8", error_code::TOO_SHORT,
+              long_input.size());
+}
+
+TEST_MAIN